@@ -3,8 +3,10 @@
 
 
 
+#include <new>
 #include "Macro.h"
 #include "Patch.h"
+#include "PatchArena.h"
 
 #ifdef PARTICLE
 #  include "Particle.h"
@@ -31,6 +33,9 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 // Description :  Data structure of the AMR implementation
 //
 // Data Member :  patch        : Pointers of all patches
+//                               --> patch[Sg][lv] is a growable table of PatchCap[lv] pointers indexed by PID
+//                PatchCap     : Capacity of the patch pointer table at each level
+//                Arena        : Memory arena of the patch structures and field arrays at each level
 //                num          : Number of patches (real patch + buffer patch) at each level
 //                scale        : Grid scale at each level (grid size normalized to that at the finest level)
 //                FluSg        : Sandglass of the current fluid          data [0/1]
@@ -65,18 +70,21 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                               --> Mainly used for estimating the weighted load-imbalance factor to determine
 //                                   when to redistribute all patches (when LOAD_BALANCE is on)
 //
-// Method      :  AMR_t    : Constructor
-//               ~AMR_t    : Destructor
-//                pnew     : Allocate one patch
-//                pdelete  : Deallocate one patch
-//                Lvdelete : Deallocate all patches in the given level
+// Method      :  AMR_t     : Constructor
+//               ~AMR_t     : Destructor
+//                pnew      : Allocate one patch
+//                pdelete   : Deallocate one patch
+//                Lvdelete  : Deallocate all patches in the given level
+//                Lvrelease : Deallocate all inactive patches in the given level
 //-------------------------------------------------------------------------------------------------------
 struct AMR_t
 {
 
 // data members
 // ===================================================================================
-   patch_t    *patch[2][NLEVEL][MAX_PATCH];
+   patch_t     **patch   [2][NLEVEL];
+   int           PatchCap   [NLEVEL];
+   PatchArena_t *Arena      [NLEVEL];
 
 #  ifdef PARTICLE
    Particle_t *Par;
@@ -154,10 +162,14 @@ struct AMR_t
 #        endif
       }
 
-      for (int Sg=0; Sg<2; Sg++)
+//    patch pointer tables are allocated on demand by pnew()
       for (int lv=0; lv<NLEVEL; lv++)
-      for (int PID=0; PID<MAX_PATCH; PID++)
-         patch[Sg][lv][PID] = NULL;
+      {
+         patch[0][lv] = NULL;
+         patch[1][lv] = NULL;
+         PatchCap[lv] = 0;
+         Arena   [lv] = new PatchArena_t( sizeof(patch_t) );
+      }
 
       for (int lv=0; lv<NLEVEL; lv++)
       for (int m=0; m<28; m++)
@@ -194,7 +206,19 @@ struct AMR_t
    {
 
       const bool ReusePatchMemory_No = false;
-      for (int lv=0; lv<NLEVEL; lv++)  Lvdelete( lv, ReusePatchMemory_No );
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         Lvdelete( lv, ReusePatchMemory_No );
+
+         delete [] patch[0][lv];
+         delete [] patch[1][lv];
+         delete Arena[lv];
+
+         patch[0][lv] = NULL;
+         patch[1][lv] = NULL;
+         PatchCap[lv] = 0;
+         Arena   [lv] = NULL;
+      }
 
 #     ifdef PARTICLE
       if ( Par != NULL )
@@ -231,6 +255,9 @@ struct AMR_t
    // Note        :  1. Each patch contains two patch pointers --> SANDGLASS (Sg) = 0 / 1
    //                2. Sg = 0 : Store both data and relation (father,son.sibling,corner,flag,flux)
    //                   Sg = 1 : Store only data
+   //                3. The patch pointer table doubles its capacity when it is full
+   //                   --> Existing PIDs are preserved
+   //                4. Patch structures are constructed in the memory arena of the target level
    //
    // Parameter   :  lv          : Target refinement level
    //                scale_x/y/z : Grid scale indices (not physical coordinates) of the patch corner
@@ -245,8 +272,24 @@ struct AMR_t
 
       const int NewPID = num[lv];
 
-      if ( NewPID > MAX_PATCH-1 )
-         Aux_Error( ERROR_INFO, "exceed MAX_PATCH (%d) => please reset it in the Makefile !!\n", MAX_PATCH );
+//    grow the patch pointer table
+      if ( NewPID >= PatchCap[lv] )
+      {
+         const int NewCap = MAX( 2*PatchCap[lv], 8 );
+
+         for (int Sg=0; Sg<2; Sg++)
+         {
+            patch_t **NewTable = new patch_t* [NewCap];
+
+            for (int PID=0;            PID<PatchCap[lv]; PID++)   NewTable[PID] = patch[Sg][lv][PID];
+            for (int PID=PatchCap[lv]; PID<NewCap;       PID++)   NewTable[PID] = NULL;
+
+            delete [] patch[Sg][lv];
+            patch[Sg][lv] = NewTable;
+         }
+
+         PatchCap[lv] = NewCap;
+      }
 
 //    allocate new patches if there are no inactive patches
       if ( patch[0][lv][NewPID] == NULL )
@@ -257,10 +300,12 @@ struct AMR_t
             Aux_Error( ERROR_INFO, "conflicting patch allocation (Lv %d, PID %d, FaPID %d) !!\n", lv, NewPID, FaPID );
 #        endif
 
-         patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
-                                             BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
-         patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
-                                             BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
+         patch[0][lv][NewPID] = new ( Arena[lv]->Patch.Alloc() )
+                                patch_t( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
+                                         BoxScale, BoxEdgeL, dh[TOP_LEVEL], Arena[lv] );
+         patch[1][lv][NewPID] = new ( Arena[lv]->Patch.Alloc() )
+                                patch_t(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
+                                         BoxScale, BoxEdgeL, dh[TOP_LEVEL], Arena[lv] );
       }
 
 //    reactivate inactive patches
@@ -287,6 +332,7 @@ struct AMR_t
       } // if ( patch[0][lv][NewPID] == NULL ) ... else ...
 
       num[lv] ++;
+      Arena[lv]->BankDirty = true;
 
    } // METHOD : pnew
 
@@ -307,6 +353,7 @@ struct AMR_t
    //                PID         : Patch ID to be removed
    //                ReuseMemory : true  --> mark patch as inactive, but do not deallocate memory (for OPT__REUSE_MEMORY)
    //                              false --> deallocate patch
+   //                                        --> memory is returned to the arena of this level but not to the system
    //===================================================================================
    void pdelete( const int lv, const int PID, const bool ReuseMemory )
    {
@@ -351,14 +398,18 @@ struct AMR_t
 
       else
       {
-         delete patch[0][lv][PID];
-         delete patch[1][lv][PID];
+         for (int Sg=0; Sg<2; Sg++)
+         {
+            patch[Sg][lv][PID]->~patch_t();
+            Arena[lv]->Patch.Free( patch[Sg][lv][PID] );
+         }
 
          patch[0][lv][PID] = NULL;
          patch[1][lv][PID] = NULL;
       } // if ( ReuseMemory ) ... else ...
 
       num[lv] --;
+      Arena[lv]->BankDirty = true;
 
 #     ifdef GAMER_DEBUG
       if ( num[lv] < 0 )
@@ -380,7 +431,8 @@ struct AMR_t
    //
    // Parameter   :  lv               : Target refinement level
    //                ReusePatchMemory : true  --> mark patch as inactive, but do not deallocate memory (for OPT__REUSE_MEMORY)
-   //                                   false --> deallocate patch
+   //                                   false --> deallocate patch and release all empty chunks of the arena
+   //                                             (unless Arena[lv]->KeepEmptyChunk is on)
    //===================================================================================
    void Lvdelete( const int lv, const bool ReusePatchMemory )
    {
@@ -400,6 +452,8 @@ struct AMR_t
          pdelete( lv, PID, ReusePatchMemory );
       }
 
+      if ( !ReusePatchMemory  &&  !Arena[lv]->KeepEmptyChunk )    Arena[lv]->Trim();
+
       for (int m=0; m<28; m++)   NPatchComma[lv][m] = 0;
 
 #     ifndef SERIAL
@@ -409,6 +463,42 @@ struct AMR_t
    } // METHOD : Lvdelete
 
 
+
+   //===================================================================================
+   // Method      :  Lvrelease
+   // Description :  Deallocate all inactive patches (i.e., PID >= num[lv]) in the target level
+   //
+   // Note        :  1. Inactive patches are created by pdelete() with ReuseMemory==true (i.e., OPT__REUSE_MEMORY)
+   //                2. Memory is returned to the arena of this level but not to the system
+   //                   --> Call Arena[lv]->Trim() afterwards to release empty chunks
+   //
+   // Parameter   :  lv : Target refinement level
+   //===================================================================================
+   void Lvrelease( const int lv )
+   {
+
+      for (int PID=num[lv]; PID<PatchCap[lv]; PID++)
+      {
+         if ( patch[0][lv][PID] == NULL )    continue;
+
+#        ifdef GAMER_DEBUG
+         if ( patch[0][lv][PID]->Active  ||  patch[1][lv][PID] == NULL  ||  patch[1][lv][PID]->Active )
+            Aux_Error( ERROR_INFO, "incorrect inactive patch (Lv %d, PID %d) !!\n", lv, PID );
+#        endif
+
+         for (int Sg=0; Sg<2; Sg++)
+         {
+            patch[Sg][lv][PID]->~patch_t();
+            Arena[lv]->Patch.Free( patch[Sg][lv][PID] );
+            patch[Sg][lv][PID] = NULL;
+         }
+      }
+
+      Arena[lv]->BankDirty = true;
+
+   } // METHOD : Lvrelease
+
+
 }; // struct AMR_t
 
 
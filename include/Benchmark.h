@@ -0,0 +1,114 @@
+#ifndef __BENCHMARK_H__
+#define __BENCHMARK_H__
+
+
+
+#include "GAMER.h"
+
+
+// maximum number of entries in each sweep list
+#define BENCH_NLIST_MAX       32
+
+// number of patch groups and threads adopted by the reference runs
+#define BENCH_REF_NPG         2
+#define BENCH_REF_NTHREAD     1
+
+// magic number and version of the reference file
+#define BENCH_REF_MAGIC       0x47424E48
+#define BENCH_REF_VERSION     1
+
+
+// target solvers
+enum BenchSolver_t { BENCH_FLU=0, BENCH_DT, BENCH_POI, BENCH_INT, BENCH_NSOLVER };
+
+// synthetic inputs
+enum BenchInput_t { BENCH_INPUT_WAVE=0, BENCH_INPUT_SHOCK, BENCH_NINPUT };
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  BenchPara_t
+// Description :  Runtime parameters of the solver benchmark
+//
+// Data Member :  Solver   : Solvers to be measured (true/false --> on/off)
+//                Input    : Synthetic inputs to be measured
+//                NPG      : List of the numbers of patch groups per solver call
+//                NThread  : List of the numbers of OpenMP threads
+//                Limiter  : List of the slope limiters (for the fluid solver only)
+//                LRScheme : List of the data reconstruction schemes (for the fluid solver only)
+//                RSolver  : List of the Riemann solvers (for the fluid solver only)
+//                Slab     : List of the slab thicknesses of the fused fluid solver (0 --> unfused)
+//                IntScheme: List of the interpolation schemes (for the interpolation only)
+//                N*       : Number of entries in each list
+//                NRepeat  : Number of timed solver calls per configuration
+//                NWarmUp  : Number of untimed solver calls per configuration
+//                FileOut  : Name of the output table (NULL --> stdout)
+//                FileRef  : Name of the reference file
+//                WriteRef : true  --> write the reference outputs to FileRef
+//                           false --> compare with the reference outputs stored in FileRef (if FileRef != NULL)
+//                TolErr   : Maximum allowed relative error when comparing with the reference outputs
+//-------------------------------------------------------------------------------------------------------
+struct BenchPara_t
+{
+   bool          Solver  [BENCH_NSOLVER];
+   bool          Input   [BENCH_NINPUT];
+   int           NPG     [BENCH_NLIST_MAX];
+   int           NThread [BENCH_NLIST_MAX];
+   LR_Limiter_t  Limiter [BENCH_NLIST_MAX];
+   OptLRScheme_t LRScheme[BENCH_NLIST_MAX];
+   OptRSolver_t  RSolver [BENCH_NLIST_MAX];
+   int           Slab    [BENCH_NLIST_MAX];
+   IntScheme_t   IntScheme[BENCH_NLIST_MAX];
+   int           NNPG, NNThread, NLimiter, NLRScheme, NRSolver, NSlab, NIntScheme;
+   int           NRepeat, NWarmUp;
+   char         *FileOut;
+   char         *FileRef;
+   bool          WriteRef;
+   double        TolErr;
+};
+
+
+// prototypes
+void Bench_Fluid_Allocate( const int MaxNPG, const int MaxNThread );
+void Bench_Fluid_Free();
+void Bench_Fluid_SetInput( const BenchInput_t Input, const int NPG );
+void Bench_Fluid_Reset( const int NPG );
+void Bench_Fluid_Run( const int NPG, const LR_Limiter_t Limiter, const OptLRScheme_t LR_Scheme,
+                      const OptRSolver_t RSolver, const int Slab );
+bool Bench_Fluid_Check( const char *Label, const int NPG, const double TolErr, double &MaxErr );
+bool Bench_Fluid_CheckFace( const char *Label, const double TolErr, double &MaxErr );
+double Bench_Fluid_NByte();
+void Bench_dt_Allocate( const int MaxNPG );
+void Bench_dt_Free();
+void Bench_dt_SetInput( const BenchInput_t Input, const int NPG );
+void Bench_dt_Run( const int NPG );
+bool Bench_dt_Check( const char *Label, const int NPG, const double TolErr, double &MaxErr );
+double Bench_dt_NByte();
+#ifdef GRAVITY
+void Bench_Poisson_Allocate( const int MaxNPG );
+void Bench_Poisson_Free();
+void Bench_Poisson_SetInput( const BenchInput_t Input, const int NPG );
+void Bench_Poisson_Run( const int NPG );
+bool Bench_Poisson_Check( const char *Label, const int NPG, const double TolErr, double &MaxErr );
+double Bench_Poisson_NByte();
+#endif
+void Bench_Int_Allocate( const int MaxNPG );
+void Bench_Int_Free();
+void Bench_Int_SetInput( const BenchInput_t Input, const int NPG );
+void Bench_Int_Run( const int NPG, const IntScheme_t IntScheme );
+bool Bench_Int_Check( const char *Label, const int NPG, const double TolErr, double &MaxErr );
+double Bench_Int_NByte();
+void Bench_GetFluid( const BenchInput_t Input, const int PG, const double x, const double y, const double z,
+                     double &Dens, double Vel[], double &Pres );
+#ifdef MHD
+void Bench_GetMag( const BenchInput_t Input, const int PG, const double x, const double y, const double z, double B[] );
+#endif
+void Bench_Reference_Open( const char *FileName, const bool Write );
+void Bench_Reference_Close();
+bool Bench_Reference_Check( const char *Label, const real *Data, const long NData, const double TolErr,
+                            double &MaxErr );
+const char* Bench_GetConfig();
+const char* Bench_GetVariant();
+
+
+
+#endif // #ifndef __BENCHMARK_H__
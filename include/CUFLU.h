@@ -76,6 +76,12 @@
 // NWAVE                : number of characteristic waves
 // NCOMP_TOTAL_PLUS_MAG : total number of fluid variables plus magnetic field
 // MAG_OFFSET           : array offset of magnetic field for arrays with the size NCOMP_TOTAL_PLUS_MAG
+// NCOMP_PASSIVE_LR     : number of passive scalars going through the data reconstruction and Riemann solvers
+//                        --> zero for SPLIT_PASSIVE, for which passive scalars are advected by a separate
+//                            upwind pass in Hydro_FullStepUpdate() using the density flux
+// NCOMP_TOTAL_LR       : number of fluid variables going through the data reconstruction and Riemann solvers
+// NCOMP_LR             : number of components of the scratch arrays PriVar[], Slope_PPM[], FC_Var[], and FC_Flux[]
+//                        --> equal to NCOMP_TOTAL_PLUS_MAG when SPLIT_PASSIVE is off
 
 #  if   ( FLU_SCHEME == MHM )
 
@@ -115,6 +121,14 @@
 #  define N_SLOPE_PPM            ( N_FC_VAR + 2 )
 #  define NCOMP_TOTAL_PLUS_MAG   ( NCOMP_TOTAL + NCOMP_MAG )
 
+#  ifdef SPLIT_PASSIVE
+#   define NCOMP_PASSIVE_LR      0
+#  else
+#   define NCOMP_PASSIVE_LR      ( NCOMP_PASSIVE )
+#  endif
+#  define NCOMP_TOTAL_LR         ( NCOMP_FLUID + NCOMP_PASSIVE_LR )
+#  define NCOMP_LR               ( NCOMP_TOTAL_LR + NCOMP_MAG )
+
 #  ifdef MHD
 #   define N_HF_ELE              ( N_FC_FLUX - 1 )
 #   define N_FL_ELE              ( N_FL_FLUX - 1 )
@@ -151,7 +165,8 @@
 
 // verify that the density and pressure in the intermediate states of Roe's Riemann solver are positive.
 // --> if either is negative, we switch to other Riemann solvers (EXACT/HLLE/HLLC/HLLD)
-#if (  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  RSOLVER == ROE  )
+// --> defined regardless of RSOLVER since the Riemann solver can be reset at runtime by OPT__RSOLVER
+#if ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )
 #  ifdef MHD
 //#     define CHECK_INTERMEDIATE    HLLD
 #     define CHECK_INTERMEDIATE    HLLE
@@ -162,14 +177,15 @@
 #endif
 
 
-// use Eulerian with Y factor for Roe Solver in MHD
-#if (  defined MHD  &&  ( RSOLVER == ROE || RSOLVER == HLLE )  )
+// use Eulerian with Y factor for the Roe and HLLE solvers in MHD
+#ifdef MHD
 #  define EULERY
 #endif
 
 
 // do not use the reference states for HLL solvers during the data reconstruction, as suggested in ATHENA
-#if (  defined RSOLVER  &&  ( RSOLVER == HLLE || RSOLVER == HLLC || RSOLVER == HLLD )  )
+// --> only applied when the adopted Riemann solver is HLLE/HLLC/HLLD
+#if ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )
 
 #  define HLL_NO_REF_STATE
 
@@ -181,8 +197,43 @@
 #endif
 
 
+// batched Riemann solvers computing the fluxes of RSOLVER_BATCH interfaces at once with structure-of-arrays inputs
+// --> CPU only; only applied to the Roe, HLLE, and HLLC solvers
+// --> can be overridden in the Makefile (e.g., -DRSOLVER_BATCH=0 to use the scalar Riemann solvers)
+#if (  !defined __CUDACC__  &&  !defined MHD  &&  !defined CHECK_NEGATIVE_IN_FLUID  &&  \
+       ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  )
+#  ifndef RSOLVER_BATCH
+#     define RSOLVER_BATCH    16
+#  endif
+#else
+#  undef RSOLVER_BATCH
+#endif
+
+#if ( defined RSOLVER_BATCH  &&  RSOLVER_BATCH <= 0 )
+#  undef RSOLVER_BATCH
+#endif
+
+
+// reconstruct the face-centered variables one pencil (i.e., a row of cells along x) at a time
+// --> slopes, slope limiters, and characteristic projection are vectorized along the pencil
+// --> CPU only
+// --> can be overridden in the Makefile (e.g., -DLR_PENCIL=0 to reconstruct one cell at a time)
+#if (  !defined __CUDACC__  &&  !defined CHECK_NEGATIVE_IN_FLUID  &&  \
+       ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  )
+#  ifndef LR_PENCIL
+#     define LR_PENCIL    1
+#  endif
+#else
+#  undef LR_PENCIL
+#endif
+
+#if ( defined LR_PENCIL  &&  LR_PENCIL <= 0 )
+#  undef LR_PENCIL
+#endif
+
+
 // maximum allowed error for the exact Riemann solver and some MHD operations
-#if (  ( FLU_SCHEME != RTVD && RSOLVER == EXACT )  ||  CHECK_INTERMEDIATE == EXACT  ||  ( MODEL == HYDRO && defined MHD )  )
+#if (  FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU  ||  ( MODEL == HYDRO && defined MHD )  )
 #  ifdef FLOAT8
 #     define MAX_ERROR    1.0e-14
 #  else
@@ -191,6 +242,22 @@
 #endif
 
 
+// apply FUNC( LR, RS ) to all combinations of the data reconstruction schemes (LR) and Riemann solvers (RS)
+// instantiated in the CPU MHM/MHM_RP/CTU solvers, which are selected at runtime by OPT__LR_SCHEME and OPT__RSOLVER
+// --> PPM requires the larger ghost zones of LR_SCHEME == PPM, while PLM works with both PLM and PPM ghost zones
+#ifdef MHD
+#  define HYDRO_FOR_EACH_RSOLVER( FUNC, LR )    FUNC( LR, ROE )  FUNC( LR, HLLE )  FUNC( LR, HLLD )
+#else
+#  define HYDRO_FOR_EACH_RSOLVER( FUNC, LR )    FUNC( LR, EXACT )  FUNC( LR, ROE )  FUNC( LR, HLLE )  FUNC( LR, HLLC )
+#endif
+
+#if ( LR_SCHEME == PPM )
+#  define HYDRO_FOR_EACH_SCHEME( FUNC )         HYDRO_FOR_EACH_RSOLVER( FUNC, PLM )  HYDRO_FOR_EACH_RSOLVER( FUNC, PPM )
+#else
+#  define HYDRO_FOR_EACH_SCHEME( FUNC )         HYDRO_FOR_EACH_RSOLVER( FUNC, PLM )
+#endif
+
+
 // 2. ELBDM macro
 //=========================================================================================
 #elif ( MODEL == ELBDM )
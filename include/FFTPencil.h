@@ -0,0 +1,80 @@
+#ifndef __FFTPENCIL_H__
+#define __FFTPENCIL_H__
+
+
+
+#include <fftw3.h>
+#include "Macro.h"
+#include "Typedef.h"
+
+
+// REAL_FFTW( name ) : FFTW 3 function or type "name" with the same precision as "real"
+#ifdef FLOAT8
+#  define REAL_FFTW( name )    fftw_##name
+#else
+#  define REAL_FFTW( name )    fftwf_##name
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  FFTPencil_t
+// Description :  3D real-to-complex FFT with the 2D pencil domain decomposition
+//
+// Note        :  1. Created by FFT_Pencil_Create() and deleted by FFT_Pencil_Destroy()
+//                2. MPI ranks form an NSplit[0] x NSplit[1] grid with MPI_Rank = RankZ*NSplit[0] + RankY
+//                   --> Unlike the slab decomposition, up to NX0_TOT[1]*NX0_TOT[2]/SQR(PS1) ranks take part in the FFT
+//                3. Data layouts (i/j/k: x/y/z indices relative to the starting indices of this rank)
+//                   (a) x-pencil (real)    : all x  , y in Split_y , z in Split_z --> Real[ (k*ny  + j)*N[0]   + i ]
+//                   (b) x-pencil (complex) : all kx , y in Split_y , z in Split_z -->      ( (k*ny  + j)*NX_Cplx + i )
+//                   (c) y-pencil (complex) : kx in Split_kx , all y, z in Split_z -->      ( (k*nkx + i)*N[1]    + j )
+//                   (d) z-pencil (complex) : kx in Split_kx , ky in Split_ky, all z -->    ( (j*nkx + i)*N[2]    + k )
+//                   --> FFT_Pencil_Forward() transforms Real[] in (a) to Cplx[] in (d)
+//                       FFT_Pencil_Backward() transforms Cplx[] in (d) back to Real[] in (a) without normalization
+//                   --> 1D transforms along x, y, and z are performed in (a) <-> (b), (c), and (d), respectively
+//                   --> (b) <-> (c) and (c) <-> (d) are transposes by MPI_Alltoallv() among the ranks with the same
+//                       RankZ and RankY, respectively
+//                4. Split_y[] and Split_z[] are multiples of PS1 so that each patch slice of PS1*PS1 cells in the
+//                   x-y plane belongs to a single rank (see Patch2Slab())
+//                5. 1D transforms are OpenMP-threaded by FFTW with OMP_NTHREAD threads
+//
+// Data Member :  N                : Size of the FFT
+//                NX_Cplx          : Number of complex numbers along x after the real-to-complex transform (N[0]/2+1)
+//                NSplit           : Number of ranks along y and z in the x-pencil layout
+//                RankY/Z          : Coordinates of this rank in the NSplit[0] x NSplit[1] grid
+//                Split_y/z/kx/ky  : Starting index of the y/z/kx/ky range of each rank along the corresponding
+//                                   direction of the rank grid, with Split_*[NSplit] equal to the total size
+//                                   --> Split_y/kx along NSplit[0] and Split_z/ky along NSplit[1]
+//                ny/nz/nkx/nky    : Sizes of the y/z/kx/ky ranges of this rank
+//                NCplx            : Size of the complex arrays (maximum of the layouts (b), (c), and (d))
+//                Real             : Real-space array in the layout (a)
+//                Cplx             : k-space array in the layout (d)
+//                Work             : Work array of the transposes
+//                Plan_*           : FFTW plans of the 1D transforms
+//                Comm_Y/Z         : Communicators of the ranks with the same RankZ/RankY (transposes along y/z)
+//-------------------------------------------------------------------------------------------------------
+struct FFTPencil_t
+{
+   int   N[3];
+   int   NX_Cplx;
+   int   NSplit[2];
+   int   RankY, RankZ;
+   int  *Split_y, *Split_z, *Split_kx, *Split_ky;
+   int   ny, nz, nkx, nky;
+   long  NCplx;
+
+   real             *Real;
+   REAL_FFTW(complex)   *Cplx;
+   REAL_FFTW(complex)   *Work;
+
+   REAL_FFTW(plan)       Plan_X_Fw, Plan_X_Bw, Plan_Y_Fw, Plan_Y_Bw, Plan_Z_Fw, Plan_Z_Bw;
+
+#  ifndef SERIAL
+   MPI_Comm          Comm_Y, Comm_Z;
+#  endif
+}; // struct FFTPencil_t
+
+
+
+#endif // #ifndef __FFTPENCIL_H__
@@ -25,7 +25,10 @@
 #  include <omp.h>
 #endif
 
-#ifdef GRAVITY
+// Macro.h sets the default SUPPORT_FFTW
+#include "Macro.h"
+
+#if ( defined GRAVITY  &&  SUPPORT_FFTW == FFTW2 )
 #  ifdef FLOAT8
 #     ifdef SERIAL
 #        include <drfftw.h>
@@ -64,6 +67,9 @@ extern "C" {
 #include "RandomNumber.h"
 #include "Global.h"
 #include "Field.h"
+#if ( defined GRAVITY  &&  SUPPORT_FFTW == FFTW3 )
+#  include "FFTPencil.h"
+#endif
 #include "Prototype.h"
 #include "PhysicalConstant.h"
 
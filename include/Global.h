@@ -56,18 +56,22 @@ extern int        GPU_NSTREAM, FLAG_BUFFER_SIZE, FLAG_BUFFER_SIZE_MAXM1_LV, FLAG
 
 extern int        OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK, OPT__GPUID_SELECT, OPT__PATCH_COUNT;
 extern int        INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK;
+extern int        CPU_PIPELINE_NTHREAD, MEMORY_POOL_WINDOW, FLU_FUSED_SLAB, AUTO_REDUCE_DT_LOCAL;
+extern double     MEMORY_POOL_SHRINK;
 extern double     OUTPUT_PART_X, OUTPUT_PART_Y, OUTPUT_PART_Z, AUTO_REDUCE_DT_FACTOR, AUTO_REDUCE_DT_FACTOR_MIN;
 extern double     OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_V, UNIT_D, UNIT_E, UNIT_P;
 extern bool       OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION;
-extern bool       OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+extern bool       OPT__DT_USER, OPT__DT_CFL_CACHE, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+extern bool       OPT__FIELD_BANK;
 extern bool       OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
-extern bool       OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
+extern bool       OPT__INT_TIME, OPT__GHOST_CACHE, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 extern bool       OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 extern bool       OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
 extern bool       OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
 extern bool       OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
 extern bool       OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
-extern bool       OPT__RECORD_NOTE, OPT__RECORD_UNPHY;
+extern bool       OPT__RECORD_NOTE, OPT__RECORD_UNPHY, OPT__CPU_PIPELINE, OPT__FLU_FUSED, OPT__TASK_GRAPH;
+extern bool       OPT__FLU_CLUSTER;
 
 extern UM_IC_Format_t     OPT__UM_IC_FORMAT;
 extern TestProbID_t       TESTPROB_ID;
@@ -90,6 +94,8 @@ extern OptTimeStepLevel_t OPT__DT_LEVEL;
 extern double           FlagTable_PresGradient[NLEVEL-1], FlagTable_Vorticity[NLEVEL-1], FlagTable_Jeans[NLEVEL-1];
 extern double           GAMMA, MINMOD_COEFF, MOLECULAR_WEIGHT;
 extern LR_Limiter_t     OPT__LR_LIMITER;
+extern OptLRScheme_t    OPT__LR_SCHEME;
+extern OptRSolver_t     OPT__RSOLVER;
 extern Opt1stFluxCorr_t OPT__1ST_FLUX_CORR;
 extern OptRSolver1st_t  OPT__1ST_FLUX_CORR_SCHEME;
 extern bool             OPT__FLAG_PRES_GRADIENT, OPT__FLAG_LOHNER_ENGY, OPT__FLAG_LOHNER_PRES, OPT__FLAG_LOHNER_TEMP;
@@ -160,7 +166,9 @@ extern double     LB_INPUT__WLI_MAX;                  // LB->WLI_Max loaded from
 #ifdef PARTICLE
 extern double     LB_INPUT__PAR_WEIGHT;               // LB->Par_Weight loaded from "Input__Parameter"
 #endif
-extern bool       OPT__RECORD_LOAD_BALANCE;
+extern bool       LB_INPUT__MEASURED_COST;            // LB->MeasuredCost loaded from "Input__Parameter"
+extern bool       LB_INPUT__INCREMENTAL;              // LB->Incremental  loaded from "Input__Parameter"
+extern bool       OPT__RECORD_LOAD_BALANCE, OPT__LB_CUT_BENCHMARK;
 #endif
 extern bool       OPT__MINIMIZE_MPI_BARRIER;
 
@@ -233,6 +241,13 @@ extern real       (*h_Mag_Array_F_In [2])[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
 extern real       (*h_Mag_Array_F_Out[2])[NCOMP_MAG][ PS2P1*SQR(PS2)          ];
 extern real       (*h_Ele_Array      [2])[9][NCOMP_ELE][ PS2P1*PS2 ];
 #endif
+#ifdef FLU_CLUSTER
+extern real       (*h_Flu_Array_C_In )[FLU_NIN ][ CUBE(FLU_CLU_NXT) ];
+extern real       (*h_Flu_Array_C_Out)[FLU_NOUT][ CUBE(FLU_CLU_NOUT) ];
+#ifdef DUAL_ENERGY
+extern char       (*h_DE_Array_C_Out )[ CUBE(FLU_CLU_NOUT) ];
+#endif
+#endif
 
 #ifdef GRAVITY
 extern real       (*h_Rho_Array_P    [2])[RHO_NXT][RHO_NXT][RHO_NXT];
@@ -20,6 +20,13 @@ datatypes in the HDF5 format
 #  define H5T_GAMER_REAL H5T_NATIVE_FLOAT
 #endif
 
+// memory datatype of the patch field arrays (see real_fld in Typedef.h)
+#ifdef MIXED_PRECISION
+#  define H5T_GAMER_REAL_FLD H5T_NATIVE_FLOAT
+#else
+#  define H5T_GAMER_REAL_FLD H5T_GAMER_REAL
+#endif
+
 #ifdef GAMER_DEBUG
 #  define DEBUG_HDF5
 #endif
@@ -417,6 +424,8 @@ struct InputPara_t
    double MolecularWeight;
    double MinMod_Coeff;
    int    Opt__LR_Limiter;
+   int    Opt__LR_Scheme;
+   int    Opt__RSolver;
    int    Opt__1stFluxCorr;
    int    Opt__1stFluxCorrScheme;
 #  endif
@@ -33,11 +33,23 @@
 //                WLI_Max                 : WLI threshold for redistributing patches at all levels
 //                Par_Weight              : Load-balance weighting of one particle over one cell
 //                                          --> Weighting of each patch is estimated as "PATCH_SIZE^3 + NParThisPatch*Par_Weight"
+//                MeasuredCost            : Use the measured wall-clock time per step of each patch group
+//                                          (patch_t::LB_Cost/LB_NStep) as the load-balance weighting instead of the
+//                                          estimation above
+//                Incremental             : Rebalance by LB_Incremental_LoadBalance() instead of LB_Init_LoadBalance()
+//                                          --> Only shift cut points between neighboring ranks and migrate the affected
+//                                              patch groups
+//                Moved_NPatch            : Number of real patches sent to other ranks by this rank when redistributing
+//                                          patches (accumulated; reset manually)
+//                Moved_NByte             : Number of bytes of patch and particle data associated with Moved_NPatch
 //                CutPoint                : Cut points in the space filling curve
 //                IdxList_Real            : Sorted LB_Idx list of all real patches
 //                IdxList_Real_IdxTable   : Index table for LB_IdxList_Real
 //                PaddedCr1DList          : Sorted PaddedCr1D list of all patches (real + buffer)
 //                PaddedCr1DList_IdxTable : Index table for LB_PaddedC1DrList
+//                NbrRank_N               : Number of ranks exchanging any buffer data with this rank
+//                NbrRank_List            : Ranks exchanging any buffer data with this rank (sorted)
+//                                          --> Union of all the Send*/Recv* lists below
 //
 //                SendH_NList             : Number of patches    for sending   hydrodynamic data
 //                SendH_IDList            : Patch indices        for sending   hydrodynamic data
@@ -132,11 +144,17 @@ struct LB_t
 #  ifdef PARTICLE
    double Par_Weight;
 #  endif
+   bool   MeasuredCost;
+   bool   Incremental;
+   long   Moved_NPatch;
+   long   Moved_NByte;
    long  *CutPoint               [NLEVEL];
    long  *IdxList_Real           [NLEVEL];
    int   *IdxList_Real_IdxTable  [NLEVEL];
    ulong *PaddedCr1DList         [NLEVEL];
    int   *PaddedCr1DList_IdxTable[NLEVEL];
+   int    NbrRank_N              [NLEVEL];
+   int   *NbrRank_List           [NLEVEL];
 
    int   *SendH_NList            [NLEVEL];
    int  **SendH_IDList           [NLEVEL];
@@ -222,19 +240,26 @@ struct LB_t
    //                   PaddedCr1DList_IdxTable", whose sizes can not be determined during
    //                   initialization, are NOT allocated with memory
    //
-   // Parameter   :  NRank             : Number of MPI ranks
-   //                Input__WLI_Max    : WLI_Max loaded from the input parameter file
-   //                Input__Par_Weight : Par_Weight loaded from the input parameter file
+   // Parameter   :  NRank               : Number of MPI ranks
+   //                Input__WLI_Max      : WLI_Max loaded from the input parameter file
+   //                Input__Par_Weight   : Par_Weight loaded from the input parameter file
+   //                Input__MeasuredCost : MeasuredCost loaded from the input parameter file
+   //                Input__Incremental  : Incremental loaded from the input parameter file
    //===================================================================================
-   LB_t( const int NRank, const double Input__WLI_Max, const double Input__Par_Weight )
+   LB_t( const int NRank, const double Input__WLI_Max, const double Input__Par_Weight, const bool Input__MeasuredCost,
+         const bool Input__Incremental )
    {
 
-      MPI_NRank  = NRank;
-      WLI        = NULL_REAL;
-      WLI_Max    = Input__WLI_Max;
+      MPI_NRank    = NRank;
+      WLI          = NULL_REAL;
+      WLI_Max      = Input__WLI_Max;
 #     ifdef PARTICLE
-      Par_Weight = Input__Par_Weight;
+      Par_Weight   = Input__Par_Weight;
 #     endif
+      MeasuredCost = Input__MeasuredCost;
+      Incremental  = Input__Incremental;
+      Moved_NPatch = 0;
+      Moved_NByte  = 0;
 
       for (int lv=0; lv<NLEVEL; lv++)
       {
@@ -253,6 +278,8 @@ struct LB_t
          IdxList_Real_IdxTable  [lv] = NULL;
          PaddedCr1DList         [lv] = NULL;
          PaddedCr1DList_IdxTable[lv] = NULL;
+         NbrRank_N              [lv] = 0;
+         NbrRank_List           [lv] = new int   [MPI_NRank];
 
          SendH_NList            [lv] = new int   [MPI_NRank];
          SendH_IDList           [lv] = new int*  [MPI_NRank];
@@ -425,8 +452,10 @@ struct LB_t
 
 //       release memory whose size is independent of the number of patches at each rank
 //       miscellaneous
-         if ( CutPoint [lv] != NULL )  delete [] CutPoint[lv];
-         CutPoint[lv] = NULL;
+         if ( CutPoint    [lv] != NULL )  delete [] CutPoint    [lv];
+         if ( NbrRank_List[lv] != NULL )  delete [] NbrRank_List[lv];
+         CutPoint    [lv] = NULL;
+         NbrRank_List[lv] = NULL;
 
 //       NList
          if ( SendH_NList   [lv] != NULL )   delete [] SendH_NList   [lv];
@@ -619,6 +648,7 @@ struct LB_t
       IdxList_Real_IdxTable  [lv] = NULL;
       PaddedCr1DList         [lv] = NULL;
       PaddedCr1DList_IdxTable[lv] = NULL;
+      NbrRank_N              [lv] = 0;
 
       for (int r=0; r<MPI_NRank; r++)
       {
@@ -75,6 +75,16 @@
 #define MG           2
 
 
+// FFTW library of the root-level Poisson solver
+// --> FFTW2 (slab decomposition of FFTW 2.1.5) if SUPPORT_FFTW is not set in the Makefile
+#define FFTW2        1
+#define FFTW3        2
+
+#if ( defined GRAVITY  &&  !defined SUPPORT_FFTW )
+#  define SUPPORT_FFTW   FFTW2
+#endif
+
+
 // load-balance parallelization
 #define HILBERT      1
 
@@ -526,6 +536,18 @@
 //###REVISE: support interpolation schemes requiring 2 ghost cells on each side for POT_NXT
 #  define FLU_NXT       ( PS2 + 2*FLU_GHOST_SIZE )                // use patch group as the unit
 #  define FLU_NXT_P1    ( FLU_NXT + 1 )
+
+// the size of arrays (in one dimension) for the CPU fluid solver updating a cluster of FLU_CLU_NPG^3 patch groups
+// as a single block (see OPT__FLU_CLUSTER)
+// --> defined by PATCH_SIZE instead of PS2 since CPU_FluidSolver_Cluster.cpp redefines PS1/PS2
+#  define FLU_CLU_NPG   2
+#  define FLU_CLU_NOUT  ( FLU_CLU_NPG*2*PATCH_SIZE )
+#  define FLU_CLU_NXT   ( FLU_CLU_NOUT + 2*FLU_GHOST_SIZE )
+#if (  MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  &&  \
+       !defined MHD  &&  !defined UNSPLIT_GRAVITY  &&  !defined GPU  )
+#  define FLU_CLUSTER                                             // clusters are only supported by these CPU solvers
+#endif
+
 #ifdef GRAVITY
 #  define POT_NXT       ( PS1/2 + 2*( (POT_GHOST_SIZE+3)/2 ) )    // assuming interpolation ghost zone == 1
 #  define RHO_NXT       ( PS1 + 2*RHO_GHOST_SIZE )                // POT/RHO/GRA_NXT use patch as the unit
@@ -667,6 +689,10 @@
 #define MAX_STRING         512
 
 
+// maximum number of records used by the adaptive memory pool to estimate the high-water mark of each level
+#define MEMPOOL_MAX_WINDOW 256
+
+
 
 // ############
 // ## Macros ##
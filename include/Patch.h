@@ -5,6 +5,7 @@
 
 #include "Macro.h"
 #include "CUFLU.h"
+#include "PatchArena.h"
 
 #ifdef PARTICLE
 #  include <math.h>
@@ -26,6 +27,8 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //
 // Data Member :  fluid           : Fluid variables (mass density, momentum density x, y ,z, energy density)
 //                                  --> Including passively advected variables (e.g., metal density)
+//                                  --> Stored as real_fld, which is single precision when MIXED_PRECISION is on
+//                                      (same for magnetic, pot, and pot_ext)
 //                magnetic        : Magnetic field (Bx, By, Bz)
 //                pot             : Potential
 //                pot_ext         : Potential with GRA_GHOST_SIZE ghost cells on each side
@@ -122,6 +125,19 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                      3D corner coordinates
 //                                  --> This number is independent of periodicity (because of the padded patches)
 //                LB_Idx          : Space-filling-curve index for load balance
+//                LB_Cost         : Measured wall-clock time (in seconds) spent on this patch since the last reset
+//                                  --> for LOAD_BALANCE with LB_INPUT__MEASURED_COST only
+//                                  --> Accumulated by LB_AccumulateCost() and reset by LB_ResetCost() after each
+//                                      rebalance and whenever the patch is (re-)allocated
+//                LB_NStep        : Number of steps at this level accumulated in LB_Cost
+//                                  --> LB_Cost/LB_NStep gives the measured cost per step
+//                                  --> Counted by LB_CountCostStep() and reset together with LB_Cost
+//                MaxCFL          : Maximum CFL speed in this patch cached for the hydro dt solver (for OPT__DT_CFL_CACHE only)
+//                                  --> Refer to the fluid data of this sandglass only
+//                                  --> Negative values indicate that the cached value is invalid and must be re-evaluated
+//                                  --> Reset whenever the patch is (re-)allocated
+//                Arena           : Memory arena of the level this patch belongs to
+//                                  --> fluid[], magnetic[], pot[], and pot_ext[] are allocated from it
 //                NPar            : Number of particles belonging to this leaf patch
 //                ParListSize     : Size of the array ParList (ParListSize can be >= NPar)
 //                ParList         : List recording the IDs of all particles belonging to this leaf real patch
@@ -184,16 +200,16 @@ struct patch_t
 
 // data members
 // ===================================================================================
-   real (*fluid)[PS1][PS1][PS1];
+   real_fld (*fluid)[PS1][PS1][PS1];
 
 #  ifdef MHD
-   real (*magnetic)[ PS1P1*SQR(PS1) ];
+   real_fld (*magnetic)[ PS1P1*SQR(PS1) ];
 #  endif
 
 #  ifdef GRAVITY
-   real (*pot)[PS1][PS1];
+   real_fld (*pot)[PS1][PS1];
 #  ifdef STORE_POT_GHOST
-   real (*pot_ext)[GRA_NXT][GRA_NXT];
+   real_fld (*pot_ext)[GRA_NXT][GRA_NXT];
 #  endif
 #  endif // GRAVITY
 
@@ -231,6 +247,14 @@ struct patch_t
 
    ulong  PaddedCr1D;
    long   LB_Idx;
+#  ifdef LOAD_BALANCE
+   double LB_Cost;
+   int    LB_NStep;
+#  endif
+#  if ( MODEL == HYDRO )
+   real   MaxCFL;
+#  endif
+   PatchArena_t *Arena;
 
 #  ifdef PARTICLE
    int    NPar;
@@ -270,12 +294,16 @@ struct patch_t
    //                BoxScale    : Simulation box scale
    //                BoxEdgeL    : Simulation box left edge
    //                dh_min      : Cell size at the maximum level
+   //                InputArena  : Memory arena of the level "lv"
    //===================================================================================
    patch_t( const int scale_x, const int scale_y, const int scale_z, const int FaPID, const bool FluData,
             const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int BoxScale[],
-            const double BoxEdgeL[], const double dh_min )
+            const double BoxEdgeL[], const double dh_min, PatchArena_t *InputArena )
    {
 
+//    must be set before allocating any field array
+      Arena = InputArena;
+
 //    always initialize field pointers (e.g., fluid, pot, ...) as NULL if they are not allocated here
       const bool InitPtrAsNull_Yes = true;
       Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, DE_Status, lv, BoxScale,
@@ -351,6 +379,13 @@ struct patch_t
 
       PaddedCr1D = Mis_Idx3D2Idx1D( BoxNScale_Padded, Cr_Padded );   // independent of periodicity
       LB_Idx     = LB_Corner2Index( lv, corner, CHECK_OFF );         // always assumes periodicity
+#     ifdef LOAD_BALANCE
+      LB_Cost    = 0.0;
+      LB_NStep   = 0;
+#     endif
+#     if ( MODEL == HYDRO )
+      MaxCFL     = (real)-1.0;
+#     endif
 
 //    set the patch edge
       const int PScale = PS1*( 1<<(TOP_LEVEL-lv) );
@@ -664,15 +699,16 @@ struct patch_t
    // Method      :  hnew
    // Description :  Allocate fluid[]
    //
-   // Note        :  Do nothing if fluid[] has been allocated
+   // Note        :  1. Do nothing if fluid[] has been allocated
+   //                2. Allocated from Arena->Flu
    //===================================================================================
    void hnew()
    {
 
       if ( fluid == NULL )
       {
-         fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
-         fluid[0][0][0][0] = (real)-1.0;  // arbitrarily initialized
+         fluid = ( real_fld (*)[PS1][PS1][PS1] )Arena->Flu.Alloc();
+         fluid[0][0][0][0] = (real_fld)-1.0;  // arbitrarily initialized
       }
 
    } // METHOD : hnew
@@ -686,7 +722,7 @@ struct patch_t
    void hdelete()
    {
 
-      delete [] fluid;
+      Arena->Flu.Free( fluid );
       fluid = NULL;
 
 #     ifdef PARTICLE
@@ -703,15 +739,16 @@ struct patch_t
    // Method      :  mnew
    // Description :  Allocate magnetic[]
    //
-   // Note        :  Do nothing if magnetic[] has been allocated
+   // Note        :  1. Do nothing if magnetic[] has been allocated
+   //                2. Allocated from Arena->Mag
    //===================================================================================
    void mnew()
    {
 
       if ( magnetic == NULL )
       {
-         magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
-         magnetic[0][0] = (real)-1.0;  // arbitrarily initialized
+         magnetic = ( real_fld (*)[ PS1P1*SQR(PS1) ] )Arena->Mag.Alloc();
+         magnetic[0][0] = (real_fld)-1.0;  // arbitrarily initialized
       }
 
    } // METHOD : mnew
@@ -725,7 +762,7 @@ struct patch_t
    void mdelete()
    {
 
-      delete [] magnetic;
+      Arena->Mag.Free( magnetic );
       magnetic = NULL;
 
    } // METHOD : mdelete
@@ -738,15 +775,16 @@ struct patch_t
    // Method      :  gnew
    // Description :  Allocate pot[] (and pot_ext[] for STORE_POT_GHOST)
    //
-   // Note        :  Do nothing if pot[] (and pot_ext[] for STORE_POT_GHOST) has been allocated
+   // Note        :  1. Do nothing if pot[] (and pot_ext[] for STORE_POT_GHOST) has been allocated
+   //                2. Allocated from Arena->Pot (and Arena->PotExt)
    //===================================================================================
    void gnew()
    {
 
-      if ( pot == NULL )      pot     = new real [PS1][PS1][PS1];
+      if ( pot == NULL )      pot     = ( real_fld (*)[PS1][PS1]         )Arena->Pot   .Alloc();
 
 #     ifdef STORE_POT_GHOST
-      if ( pot_ext == NULL )  pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
+      if ( pot_ext == NULL )  pot_ext = ( real_fld (*)[GRA_NXT][GRA_NXT] )Arena->PotExt.Alloc();
 
 //    always initialize pot_ext[] (even if pot_ext != NULL when calling this function) to indicate that this array
 //    has NOT been properly set --> used by Poi_StorePotWithGhostZone()
@@ -764,11 +802,11 @@ struct patch_t
    void gdelete()
    {
 
-      delete [] pot;
+      Arena->Pot.Free( pot );
       pot = NULL;
 
 #     ifdef STORE_POT_GHOST
-      delete [] pot_ext;
+      Arena->PotExt.Free( pot_ext );
       pot_ext = NULL;
 #     endif
 
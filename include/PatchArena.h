@@ -0,0 +1,705 @@
+#ifndef __PATCHARENA_H__
+#define __PATCHARENA_H__
+
+
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "Macro.h"
+
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
+
+
+// alignment (in bytes) of all blocks and chunks
+#define ARENA_ALIGN           64
+
+// number of banks in each pool (one for each sandglass)
+#define ARENA_NBANK           2
+
+// number of blocks in the first chunk and the maximum size (in bytes) of a single chunk
+// --> chunk size doubles with the number of allocated blocks until reaching ARENA_MAX_CHUNK_SIZE
+#define ARENA_MIN_CHUNK_NBLOCK    8
+#define ARENA_MAX_CHUNK_SIZE      ( 1L<<22 )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  BlockPool_t
+// Description :  Allocator of fixed-size memory blocks carved from large contiguous chunks
+//
+// Note        :  1. Freed blocks are kept in a LIFO free list and reused by the next Alloc()
+//                   --> Chunks are returned to the system only by Trim() and FreeAll()
+//                2. New chunks are first-touched by all OpenMP threads with a static schedule so that
+//                   consecutively allocated blocks are distributed over the NUMA domains in the same way
+//                   as the static OpenMP loops over patches
+//                3. Optionally, the pool also owns ARENA_NBANK "banks", each of which is a single contiguous array of
+//                   BankNSlot blocks
+//                   --> Bank slots are never handed out by Alloc(). They are assigned to patches by
+//                       Mis_FieldBank_Bind(), which also moves the data between slots (see OPT__FIELD_BANK).
+//                   --> Free() does nothing for a bank slot
+//                4. NOT thread-safe
+//
+// Data Member :  BlockSize    : Size of a single block in bytes (padded to a multiple of ARENA_ALIGN)
+//                NChunk       : Number of chunks
+//                ChunkCap     : Capacity of Chunk[], ChunkNBlock[], and ChunkNUsed[]
+//                Chunk        : Base addresses of all chunks sorted in ascending order
+//                ChunkNBlock  : Number of blocks in each chunk
+//                ChunkNUsed   : Number of blocks currently in use in each chunk
+//                NFree        : Number of blocks in the free list
+//                FreeCap      : Capacity of FreeList[]
+//                FreeList     : Free blocks
+//                NUsed        : Total number of blocks currently in use
+//                NBlock       : Total number of blocks in all chunks
+//                Bank         : Base addresses of the banks
+//                BankNSlot    : Number of blocks in each bank
+//                BankNUsed    : Total number of bank slots in use (set by Mis_FieldBank_Bind())
+//
+// Method      :  BlockPool_t  : Constructor
+//               ~BlockPool_t  : Destructor
+//                Init         : Set the block size
+//                Alloc        : Return one block
+//                Free         : Return one block to the free list
+//                Reserve      : Allocate chunks until the pool holds at least the given number of blocks
+//                Trim         : Release all chunks without any block in use
+//                FreeAll      : Release all chunks
+//                GetNByte     : Total number of bytes allocated from the system
+//                GetNByteUsed : Total number of bytes in use
+//                GetNByteFrag : Total number of free bytes in chunks and banks that cannot be released
+//                BankOf       : Index of the bank containing the target block
+//                ResizeBank   : Reallocate all banks
+//                ChunkOf      : Index of the chunk containing the target block
+//                NewChunk     : Allocate a new chunk
+//-------------------------------------------------------------------------------------------------------
+struct BlockPool_t
+{
+
+// data members
+// ===================================================================================
+   size_t BlockSize;
+   int    NChunk;
+   int    ChunkCap;
+   char **Chunk;
+   int   *ChunkNBlock;
+   int   *ChunkNUsed;
+   long   NFree;
+   long   FreeCap;
+   void **FreeList;
+   long   NUsed;
+   long   NBlock;
+   char  *Bank[ARENA_NBANK];
+   long   BankNSlot;
+   long   BankNUsed;
+
+
+
+   //===================================================================================
+   // Constructor :  BlockPool_t
+   // Description :  Constructor of the structure "BlockPool_t"
+   //
+   // Note        :  Initialize the data members
+   //===================================================================================
+   BlockPool_t()
+   {
+
+      BlockSize   = 0;
+      NChunk      = 0;
+      ChunkCap    = 0;
+      Chunk       = NULL;
+      ChunkNBlock = NULL;
+      ChunkNUsed  = NULL;
+      NFree       = 0;
+      FreeCap     = 0;
+      FreeList    = NULL;
+      NUsed       = 0;
+      NBlock      = 0;
+      BankNSlot   = 0;
+      BankNUsed   = 0;
+
+      for (int b=0; b<ARENA_NBANK; b++)   Bank[b] = NULL;
+
+   } // METHOD : BlockPool_t
+
+
+
+   //===================================================================================
+   // Destructor  :  ~BlockPool_t
+   // Description :  Destructor of the structure "BlockPool_t"
+   //
+   // Note        :  Free all chunks and the bookkeeping arrays
+   //===================================================================================
+   ~BlockPool_t()
+   {
+
+      FreeAll();
+
+      free( Chunk       );
+      free( ChunkNBlock );
+      free( ChunkNUsed  );
+      free( FreeList    );
+
+   } // METHOD : ~BlockPool_t
+
+
+
+   //===================================================================================
+   // Method      :  Init
+   // Description :  Set the block size
+   //
+   // Note        :  Must be called before any Alloc()
+   //
+   // Parameter   :  Size : Minimum size of a block in bytes
+   //===================================================================================
+   void Init( const size_t Size )
+   {
+
+      if ( NChunk != 0 )   Aux_Error( ERROR_INFO, "cannot reset the block size of a non-empty pool !!\n" );
+
+      BlockSize = ( (Size+ARENA_ALIGN-1)/ARENA_ALIGN )*ARENA_ALIGN;
+
+   } // METHOD : Init
+
+
+
+   //===================================================================================
+   // Method      :  Alloc
+   // Description :  Return one block
+   //
+   // Note        :  Allocate a new chunk if the free list is empty
+   //===================================================================================
+   void* Alloc()
+   {
+
+      if ( NFree == 0 )    NewChunk();
+
+      void *Block = FreeList[ --NFree ];
+
+      ChunkNUsed[ ChunkOf(Block) ] ++;
+      NUsed ++;
+
+      return Block;
+
+   } // METHOD : Alloc
+
+
+
+   //===================================================================================
+   // Method      :  Free
+   // Description :  Return one block to the free list
+   //
+   // Note        :  Do nothing for NULL and bank slots
+   //
+   // Parameter   :  Block : Block to be freed
+   //===================================================================================
+   void Free( void *Block )
+   {
+
+      if ( Block == NULL  ||  BankOf(Block) >= 0 )    return;
+
+      const int c = ChunkOf( Block );
+
+#     ifdef GAMER_DEBUG
+      if ( c < 0 )   Aux_Error( ERROR_INFO, "block %p does not belong to this pool !!\n", Block );
+#     endif
+
+      ChunkNUsed[c] --;
+      NUsed --;
+      FreeList[ NFree ++ ] = Block;
+
+   } // METHOD : Free
+
+
+
+   //===================================================================================
+   // Method      :  Reserve
+   // Description :  Allocate chunks until the pool holds at least the given number of blocks
+   //
+   // Parameter   :  NTarget : Target number of blocks
+   //===================================================================================
+   void Reserve( const long NTarget )
+   {
+
+      while ( NBlock < NTarget )    NewChunk();
+
+   } // METHOD : Reserve
+
+
+
+   //===================================================================================
+   // Method      :  Trim
+   // Description :  Release all chunks without any block in use
+   //===================================================================================
+   void Trim()
+   {
+
+      if ( NUsed == NBlock )  return;
+
+//    1. remove the blocks of empty chunks from the free list
+      long NFree_New = 0;
+      for (long t=0; t<NFree; t++)
+         if ( ChunkNUsed[ ChunkOf(FreeList[t]) ] != 0 )  FreeList[ NFree_New ++ ] = FreeList[t];
+      NFree = NFree_New;
+
+//    2. release empty chunks and keep Chunk[] sorted
+      int NChunk_New = 0;
+      for (int c=0; c<NChunk; c++)
+      {
+         if ( ChunkNUsed[c] == 0 )
+         {
+            free( Chunk[c] );
+            NBlock -= ChunkNBlock[c];
+         }
+
+         else
+         {
+            Chunk      [NChunk_New] = Chunk      [c];
+            ChunkNBlock[NChunk_New] = ChunkNBlock[c];
+            ChunkNUsed [NChunk_New] = ChunkNUsed [c];
+            NChunk_New ++;
+         }
+      }
+      NChunk = NChunk_New;
+
+   } // METHOD : Trim
+
+
+
+   //===================================================================================
+   // Method      :  FreeAll
+   // Description :  Release all chunks and banks
+   //
+   // Note        :  All blocks become invalid
+   //===================================================================================
+   void FreeAll()
+   {
+
+      for (int c=0; c<NChunk;      c++)  free( Chunk[c] );
+      for (int b=0; b<ARENA_NBANK; b++)  free( Bank [b] );
+
+      NChunk    = 0;
+      NFree     = 0;
+      NUsed     = 0;
+      NBlock    = 0;
+      BankNSlot = 0;
+      BankNUsed = 0;
+
+      for (int b=0; b<ARENA_NBANK; b++)   Bank[b] = NULL;
+
+   } // METHOD : FreeAll
+
+
+
+   //===================================================================================
+   // Method      :  GetNByte
+   // Description :  Return the total number of bytes allocated from the system
+   //===================================================================================
+   long GetNByte() const
+   {
+
+      return ( NBlock + ARENA_NBANK*BankNSlot )*(long)BlockSize;
+
+   } // METHOD : GetNByte
+
+
+
+   //===================================================================================
+   // Method      :  GetNByteUsed
+   // Description :  Return the total number of bytes in use
+   //===================================================================================
+   long GetNByteUsed() const
+   {
+
+      return ( NUsed + BankNUsed )*(long)BlockSize;
+
+   } // METHOD : GetNByteUsed
+
+
+
+   //===================================================================================
+   // Method      :  GetNByteFrag
+   // Description :  Return the total number of free bytes in chunks with at least one block in use and
+   //                in banks
+   //
+   // Note        :  These bytes cannot be returned to the system by Trim()
+   //===================================================================================
+   long GetNByteFrag() const
+   {
+
+      long NFrag = ARENA_NBANK*BankNSlot - BankNUsed;
+      for (int c=0; c<NChunk; c++)
+         if ( ChunkNUsed[c] > 0 )   NFrag += ChunkNBlock[c] - ChunkNUsed[c];
+
+      return NFrag*(long)BlockSize;
+
+   } // METHOD : GetNByteFrag
+
+
+
+   //===================================================================================
+   // Method      :  BankOf
+   // Description :  Return the index of the bank containing the target block (-1 if not found)
+   //===================================================================================
+   int BankOf( const void *Block ) const
+   {
+
+      const char *Ptr = (const char*)Block;
+
+      for (int b=0; b<ARENA_NBANK; b++)
+         if ( Ptr >= Bank[b]  &&  Ptr < Bank[b] + BankNSlot*BlockSize )    return b;
+
+      return -1;
+
+   } // METHOD : BankOf
+
+
+
+   //===================================================================================
+   // Method      :  ResizeBank
+   // Description :  Reallocate all banks with the given number of slots
+   //
+   // Note        :  1. The first MIN(NSlot,BankNSlot) slots of each bank are copied to the new bank
+   //                2. The new banks are first-touched in parallel
+   //                3. The old banks are NOT freed but returned by OldBank[]
+   //                   --> The caller must redirect all pointers to the old banks and then free() them
+   //
+   // Parameter   :  NSlot   : New number of slots in each bank
+   //                OldBank : Base addresses of the old banks to be returned
+   //===================================================================================
+   void ResizeBank( const long NSlot, char *OldBank[] )
+   {
+
+      if ( BlockSize == 0 )   Aux_Error( ERROR_INFO, "block size has not been set !!\n" );
+
+      const long NCopy = MIN( NSlot, BankNSlot );
+
+      for (int b=0; b<ARENA_NBANK; b++)
+      {
+         OldBank[b] = Bank[b];
+         Bank   [b] = NULL;
+
+         if ( NSlot == 0 )    continue;
+
+         void *Ptr = NULL;
+         if (  posix_memalign( &Ptr, ARENA_ALIGN, NSlot*BlockSize ) != 0  )
+            Aux_Error( ERROR_INFO, "failed to allocate a bank of %ld bytes !!\n", NSlot*(long)BlockSize );
+
+         Bank[b] = (char*)Ptr;
+
+#        pragma omp parallel for schedule( static )
+         for (long t=0; t<NSlot; t++)
+         {
+            if ( t < NCopy )  memcpy( Bank[b] + t*BlockSize, OldBank[b] + t*BlockSize, BlockSize );
+            else              memset( Bank[b] + t*BlockSize, 0,                        BlockSize );
+         }
+      }
+
+      BankNSlot = NSlot;
+
+   } // METHOD : ResizeBank
+
+
+
+   //===================================================================================
+   // Method      :  ChunkOf
+   // Description :  Return the index of the chunk containing the target block (-1 if not found)
+   //
+   // Note        :  Binary search on the sorted chunk addresses
+   //===================================================================================
+   int ChunkOf( const void *Block ) const
+   {
+
+      const char *Ptr = (const char*)Block;
+      int L = 0, R = NChunk-1;
+
+      while ( L <= R )
+      {
+         const int c = (L+R)/2;
+
+         if      ( Ptr <  Chunk[c] )                                 R = c - 1;
+         else if ( Ptr >= Chunk[c] + ChunkNBlock[c]*BlockSize )      L = c + 1;
+         else                                                        return c;
+      }
+
+      return -1;
+
+   } // METHOD : ChunkOf
+
+
+
+   //===================================================================================
+   // Method      :  NewChunk
+   // Description :  Allocate a new chunk and push all its blocks to the free list
+   //
+   // Note        :  1. Chunk size doubles with the number of blocks already allocated until reaching
+   //                   ARENA_MAX_CHUNK_SIZE
+   //                2. The new chunk is first-touched in parallel
+   //===================================================================================
+   void NewChunk()
+   {
+
+      if ( BlockSize == 0 )   Aux_Error( ERROR_INFO, "block size has not been set !!\n" );
+
+      const long MaxNBlock = MAX( ARENA_MAX_CHUNK_SIZE/(long)BlockSize, (long)ARENA_MIN_CHUNK_NBLOCK );
+      const int  NNew      = (int)MIN(  MAX( NBlock, (long)ARENA_MIN_CHUNK_NBLOCK ), MaxNBlock  );
+
+      void *Ptr = NULL;
+      if (  posix_memalign( &Ptr, ARENA_ALIGN, NNew*BlockSize ) != 0  )
+         Aux_Error( ERROR_INFO, "failed to allocate a chunk of %ld bytes !!\n", NNew*(long)BlockSize );
+
+      char *NewBase = (char*)Ptr;
+
+//    first touch
+#     pragma omp parallel for schedule( static )
+      for (int b=0; b<NNew; b++)    memset( NewBase + b*BlockSize, 0, BlockSize );
+
+//    insert the new chunk into the sorted chunk list
+      if ( NChunk == ChunkCap )
+      {
+         ChunkCap    = MAX( 2*ChunkCap, 16 );
+         Chunk       = (char**)realloc( Chunk,       ChunkCap*sizeof(char*) );
+         ChunkNBlock = (int*  )realloc( ChunkNBlock, ChunkCap*sizeof(int  ) );
+         ChunkNUsed  = (int*  )realloc( ChunkNUsed,  ChunkCap*sizeof(int  ) );
+      }
+
+      int c = NChunk;
+      while ( c > 0  &&  Chunk[c-1] > NewBase )
+      {
+         Chunk      [c] = Chunk      [c-1];
+         ChunkNBlock[c] = ChunkNBlock[c-1];
+         ChunkNUsed [c] = ChunkNUsed [c-1];
+         c --;
+      }
+
+      Chunk      [c] = NewBase;
+      ChunkNBlock[c] = NNew;
+      ChunkNUsed [c] = 0;
+      NChunk ++;
+      NBlock += NNew;
+
+//    push blocks in reverse order so that they are handed out in ascending address order
+//    --> the free list must be able to hold all blocks
+      if ( NBlock > FreeCap )
+      {
+         FreeCap  = MAX( 2*FreeCap, NBlock );
+         FreeList = (void**)realloc( FreeList, FreeCap*sizeof(void*) );
+      }
+
+      for (int b=NNew-1; b>=0; b--)    FreeList[ NFree ++ ] = NewBase + b*BlockSize;
+
+   } // METHOD : NewChunk
+
+
+}; // struct BlockPool_t
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  PatchArena_t
+// Description :  Memory arena of all patches at one level
+//
+// Note        :  1. Allocated by AMR_t for each level and referenced by all patches at that level
+//                2. Patch structures and the field arrays fluid[], magnetic[], pot[], and pot_ext[] are carved from
+//                   the pools below
+//                   --> Other arrays (e.g., flux[] and electric[]) may be allocated concurrently by different
+//                       OpenMP threads and are still allocated by new
+//                3. NOT thread-safe
+//
+// Data Member :  Patch          : Pool of the patch_t structures
+//                Flu            : Pool of fluid[]
+//                Mag            : Pool of magnetic[]
+//                Pot            : Pool of pot[]
+//                PotExt         : Pool of pot_ext[]
+//                KeepEmptyChunk : Do not release empty chunks in AMR_t::Lvdelete()
+//                                 --> Set by the adaptive memory pool (OPT__MEMORY_POOL), which releases them
+//                                     by itself in Mis_MemoryPool_Update()
+//                BankDirty      : Patches have been allocated or deallocated since the last call to
+//                                 Mis_FieldBank_Bind() (for OPT__FIELD_BANK)
+//
+// Method      :  PatchArena_t : Constructor
+//                Reserve      : Grow all pools in proportion to their current usage
+//                Trim         : Release all empty chunks
+//                GetNByte     : Total number of bytes allocated from the system
+//                GetNByteUsed : Total number of bytes in use
+//                GetNByteFrag : Total number of free bytes in chunks that cannot be released
+//-------------------------------------------------------------------------------------------------------
+struct PatchArena_t
+{
+
+// data members
+// ===================================================================================
+   BlockPool_t Patch;
+   BlockPool_t Flu;
+#  ifdef MHD
+   BlockPool_t Mag;
+#  endif
+#  ifdef GRAVITY
+   BlockPool_t Pot;
+#  ifdef STORE_POT_GHOST
+   BlockPool_t PotExt;
+#  endif
+#  endif
+   bool        KeepEmptyChunk;
+   bool        BankDirty;
+
+
+
+   //===================================================================================
+   // Constructor :  PatchArena_t
+   // Description :  Constructor of the structure "PatchArena_t"
+   //
+   // Note        :  Set the block size of all pools
+   //
+   // Parameter   :  PatchSize : sizeof(patch_t)
+   //===================================================================================
+   PatchArena_t( const size_t PatchSize )
+   {
+
+      KeepEmptyChunk = false;
+      BankDirty      = true;
+
+      Patch .Init( PatchSize );
+      Flu   .Init( sizeof(real_fld)*NCOMP_TOTAL*CUBE(PS1) );
+#     ifdef MHD
+      Mag   .Init( sizeof(real_fld)*NCOMP_MAG*PS1P1*SQR(PS1) );
+#     endif
+#     ifdef GRAVITY
+      Pot   .Init( sizeof(real_fld)*CUBE(PS1) );
+#     ifdef STORE_POT_GHOST
+      PotExt.Init( sizeof(real_fld)*CUBE(GRA_NXT) );
+#     endif
+#     endif
+
+   } // METHOD : PatchArena_t
+
+
+
+   //===================================================================================
+   // Method      :  Reserve
+   // Description :  Grow all pools to hold at least "Scale" times the number of blocks currently in use
+   //
+   // Note        :  Used to pre-grow the arena before creating patches since the ratio between the number of
+   //                field arrays and the number of patches depends on the type of patches (e.g., buffer patches
+   //                may not allocate pot[])
+   //
+   // Parameter   :  Scale : Target number of blocks normalized to the number of blocks currently in use
+   //===================================================================================
+   void Reserve( const double Scale )
+   {
+
+      Patch .Reserve( (long)ceil(Scale*Patch .NUsed) );
+      Flu   .Reserve( (long)ceil(Scale*Flu   .NUsed) );
+#     ifdef MHD
+      Mag   .Reserve( (long)ceil(Scale*Mag   .NUsed) );
+#     endif
+#     ifdef GRAVITY
+      Pot   .Reserve( (long)ceil(Scale*Pot   .NUsed) );
+#     ifdef STORE_POT_GHOST
+      PotExt.Reserve( (long)ceil(Scale*PotExt.NUsed) );
+#     endif
+#     endif
+
+   } // METHOD : Reserve
+
+
+
+   //===================================================================================
+   // Method      :  Trim
+   // Description :  Release all empty chunks of all pools
+   //===================================================================================
+   void Trim()
+   {
+
+      Patch .Trim();
+      Flu   .Trim();
+#     ifdef MHD
+      Mag   .Trim();
+#     endif
+#     ifdef GRAVITY
+      Pot   .Trim();
+#     ifdef STORE_POT_GHOST
+      PotExt.Trim();
+#     endif
+#     endif
+
+   } // METHOD : Trim
+
+
+
+   //===================================================================================
+   // Method      :  GetNByte
+   // Description :  Return the total number of bytes allocated from the system by all pools
+   //===================================================================================
+   long GetNByte() const
+   {
+
+      long NByte = Patch.GetNByte() + Flu.GetNByte();
+#     ifdef MHD
+      NByte += Mag.GetNByte();
+#     endif
+#     ifdef GRAVITY
+      NByte += Pot.GetNByte();
+#     ifdef STORE_POT_GHOST
+      NByte += PotExt.GetNByte();
+#     endif
+#     endif
+
+      return NByte;
+
+   } // METHOD : GetNByte
+
+
+
+   //===================================================================================
+   // Method      :  GetNByteUsed
+   // Description :  Return the total number of bytes in use by all pools
+   //===================================================================================
+   long GetNByteUsed() const
+   {
+
+      long NByte = Patch.GetNByteUsed() + Flu.GetNByteUsed();
+#     ifdef MHD
+      NByte += Mag.GetNByteUsed();
+#     endif
+#     ifdef GRAVITY
+      NByte += Pot.GetNByteUsed();
+#     ifdef STORE_POT_GHOST
+      NByte += PotExt.GetNByteUsed();
+#     endif
+#     endif
+
+      return NByte;
+
+   } // METHOD : GetNByteUsed
+
+
+
+   //===================================================================================
+   // Method      :  GetNByteFrag
+   // Description :  Return the total number of free bytes in the non-empty chunks of all pools
+   //===================================================================================
+   long GetNByteFrag() const
+   {
+
+      long NByte = Patch.GetNByteFrag() + Flu.GetNByteFrag();
+#     ifdef MHD
+      NByte += Mag.GetNByteFrag();
+#     endif
+#     ifdef GRAVITY
+      NByte += Pot.GetNByteFrag();
+#     ifdef STORE_POT_GHOST
+      NByte += PotExt.GetNByteFrag();
+#     endif
+#     endif
+
+      return NByte;
+
+   } // METHOD : GetNByteFrag
+
+
+}; // struct PatchArena_t
+
+
+
+#endif // #ifndef __PATCHARENA_H__
@@ -39,6 +39,10 @@ int  Aux_CountRow( const char *FileName );
 void Aux_Record_BoundaryPatch( const int lv, int *NList, int **IDList, int **PosList );
 #endif
 void Aux_SwapPointer( void **Ptr1, void **Ptr2 );
+void Aux_Scratch_Init();
+void* Aux_Scratch_Get( const ScratchSlot_t Slot, const long NByte );
+void Aux_Scratch_GetNAlloc( long NAlloc[], const bool Reset );
+void Aux_Scratch_Free();
 template <typename T> void Aux_AllocateArray2D( T** &Array, const int J, const int I );
 template <typename T> void Aux_AllocateArray3D( T*** &Array, const int K, const int J, const int I );
 template <typename T> void Aux_DeallocateArray2D( T** &Array );
@@ -78,11 +82,25 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const int NPatchGroup, const real dt, const real dh, const real Gamma,
                       const bool StoreFlux, const bool StoreElectric,
                       const bool XYZ, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                      const OptLRScheme_t LR_Scheme, const OptRSolver_t RSolver,
                       const real ELBDM_Eta, real ELBDM_Taylor3_Coeff, const bool ELBDM_Taylor3_Auto,
                       const double Time, const OptGravityType_t GravityType,
                       const real MinDens, const real MinPres, const real DualEnergySwitch,
                       const bool NormPassive, const int NNorm, const int NormIdx[],
-                      const bool JeansMinPres, const real JeansMinPres_Coeff );
+                      const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab );
+#ifdef FLU_CLUSTER
+void CPU_FluidSolver_Cluster( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_CLU_NXT) ],
+                              real h_Flu_Array_Out[][FLU_NOUT][ CUBE(FLU_CLU_NOUT) ],
+                              char h_DE_Array_Out[][ CUBE(FLU_CLU_NOUT) ],
+                              const int NCluster, const real dt, const real dh, const real Gamma,
+                              const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                              const OptLRScheme_t LR_Scheme, const OptRSolver_t RSolver,
+                              const real MinDens, const real MinPres, const real DualEnergySwitch,
+                              const bool NormPassive, const int NNorm, const int NormIdx[],
+                              const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab );
+void CPU_FluidSolver_Cluster_MemAllocate( const int NThread );
+void CPU_FluidSolver_Cluster_MemFree();
+#endif
 real Hydro_GetPressure( const real Dens, const real MomX, const real MomY, const real MomZ, const real Engy,
                         const real Gamma_m1, const bool CheckMinPres, const real MinPres, const real EngyB );
 real Hydro_GetTemperature( const real Dens, const real MomX, const real MomY, const real MomZ, const real Engy,
@@ -124,6 +142,16 @@ void Flu_Prepare( const int lv, const double PrepTime,
                   real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                   real h_Pot_Array_USG_F[][ CUBE(USG_NXT_F) ],
                   double h_Corner_Array_F[][3], const int NPG, const int *PID0_List );
+#ifdef FLU_CLUSTER
+int  Flu_FindCluster( const int lv, const double PrepTime, int &NPG, int *PID0_List, int *Clu_PID0_List );
+void Flu_Prepare_Cluster( const int lv, const double PrepTime, real h_Flu_Array_C_In[][FLU_NIN][ CUBE(FLU_CLU_NXT) ],
+                          const int NClu, const int *Clu_PID0_List );
+int  Flu_Close_Cluster( const int lv, const int SaveSg_Flu,
+                        const real h_Flu_Array_C_Out[][FLU_NOUT][ CUBE(FLU_CLU_NOUT) ],
+                        const char h_DE_Array_C_Out[][ CUBE(FLU_CLU_NOUT) ],
+                        const int NClu, const int *Clu_PID0_List, int *Fail_PID0_List );
+#endif
+void Flu_RecordRetry();
 void Flu_FixUp_Flux( const int lv );
 void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg, const int SonMagSg, const int FaMagSg,
                          const int SonPotSg, const int FaPotSg, const long TVarCC, const long TVarFC );
@@ -145,11 +173,27 @@ void EvolveLevel( const int lv, const double dTime_FaLv );
 void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
                    const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
                    const bool OverlapMPI, const bool Overlap_Sync );
+#if ( !defined GPU  &&  defined OPENMP )
+void InvokeSolver_TaskGraph( const Solver_t TSolver1, const Solver_t TSolver2, const int lv, const double TimeNew,
+                             const double TimeOld, const double dt, const double Poi_Coeff, const int SaveSg_Flu,
+                             const int SaveSg_Mag, const int SaveSg_Pot );
+#endif
 void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, real *OutputFC,
                         const int GhostSize, const int NPG, const int *PID0_List, long TVarCC, long TVarFC,
                         const IntScheme_t IntScheme_CC, const IntScheme_t IntScheme_FC, const PrepUnit_t PrepUnit,
                         const NSide_t NSide, const bool IntPhase, const OptFluBC_t FluBC[], const OptPotBC_t PotBC,
                         const real MinDens, const real MinPres, const bool DE_Consistency );
+void Prepare_PatchData_GhostCache_Begin( const int lv );
+void Prepare_PatchData_GhostCache_End( const int lv );
+int  Prepare_PatchData_GhostCache_GetSig( const int lv, const double PrepTime, const int GhostSize, const long TVarCC,
+                                          const int NVarCC_Tot, const int NVarCC_Flu, const int TVarCCIdxList_Flu[],
+                                          const int NVarCC_Der, const long TVarCCList_Der[], const int NVarFC_Tot,
+                                          const IntScheme_t IntScheme_CC, const bool IntPhase, const OptFluBC_t FluBC[],
+                                          const OptPotBC_t PotBC, const real MinPres, const bool DE_Consistency, int Key[] );
+bool Prepare_PatchData_GhostCache_Load( const int lv, const int Sig, const int Key[], const int NVar, const int PID0,
+                                        const int Side, real IntData_CC[], const int Size3D );
+void Prepare_PatchData_GhostCache_Store( const int lv, const int Sig, const int Key[], const int NVar, const int PID0,
+                                         const int Side, const real IntData_CC[], const int Size3D );
 
 
 // Init
@@ -189,6 +233,10 @@ void Init_ByRestart_HDF5( const char *FileName );
 
 // Interpolation
 void Int_Table( const IntScheme_t IntScheme, int &NSide, int &NGhost );
+void Int_Separable( const Int1D_t Int1D, const int CGhost,
+                    real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                    real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                    const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff );
 void Interpolate( real CData [], const int CSize[3], const int CStart[3], const int CRange[3],
                   real FData [], const int FSize[3], const int FStart[3],
                   const int NComp, const IntScheme_t IntScheme, const bool UnwrapPhase, const bool Monotonic[] );
@@ -204,10 +252,15 @@ template <typename T> void  Mis_Heapsort( const int N, T Array[], int IdxTable[]
 template <typename T> int   Mis_Matching_char( const int N, const T Array[], const int M, const T Key[], char Match[] );
 template <typename T> int   Mis_Matching_int( const int N, const T Array[], const int M, const T Key[], int Match[] );
 template <typename T> bool  Mis_CompareRealValue( const T Input1, const T Input2, const char *comment, const bool Verbose );
+template <typename TOut, typename TIn> void Mis_CopyArray( TOut *Out, const TIn *In, const long N );
 ulong  Mis_Idx3D2Idx1D( const int Size[], const int Idx3D[] );
 double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double AutoReduceDtCoeff );
 double Mis_dTime2dt( const double Time_In, const double dTime_In );
 void   Mis_GetTotalPatchNumber( const int lv );
+void   Mis_MemoryPool_Reserve( const int lv );
+void   Mis_MemoryPool_Update( const int lv );
+void   Mis_FieldBank_Bind( const int lv );
+real_fld* Mis_FieldBank_GetFluid( const int lv, const int Sg );
 double Mis_Scale2PhySize( const int Scale );
 double Mis_Cell2PhySize( const int NCell, const int lv );
 int    Mis_Scale2Cell( const int Scale, const int lv );
@@ -220,6 +273,11 @@ void   dt_Prepare_Pot( const int lv, real h_Pot_Array_T[][ CUBE(GRA_NXT) ], cons
                        const double PrepTime );
 #endif
 void   dt_Close( const real h_dt_Array_T[], const int NPG );
+#if ( MODEL == HYDRO )
+void   dt_CFLCache_Update( const int lv, const int Sg, const int PID );
+void   dt_CFLCache_Invalidate( const int lv, const int Sg, const int PID );
+double dt_CFLCache_GetTimeStep( const int lv, const real Safety );
+#endif
 void   CPU_dtSolver( const Solver_t TSolver, real dt_Array[], const real Flu_Array[][NCOMP_FLUID][ CUBE(PS1) ],
                      const real Mag_Array[][NCOMP_MAG][ PS1P1*SQR(PS1) ], const real Pot_Array[][ CUBE(GRA_NXT) ],
                      const double Corner_Array[][3], const int NPatchGroup, const real dh, const real Safety,
@@ -313,15 +371,24 @@ void CPU_PoissonGravitySolver( const real h_Rho_Array    [][RHO_NXT][RHO_NXT][RH
 void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double PrepTime );
 void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf_SIdx, long *RecvBuf_SIdx,
                  int **List_PID, int **List_k, int *List_NSend_Rho, int *List_NRecv_Rho,
-                 const int *List_z_start, const int local_nz, const int FFT_Size[], const int NRecvSlice,
-                 const double PrepTime );
+                 const int NSplit_y, const int *List_y_start, const int *List_z_start, const int SSize_x,
+                 const long NRecvCell, const double PrepTime );
 void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveSg, const long *List_SIdx,
-                 int **List_PID, int **List_k, int *List_NSend, int *List_NRecv, const int local_nz, const int FFT_Size[],
-                 const int NSendSlice );
+                 int **List_PID, int **List_k, int *List_NSend, int *List_NRecv, const int SSize_x );
+#if ( SUPPORT_FFTW == FFTW3 )
+FFTPencil_t* FFT_Pencil_Create( const int N[] );
+void FFT_Pencil_Destroy( FFTPencil_t *Pencil );
+void FFT_Pencil_Forward( FFTPencil_t *Pencil );
+void FFT_Pencil_Backward( FFTPencil_t *Pencil );
+#endif
 void End_MemFree_PoissonGravity();
 void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
                     const int SaveSg_Flu, const int SaveSg_Pot, const bool Poisson, const bool Gravity,
                     const bool OverlapMPI, const bool Overlap_Sync );
+#if ( !defined GPU  &&  defined OPENMP )
+void FluGra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                       const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot, const bool Poisson );
+#endif
 void Gra_Close( const int lv, const int SaveSg, const real h_Flu_Array_G[][GRA_NIN][PS1][PS1][PS1],
                 const char h_DE_Array_G[][PS1][PS1][PS1], const real h_EngyB_Array_G[][PS1][PS1][PS1],
                 const int NPG, const int *PID0_List );
@@ -376,6 +443,9 @@ void TABLE_SiblingSharingSameEdge( const int EdgeID, int SibID[], int SibSibID[]
 // LoadBalance
 long LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 #ifdef LOAD_BALANCE
+void LB_AccumulateCost( const int lv, const int NPG, const int *PID0_List, const double Cost );
+void LB_CountCostStep( const int lv );
+void LB_ResetCost( const int lv );
 void LB_AllocateBufferPatch_Father( const int SonLv, const bool SearchAllSon, const int NInput, int* TargetSonPID0,
                                     const bool RecordFaPID, int* NNewFaBuf0, int** NewFaBufPID0 );
 void LB_AllocateBufferPatch_Sibling_Base();
@@ -390,17 +460,21 @@ real*LB_GetBufferData_MemAllocate_Send( const int NSend );
 real*LB_GetBufferData_MemAllocate_Recv( const int NRecv );
 void LB_GrandsonCheck( const int lv );
 void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const bool Reset, const int TLv );
+int  LB_Incremental_LoadBalance( const double ParWeight );
+void LB_Record_Rebalance( const int NLv, const double Time_Rebalance );
 void LB_Init_ByFunction();
 void LB_Init_Refine( const int FaLv );
+void*LB_MPIBuffer_Get( const MPIBuf_t BufID, const long NByte );
 void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bool InputLBIdx0AndLoad,
                      long *LBIdx0_AllRank_Input, double *Load_AllRank_Input, const double ParWeight );
-void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG );
+bool LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG );
 double LB_EstimateLoadImbalance();
 void LB_SetCutPoint( const int lv, long *CutPoint, const bool InputLBIdx0AndLoad, long *LBIdx0_AllRank_Input,
                      double *Load_AllRank_Input, const double ParWeight );
 void LB_Output_LBIdx( const int lv );
 void LB_RecordExchangeDataPatchID( const int Lv, const bool AfterRefine );
 void LB_RecordExchangeFixUpDataPatchID( const int Lv );
+void LB_RecordExchangeNeighborRank( const int Lv );
 void LB_RecordExchangeRestrictDataPatchID( const int FaLv );
 void LB_RecordOverlapMPIPatchID( const int Lv );
 void LB_Refine( const int FaLv );
@@ -22,6 +22,22 @@ typedef double real;
 typedef float  real;
 #endif
 
+// precision of the field arrays stored in patches (fluid, magnetic, pot, and pot_ext)
+// --> MIXED_PRECISION: store them in single precision while all solvers and the flux/electric arrays for the
+//                      fix-up operations still use "real" (which must be double precision)
+#ifdef MIXED_PRECISION
+typedef float  real_fld;
+#else
+typedef real   real_fld;
+#endif
+
+// MPI datatype of real_fld for exchanging the patch field arrays
+#if ( defined MIXED_PRECISION  ||  !defined FLOAT8 )
+#  define MPI_GAMER_REAL_FLD MPI_FLOAT
+#else
+#  define MPI_GAMER_REAL_FLD MPI_DOUBLE
+#endif
+
 
 // short names for unsigned type
 typedef unsigned short     ushort;
@@ -98,6 +114,12 @@ const IntScheme_t
    INT_CQUAR    = 6,
    INT_QUAR     = 7;
 
+// 1D interpolation of a row of N contiguous coarse cells In[0 ... N-1] into the left and right fine cells
+// OutL/R[0 ... N-1] (see Int_Separable())
+// --> stencil neighbors of In[i] are In[i +/- m*dIn]
+typedef void (*Int1D_t)( const real In[], const int dIn, real OutL[], real OutR[], const int N,
+                         const bool Monotonic, const real MonoCoeff );
+
 
 // data reconstruction TVD limiters
 typedef int LR_Limiter_t;
@@ -110,6 +132,27 @@ const LR_Limiter_t
    EXTPRE          = 5;
 
 
+// OPT__LR_SCHEME options (same values as the Makefile option LR_SCHEME)
+typedef int OptLRScheme_t;
+const OptLRScheme_t
+   LR_SCHEME_DEFAULT = -1,
+   LR_SCHEME_NONE    = 0,
+   LR_SCHEME_PLM     = 1,
+   LR_SCHEME_PPM     = 2;
+
+
+// OPT__RSOLVER options (same values as the Makefile option RSOLVER)
+typedef int OptRSolver_t;
+const OptRSolver_t
+   RSOLVER_DEFAULT = -1,
+   RSOLVER_NONE    = 0,
+   RSOLVER_EXACT   = 1,
+   RSOLVER_ROE     = 2,
+   RSOLVER_HLLE    = 3,
+   RSOLVER_HLLC    = 4,
+   RSOLVER_HLLD    = 5;
+
+
 // data output formats
 typedef int OptOutputFormat_t;
 const OptOutputFormat_t
@@ -151,6 +194,25 @@ const NSide_t
    NSIDE_06 = 6,
    NSIDE_26 = 26;
 
+// slots of the thread-private scratch buffers returned by Aux_Scratch_Get()
+// --> buffers used by Prepare_PatchData(), InterpolateGhostZone(), and the interpolation schemes must use different
+//     slots since the latter two are invoked while the buffers of the former are still in use
+// --> must start from 0 and end with SCRATCH_NSLOT
+typedef int ScratchSlot_t;
+const ScratchSlot_t
+   SCRATCH_PREP_DATA1PG_CC = 0,
+   SCRATCH_PREP_DATA1PG_FC = 1,
+   SCRATCH_PREP_INTDATA_CC = 2,
+   SCRATCH_PREP_INTDATA_FC = 3,
+   SCRATCH_PREP_FINTERFACE = 4,
+   SCRATCH_PREP_PARMASS    = 5,
+   SCRATCH_INTGZ_CDATA_CC  = 6,
+   SCRATCH_INTGZ_CDATA_FC  = 7,
+   SCRATCH_INT_TDATA_X     = 8,
+   SCRATCH_INT_TDATA_Y     = 9,
+   SCRATCH_INT_ROW         = 10,
+   SCRATCH_NSLOT           = 11;
+
 
 // use the load-balance alternative functions
 typedef int UseLBFunc_t;
@@ -207,6 +269,22 @@ const GetBufMode_t
   ;
 
 
+// persistent MPI buffers managed by LB_MPIBuffer_Get() for LOAD_BALANCE
+// --> buffers that may be in use at the same time must have different IDs
+typedef int MPIBuf_t;
+const MPIBuf_t
+   MPIBUF_SEND        = 0    // send buffer of the main data                 (real)
+  ,MPIBUF_RECV        = 1    // recv buffer of the main data                 (real)
+  ,MPIBUF_TABLE       = 2    // MPI count/disp arrays and pack/unpack tables  (int)
+  ,MPIBUF_SEND_NPAR   = 3    // number of particles in each patch to be sent (int)
+  ,MPIBUF_SEND_LBIDX  = 4    // load-balance index of each patch to be sent  (long)
+  ,MPIBUF_RECV_NPATCH = 5    // number of patches received from each rank    (int)
+  ,MPIBUF_RECV_NPAR   = 6    // number of particles in each received patch   (int)
+  ,MPIBUF_RECV_LBIDX  = 7    // load-balance index of each received patch    (long)
+  ,MPIBUF_NTYPE       = 8    // total number of MPI buffers
+  ;
+
+
 // fluid boundary conditions
 typedef int OptFluBC_t;
 const OptFluBC_t
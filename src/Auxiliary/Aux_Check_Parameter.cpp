@@ -35,6 +35,14 @@ void Aux_Check_Parameter()
 #     error : ERROR : OVERLAP_MPI must work with LOAD_BALANCE !!
 #  endif
 
+#  if ( defined OVERLAP_MPI  &&  !defined OPENMP )
+#     error : ERROR : OVERLAP_MPI must work with OPENMP !!
+#  endif
+
+#  if ( defined MIXED_PRECISION  &&  !defined FLOAT8 )
+#     error : ERROR : MIXED_PRECISION must work with FLOAT8 !!
+#  endif
+
 #  if ( !defined GRAVITY  &&  defined UNSPLIT_GRAVITY )
 #     error : ERROR : UNSPLIT_GRAVITY must work with GRAVITY !!
 #  endif
@@ -155,8 +163,9 @@ void Aux_Check_Parameter()
                  "OVERLAP_MPI", "OPT__OVERLAP_MPI" );
 #  endif
 
-   if ( OPT__OVERLAP_MPI )
-      Aux_Error( ERROR_INFO, "\"%s\" is NOT supported yet !!\n", "OPT__OVERLAP_MPI" );
+// MPI_Barrier() must not be called by the computation thread while the communication thread is exchanging data
+   if ( OPT__OVERLAP_MPI  &&  OPT__TIMING_BARRIER )
+      Aux_Error( ERROR_INFO, "OPT__OVERLAP_MPI does NOT work with OPT__TIMING_BARRIER !!\n" );
 
    if ( AUTO_REDUCE_DT )
    {
@@ -195,9 +204,6 @@ void Aux_Check_Parameter()
    if ( INT_MONO_COEFF < 1.0  ||  INT_MONO_COEFF > 4.0 )
       Aux_Error( ERROR_INFO, "INT_MONO_COEFF (%14.7e) is not within the correct range [1.0, 4.0] !!\n", INT_MONO_COEFF );
 
-   if ( OPT__MEMORY_POOL  &&  !OPT__REUSE_MEMORY )
-      Aux_Error( ERROR_INFO, "please turn on OPT__REUSE_MEMORY for OPT__MEMORY_POOL !!\n" );
-
    if ( OPT__CORR_AFTER_ALL_SYNC != CORR_AFTER_SYNC_NONE  &&  OPT__CORR_AFTER_ALL_SYNC != CORR_AFTER_SYNC_EVERY_STEP  &&
         OPT__CORR_AFTER_ALL_SYNC != CORR_AFTER_SYNC_BEFORE_DUMP )
       Aux_Error( ERROR_INFO, "incorrect option \"OPT__CORR_AFTER_ALL_SYNC = %d\" [0/1/2] !!\n", OPT__CORR_AFTER_ALL_SYNC );
@@ -230,6 +236,31 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "please set OPT__CORR_AFTER_ALL_SYNC to 1/2 when BITWISE_REPRODUCIBILITY is enabled !!\n" );
 #  endif
 
+   if ( OPT__CPU_PIPELINE )
+   {
+#     ifdef GPU
+         Aux_Error( ERROR_INFO, "OPT__CPU_PIPELINE does NOT work with GPU !!\n" );
+#     endif
+
+      if ( CPU_PIPELINE_NTHREAD < 1  ||  CPU_PIPELINE_NTHREAD >= OMP_NTHREAD )
+         Aux_Error( ERROR_INFO, "CPU_PIPELINE_NTHREAD (%d) is not within the correct range [1, OMP_NTHREAD-1=%d] !!\n",
+                    CPU_PIPELINE_NTHREAD, OMP_NTHREAD-1 );
+   }
+
+   if ( OPT__TASK_GRAPH )
+   {
+#     ifdef GPU
+         Aux_Error( ERROR_INFO, "OPT__TASK_GRAPH does NOT work with GPU !!\n" );
+#     endif
+
+      if ( OPT__CPU_PIPELINE )
+         Aux_Error( ERROR_INFO, "OPT__TASK_GRAPH does NOT work with OPT__CPU_PIPELINE !!\n" );
+   }
+
+   if ( OPT__FLU_FUSED  &&  ( FLU_FUSED_SLAB < 1 || FLU_FUSED_SLAB > PS2 )  )
+      Aux_Error( ERROR_INFO, "FLU_FUSED_SLAB (%d) is not within the correct range [1, PS2=%d] !!\n",
+                 FLU_FUSED_SLAB, PS2 );
+
 #  if ( !defined SERIAL  &&  !defined LOAD_BALANCE )
    if ( OPT__INIT == INIT_BY_FILE )
       Aux_Error( ERROR_INFO, "must enable either SERIAL or LOAD_BALANCE for OPT__INIT=3 !!\n" );
@@ -319,25 +350,24 @@ void Aux_Check_Parameter()
 
    if ( OPT__OVERLAP_MPI )
    {
-      Aux_Message( stderr, "WARNING : \"%s\" is still experimental and is not fully optimized !!\n",
-                   "OPT__OVERLAP_MPI" );
-
 #     ifdef OPENMP
+      const int Nested_Backup = omp_get_nested();
+
       omp_set_nested( true );
 
       if ( !omp_get_nested() )
          Aux_Message( stderr, "WARNING : OpenMP nested parallelism is NOT supported for \"%s\" !!\n",
                       "OPT__OVERLAP_MPI" );
 
-      omp_set_nested( false );
+      omp_set_nested( Nested_Backup );
 #     else
       Aux_Message( stderr, "WARNING : OpenMP is NOT turned on for \"%s\" !!\n", "OPT__OVERLAP_MPI" );
 #     endif
    } // if ( OPT__OVERLAP_MPI )
 
    if ( OPT__TIMING_BARRIER )
-      Aux_Message( stderr, "WARNING : \"%s\" may deteriorate performance (especially if %s is on) ...\n",
-                   "OPT__TIMING_BARRIER", "OPT__OVERLAP_MPI" );
+      Aux_Message( stderr, "WARNING : \"%s\" may deteriorate performance ...\n",
+                   "OPT__TIMING_BARRIER" );
 
    if ( OPT__TIMING_BARRIER  &&  !OPT__TIMING_BALANCE )
    {
@@ -576,6 +606,20 @@ void Aux_Check_Parameter()
 #   endif
 #  endif // MHD
 
+#  ifdef SPLIT_PASSIVE
+#   if ( FLU_SCHEME == RTVD )
+#     error : ERROR : RTVD does NOT support SPLIT_PASSIVE !!
+#   endif
+
+#   ifdef MHD
+#     error : ERROR : MHD does NOT support SPLIT_PASSIVE !!
+#   endif
+
+#   ifdef GPU
+#     error : ERROR : GPU does NOT support SPLIT_PASSIVE !!
+#   endif
+#  endif // #ifdef SPLIT_PASSIVE
+
 #  ifdef DUAL_ENERGY
 #   if ( FLU_SCHEME == RTVD )
 #     error : RTVD does NOT support DUAL_ENERGY !!
@@ -639,8 +683,14 @@ void Aux_Check_Parameter()
 
 #  if ( defined RSOLVER  &&  RSOLVER == EXACT )
 #     warning : WARNING : exact Riemann solver is not recommended since the vacuum solution has not been implemented
+#  endif
+
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+   if ( OPT__RSOLVER == RSOLVER_EXACT )
+   {
       Aux_Message( stderr, "WARNING : exact Riemann solver is not recommended since the vacuum solution " );
       Aux_Message( stderr,           "has not been implemented !!\n" );
+   }
 #  endif
 
 #  if ( defined CHAR_RECONSTRUCTION  &&  defined GRAVITY )
@@ -678,11 +728,32 @@ void Aux_Check_Parameter()
 
 // errors
 // ------------------------------
-#  if ( LR_SCHEME == PPM )
-   if ( OPT__LR_LIMITER == EXTPRE )
+   if ( OPT__LR_SCHEME != LR_SCHEME_PLM  &&  OPT__LR_SCHEME != LR_SCHEME_PPM )
+      Aux_Error( ERROR_INFO, "unsupported parameter \"%s = %d\" !!\n", "OPT__LR_SCHEME", OPT__LR_SCHEME );
+
+#  if ( LR_SCHEME != PPM )
+   if ( OPT__LR_SCHEME == LR_SCHEME_PPM )
+      Aux_Error( ERROR_INFO, "\"%s\" requires \"%s\" in the Makefile !!\n", "OPT__LR_SCHEME = 2", "LR_SCHEME=PPM" );
+#  endif
+
+#  ifdef MHD
+   if ( OPT__RSOLVER != RSOLVER_ROE  &&  OPT__RSOLVER != RSOLVER_HLLE  &&  OPT__RSOLVER != RSOLVER_HLLD )
+      Aux_Error( ERROR_INFO, "unsupported parameter \"%s = %d\" for MHD (ROE/HLLE/HLLD) !!\n", "OPT__RSOLVER", OPT__RSOLVER );
+#  else
+   if ( OPT__RSOLVER != RSOLVER_EXACT  &&  OPT__RSOLVER != RSOLVER_ROE  &&  OPT__RSOLVER != RSOLVER_HLLE  &&
+        OPT__RSOLVER != RSOLVER_HLLC )
+      Aux_Error( ERROR_INFO, "unsupported parameter \"%s = %d\" (EXACT/ROE/HLLE/HLLC) !!\n", "OPT__RSOLVER", OPT__RSOLVER );
+#  endif
+
+#  ifdef GPU
+   if ( OPT__LR_SCHEME != LR_SCHEME  ||  OPT__RSOLVER != RSOLVER )
+      Aux_Error( ERROR_INFO, "GPU fluid solvers only support \"%s\" and \"%s\" consistent with the Makefile !!\n",
+                 "OPT__LR_SCHEME", "OPT__RSOLVER" );
+#  endif
+
+   if ( OPT__LR_SCHEME == LR_SCHEME_PPM  &&  OPT__LR_LIMITER == EXTPRE )
       Aux_Error( ERROR_INFO, "currently the PPM reconstruction does not support the \"%s\" limiter\n",
                  "extrema-preserving" );
-#  endif
 
    if ( OPT__LR_LIMITER != VANLEER  &&  OPT__LR_LIMITER != GMINMOD  &&  OPT__LR_LIMITER != ALBADA  &&
         OPT__LR_LIMITER != EXTPRE   &&  OPT__LR_LIMITER != VL_GMINMOD )
@@ -703,33 +774,35 @@ void Aux_Check_Parameter()
 // ------------------------------
 #  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == CTU )
 
-#  if ( LR_SCHEME == PLM )
-   if ( OPT__LR_LIMITER == EXTPRE  &&  FLU_GHOST_SIZE < 3 )
-      Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
-                 "FLU_GHOST_SIZE = 3", "MHM/CTU scheme + PLM reconstruction + EXTPRE limiter" );
+   if ( OPT__LR_SCHEME == LR_SCHEME_PLM )
+   {
+      if ( OPT__LR_LIMITER == EXTPRE  &&  FLU_GHOST_SIZE < 3 )
+         Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
+                    "FLU_GHOST_SIZE = 3", "MHM/CTU scheme + PLM reconstruction + EXTPRE limiter" );
 
-   if ( OPT__LR_LIMITER == EXTPRE  &&  FLU_GHOST_SIZE > 3  &&  MPI_Rank == 0 )
-      Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
-                   "FLU_GHOST_SIZE = 3", "MHM/CTU scheme + PLM reconstruction + EXTPRE limiter" );
+      if ( OPT__LR_LIMITER == EXTPRE  &&  FLU_GHOST_SIZE > 3  &&  LR_SCHEME == PLM  &&  MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
+                      "FLU_GHOST_SIZE = 3", "MHM/CTU scheme + PLM reconstruction + EXTPRE limiter" );
 
-   if ( OPT__LR_LIMITER != EXTPRE  &&  FLU_GHOST_SIZE < 2 )
-      Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
-                 "FLU_GHOST_SIZE = 2", "MHM/CTU scheme + PLM reconstruction + non-EXTPRE limiter" );
+      if ( OPT__LR_LIMITER != EXTPRE  &&  FLU_GHOST_SIZE < 2 )
+         Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
+                    "FLU_GHOST_SIZE = 2", "MHM/CTU scheme + PLM reconstruction + non-EXTPRE limiter" );
 
-   if ( OPT__LR_LIMITER != EXTPRE  &&  FLU_GHOST_SIZE > 2  &&  MPI_Rank == 0 )
-      Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
-                   "FLU_GHOST_SIZE = 2", "MHM/CTU scheme + PLM reconstruction + non-EXTPRE limiter" );
-#  endif // #if ( LR_SCHEME == PLM )
+      if ( OPT__LR_LIMITER != EXTPRE  &&  FLU_GHOST_SIZE > 2  &&  LR_SCHEME == PLM  &&  MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
+                      "FLU_GHOST_SIZE = 2", "MHM/CTU scheme + PLM reconstruction + non-EXTPRE limiter" );
+   } // if ( OPT__LR_SCHEME == LR_SCHEME_PLM )
 
-#  if ( LR_SCHEME == PPM )
-   if ( FLU_GHOST_SIZE < 3 )
-      Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
-                 "FLU_GHOST_SIZE = 3", "MHM/CTU scheme + PPM reconstruction + non-EXTPRE limiter" );
+   if ( OPT__LR_SCHEME == LR_SCHEME_PPM )
+   {
+      if ( FLU_GHOST_SIZE < 3 )
+         Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
+                    "FLU_GHOST_SIZE = 3", "MHM/CTU scheme + PPM reconstruction + non-EXTPRE limiter" );
 
-   if ( FLU_GHOST_SIZE > 3  &&  MPI_Rank == 0 )
-      Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
-                   "FLU_GHOST_SIZE = 3", "MHM/CTU scheme + PPM reconstruction + non-EXTPRE limiter" );
-#  endif // #if ( LR_SCHEME == PPM )
+      if ( FLU_GHOST_SIZE > 3  &&  MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
+                      "FLU_GHOST_SIZE = 3", "MHM/CTU scheme + PPM reconstruction + non-EXTPRE limiter" );
+   } // if ( OPT__LR_SCHEME == LR_SCHEME_PPM )
 
 #  endif // #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == CTU )
 
@@ -738,33 +811,35 @@ void Aux_Check_Parameter()
 // ------------------------------
 #  if ( FLU_SCHEME == MHM_RP )
 
-#  if ( LR_SCHEME == PLM )
-   if ( OPT__LR_LIMITER == EXTPRE  &&  FLU_GHOST_SIZE < 4 )
-      Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
-                 "FLU_GHOST_SIZE = 4", "MHM_RP scheme + PLM reconstruction + EXTPRE limiter" );
+   if ( OPT__LR_SCHEME == LR_SCHEME_PLM )
+   {
+      if ( OPT__LR_LIMITER == EXTPRE  &&  FLU_GHOST_SIZE < 4 )
+         Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
+                    "FLU_GHOST_SIZE = 4", "MHM_RP scheme + PLM reconstruction + EXTPRE limiter" );
 
-   if ( OPT__LR_LIMITER == EXTPRE  &&  FLU_GHOST_SIZE > 4  &&  MPI_Rank == 0 )
-      Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
-                   "FLU_GHOST_SIZE = 4", "MHM_RP scheme + PLM reconstruction + EXTPRE limiter" );
+      if ( OPT__LR_LIMITER == EXTPRE  &&  FLU_GHOST_SIZE > 4  &&  LR_SCHEME == PLM  &&  MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
+                      "FLU_GHOST_SIZE = 4", "MHM_RP scheme + PLM reconstruction + EXTPRE limiter" );
 
-   if ( OPT__LR_LIMITER != EXTPRE  &&  FLU_GHOST_SIZE < 3 )
-      Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
-                 "FLU_GHOST_SIZE = 3", "MHM_RP scheme + PLM reconstruction + non-EXTPRE limiter" );
+      if ( OPT__LR_LIMITER != EXTPRE  &&  FLU_GHOST_SIZE < 3 )
+         Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
+                    "FLU_GHOST_SIZE = 3", "MHM_RP scheme + PLM reconstruction + non-EXTPRE limiter" );
 
-   if ( OPT__LR_LIMITER != EXTPRE  &&  FLU_GHOST_SIZE > 3  &&  MPI_Rank == 0 )
-      Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
-                   "FLU_GHOST_SIZE = 3", "MHM_RP scheme + PLM reconstruction + non-EXTPRE limiter" );
-#  endif // #if ( LR_SCHEME == PLM )
+      if ( OPT__LR_LIMITER != EXTPRE  &&  FLU_GHOST_SIZE > 3  &&  LR_SCHEME == PLM  &&  MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
+                      "FLU_GHOST_SIZE = 3", "MHM_RP scheme + PLM reconstruction + non-EXTPRE limiter" );
+   } // if ( OPT__LR_SCHEME == LR_SCHEME_PLM )
 
-#  if ( LR_SCHEME == PPM )
-   if ( FLU_GHOST_SIZE < 4 )
-      Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
-                 "FLU_GHOST_SIZE = 4", "MHM_RP scheme + PPM reconstruction + non-EXTPRE limiter" );
+   if ( OPT__LR_SCHEME == LR_SCHEME_PPM )
+   {
+      if ( FLU_GHOST_SIZE < 4 )
+         Aux_Error( ERROR_INFO, "please set \"%s\" for \"%s\" !!\n",
+                    "FLU_GHOST_SIZE = 4", "MHM_RP scheme + PPM reconstruction + non-EXTPRE limiter" );
 
-   if ( FLU_GHOST_SIZE > 4  &&  MPI_Rank == 0 )
-      Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
-                   "FLU_GHOST_SIZE = 4", "MHM_RP scheme + PPM reconstruction + non-EXTPRE limiter" );
-#  endif // #if ( LR_SCHEME == PPM )
+      if ( FLU_GHOST_SIZE > 4  &&  MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : please set \"%s\" in \"%s\" for higher performance !!\n",
+                      "FLU_GHOST_SIZE = 4", "MHM_RP scheme + PPM reconstruction + non-EXTPRE limiter" );
+   } // if ( OPT__LR_SCHEME == LR_SCHEME_PPM )
 
 #  endif // #if ( FLU_SCHEME == MHM_RP )
 
@@ -975,7 +1050,7 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "PATCH_SIZE must == 8 for the GPU Poisson solver !!\n" );
 #  endif // GPU
 
-#  ifndef LOAD_BALANCE
+#  if ( !defined LOAD_BALANCE  &&  SUPPORT_FFTW == FFTW2 )
    if ( NX0_TOT[2]%MPI_NRank != 0 )
    {
       Aux_Message( stderr, "ERROR : NX0_TOT[2] %% MPI_NRank != 0 !!\n" );
@@ -11,6 +11,10 @@
 //                   (1) VmSize : current virtual memory size
 //                   (2) VmRSS  : current resident set size
 //                2. Only the maximum values among all MPI ranks will be recorded
+//                3. Also record the memory pool of patches (i.e., amr->Arena[]) summed over all levels and ranks
+//                   (1) Pool     : memory allocated from the system
+//                   (2) Occupancy: fraction of the pool in use
+//                   (3) Frag     : fraction of the pool free but not releasable since it lies in chunks in use
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -25,7 +29,7 @@ void Aux_GetMemInfo()
    char   FileName_Status[StrSize], Useless[2][StrSize], *line=NULL;
    char   VmSize[StrSize], VmRSS[StrSize];
    bool   GetVmSize=false, GetVmRSS=false;
-   double Vm_double[2], Vm_max[2], Vm_sum[2];
+   double Vm_double[2], Vm_max[2], Vm_sum[2], Pool_double[3], Pool_sum[3];
    size_t len=0;
 
 
@@ -72,8 +76,18 @@ void Aux_GetMemInfo()
    Vm_double[0] = atof( VmSize );
    Vm_double[1] = atof( VmRSS  );
 
-   MPI_Reduce( Vm_double, Vm_max, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
-   MPI_Reduce( Vm_double, Vm_sum, 2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   for (int t=0; t<3; t++)    Pool_double[t] = 0.0;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      Pool_double[0] += (double)amr->Arena[lv]->GetNByte();
+      Pool_double[1] += (double)amr->Arena[lv]->GetNByteUsed();
+      Pool_double[2] += (double)amr->Arena[lv]->GetNByteFrag();
+   }
+
+   MPI_Reduce( Vm_double,   Vm_max,   2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Vm_double,   Vm_sum,   2, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( Pool_double, Pool_sum, 3, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
 
 
 // 3. record memory information
@@ -87,14 +101,19 @@ void Aux_GetMemInfo()
          FirstTime = false;
 
          FILE *File_Record = fopen( FileName_Record, "a" );
-         fprintf( File_Record, "#%13s%14s%s%20s%20s%20s%20s\n", "Time", "Step", " ", "Virtual_Max (MB)",
-                  "Virtual_Sum (MB)", "Resident_Max (MB)", "Resident_Sum (MB)" );
+         fprintf( File_Record, "#%13s%14s%s%20s%20s%20s%20s%20s%20s%20s\n", "Time", "Step", " ", "Virtual_Max (MB)",
+                  "Virtual_Sum (MB)", "Resident_Max (MB)", "Resident_Sum (MB)", "Pool_Sum (MB)",
+                  "Pool_Occupancy (%)", "Pool_Frag (%)" );
          fclose( File_Record );
       }
 
+      const double Occupancy = ( Pool_sum[0] > 0.0 ) ? 100.0*Pool_sum[1]/Pool_sum[0] : 0.0;
+      const double Frag      = ( Pool_sum[0] > 0.0 ) ? 100.0*Pool_sum[2]/Pool_sum[0] : 0.0;
+
       FILE *File_Record = fopen( FileName_Record, "a" );
-      fprintf( File_Record, "%14.7e%14ld%20.2f%20.2f%20.2f%20.2f\n",
-               Time[0], Step, Vm_max[0]/1024.0, Vm_sum[0]/1024.0, Vm_max[1]/1024.0, Vm_sum[1]/1024.0 );
+      fprintf( File_Record, "%14.7e%14ld%20.2f%20.2f%20.2f%20.2f%20.2f%20.2f%20.2f\n",
+               Time[0], Step, Vm_max[0]/1024.0, Vm_sum[0]/1024.0, Vm_max[1]/1024.0, Vm_sum[1]/1024.0,
+               Pool_sum[0]/SQR(1024.0), Occupancy, Frag );
       fclose( File_Record );
 
    } // if ( MPI_Rank == 0 )
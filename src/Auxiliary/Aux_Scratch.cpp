@@ -0,0 +1,203 @@
+#include "GAMER.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  Scratch_t
+// Description :  Scratch buffers owned by one thread
+//
+// Data Member :  Buf    : Buffer of each slot
+//                NByte  : Allocated size of each slot in bytes
+//                NAlloc : Number of (re)allocations of each slot after Aux_Scratch_Init() (recorded in Aux_Record_Timing())
+//                Next   : Next arena in the list of all arenas (for Aux_Scratch_Free() and Aux_Scratch_GetNAlloc())
+//-------------------------------------------------------------------------------------------------------
+struct Scratch_t
+{
+   void      *Buf   [SCRATCH_NSLOT];
+   long       NByte [SCRATCH_NSLOT];
+   long       NAlloc[SCRATCH_NSLOT];
+   Scratch_t *Next;
+};
+
+// Scratch_Arena is thread-private, including the threads of nested parallel regions
+// --> the threads of a nested team and the thread invoking a nested region never share the same arena even
+//     though they may share the same omp_get_thread_num()
+static Scratch_t *Scratch_Arena = NULL;
+#ifdef OPENMP
+#  pragma omp threadprivate( Scratch_Arena )
+#endif
+
+static Scratch_t *Scratch_List = NULL;
+static long       Scratch_InitNByte[SCRATCH_NSLOT];
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Scratch_Init
+// Description :  Allocate the scratch buffers of all OpenMP threads with the sizes required for preparing the
+//                fluid solver input
+//
+// Note        :  1. Invoked by Init_MemAllocate()
+//                2. Buffers still grow on demand in Aux_Scratch_Get()
+//                   --> For example, when preparing more variables or a larger ghost zone, or for the threads
+//                       of nested parallel regions
+//                3. Scratch_t::NAlloc[] only counts the allocations after this function
+//-------------------------------------------------------------------------------------------------------
+void Aux_Scratch_Init()
+{
+
+// interpolation table of the fluid solver
+   int NSide_Useless, CGhost;
+   Int_Table( OPT__FLU_INT_SCHEME, NSide_Useless, CGhost );
+
+   const int  GhostSize_Padded = FLU_GHOST_SIZE + (FLU_GHOST_SIZE&1);
+   const int  CGrid            = GhostSize_Padded/2 + 2*CGhost;
+   const int  CWidth           = PS1 + 2*CGhost;
+   const long NByteVar         = NCOMP_TOTAL*sizeof(real);
+
+   for (int s=0; s<SCRATCH_NSLOT; s++)    Scratch_InitNByte[s] = 0;
+
+// see Prepare_PatchData(), InterpolateGhostZone(), and Int_*() for the array sizes
+   Scratch_InitNByte[SCRATCH_PREP_INTDATA_CC] = NByteVar*PS2*PS2*GhostSize_Padded;
+   Scratch_InitNByte[SCRATCH_INTGZ_CDATA_CC ] = NByteVar*CGrid*CWidth*CWidth;
+   Scratch_InitNByte[SCRATCH_INT_TDATA_X    ] = NByteVar*2*PS1*CWidth*CWidth;
+   Scratch_InitNByte[SCRATCH_INT_TDATA_Y    ] = NByteVar*4*PS1*PS1*CWidth;
+   Scratch_InitNByte[SCRATCH_INT_ROW        ] = sizeof(real)*2*PS1;
+#  ifdef MHD
+   Scratch_InitNByte[SCRATCH_PREP_INTDATA_FC] = NCOMP_MAG*sizeof(real)*PS2*PS2*(GhostSize_Padded+1);
+   Scratch_InitNByte[SCRATCH_PREP_FINTERFACE] = sizeof(real)*( SQR(PS2) + 4*PS2*GhostSize_Padded );
+   Scratch_InitNByte[SCRATCH_INTGZ_CDATA_FC ] = NCOMP_MAG*sizeof(real)*(CGrid+1)*(CWidth+1)*CWidth;
+#  endif
+
+#  pragma omp parallel
+   {
+      for (int s=0; s<SCRATCH_NSLOT; s++)    Aux_Scratch_Get( s, Scratch_InitNByte[s] );
+   }
+
+   long NAlloc_Useless[SCRATCH_NSLOT];
+
+   Aux_Scratch_GetNAlloc( NAlloc_Useless, true );
+
+} // FUNCTION : Aux_Scratch_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Scratch_Get
+// Description :  Return the scratch buffer of the target slot owned by the calling thread
+//
+// Note        :  1. Reallocate the buffer if it has fewer than "NByte" bytes
+//                   --> Previous contents are NOT preserved
+//                2. The returned buffer remains valid until the next call with the same slot by the same thread
+//                   --> Functions which may be invoked while a slot is in use must use different slots
+//                       (see ScratchSlot_t in Typedef.h)
+//                3. Thread-safe
+//
+// Parameter   :  Slot  : Target slot (SCRATCH_*)
+//                NByte : Minimum buffer size in bytes
+//
+// Return      :  Pointer to the buffer (NULL if NByte == 0 and the slot has never been allocated)
+//-------------------------------------------------------------------------------------------------------
+void* Aux_Scratch_Get( const ScratchSlot_t Slot, const long NByte )
+{
+
+#  ifdef GAMER_DEBUG
+   if ( Slot < 0  ||  Slot >= SCRATCH_NSLOT )   Aux_Error( ERROR_INFO, "incorrect Slot = %d !!\n", Slot );
+   if ( NByte < 0 )                               Aux_Error( ERROR_INFO, "NByte (%ld) < 0 !!\n", NByte );
+#  endif
+
+// allocate the arena of this thread on its first call
+   if ( Scratch_Arena == NULL )
+   {
+      Scratch_Arena = new Scratch_t;
+
+      for (int s=0; s<SCRATCH_NSLOT; s++)
+      {
+         Scratch_Arena->Buf   [s] = NULL;
+         Scratch_Arena->NByte [s] = 0;
+         Scratch_Arena->NAlloc[s] = 0;
+      }
+
+#     pragma omp critical( Aux_Scratch )
+      {
+         Scratch_Arena->Next = Scratch_List;
+         Scratch_List        = Scratch_Arena;
+      }
+   }
+
+   if ( NByte > Scratch_Arena->NByte[Slot] )
+   {
+      const long NByte_New = MAX( NByte, Scratch_InitNByte[Slot] );
+
+      free( Scratch_Arena->Buf[Slot] );
+
+      Scratch_Arena->Buf  [Slot] = malloc( NByte_New );
+      Scratch_Arena->NByte[Slot] = NByte_New;
+
+      if ( Scratch_Arena->Buf[Slot] == NULL )
+         Aux_Error( ERROR_INFO, "failed to allocate %ld bytes for scratch slot %d !!\n", NByte_New, Slot );
+
+//    count the allocations in the arena of this thread to avoid a data race between threads
+      Scratch_Arena->NAlloc[Slot] ++;
+   }
+
+   return Scratch_Arena->Buf[Slot];
+
+} // FUNCTION : Aux_Scratch_Get
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Scratch_GetNAlloc
+// Description :  Get the number of (re)allocations of each slot summed over the arenas of all threads
+//
+// Note        :  1. Invoked by Aux_Scratch_Init() and Aux_Record_Timing()
+//                2. Must be invoked outside OpenMP parallel regions since it accesses the arenas of other threads
+//
+// Parameter   :  NAlloc : Array to store the number of allocations of each slot
+//                Reset  : Reset the counters of all arenas to zero
+//
+// Return      :  NAlloc[]
+//-------------------------------------------------------------------------------------------------------
+void Aux_Scratch_GetNAlloc( long NAlloc[], const bool Reset )
+{
+
+   for (int s=0; s<SCRATCH_NSLOT; s++)    NAlloc[s] = 0;
+
+   for (Scratch_t *Arena=Scratch_List; Arena!=NULL; Arena=Arena->Next)
+   for (int s=0; s<SCRATCH_NSLOT; s++)
+   {
+      NAlloc[s] += Arena->NAlloc[s];
+
+      if ( Reset )   Arena->NAlloc[s] = 0;
+   }
+
+} // FUNCTION : Aux_Scratch_GetNAlloc
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Scratch_Free
+// Description :  Free the scratch buffers of all threads
+//
+// Note        :  1. Invoked by End_MemFree()
+//                2. Aux_Scratch_Get() must not be called afterwards
+//-------------------------------------------------------------------------------------------------------
+void Aux_Scratch_Free()
+{
+
+   while ( Scratch_List != NULL )
+   {
+      Scratch_t *Next = Scratch_List->Next;
+
+      for (int s=0; s<SCRATCH_NSLOT; s++)    free( Scratch_List->Buf[s] );
+
+      delete Scratch_List;
+      Scratch_List = Next;
+   }
+
+   Scratch_Arena = NULL;
+
+} // FUNCTION : Aux_Scratch_Free
@@ -77,6 +77,14 @@ void Aux_TakeNote()
       fprintf( Note, "POT_SCHEME                      UNKNOWN\n" );
 #     endif
 
+#     if   ( SUPPORT_FFTW == FFTW2 )
+      fprintf( Note, "SUPPORT_FFTW                    FFTW2\n" );
+#     elif ( SUPPORT_FFTW == FFTW3 )
+      fprintf( Note, "SUPPORT_FFTW                    FFTW3\n" );
+#     else
+      fprintf( Note, "SUPPORT_FFTW                    UNKNOWN\n" );
+#     endif
+
 #     ifdef STORE_POT_GHOST
       fprintf( Note, "STORE_POT_GHOST                 ON\n" );
 #     else
@@ -161,6 +169,12 @@ void Aux_TakeNote()
       fprintf( Note, "DUAL_ENERGY                     UNKNOWN\n" );
 #     endif
 
+#     ifdef SPLIT_PASSIVE
+      fprintf( Note, "SPLIT_PASSIVE                   ON\n" );
+#     else
+      fprintf( Note, "SPLIT_PASSIVE                   OFF\n" );
+#     endif
+
 #     ifdef MHD
       fprintf( Note, "MHD                             ON\n" );
 #     else
@@ -251,6 +265,12 @@ void Aux_TakeNote()
       fprintf( Note, "FLOAT8                          OFF\n" );
 #     endif
 
+#     ifdef MIXED_PRECISION
+      fprintf( Note, "MIXED_PRECISION                 ON\n" );
+#     else
+      fprintf( Note, "MIXED_PRECISION                 OFF\n" );
+#     endif
+
 #     ifdef SERIAL
       fprintf( Note, "SERIAL                          ON\n" );
 #     else
@@ -476,7 +496,6 @@ void Aux_TakeNote()
       fprintf( Note, "#define NCOMP_ELE               %d\n",      NCOMP_ELE           );
 #     endif
       fprintf( Note, "#define PATCH_SIZE              %d\n",      PATCH_SIZE          );
-      fprintf( Note, "#define MAX_PATCH               %d\n",      MAX_PATCH           );
       fprintf( Note, "#define NLEVEL                  %d\n",      NLEVEL              );
       fprintf( Note, "\n" );
       fprintf( Note, "#define FLU_GHOST_SIZE          %d\n",      FLU_GHOST_SIZE      );
@@ -692,9 +711,11 @@ void Aux_TakeNote()
       fprintf( Note, "DT__SYNC_CHILDREN_LV            %13.7e\n",  DT__SYNC_CHILDREN_LV      );
       fprintf( Note, "OPT__DT_USER                    %d\n",      OPT__DT_USER              );
       fprintf( Note, "OPT__DT_LEVEL                   %d\n",      OPT__DT_LEVEL             );
+      fprintf( Note, "OPT__DT_CFL_CACHE               %d\n",      OPT__DT_CFL_CACHE         );
       fprintf( Note, "AUTO_REDUCE_DT                  %d\n",      AUTO_REDUCE_DT            );
       fprintf( Note, "AUTO_REDUCE_DT_FACTOR           %13.7e\n",  AUTO_REDUCE_DT_FACTOR     );
       fprintf( Note, "AUTO_REDUCE_DT_FACTOR_MIN       %13.7e\n",  AUTO_REDUCE_DT_FACTOR_MIN );
+      fprintf( Note, "AUTO_REDUCE_DT_LOCAL            %d\n",      AUTO_REDUCE_DT_LOCAL      );
       fprintf( Note, "OPT__RECORD_DT                  %d\n",      OPT__RECORD_DT            );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
@@ -746,6 +767,10 @@ void Aux_TakeNote()
 #     endif
       fprintf( Note, "OPT__REUSE_MEMORY               %d\n",      OPT__REUSE_MEMORY         );
       fprintf( Note, "OPT__MEMORY_POOL                %d\n",      OPT__MEMORY_POOL          );
+      if ( OPT__MEMORY_POOL ) {
+      fprintf( Note, "MEMORY_POOL_WINDOW              %d\n",      MEMORY_POOL_WINDOW        );
+      fprintf( Note, "MEMORY_POOL_SHRINK              %13.7e\n",  MEMORY_POOL_SHRINK        ); }
+      fprintf( Note, "OPT__FIELD_BANK                 %d\n",      OPT__FIELD_BANK           );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
 
@@ -764,7 +789,10 @@ void Aux_TakeNote()
 #     ifdef PARTICLE
       fprintf( Note, "LB_PAR_WEIGHT                   %13.7e\n",  amr->LB->Par_Weight       );
 #     endif
+      fprintf( Note, "LB_MEASURED_COST                %d\n",      amr->LB->MeasuredCost     );
+      fprintf( Note, "LB_INCREMENTAL                  %d\n",      amr->LB->Incremental      );
       fprintf( Note, "OPT__RECORD_LOAD_BALANCE        %d\n",      OPT__RECORD_LOAD_BALANCE  );
+      fprintf( Note, "OPT__LB_CUT_BENCHMARK           %d\n",      OPT__LB_CUT_BENCHMARK     );
 #     endif // #ifdef LOAD_BALANCE
       fprintf( Note, "OPT__MINIMIZE_MPI_BARRIER       %d\n",      OPT__MINIMIZE_MPI_BARRIER );
       fprintf( Note, "***********************************************************************************\n" );
@@ -830,6 +858,17 @@ void Aux_TakeNote()
                                                                   ( OPT__LR_LIMITER == EXTPRE            ) ? "EXTPRE"     :
                                                                   ( OPT__LR_LIMITER == LR_LIMITER_NONE   ) ? "NONE"       :
                                                                                                              "UNKNOWN" );
+      fprintf( Note, "OPT__LR_SCHEME                  %s\n",      ( OPT__LR_SCHEME == LR_SCHEME_PLM  ) ? "PLM"  :
+                                                                  ( OPT__LR_SCHEME == LR_SCHEME_PPM  ) ? "PPM"  :
+                                                                  ( OPT__LR_SCHEME == LR_SCHEME_NONE ) ? "NONE" :
+                                                                                                         "UNKNOWN" );
+      fprintf( Note, "OPT__RSOLVER                    %s\n",      ( OPT__RSOLVER == RSOLVER_EXACT ) ? "EXACT" :
+                                                                  ( OPT__RSOLVER == RSOLVER_ROE   ) ? "ROE"   :
+                                                                  ( OPT__RSOLVER == RSOLVER_HLLE  ) ? "HLLE"  :
+                                                                  ( OPT__RSOLVER == RSOLVER_HLLC  ) ? "HLLC"  :
+                                                                  ( OPT__RSOLVER == RSOLVER_HLLD  ) ? "HLLD"  :
+                                                                  ( OPT__RSOLVER == RSOLVER_NONE  ) ? "NONE"  :
+                                                                                                      "UNKNOWN" );
       fprintf( Note, "OPT__1ST_FLUX_CORR              %s\n",      ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D   ) ? "3D"   :
                                                                   ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_3D1D ) ? "3D1D" :
                                                                   ( OPT__1ST_FLUX_CORR == FIRST_FLUX_CORR_NONE ) ? "NONE" :
@@ -899,6 +938,14 @@ void Aux_TakeNote()
       fprintf( Note, "\n" ); }
 
       fprintf( Note, "OPT__OVERLAP_MPI                %d\n",      OPT__OVERLAP_MPI         );
+      fprintf( Note, "OPT__CPU_PIPELINE               %d\n",      OPT__CPU_PIPELINE        );
+      if ( OPT__CPU_PIPELINE )
+      fprintf( Note, "CPU_PIPELINE_NTHREAD            %d\n",      CPU_PIPELINE_NTHREAD     );
+      fprintf( Note, "OPT__TASK_GRAPH                 %d\n",      OPT__TASK_GRAPH          );
+      fprintf( Note, "OPT__FLU_FUSED                  %d\n",      OPT__FLU_FUSED           );
+      if ( OPT__FLU_FUSED )
+      fprintf( Note, "FLU_FUSED_SLAB                  %d\n",      FLU_FUSED_SLAB           );
+      fprintf( Note, "OPT__FLU_CLUSTER                %d\n",      OPT__FLU_CLUSTER         );
       fprintf( Note, "OPT__RESET_FLUID                %d\n",      OPT__RESET_FLUID         );
 #     if ( MODEL == HYDRO  ||  MODEL == ELBDM )
       fprintf( Note, "MIN_DENS                        %13.7e\n",  MIN_DENS                 );
@@ -988,6 +1035,7 @@ void Aux_TakeNote()
       fprintf( Note, "Parameters of Interpolation Schemes\n" );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "OPT__INT_TIME                   %d\n",      OPT__INT_TIME           );
+      fprintf( Note, "OPT__GHOST_CACHE                %d\n",      OPT__GHOST_CACHE        );
 #     if ( MODEL == ELBDM )
       fprintf( Note, "OPT__INT_PHASE                  %d\n",      OPT__INT_PHASE          );
 #     endif
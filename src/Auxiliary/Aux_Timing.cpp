@@ -6,6 +6,8 @@ void Timing__EvolveLevel( const char FileName[], const double Time_LB_Main[][3]
 #ifdef TIMING_SOLVER
 void Timing__Solver( const char FileName[] );
 #endif
+void Timing__GhostCache( const char FileName[] );
+void Timing__Scratch( const char FileName[] );
 
 
 // global timing variables
@@ -28,6 +30,9 @@ extern Timer_t *Timer_Par_2Son   [NLEVEL];
 extern Timer_t *Timer_Par_Collect[NLEVEL];
 extern Timer_t *Timer_Par_MPI    [NLEVEL][6];
 
+extern long GhostCache_NHit [NLEVEL];
+extern long GhostCache_NMiss[NLEVEL];
+
 #ifdef TIMING_SOLVER
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
@@ -36,6 +41,9 @@ extern Timer_t *Timer_Poi_PreRho  [NLEVEL];
 extern Timer_t *Timer_Poi_PreFlu  [NLEVEL];
 extern Timer_t *Timer_Poi_PrePot_C[NLEVEL];
 extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
+extern Timer_t *Timer_Pipe_Wall   [NLEVEL][NSOLVER];
+extern Timer_t *Timer_Pipe_Sol    [NLEVEL][NSOLVER];
+extern Timer_t *Timer_Pipe_Host   [NLEVEL][NSOLVER];
 #endif
 
 // accumulated timing results
@@ -98,6 +106,10 @@ void Aux_CreateTimer()
          Timer_Pre[lv][v]    = new Timer_t;
          Timer_Sol[lv][v]    = new Timer_t;
          Timer_Clo[lv][v]    = new Timer_t;
+
+         Timer_Pipe_Wall[lv][v] = new Timer_t;
+         Timer_Pipe_Sol [lv][v] = new Timer_t;
+         Timer_Pipe_Host[lv][v] = new Timer_t;
       }
       Timer_Poi_PreRho  [lv] = new Timer_t;
       Timer_Poi_PreFlu  [lv] = new Timer_t;
@@ -149,6 +161,10 @@ void Aux_DeleteTimer()
          delete Timer_Pre      [lv][v];
          delete Timer_Sol      [lv][v];
          delete Timer_Clo      [lv][v];
+
+         delete Timer_Pipe_Wall[lv][v];
+         delete Timer_Pipe_Sol [lv][v];
+         delete Timer_Pipe_Host[lv][v];
       }
       delete Timer_Poi_PreRho  [lv];
       delete Timer_Poi_PreFlu  [lv];
@@ -194,6 +210,10 @@ void Aux_ResetTimer()
          Timer_Pre      [lv][v]->Reset();
          Timer_Sol      [lv][v]->Reset();
          Timer_Clo      [lv][v]->Reset();
+
+         Timer_Pipe_Wall[lv][v]->Reset();
+         Timer_Pipe_Sol [lv][v]->Reset();
+         Timer_Pipe_Host[lv][v]->Reset();
       }
       Timer_Poi_PreRho  [lv]->Reset();
       Timer_Poi_PreFlu  [lv]->Reset();
@@ -355,6 +375,14 @@ void Aux_Record_Timing()
 #  endif
 
 
+// 4. ghost-zone cache
+   if ( OPT__GHOST_CACHE )    Timing__GhostCache( FileName );
+
+
+// 5. scratch-buffer allocations
+   Timing__Scratch( FileName );
+
+
    if ( MPI_Rank == 0 )
    {
       FILE *File = fopen( FileName, "a" );
@@ -924,11 +952,204 @@ void Timing__Solver( const char FileName[] )
       fclose( File );
    } // if ( MPI_Rank == 0 )
 
+
+// timing results of the pipelined CPU solvers
+// --> Wall : elapsed time of the overlapped stages
+//     Sol  : time spent in the solvers         during the overlapped stages
+//     Host : time spent in the preparation and closing steps during the overlapped stages
+// --> the non-overlapped stages (i.e., the first preparation and the last closing steps) are still recorded
+//     in Timer_Pre/Sol/Clo
+   if ( OPT__CPU_PIPELINE )
+   {
+      const int NPipeSolver = 5;
+      const char PipeLabel[NPipeSolver][6] = { "Flu", "Gra", "Che", "dtFlu", "dtGra" };
+
+      double PipeWall_loc[NLEVEL][NSOLVER], PipeSol_loc[NLEVEL][NSOLVER], PipeHost_loc[NLEVEL][NSOLVER];
+      double PipeWall_max[NLEVEL][NSOLVER], PipeSol_max[NLEVEL][NSOLVER], PipeHost_max[NLEVEL][NSOLVER];
+      double Pipe_out[NLEVEL+1][NPipeSolver][3];
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      for (int v=0; v<NSOLVER; v++)
+      {
+         PipeWall_loc[lv][v] = Timer_Pipe_Wall[lv][v]->GetValue();
+         PipeSol_loc [lv][v] = Timer_Pipe_Sol [lv][v]->GetValue();
+         PipeHost_loc[lv][v] = Timer_Pipe_Host[lv][v]->GetValue();
+      }
+
+      MPI_Reduce( PipeWall_loc[0], PipeWall_max[0], NLEVEL*NSOLVER, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+      MPI_Reduce( PipeSol_loc [0], PipeSol_max [0], NLEVEL*NSOLVER, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+      MPI_Reduce( PipeHost_loc[0], PipeHost_max[0], NLEVEL*NSOLVER, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+
+
+      if ( MPI_Rank == 0 )
+      {
+//       combine GRAVITY_SOLVER and POISSON_AND_GRAVITY_SOLVER solvers as Timing__Solver does above
+         for (int t=0; t<3; t++)
+         {
+            const double (*Pipe_max)[NSOLVER] = ( t == 0 ) ? PipeWall_max : ( t == 1 ) ? PipeSol_max : PipeHost_max;
+
+            for (int s=0; s<NPipeSolver; s++)   Pipe_out[NLEVEL][s][t] = 0.0;
+
+            for (int lv=0; lv<NLEVEL; lv++)
+            {
+               Pipe_out[lv][0][t] = Pipe_max[lv][0];
+               Pipe_out[lv][1][t] = Pipe_max[lv][2] + Pipe_max[lv][3];
+               Pipe_out[lv][2][t] = Pipe_max[lv][4];
+               Pipe_out[lv][3][t] = Pipe_max[lv][5];
+               Pipe_out[lv][4][t] = Pipe_max[lv][6];
+
+               for (int s=0; s<NPipeSolver; s++)   Pipe_out[NLEVEL][s][t] += Pipe_out[lv][s][t];
+            }
+         }
+
+         FILE *File = fopen( FileName, "a" );
+
+         fprintf( File, "\nPipelined CPU solvers (Wall: overlapped stages, Sol: solvers, Host: preparation+closing)\n" );
+         fprintf( File, "---------------------------------------------------------------------------------------" );
+         fprintf( File, "---------------------------------------\n" );
+
+         fprintf( File, "%3s", "Lv" );
+         for (int s=0; s<NPipeSolver; s++)
+         {
+            char Label[3][16];
+            sprintf( Label[0], "%s_Wall", PipeLabel[s] );
+            sprintf( Label[1], "%s_Sol",  PipeLabel[s] );
+            sprintf( Label[2], "%s_Host", PipeLabel[s] );
+            fprintf( File, "%11s%11s%11s", Label[0], Label[1], Label[2] );
+         }
+         fprintf( File, "\n" );
+
+         for (int lv=0; lv<=NLEVEL; lv++)
+         {
+            if ( lv == NLEVEL )  fprintf( File, "%3s", "Sum" );
+            else                 fprintf( File, "%3d", lv );
+
+            for (int s=0; s<NPipeSolver; s++)
+               fprintf( File, "%11.4f%11.4f%11.4f", Pipe_out[lv][s][0], Pipe_out[lv][s][1], Pipe_out[lv][s][2] );
+
+            fprintf( File, "\n" );
+         }
+
+         fprintf( File, "\n" );
+
+         fclose( File );
+      } // if ( MPI_Rank == 0 )
+   } // if ( OPT__CPU_PIPELINE )
+
 } // FUNCTION : TimingSolver
 #endif // TIMING_SOLVER
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Timing__GhostCache
+// Description :  Record the hit rate of the coarse-fine ghost-zone cache for OPT__GHOST_CACHE
+//
+// Note        :  1. Sum over all ranks
+//                2. Counters are reset after recording
+//-------------------------------------------------------------------------------------------------------
+void Timing__GhostCache( const char FileName[] )
+{
+
+   long NHit_sum[NLEVEL], NMiss_sum[NLEVEL];
+
+   MPI_Reduce( GhostCache_NHit,  NHit_sum,  NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( GhostCache_NMiss, NMiss_sum, NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      long NHit_all = 0, NMiss_all = 0;
+
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "\nGhost-zone cache (coarse-fine interpolations)\n" );
+      fprintf( File, "---------------------------------------------------------------------------------------" );
+      fprintf( File, "---------------------------------------\n" );
+      fprintf( File, "%3s%14s%14s%10s\n", "Lv", "Hit", "Miss", "HitRate" );
+
+      for (int lv=0; lv<=NLEVEL; lv++)
+      {
+         const long NHit  = ( lv == NLEVEL ) ? NHit_all  : NHit_sum [lv];
+         const long NMiss = ( lv == NLEVEL ) ? NMiss_all : NMiss_sum[lv];
+         const long NTot  = NHit + NMiss;
+
+         if ( lv == NLEVEL )  fprintf( File, "%3s", "Sum" );
+         else                 fprintf( File, "%3d", lv );
+
+         fprintf( File, "%14ld%14ld%9.3f%%\n", NHit, NMiss, ( NTot > 0 ) ? 100.0*NHit/NTot : 0.0 );
+
+         if ( lv < NLEVEL )
+         {
+            NHit_all  += NHit;
+            NMiss_all += NMiss;
+         }
+      }
+
+      fprintf( File, "\n" );
+
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      GhostCache_NHit [lv] = 0;
+      GhostCache_NMiss[lv] = 0;
+   }
+
+} // FUNCTION : Timing__GhostCache
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Timing__Scratch
+// Description :  Record the number of heap allocations of the thread-private scratch buffers returned by
+//                Aux_Scratch_Get()
+//
+// Note        :  1. Sum over all ranks
+//                2. Counters are reset after recording
+//                3. Nonzero counts after the first few steps indicate that the buffers are still growing
+//                   (e.g., new variables or ghost-zone sizes being prepared)
+//-------------------------------------------------------------------------------------------------------
+void Timing__Scratch( const char FileName[] )
+{
+
+   const char SlotName[SCRATCH_NSLOT][MAX_STRING] = { "Prep_Data1PG_CC", "Prep_Data1PG_FC", "Prep_IntData_CC",
+                                                      "Prep_IntData_FC", "Prep_FInterface", "Prep_ParMass",
+                                                      "IntGZ_CData_CC", "IntGZ_CData_FC", "Int_TDataX", "Int_TDataY",
+                                                      "Int_Row" };
+
+   long NAlloc[SCRATCH_NSLOT], NAlloc_sum[SCRATCH_NSLOT];
+
+   Aux_Scratch_GetNAlloc( NAlloc, true );
+
+   MPI_Reduce( NAlloc, NAlloc_sum, SCRATCH_NSLOT, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      long NAlloc_all = 0;
+
+      FILE *File = fopen( FileName, "a" );
+
+      fprintf( File, "\nScratch-buffer allocations (Prepare_PatchData, InterpolateGhostZone, and interpolation)\n" );
+      fprintf( File, "---------------------------------------------------------------------------------------" );
+      fprintf( File, "---------------------------------------\n" );
+
+      for (int s=0; s<SCRATCH_NSLOT; s++)
+      {
+         fprintf( File, "%-16s%14ld\n", SlotName[s], NAlloc_sum[s] );
+         NAlloc_all += NAlloc_sum[s];
+      }
+
+      fprintf( File, "%-16s%14ld\n", "Sum", NAlloc_all );
+      fprintf( File, "\n" );
+
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+} // FUNCTION : Timing__Scratch
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Aux_AccumulatedTiming
 // Description :  Record the accumulated timing results (in second)
@@ -0,0 +1,373 @@
+#include "Benchmark.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+// scratch arrays of the CPU fluid solvers, which are declared as extern in CPU_FluidSolver()
+// --> defined in Main.cpp and allocated by Init_MemAllocate_Fluid() in GAMER
+#if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+real (*h_PriVar)      [NCOMP_LR][ CUBE(FLU_NXT)     ]  = NULL;
+real (*h_Slope_PPM)[3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ]  = NULL;
+real (*h_FC_Var)   [6][NCOMP_LR][ CUBE(N_FC_VAR)    ]  = NULL;
+real (*h_FC_Flux)  [3][NCOMP_LR][ CUBE(N_FC_FLUX)   ]  = NULL;
+#ifdef MHD
+real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ]        = NULL;
+real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ]        = NULL;
+#endif
+#endif // FLU_SCHEME
+
+
+// input and output arrays of the benchmark
+// --> Flu_In0/Mag_In0 store the pristine inputs, which are copied to Flu_In/Mag_In before each solver call since
+//     the fluid solvers may overwrite the input arrays
+static real (*Flu_In0 )[FLU_NIN ][ CUBE(FLU_NXT) ]               = NULL;
+static real (*Flu_In  )[FLU_NIN ][ CUBE(FLU_NXT) ]               = NULL;
+static real (*Flu_Out )[FLU_NOUT][ CUBE(PS2) ]                   = NULL;
+static real (*Mag_In0 )[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ]    = NULL;
+static real (*Mag_In  )[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ]    = NULL;
+static real (*Mag_Out )[NCOMP_MAG][ PS2P1*SQR(PS2) ]             = NULL;
+static char (*DE_Out  )[ CUBE(PS2) ]                             = NULL;
+static real (*Flux    )[9][NFLUX_TOTAL][ SQR(PS2) ]              = NULL;
+static real (*Ele     )[9][NCOMP_ELE][ PS2P1*PS2 ]               = NULL;
+static double (*Corner)[3]                                       = NULL;
+
+// parameters of the fluid solver
+static const real   Gamma            = 5.0/3.0;
+static const real   MinMod_Coeff     = 1.5;
+static const real   DualEnergySwitch = 2.0e-2;
+static const real   Safety           = 0.4;
+static const real   dh               = 1.0/PS2;
+static       real   dt               = NULL_REAL;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Fluid_Allocate / Bench_Fluid_Free
+// Description :  Allocate/free the arrays of the fluid solver benchmark
+//
+// Note        :  1. Scratch arrays of the CPU solvers are indexed by the OpenMP thread ID
+//                   --> Allocate at least MaxNThread of them
+//
+// Parameter   :  MaxNPG     : Maximum number of patch groups per solver call
+//                MaxNThread : Maximum number of OpenMP threads
+//-------------------------------------------------------------------------------------------------------
+void Bench_Fluid_Allocate( const int MaxNPG, const int MaxNThread )
+{
+
+   Flu_In0 = new real [MaxNPG][FLU_NIN ][ CUBE(FLU_NXT) ];
+   Flu_In  = new real [MaxNPG][FLU_NIN ][ CUBE(FLU_NXT) ];
+   Flu_Out = new real [MaxNPG][FLU_NOUT][ CUBE(PS2) ];
+   DE_Out  = new char [MaxNPG][ CUBE(PS2) ];
+   Flux    = new real [MaxNPG][9][NFLUX_TOTAL][ SQR(PS2) ];
+   Corner  = new double [MaxNPG][3];
+#  ifdef MHD
+   Mag_In0 = new real [MaxNPG][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
+   Mag_In  = new real [MaxNPG][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
+   Mag_Out = new real [MaxNPG][NCOMP_MAG][ PS2P1*SQR(PS2) ];
+   Ele     = new real [MaxNPG][9][NCOMP_ELE][ PS2P1*PS2 ];
+#  endif
+
+   for (int PG=0; PG<MaxNPG; PG++)
+   for (int d=0; d<3; d++)    Corner[PG][d] = 0.0;
+
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+   const int NSlot = MAX( MaxNPG, MaxNThread );
+
+   h_FC_Var      = new real [NSlot][6][NCOMP_LR][ CUBE(N_FC_VAR)    ];
+   h_FC_Flux     = new real [NSlot][3][NCOMP_LR][ CUBE(N_FC_FLUX)   ];
+   h_PriVar      = new real [NSlot]   [NCOMP_LR][ CUBE(FLU_NXT)     ];
+#  if ( LR_SCHEME == PPM )
+   h_Slope_PPM   = new real [NSlot][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ];
+#  endif
+#  ifdef MHD
+   h_FC_Mag_Half = new real [NSlot][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
+   h_EC_Ele      = new real [NSlot][NCOMP_MAG][ CUBE(N_EC_ELE)          ];
+#  endif
+#  endif // FLU_SCHEME
+
+} // FUNCTION : Bench_Fluid_Allocate
+
+
+
+void Bench_Fluid_Free()
+{
+
+   delete [] Flu_In0;   Flu_In0 = NULL;
+   delete [] Flu_In;    Flu_In  = NULL;
+   delete [] Flu_Out;   Flu_Out = NULL;
+   delete [] DE_Out;    DE_Out  = NULL;
+   delete [] Flux;      Flux    = NULL;
+   delete [] Corner;    Corner  = NULL;
+   delete [] Mag_In0;   Mag_In0 = NULL;
+   delete [] Mag_In;    Mag_In  = NULL;
+   delete [] Mag_Out;   Mag_Out = NULL;
+   delete [] Ele;       Ele     = NULL;
+
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+   delete [] h_FC_Var;        h_FC_Var      = NULL;
+   delete [] h_FC_Flux;       h_FC_Flux     = NULL;
+   delete [] h_PriVar;        h_PriVar      = NULL;
+   delete [] h_Slope_PPM;     h_Slope_PPM   = NULL;
+#  ifdef MHD
+   delete [] h_FC_Mag_Half;   h_FC_Mag_Half = NULL;
+   delete [] h_EC_Ele;        h_EC_Ele      = NULL;
+#  endif
+#  endif
+
+} // FUNCTION : Bench_Fluid_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Fluid_SetInput
+// Description :  Fill the input arrays of the fluid solver with the target synthetic input
+//
+// Note        :  1. Also set the time-step from the CFL condition of the first BENCH_REF_NPG patch groups
+//                   --> Independent of NPG so that the reference outputs do not depend on the sweep lists
+//                2. Passive scalars are set to a fraction of the density varying among components
+//
+// Parameter   :  Input : Target synthetic input
+//                NPG   : Number of patch groups
+//-------------------------------------------------------------------------------------------------------
+void Bench_Fluid_SetInput( const BenchInput_t Input, const int NPG )
+{
+
+   const real Gamma_m1 = Gamma - (real)1.0;
+   double MaxSpeed = 0.0;
+
+   for (int PG=0; PG<NPG; PG++)
+   {
+//    1. magnetic field
+#     ifdef MHD
+      for (int v=0; v<NCOMP_MAG; v++)
+      {
+         const int Nx = ( v == MAGX ) ? FLU_NXT_P1 : FLU_NXT;
+         const int Ny = ( v == MAGY ) ? FLU_NXT_P1 : FLU_NXT;
+         const int Nz = ( v == MAGZ ) ? FLU_NXT_P1 : FLU_NXT;
+
+         for (int k=0; k<Nz; k++)   {  const double z = ( k - FLU_GHOST_SIZE + ( v == MAGZ ? 0.0 : 0.5 ) )*dh;
+         for (int j=0; j<Ny; j++)   {  const double y = ( j - FLU_GHOST_SIZE + ( v == MAGY ? 0.0 : 0.5 ) )*dh;
+         for (int i=0; i<Nx; i++)   {  const double x = ( i - FLU_GHOST_SIZE + ( v == MAGX ? 0.0 : 0.5 ) )*dh;
+
+            double B[NCOMP_MAG];
+            Bench_GetMag( Input, PG, x, y, z, B );
+
+            Mag_In0[PG][v][ IDX321(i,j,k,Nx,Ny) ] = B[v];
+         }}}
+      }
+#     endif // #ifdef MHD
+
+
+//    2. fluid
+      for (int k=0; k<FLU_NXT; k++)    {  const double z = ( k - FLU_GHOST_SIZE + 0.5 )*dh;
+      for (int j=0; j<FLU_NXT; j++)    {  const double y = ( j - FLU_GHOST_SIZE + 0.5 )*dh;
+      for (int i=0; i<FLU_NXT; i++)    {  const double x = ( i - FLU_GHOST_SIZE + 0.5 )*dh;
+
+         const int idx = IDX321( i, j, k, FLU_NXT, FLU_NXT );
+         double Dens, Vel[3], Pres, EngyB=0.0, Cs2;
+
+         Bench_GetFluid( Input, PG, x, y, z, Dens, Vel, Pres );
+
+#        ifdef MHD
+         EngyB = MHD_GetCellCenteredBEnergy( Mag_In0[PG][MAGX], Mag_In0[PG][MAGY], Mag_In0[PG][MAGZ],
+                                             FLU_NXT, FLU_NXT, FLU_NXT, i, j, k );
+#        endif
+
+         Flu_In0[PG][DENS][idx] = Dens;
+         Flu_In0[PG][MOMX][idx] = Dens*Vel[0];
+         Flu_In0[PG][MOMY][idx] = Dens*Vel[1];
+         Flu_In0[PG][MOMZ][idx] = Dens*Vel[2];
+         Flu_In0[PG][ENGY][idx] = Pres/Gamma_m1 + 0.5*Dens*( SQR(Vel[0]) + SQR(Vel[1]) + SQR(Vel[2]) ) + EngyB;
+
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+            Flu_In0[PG][v][idx] = Dens*( 0.5 + 0.4*sin( 2.0*M_PI*(x+0.1*v) ) );
+
+#        ifdef DUAL_ENERGY
+         Flu_In0[PG][ENPY][idx] = Hydro_Fluid2Entropy( Flu_In0[PG][DENS][idx], Flu_In0[PG][MOMX][idx],
+                                                       Flu_In0[PG][MOMY][idx], Flu_In0[PG][MOMZ][idx],
+                                                       Flu_In0[PG][ENGY][idx], Gamma_m1, EngyB );
+#        endif
+
+//       fast magnetosonic speed is bounded by sqrt( Cs^2 + Va^2 )
+         Cs2 = Gamma*Pres/Dens + 2.0*EngyB/Dens;
+
+         if ( PG < BENCH_REF_NPG )
+         MaxSpeed = MAX( MaxSpeed, sqrt( SQR(Vel[0]) + SQR(Vel[1]) + SQR(Vel[2]) ) + sqrt(Cs2) );
+      }}}
+   } // for (int PG=0; PG<NPG; PG++)
+
+   dt = Safety*dh/MaxSpeed;
+
+} // FUNCTION : Bench_Fluid_SetInput
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Fluid_Reset / Bench_Fluid_Run
+// Description :  Restore the pristine inputs / invoke the CPU fluid solver once
+//
+// Note        :  1. Bench_Fluid_Reset() must be invoked before each Bench_Fluid_Run() and is not timed
+//                2. Always store the coarse-fine fluxes (and electric field) as for patches adjacent to
+//                   coarse-fine boundaries
+//
+// Parameter   :  NPG       : Number of patch groups
+//                Limiter   : Slope limiter
+//                LR_Scheme : Data reconstruction scheme
+//                RSolver   : Riemann solver
+//                Slab      : Slab thickness of the fused MHM/CTU solver (0 --> unfused)
+//-------------------------------------------------------------------------------------------------------
+void Bench_Fluid_Reset( const int NPG )
+{
+
+   memcpy( Flu_In, Flu_In0, (long)NPG*sizeof(*Flu_In) );
+#  ifdef MHD
+   memcpy( Mag_In, Mag_In0, (long)NPG*sizeof(*Mag_In) );
+#  endif
+
+} // FUNCTION : Bench_Fluid_Reset
+
+
+
+void Bench_Fluid_Run( const int NPG, const LR_Limiter_t Limiter, const OptLRScheme_t LR_Scheme,
+                      const OptRSolver_t RSolver, const int Slab )
+{
+
+   const bool StoreFlux     = true;
+#  ifdef MHD
+   const bool StoreElectric = true;
+#  else
+   const bool StoreElectric = false;
+#  endif
+   const int  NormIdx[1]    = { -1 };
+
+   CPU_FluidSolver( Flu_In, Flu_Out, Mag_In, Mag_Out, DE_Out, Flux, Ele, Corner, NULL,
+                    NPG, dt, dh, Gamma, StoreFlux, StoreElectric, true, Limiter, MinMod_Coeff,
+                    LR_Scheme, RSolver, NULL_REAL, NULL_REAL, false, 0.0, GRAVITY_NONE,
+                    (real)0.0, (real)0.0, DualEnergySwitch, false, 0, NormIdx, false, NULL_REAL, Slab );
+
+} // FUNCTION : Bench_Fluid_Run
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Fluid_Check
+// Description :  Compare the outputs of the first BENCH_REF_NPG patch groups with the reference outputs
+//
+// Parameter   :  Label  : Label of the current configuration
+//                NPG    : Number of patch groups in the last solver call
+//                TolErr : Maximum allowed relative error
+//                MaxErr : Maximum relative error to be returned
+//
+// Return      :  true/false --> pass/fail
+//-------------------------------------------------------------------------------------------------------
+bool Bench_Fluid_Check( const char *Label, const int NPG, const double TolErr, double &MaxErr )
+{
+
+   const long NPG_Ref = MIN( NPG, BENCH_REF_NPG );
+   char   SubLabel[MAX_STRING];
+   double Err;
+   bool   Pass = true;
+
+   MaxErr = -1.0;
+
+   sprintf( SubLabel, "%s_flu",  Label );
+   Pass &= Bench_Reference_Check( SubLabel, Flu_Out[0][0],    NPG_Ref*FLU_NOUT*CUBE(PS2),          TolErr, Err );
+   MaxErr = MAX( MaxErr, Err );
+
+   sprintf( SubLabel, "%s_flux", Label );
+   Pass &= Bench_Reference_Check( SubLabel, Flux[0][0][0],    NPG_Ref*9*NFLUX_TOTAL*SQR(PS2),      TolErr, Err );
+   MaxErr = MAX( MaxErr, Err );
+
+#  ifdef MHD
+   sprintf( SubLabel, "%s_mag",  Label );
+   Pass &= Bench_Reference_Check( SubLabel, Mag_Out[0][0],    NPG_Ref*NCOMP_MAG*PS2P1*SQR(PS2),    TolErr, Err );
+   MaxErr = MAX( MaxErr, Err );
+
+   sprintf( SubLabel, "%s_ele",  Label );
+   Pass &= Bench_Reference_Check( SubLabel, Ele[0][0][0],     NPG_Ref*9*NCOMP_ELE*PS2P1*PS2,       TolErr, Err );
+   MaxErr = MAX( MaxErr, Err );
+#  endif
+
+   return Pass;
+
+} // FUNCTION : Bench_Fluid_Check
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Fluid_CheckFace
+// Description :  Compare the face-centered variables and fluxes of the last full-step update with the reference
+//                outputs
+//
+// Note        :  1. Data are taken from the scratch arrays h_FC_Var[0] and h_FC_Flux[0] of the first OpenMP
+//                   thread, which hold the face states and fluxes of all interfaces of the last patch group when
+//                   the solver is invoked with a single thread and without slabs
+//                   --> Must be invoked right after the reference run
+//                2. Useful for verifying that the compile-time variants of the CPU solvers (see Bench_GetVariant())
+//                   give the same face states and fluxes
+//                   --> Bench_Fluid_Check() only covers the coarse-fine fluxes on the patch-group boundaries
+//                3. Do nothing for RTVD
+//
+// Parameter   :  Label  : Label of the current configuration
+//                TolErr : Maximum allowed relative error
+//                MaxErr : Maximum relative error to be returned
+//
+// Return      :  true/false --> pass/fail
+//-------------------------------------------------------------------------------------------------------
+bool Bench_Fluid_CheckFace( const char *Label, const double TolErr, double &MaxErr )
+{
+
+   MaxErr = -1.0;
+
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+   char   SubLabel[MAX_STRING];
+   double Err;
+   bool   Pass = true;
+
+   sprintf( SubLabel, "%s_face",   Label );
+   Pass &= Bench_Reference_Check( SubLabel, h_FC_Var [0][0][0], 6L*NCOMP_LR*CUBE(N_FC_VAR),  TolErr, Err );
+   MaxErr = MAX( MaxErr, Err );
+
+   sprintf( SubLabel, "%s_fcflux", Label );
+   Pass &= Bench_Reference_Check( SubLabel, h_FC_Flux[0][0][0], 3L*NCOMP_LR*CUBE(N_FC_FLUX), TolErr, Err );
+   MaxErr = MAX( MaxErr, Err );
+
+   return Pass;
+
+#  else
+   return true;
+#  endif
+
+} // FUNCTION : Bench_Fluid_CheckFace
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Fluid_NByte
+// Description :  Return the number of bytes per updated cell that the fluid solver must at least read from and
+//                write to the main memory
+//
+// Note        :  Scratch arrays are excluded since they are expected to stay in cache
+//-------------------------------------------------------------------------------------------------------
+double Bench_Fluid_NByte()
+{
+
+   double NByte = sizeof(real)*( (double)FLU_NIN*CUBE(FLU_NXT) + (double)FLU_NOUT*CUBE(PS2) +
+                                 9.0*NFLUX_TOTAL*SQR(PS2) );
+#  ifdef DUAL_ENERGY
+   NByte += sizeof(char)*CUBE(PS2);
+#  endif
+#  ifdef MHD
+   NByte += sizeof(real)*( (double)NCOMP_MAG*FLU_NXT_P1*SQR(FLU_NXT) + (double)NCOMP_MAG*PS2P1*SQR(PS2) +
+                           9.0*NCOMP_ELE*PS2P1*PS2 );
+#  endif
+
+   return NByte/CUBE(PS2);
+
+} // FUNCTION : Bench_Fluid_NByte
+
+
+
+#endif // #if ( MODEL == HYDRO )
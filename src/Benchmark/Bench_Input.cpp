@@ -0,0 +1,100 @@
+#include "Benchmark.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_GetFluid
+// Description :  Return the primitive variables of the synthetic inputs
+//
+// Note        :  1. Invoked by Bench_Fluid_SetInput(), Bench_dt_SetInput(), and Bench_Poisson_SetInput()
+//                2. Each patch group spans [0,1)^3 in its own coordinates
+//                   --> The ghost zones of the solvers simply extend beyond this range
+//                3. Inputs:
+//                   BENCH_INPUT_WAVE  : smooth sound and shear waves propagating along different directions
+//                   BENCH_INPUT_SHOCK : Sod-like discontinuity with a pressure ratio of 1e3 across a plane
+//                                       whose orientation varies among patch groups
+//                4. The solutions of different patch groups differ by a phase shift (or a plane orientation) so
+//                   that the solvers do not see identical data in all patch groups
+//
+// Parameter   :  Input    : Target synthetic input
+//                PG       : Target patch group
+//                x/y/z    : Target coordinates
+//                Dens     : Mass density to be returned
+//                Vel      : Velocity to be returned
+//                Pres     : Pressure to be returned
+//
+// Return      :  Dens, Vel[], Pres
+//-------------------------------------------------------------------------------------------------------
+void Bench_GetFluid( const BenchInput_t Input, const int PG, const double x, const double y, const double z,
+                     double &Dens, double Vel[], double &Pres )
+{
+
+   const double Phase = 0.37*PG;
+
+   switch ( Input )
+   {
+      case BENCH_INPUT_WAVE :
+         Dens   = 1.0 + 0.2*sin( 2.0*M_PI*(x+2.0*y+z) + Phase );
+         Vel[0] = 0.1*sin( 2.0*M_PI*y + Phase );
+         Vel[1] = 0.1*cos( 2.0*M_PI*z + Phase );
+         Vel[2] = 0.1*sin( 2.0*M_PI*(x+z) + Phase );
+         Pres   = 1.0 + 0.1*cos( 2.0*M_PI*(x-y) + Phase );
+      break;
+
+      case BENCH_INPUT_SHOCK :
+      {
+         const double Normal[3] = { 1.0, 0.3*(PG%3), 0.2*(PG%5) };
+         const double Offset    = 0.1*( (double)(PG%7)/7.0 - 0.5 );
+         const double Dist      = (x-0.5)*Normal[0] + (y-0.5)*Normal[1] + (z-0.5)*Normal[2] - Offset;
+
+         Dens   = ( Dist < 0.0 ) ? 1.0   : 0.125;
+         Pres   = ( Dist < 0.0 ) ? 1.0e2 : 0.1;
+         Vel[0] = 0.0;
+         Vel[1] = 0.0;
+         Vel[2] = 0.0;
+      }
+      break;
+
+      default :
+         Aux_Error( ERROR_INFO, "unsupported input (%d) !!\n", Input );
+   } // switch ( Input )
+
+} // FUNCTION : Bench_GetFluid
+
+
+
+#ifdef MHD
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_GetMag
+// Description :  Return the magnetic field of the synthetic inputs
+//
+// Note        :  1. Each component does not depend on its own coordinate (e.g., Bx = Bx(y,z))
+//                   --> The face-centered field sampled at the face centers is divergence-free to round-off
+//                2. Superposed on all synthetic inputs, with a stronger field for BENCH_INPUT_SHOCK
+//
+// Parameter   :  Input : Target synthetic input
+//                PG    : Target patch group
+//                x/y/z : Target coordinates
+//                B     : Magnetic field to be returned
+//
+// Return      :  B[]
+//-------------------------------------------------------------------------------------------------------
+void Bench_GetMag( const BenchInput_t Input, const int PG, const double x, const double y, const double z, double B[] )
+{
+
+   const double Phase = 0.37*PG;
+   const double B0    = ( Input == BENCH_INPUT_SHOCK ) ? 2.0 : 0.5;
+
+   B[MAGX] = B0*( 1.0 + 0.2*sin( 2.0*M_PI*(y+z) + Phase ) );
+   B[MAGY] = B0*( 0.5 + 0.2*sin( 2.0*M_PI*(z+x) + Phase ) );
+   B[MAGZ] = B0*( 0.2 + 0.2*sin( 2.0*M_PI*(x+y) + Phase ) );
+
+} // FUNCTION : Bench_GetMag
+#endif // #ifdef MHD
+
+
+
+#endif // #if ( MODEL == HYDRO )
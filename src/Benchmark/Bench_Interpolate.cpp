@@ -0,0 +1,162 @@
+#include "Benchmark.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+// number of coarse-grid ghost zones stored for each patch (maximum of all interpolation schemes)
+#define INT_NGHOST   2
+#define INT_CNX      ( PS1 + 2*INT_NGHOST )
+
+// input and output arrays of the benchmark
+static real (*Int_CData)[NCOMP_TOTAL][ CUBE(INT_CNX) ]    = NULL;
+static real (*Int_FData)[NCOMP_TOTAL][ CUBE(PS2) ]        = NULL;
+
+// parameters of the interpolation
+static const real Gamma = 5.0/3.0;
+static const real dh    = 1.0/PS2;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Int_Allocate / Bench_Int_Free
+// Description :  Allocate/free the arrays of the interpolation benchmark
+//
+// Note        :  1. The thread-private scratch buffers of the interpolation routines are released at exit
+//                   (see Aux_Scratch_Get())
+//
+// Parameter   :  MaxNPG : Maximum number of patch groups per call
+//-------------------------------------------------------------------------------------------------------
+void Bench_Int_Allocate( const int MaxNPG )
+{
+
+   Int_CData = new real [MaxNPG][NCOMP_TOTAL][ CUBE(INT_CNX) ];
+   Int_FData = new real [MaxNPG][NCOMP_TOTAL][ CUBE(PS2) ];
+
+} // FUNCTION : Bench_Int_Allocate
+
+
+
+void Bench_Int_Free()
+{
+
+   delete [] Int_CData;    Int_CData = NULL;
+   delete [] Int_FData;    Int_FData = NULL;
+
+} // FUNCTION : Bench_Int_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Int_SetInput
+// Description :  Fill the coarse-grid arrays with the target synthetic input
+//
+// Note        :  1. Each patch group is refined from a single coarse patch with INT_NGHOST ghost zones on
+//                   each side, the same as refining a patch in Refine()
+//                2. Same fluid as Bench_Fluid_SetInput() sampled at the coarse-grid cell centers
+//
+// Parameter   :  Input : Target synthetic input
+//                NPG   : Number of patch groups
+//-------------------------------------------------------------------------------------------------------
+void Bench_Int_SetInput( const BenchInput_t Input, const int NPG )
+{
+
+   const real   Gamma_m1 = Gamma - (real)1.0;
+   const double dh_C     = 2.0*dh;
+
+   for (int PG=0; PG<NPG; PG++)
+   {
+      for (int k=0; k<INT_CNX; k++)    {  const double z = ( k - INT_NGHOST + 0.5 )*dh_C;
+      for (int j=0; j<INT_CNX; j++)    {  const double y = ( j - INT_NGHOST + 0.5 )*dh_C;
+      for (int i=0; i<INT_CNX; i++)    {  const double x = ( i - INT_NGHOST + 0.5 )*dh_C;
+
+         const int idx = IDX321( i, j, k, INT_CNX, INT_CNX );
+         double Dens, Vel[3], Pres;
+
+         Bench_GetFluid( Input, PG, x, y, z, Dens, Vel, Pres );
+
+         Int_CData[PG][DENS][idx] = Dens;
+         Int_CData[PG][MOMX][idx] = Dens*Vel[0];
+         Int_CData[PG][MOMY][idx] = Dens*Vel[1];
+         Int_CData[PG][MOMZ][idx] = Dens*Vel[2];
+         Int_CData[PG][ENGY][idx] = Pres/Gamma_m1 + 0.5*Dens*( SQR(Vel[0]) + SQR(Vel[1]) + SQR(Vel[2]) );
+
+         for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
+            Int_CData[PG][v][idx] = Dens*( 0.5 + 0.4*sin( 2.0*M_PI*(x+0.1*v) ) );
+      }}}
+   } // for (int PG=0; PG<NPG; PG++)
+
+} // FUNCTION : Bench_Int_SetInput
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Int_Run
+// Description :  Interpolate all patch groups once
+//
+// Note        :  1. Patch groups are distributed among OpenMP threads, the same as Refine()
+//                2. All components are monotonic
+//
+// Parameter   :  NPG       : Number of patch groups
+//                IntScheme : Interpolation scheme
+//-------------------------------------------------------------------------------------------------------
+void Bench_Int_Run( const int NPG, const IntScheme_t IntScheme )
+{
+
+   const int CSize [3] = { INT_CNX,    INT_CNX,    INT_CNX    };
+   const int CStart[3] = { INT_NGHOST, INT_NGHOST, INT_NGHOST };
+   const int CRange[3] = { PS1,        PS1,        PS1        };
+   const int FSize [3] = { PS2,        PS2,        PS2        };
+   const int FStart[3] = { 0,          0,          0          };
+
+   bool Monotonic[NCOMP_TOTAL];
+   for (int v=0; v<NCOMP_TOTAL; v++)   Monotonic[v] = true;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PG=0; PG<NPG; PG++)
+      Interpolate( Int_CData[PG][0], CSize, CStart, CRange, Int_FData[PG][0], FSize, FStart,
+                   NCOMP_TOTAL, IntScheme, false, Monotonic );
+
+} // FUNCTION : Bench_Int_Run
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Int_Check
+// Description :  Compare the outputs of the first BENCH_REF_NPG patch groups with the reference outputs
+//
+// Parameter   :  See Bench_Fluid_Check()
+//
+// Return      :  true/false --> pass/fail
+//-------------------------------------------------------------------------------------------------------
+bool Bench_Int_Check( const char *Label, const int NPG, const double TolErr, double &MaxErr )
+{
+
+   const long NPG_Ref = MIN( NPG, BENCH_REF_NPG );
+
+   return Bench_Reference_Check( Label, Int_FData[0][0], NPG_Ref*NCOMP_TOTAL*CUBE(PS2), TolErr, MaxErr );
+
+} // FUNCTION : Bench_Int_Check
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Int_NByte
+// Description :  Return the number of bytes per fine-grid cell that the interpolation must at least read from
+//                and write to the main memory
+//
+// Note        :  Assume INT_NGHOST coarse-grid ghost zones for all schemes
+//-------------------------------------------------------------------------------------------------------
+double Bench_Int_NByte()
+{
+
+   const double NByte = sizeof(real)*( (double)NCOMP_TOTAL*( CUBE(INT_CNX) + CUBE(PS2) ) );
+
+   return NByte/CUBE(PS2);
+
+} // FUNCTION : Bench_Int_NByte
+
+
+
+#endif // #if ( MODEL == HYDRO )
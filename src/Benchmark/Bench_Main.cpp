@@ -0,0 +1,597 @@
+#include "Benchmark.h"
+#include <unistd.h>
+
+#if ( MODEL != HYDRO )
+#  error : ERROR : the solver benchmark only supports MODEL == HYDRO !!
+#endif
+
+#ifdef GPU
+#  error : ERROR : the solver benchmark only supports the CPU solvers !!
+#endif
+
+#ifndef SERIAL
+#  error : ERROR : the solver benchmark must be compiled with SERIAL !!
+#endif
+
+
+
+// global variables required by the GAMER routines linked to the benchmark
+int         MPI_Rank            = 0;
+double      INT_MONO_COEFF      = 2.0;
+IntScheme_t OPT__FLU_INT_SCHEME = INT_CQUAD;
+#ifdef GRAVITY
+#include "CUPOT.h"
+double ExtPot_AuxArray[EXT_POT_NAUX_MAX];
+double ExtAcc_AuxArray[EXT_ACC_NAUX_MAX];
+#endif
+
+static void ReadOption( int argc, char *argv[], BenchPara_t &Para );
+static void CheckParameter( BenchPara_t &Para );
+static int  ReadList( const char *Str, int List[], const char *Option );
+static bool Bench_Solver( const BenchSolver_t Solver, const BenchPara_t &Para, FILE *File );
+static void SetNThread( const int NThread );
+
+static const char *SolverName[BENCH_NSOLVER] = { "flu", "dt", "poi", "int" };
+static const char *InputName [BENCH_NINPUT ] = { "wave", "shock" };
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  main
+// Description :  Standalone benchmark of the CPU fluid, dt, and Poisson solvers and the spatial interpolation
+//
+// Note        :  1. Compiled by "make bench", which links only the solver routines with the compile-time
+//                   options of the Makefile (no AMR, no MPI, no runtime parameter files)
+//                2. Measure each solver on synthetic patch-group inputs (see Bench_GetFluid()) for all
+//                   combinations of the sweep lists and output one row per combination:
+//                      Solver Input Limiter LR RS Slab NPG NThread NCell Time_Min Time_Mean Time_Std
+//                      Cell/s(mean) Cell/s(max) Byte/Cell RefErr
+//                   --> Byte/Cell is the minimum main-memory traffic of the solver inputs and outputs
+//                   --> RefErr is the error with respect to the reference outputs (-1 --> not compared)
+//                   --> For the interpolation ("int"), which refines one coarse patch to a patch group per call
+//                       of Interpolate(), the column Limiter lists the interpolation scheme (IntScheme_t)
+//                3. Reference outputs:
+//                   -R FILE : write the outputs of the first BENCH_REF_NPG patch groups to FILE
+//                   -C FILE : compare all configurations with the outputs stored in FILE and return 1 if any
+//                             error exceeds the tolerance set by -e
+//                   --> A reference file can only be compared with a build of the same configuration
+//                   --> But it can be compared with a build of a different variant (see Bench_GetVariant())
+//                   --> The reference run of the fluid solver also records the face states and fluxes of all
+//                       interfaces of the last patch group (see Bench_Fluid_CheckFace())
+//                4. Example:
+//                      make bench
+//                      ../bin/gamer_bench -R Ref.bin                   (on the trusted version)
+//                      ../bin/gamer_bench -C Ref.bin -n 8,64 -t 1,8 -o Bench.txt
+//                5. Example of comparing the batched and scalar Riemann solvers (or the pencil and scalar data
+//                   reconstruction with -DLR_PENCIL=0):
+//                      make bench
+//                      ../bin/gamer_bench -s f -R Ref.bin
+//                      (rebuild with "SIMU_OPTION += -DRSOLVER_BATCH=0" in the Makefile)
+//                      ../bin/gamer_bench -s f -C Ref.bin -e 0
+//-------------------------------------------------------------------------------------------------------
+int main( int argc, char *argv[] )
+{
+
+   BenchPara_t Para;
+
+   ReadOption( argc, argv, Para );
+   CheckParameter( Para );
+
+
+// open the output table and the reference file
+   FILE *File = ( Para.FileOut == NULL ) ? stdout : fopen( Para.FileOut, "w" );
+
+   if ( File == NULL )  Aux_Error( ERROR_INFO, "cannot create the output file \"%s\" !!\n", Para.FileOut );
+
+   if ( Para.FileRef != NULL )   Bench_Reference_Open( Para.FileRef, Para.WriteRef );
+
+
+// header
+   fprintf( File, "# GAMER solver benchmark\n" );
+   fprintf( File, "# Config  : %s\n", Bench_GetConfig() );
+   fprintf( File, "# Variant : %s\n", Bench_GetVariant() );
+   fprintf( File, "# NRepeat : %d, NWarmUp : %d\n", Para.NRepeat, Para.NWarmUp );
+   fprintf( File, "# Ref     : %s %s\n", ( Para.FileRef == NULL ) ? "none" : ( Para.WriteRef ? "write" : "compare" ),
+            ( Para.FileRef == NULL ) ? "" : Para.FileRef );
+   fprintf( File, "#%5s %6s %7s %2s %2s %4s %6s %7s %12s %13s %13s %13s %13s %13s %10s %13s\n",
+            "Solver", "Input", "Limiter", "LR", "RS", "Slab", "NPG", "NThread", "NCell", "Time_Min", "Time_Mean", "Time_Std",
+            "Cell/s", "Cell/s_Max", "Byte/Cell", "RefErr" );
+   fflush( File );
+
+
+// measure all target solvers
+   bool Pass = true;
+
+   for (int s=0; s<BENCH_NSOLVER; s++)
+      if ( Para.Solver[s] )   Pass &= Bench_Solver( (BenchSolver_t)s, Para, File );
+
+
+   if ( Para.FileOut != NULL )   fclose( File );
+   if ( Para.FileRef != NULL )   Bench_Reference_Close();
+
+   if ( Para.FileRef != NULL  &&  !Para.WriteRef )
+      Aux_Message( stderr, "Comparison with the reference file \"%s\" --> %s\n", Para.FileRef,
+                   Pass ? "PASSED" : "FAILED" );
+
+   return ( Pass ) ? 0 : 1;
+
+} // FUNCTION : main
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Solver
+// Description :  Measure the target solver for all combinations of the sweep lists
+//
+// Note        :  1. For each input, first invoke the solver with BENCH_REF_NPG patch groups and BENCH_REF_NTHREAD
+//                   threads (and without slabs) to write or compare the reference outputs
+//                   --> Then compare the outputs of all timed configurations as well (when comparing)
+//                2. The inputs of each patch group do not depend on the number of patch groups per call
+//                   --> Set the inputs only once for the maximum number of patch groups
+//
+// Parameter   :  Solver : Target solver
+//                Para   : Runtime parameters
+//                File   : Output table
+//
+// Return      :  true/false --> all comparisons passed/failed
+//-------------------------------------------------------------------------------------------------------
+bool Bench_Solver( const BenchSolver_t Solver, const BenchPara_t &Para, FILE *File )
+{
+
+   int MaxNPG = BENCH_REF_NPG, MaxNThread = BENCH_REF_NTHREAD;
+   for (int n=0; n<Para.NNPG;     n++)   MaxNPG     = MAX( MaxNPG,     Para.NPG    [n] );
+   for (int t=0; t<Para.NNThread; t++)   MaxNThread = MAX( MaxNThread, Para.NThread[t] );
+
+   const int NLimiter = ( Solver == BENCH_FLU ) ? Para.NLimiter*Para.NLRScheme*Para.NRSolver :
+                        ( Solver == BENCH_INT ) ? Para.NIntScheme                             : 1;
+   const int NSlab    = ( Solver == BENCH_FLU ) ? Para.NSlab : 1;
+   double    NByte    = NULL_REAL;
+
+   switch ( Solver )
+   {
+      case BENCH_FLU :  Bench_Fluid_Allocate( MaxNPG, MaxNThread );  NByte = Bench_Fluid_NByte();    break;
+      case BENCH_DT  :  Bench_dt_Allocate( MaxNPG );                 NByte = Bench_dt_NByte();       break;
+#     ifdef GRAVITY
+      case BENCH_POI :  Bench_Poisson_Allocate( MaxNPG );            NByte = Bench_Poisson_NByte();  break;
+#     endif
+      case BENCH_INT :  Bench_Int_Allocate( MaxNPG );                NByte = Bench_Int_NByte();      break;
+      default        :  Aux_Error( ERROR_INFO, "unsupported solver (%d) !!\n", Solver );
+   }
+
+   double *Time = new double [Para.NRepeat];
+   Timer_t Timer;
+   bool    Pass = true;
+
+   for (int Input=0; Input<BENCH_NINPUT; Input++)
+   {
+      if ( !Para.Input[Input] )  continue;
+
+      switch ( Solver )
+      {
+         case BENCH_FLU :  Bench_Fluid_SetInput  ( (BenchInput_t)Input, MaxNPG );  break;
+         case BENCH_DT  :  Bench_dt_SetInput     ( (BenchInput_t)Input, MaxNPG );  break;
+#        ifdef GRAVITY
+         case BENCH_POI :  Bench_Poisson_SetInput( (BenchInput_t)Input, MaxNPG );  break;
+#        endif
+         case BENCH_INT :  Bench_Int_SetInput    ( (BenchInput_t)Input, MaxNPG );  break;
+         default        :  break;
+      }
+
+//    l loops over all combinations of the slope limiters, data reconstruction schemes, and Riemann solvers
+//    --> or over the interpolation schemes for the interpolation
+      for (int l=0; l<NLimiter; l++)
+      {
+         const bool          IsFlu     = ( Solver == BENCH_FLU );
+         const bool          IsInt     = ( Solver == BENCH_INT );
+         const LR_Limiter_t  Limiter   = ( IsFlu ) ? Para.Limiter [ l/(Para.NRSolver*Para.NLRScheme) ] :
+                                         ( IsInt ) ? (LR_Limiter_t)Para.IntScheme[l]                  : LR_LIMITER_NONE;
+         const OptLRScheme_t LR_Scheme = ( IsFlu ) ? Para.LRScheme[ (l/Para.NRSolver)%Para.NLRScheme ] : LR_SCHEME_NONE;
+         const OptRSolver_t  RSolver   = ( IsFlu ) ? Para.RSolver [ l%Para.NRSolver ]                   : RSOLVER_NONE;
+         char Label[MAX_STRING];
+
+         if ( Solver == BENCH_FLU )
+            sprintf( Label, "%s_%s_lim%d_lr%d_rs%d", SolverName[Solver], InputName[Input], Limiter, LR_Scheme, RSolver );
+         else if ( Solver == BENCH_INT )
+            sprintf( Label, "%s_%s_int%d",  SolverName[Solver], InputName[Input], Para.IntScheme[l] );
+         else
+            sprintf( Label, "%s_%s",       SolverName[Solver], InputName[Input] );
+
+
+         for (int Step=-1; Step<NSlab*Para.NNPG*Para.NNThread; Step++)
+         {
+//          Step = -1 is the reference run
+            const bool IsRef   = ( Step == -1 );
+            const int  Slab    = ( IsRef  ||  Solver != BENCH_FLU ) ? 0 : Para.Slab[ Step/(Para.NNThread*Para.NNPG) ];
+            const int  NPG     = ( IsRef ) ? BENCH_REF_NPG     : Para.NPG    [ (Step/Para.NNThread)%Para.NNPG ];
+            const int  NThread = ( IsRef ) ? BENCH_REF_NTHREAD : Para.NThread[ Step%Para.NNThread ];
+            const int  NCall   = ( IsRef ) ? 1                 : Para.NWarmUp + Para.NRepeat;
+
+            SetNThread( NThread );
+
+            for (int c=0; c<NCall; c++)
+            {
+               if ( Solver == BENCH_FLU )    Bench_Fluid_Reset( NPG );
+
+               Timer.Reset();
+               Timer.Start();
+
+               switch ( Solver )
+               {
+                  case BENCH_FLU :  Bench_Fluid_Run  ( NPG, Limiter, LR_Scheme, RSolver, Slab );  break;
+                  case BENCH_DT  :  Bench_dt_Run     ( NPG );                                     break;
+#                 ifdef GRAVITY
+                  case BENCH_POI :  Bench_Poisson_Run( NPG );                                     break;
+#                 endif
+                  case BENCH_INT :  Bench_Int_Run    ( NPG, Para.IntScheme[l] );                  break;
+                  default        :  break;
+               }
+
+               Timer.Stop();
+
+               if ( !IsRef  &&  c >= Para.NWarmUp )   Time[ c - Para.NWarmUp ] = Timer.GetValue();
+            } // for (int c=0; c<NCall; c++)
+
+
+//          compare with or write the reference outputs
+//          --> only the reference run writes the reference outputs
+            double RefErr = -1.0;
+
+            if ( IsRef  ||  !Para.WriteRef )
+            {
+               bool PassThis = true;
+
+               switch ( Solver )
+               {
+                  case BENCH_FLU :  PassThis = Bench_Fluid_Check  ( Label, NPG, Para.TolErr, RefErr );  break;
+                  case BENCH_DT  :  PassThis = Bench_dt_Check     ( Label, NPG, Para.TolErr, RefErr );  break;
+#                 ifdef GRAVITY
+                  case BENCH_POI :  PassThis = Bench_Poisson_Check( Label, NPG, Para.TolErr, RefErr );  break;
+#                 endif
+                  case BENCH_INT :  PassThis = Bench_Int_Check    ( Label, NPG, Para.TolErr, RefErr );  break;
+                  default        :  break;
+               }
+
+//             face states and fluxes of all interfaces are only available right after the reference run
+               if ( IsRef  &&  Solver == BENCH_FLU )
+               {
+                  double FaceErr;
+                  PassThis &= Bench_Fluid_CheckFace( Label, Para.TolErr, FaceErr );
+                  RefErr    = MAX( RefErr, FaceErr );
+               }
+
+               if ( !PassThis )
+                  Aux_Message( stderr, "WARNING : %s (Slab %d, NPG %d, NThread %d) differs from the reference "
+                               "(error %13.7e > %13.7e) !!\n", Label, Slab, NPG, NThread, RefErr, Para.TolErr );
+
+               Pass &= PassThis;
+            }
+
+            if ( IsRef )   continue;
+
+
+//          output the statistics
+            const long NCell = (long)NPG*CUBE(PS2);
+            double Time_Min = __FLT_MAX__, Time_Mean = 0.0, Time_Std = 0.0;
+
+            for (int r=0; r<Para.NRepeat; r++)
+            {
+               Time_Min   = MIN( Time_Min, Time[r] );
+               Time_Mean += Time[r];
+            }
+            Time_Mean /= Para.NRepeat;
+
+            for (int r=0; r<Para.NRepeat; r++)  Time_Std += SQR( Time[r] - Time_Mean );
+            Time_Std = ( Para.NRepeat > 1 ) ? sqrt( Time_Std/(Para.NRepeat-1) ) : 0.0;
+
+            fprintf( File, "%6s %6s %7d %2d %2d %4d %6d %7d %12ld %13.6e %13.6e %13.6e %13.6e %13.6e %10.2f %13.6e\n",
+                     SolverName[Solver], InputName[Input], Limiter, LR_Scheme, RSolver, Slab, NPG, NThread, NCell,
+                     Time_Min, Time_Mean, Time_Std, NCell/Time_Mean, NCell/Time_Min, NByte, RefErr );
+            fflush( File );
+         } // for (int Step=-1; Step<NSlab*Para.NNPG*Para.NNThread; Step++)
+      } // for (int l=0; l<NLimiter; l++)
+   } // for (int Input=0; Input<BENCH_NINPUT; Input++)
+
+   delete [] Time;
+
+   switch ( Solver )
+   {
+      case BENCH_FLU :  Bench_Fluid_Free();     break;
+      case BENCH_DT  :  Bench_dt_Free();        break;
+#     ifdef GRAVITY
+      case BENCH_POI :  Bench_Poisson_Free();   break;
+#     endif
+      case BENCH_INT :  Bench_Int_Free();       break;
+      default        :  break;
+   }
+
+   return Pass;
+
+} // FUNCTION : Bench_Solver
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetNThread
+// Description :  Set the number of OpenMP threads adopted by the solvers
+//
+// Note        :  Same schedule as Init_OpenMP()
+//-------------------------------------------------------------------------------------------------------
+void SetNThread( const int NThread )
+{
+
+#  ifdef OPENMP
+   omp_set_num_threads( NThread );
+   omp_set_nested( false );
+   omp_set_schedule( omp_sched_dynamic, 1 );
+#  endif
+
+} // FUNCTION : SetNThread
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReadOption
+// Description :  Read the command-line options
+//-------------------------------------------------------------------------------------------------------
+void ReadOption( int argc, char *argv[], BenchPara_t &Para )
+{
+
+// default values
+   for (int s=0; s<BENCH_NSOLVER; s++)    Para.Solver[s] = true;
+   for (int i=0; i<BENCH_NINPUT;  i++)    Para.Input [i] = true;
+#  ifndef GRAVITY
+   Para.Solver[BENCH_POI] = false;
+#  endif
+
+   const int DefaultNPG[4] = { 1, 4, 16, 64 };
+   Para.NNPG = 4;
+   for (int n=0; n<Para.NNPG; n++)  Para.NPG[n] = DefaultNPG[n];
+
+   Para.NNThread   = 1;
+   Para.NThread[0] = 1;
+#  ifdef OPENMP
+   if ( omp_get_max_threads() > 1 )    Para.NThread[ Para.NNThread ++ ] = omp_get_max_threads();
+#  endif
+
+   Para.NLimiter    = 1;
+   Para.Limiter [0] = VL_GMINMOD;
+   Para.NLRScheme   = 1;
+   Para.LRScheme[0] = LR_SCHEME_DEFAULT;
+   Para.NRSolver    = 1;
+   Para.RSolver [0] = RSOLVER_DEFAULT;
+   Para.NSlab       = 1;
+   Para.Slab[0]     = 0;
+   Para.NIntScheme  = 1;
+   Para.IntScheme[0] = INT_CQUAD;
+   Para.NRepeat     = 10;
+   Para.NWarmUp     = 2;
+   Para.FileOut     = NULL;
+   Para.FileRef     = NULL;
+   Para.WriteRef    = false;
+#  ifdef FLOAT8
+   Para.TolErr      = 1.0e-12;
+#  else
+   Para.TolErr      = 1.0e-5;
+#  endif
+
+
+// load the command-line options
+   int c;
+
+   while ( (c = getopt(argc, argv, "hs:i:n:t:l:p:q:f:m:r:w:o:R:C:e:")) != -1 )
+   {
+      switch ( c )
+      {
+         case 's': for (int s=0; s<BENCH_NSOLVER; s++)   Para.Solver[s] = false;
+                   for (const char *p=optarg; *p!='\0'; p++)
+                   {
+                      if      ( *p == 'f' )  Para.Solver[BENCH_FLU] = true;
+                      else if ( *p == 'd' )  Para.Solver[BENCH_DT ] = true;
+                      else if ( *p == 'p' )  Para.Solver[BENCH_POI] = true;
+                      else if ( *p == 'i' )  Para.Solver[BENCH_INT] = true;
+                      else    Aux_Error( ERROR_INFO, "unknown solver '%c' in -s (f/d/p/i) !!\n", *p );
+                   }
+                   break;
+         case 'i': for (int i=0; i<BENCH_NINPUT; i++)    Para.Input[i] = false;
+                   for (const char *p=optarg; *p!='\0'; p++)
+                   {
+                      if      ( *p == 'w' )  Para.Input[BENCH_INPUT_WAVE ] = true;
+                      else if ( *p == 's' )  Para.Input[BENCH_INPUT_SHOCK] = true;
+                      else    Aux_Error( ERROR_INFO, "unknown input '%c' in -i (w/s) !!\n", *p );
+                   }
+                   break;
+         case 'n': Para.NNPG     = ReadList( optarg, Para.NPG,     "-n" );
+                   break;
+         case 't': Para.NNThread = ReadList( optarg, Para.NThread, "-t" );
+                   break;
+         case 'l': Para.NLimiter  = ReadList( optarg, Para.Limiter,  "-l" );
+                   break;
+         case 'p': Para.NLRScheme = ReadList( optarg, Para.LRScheme, "-p" );
+                   break;
+         case 'q': Para.NRSolver  = ReadList( optarg, Para.RSolver,  "-q" );
+                   break;
+         case 'f': Para.NSlab     = ReadList( optarg, Para.Slab,     "-f" );
+                   break;
+         case 'm': Para.NIntScheme = ReadList( optarg, Para.IntScheme, "-m" );
+                   break;
+         case 'r': Para.NRepeat   = atoi( optarg );
+                   break;
+         case 'w': Para.NWarmUp   = atoi( optarg );
+                   break;
+         case 'o': Para.FileOut   = optarg;
+                   break;
+         case 'R': Para.FileRef   = optarg;
+                   Para.WriteRef  = true;
+                   break;
+         case 'C': Para.FileRef   = optarg;
+                   Para.WriteRef  = false;
+                   break;
+         case 'e': Para.TolErr    = atof( optarg );
+                   break;
+         case 'h':
+         case '?': fprintf( stderr, "\nusage: %s [-h (for help)] [-s solvers: f(luid)/d(t)/p(oisson)/i(nterpolation) [fdpi]]\n"
+                                    "          [-i inputs: w(ave)/s(hock) [ws]] [-n list of patch groups per call [1,4,16,64]]\n"
+                                    "          [-t list of OpenMP threads [1,max]] [-l list of slope limiters (OPT__LR_LIMITER) [4]]\n"
+                                    "          [-p list of data reconstruction schemes (OPT__LR_SCHEME) [LR_SCHEME]]\n"
+                                    "          [-q list of Riemann solvers (OPT__RSOLVER) [RSOLVER]]\n"
+                                    "          [-f list of slab thicknesses of the fused MHM/CTU solver (0=off) [0]]\n"
+                                    "          [-m list of interpolation schemes (OPT__FLU_INT_SCHEME) [4]]\n"
+                                    "          [-r timed calls per configuration [10]] [-w untimed calls per configuration [2]]\n"
+                                    "          [-o output table [stdout]] [-R reference file to write] [-C reference file to compare]\n"
+                                    "          [-e maximum allowed error when comparing with the reference [%.1e]]\n\n",
+                            argv[0], Para.TolErr );
+                   exit( 1 );
+      } // switch ( c )
+   } // while ( (c = getopt(argc, argv, "...")) != -1 )
+
+} // FUNCTION : ReadOption
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ReadList
+// Description :  Load a comma-separated list of integers
+//
+// Return      :  Number of entries
+//-------------------------------------------------------------------------------------------------------
+int ReadList( const char *Str, int List[], const char *Option )
+{
+
+   int  N = 0;
+   char Buf[MAX_STRING];
+
+   strncpy( Buf, Str, MAX_STRING-1 );
+   Buf[MAX_STRING-1] = '\0';
+
+   for (char *Token=strtok(Buf, ","); Token!=NULL; Token=strtok(NULL, ","))
+   {
+      if ( N >= BENCH_NLIST_MAX )
+         Aux_Error( ERROR_INFO, "too many entries in %s (> %d) !!\n", Option, BENCH_NLIST_MAX );
+
+      List[ N ++ ] = atoi( Token );
+   }
+
+   if ( N == 0 )  Aux_Error( ERROR_INFO, "empty list in %s !!\n", Option );
+
+   return N;
+
+} // FUNCTION : ReadList
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CheckParameter
+// Description :  Verify the runtime parameters and reset the options not supported by the current build
+//-------------------------------------------------------------------------------------------------------
+void CheckParameter( BenchPara_t &Para )
+{
+
+   for (int n=0; n<Para.NNPG; n++)
+      if ( Para.NPG[n] < 1 )  Aux_Error( ERROR_INFO, "incorrect number of patch groups (%d) !!\n", Para.NPG[n] );
+
+   for (int t=0; t<Para.NNThread; t++)
+      if ( Para.NThread[t] < 1 )    Aux_Error( ERROR_INFO, "incorrect number of threads (%d) !!\n", Para.NThread[t] );
+
+   if ( Para.NRepeat < 1 )    Aux_Error( ERROR_INFO, "incorrect number of timed calls (%d) !!\n", Para.NRepeat );
+   if ( Para.NWarmUp < 0 )    Aux_Error( ERROR_INFO, "incorrect number of untimed calls (%d) !!\n", Para.NWarmUp );
+
+#  ifndef GRAVITY
+   if ( Para.Solver[BENCH_POI] )
+      Aux_Error( ERROR_INFO, "the Poisson solver requires GRAVITY !!\n" );
+#  endif
+
+#  ifndef OPENMP
+   if ( Para.NNThread > 1  ||  Para.NThread[0] != 1 )
+   {
+      Para.NNThread   = 1;
+      Para.NThread[0] = 1;
+
+      Aux_Message( stderr, "WARNING : the list of threads is reset to {1} since OPENMP is disabled !!\n" );
+   }
+#  endif
+
+
+// slope limiters, data reconstruction schemes, and Riemann solvers
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+   for (int l=0; l<Para.NLimiter; l++)
+   {
+      const LR_Limiter_t Limiter = Para.Limiter[l];
+
+      if ( Limiter != VANLEER  &&  Limiter != GMINMOD  &&  Limiter != ALBADA  &&
+           Limiter != EXTPRE   &&  Limiter != VL_GMINMOD )
+         Aux_Error( ERROR_INFO, "unsupported data reconstruction limiter (%d) !!\n", Limiter );
+
+#     if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == CTU )
+      if ( Limiter == EXTPRE  &&  FLU_GHOST_SIZE < 3 )
+         Aux_Error( ERROR_INFO, "the extrema-preserving limiter requires FLU_GHOST_SIZE >= 3 !!\n" );
+#     endif
+   }
+
+// data reconstruction schemes and Riemann solvers (-1 --> the Makefile options)
+   for (int p=0; p<Para.NLRScheme; p++)
+   {
+      if ( Para.LRScheme[p] < 0 )   Para.LRScheme[p] = LR_SCHEME;
+
+      if ( Para.LRScheme[p] != LR_SCHEME_PLM  &&  Para.LRScheme[p] != LR_SCHEME_PPM )
+         Aux_Error( ERROR_INFO, "unsupported data reconstruction scheme (%d) !!\n", Para.LRScheme[p] );
+
+#     if ( LR_SCHEME != PPM )
+      if ( Para.LRScheme[p] == LR_SCHEME_PPM )
+         Aux_Error( ERROR_INFO, "the PPM reconstruction requires LR_SCHEME=PPM in the Makefile !!\n" );
+#     endif
+
+      for (int l=0; l<Para.NLimiter; l++)
+         if ( Para.LRScheme[p] == LR_SCHEME_PPM  &&  Para.Limiter[l] == EXTPRE )
+            Aux_Error( ERROR_INFO, "the PPM reconstruction does not support the extrema-preserving limiter !!\n" );
+   }
+
+   for (int q=0; q<Para.NRSolver; q++)
+   {
+      if ( Para.RSolver[q] < 0 )    Para.RSolver[q] = RSOLVER;
+
+#     ifdef MHD
+      if ( Para.RSolver[q] != RSOLVER_ROE  &&  Para.RSolver[q] != RSOLVER_HLLE  &&  Para.RSolver[q] != RSOLVER_HLLD )
+#     else
+      if ( Para.RSolver[q] != RSOLVER_EXACT  &&  Para.RSolver[q] != RSOLVER_ROE  &&  Para.RSolver[q] != RSOLVER_HLLE  &&
+           Para.RSolver[q] != RSOLVER_HLLC )
+#     endif
+         Aux_Error( ERROR_INFO, "unsupported Riemann solver (%d) !!\n", Para.RSolver[q] );
+   }
+
+#  else
+   Para.NLimiter    = 1;
+   Para.Limiter [0] = LR_LIMITER_NONE;
+   Para.NLRScheme   = 1;
+   Para.LRScheme[0] = LR_SCHEME_NONE;
+   Para.NRSolver    = 1;
+   Para.RSolver [0] = RSOLVER_NONE;
+#  endif
+
+
+// interpolation schemes
+   for (int m=0; m<Para.NIntScheme; m++)
+   {
+      int NSide_Useless, NGhost_Useless;
+      Int_Table( Para.IntScheme[m], NSide_Useless, NGhost_Useless );
+   }
+
+
+// slabs of the fused solver
+   for (int s=0; s<Para.NSlab; s++)
+      if ( Para.Slab[s] < 0  ||  Para.Slab[s] > PS2 )
+         Aux_Error( ERROR_INFO, "slab thickness (%d) is not within the correct range [0, PS2=%d] !!\n",
+                    Para.Slab[s], PS2 );
+
+#  if ( ( FLU_SCHEME != MHM && FLU_SCHEME != CTU )  ||  defined MHD )
+   if ( Para.NSlab > 1  ||  Para.Slab[0] != 0 )
+   {
+      Para.NSlab   = 1;
+      Para.Slab[0] = 0;
+
+      Aux_Message( stderr, "WARNING : the list of slabs is reset to {0} since the fused solver only supports "
+                           "MHM/CTU without MHD !!\n" );
+   }
+#  endif
+
+} // FUNCTION : CheckParameter
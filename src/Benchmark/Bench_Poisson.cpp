@@ -0,0 +1,172 @@
+#include "Benchmark.h"
+
+#if ( MODEL == HYDRO  &&  defined GRAVITY )
+
+
+
+// input and output arrays of the benchmark
+static real (*Rho_In )[RHO_NXT][RHO_NXT][RHO_NXT]     = NULL;
+static real (*Pot_In )[POT_NXT][POT_NXT][POT_NXT]     = NULL;
+static real (*Pot_Out)[GRA_NXT][GRA_NXT][GRA_NXT]     = NULL;
+
+// parameters of the Poisson solver
+static const real        dh        = 1.0/PS2;
+static const real        Poi_Coeff = 4.0*M_PI;
+static const IntScheme_t IntScheme = INT_CQUAD;
+static double            SOR_Omega;
+static int               SOR_Max_Iter, SOR_Min_Iter;
+static int               MG_Max_Iter, MG_NPre_Smooth, MG_NPost_Smooth;
+static double            MG_Tolerated_Error;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Poisson_Allocate / Bench_Poisson_Free
+// Description :  Allocate/free the arrays of the Poisson solver benchmark and set the default parameters of
+//                the SOR and multigrid solvers
+//
+// Parameter   :  MaxNPG : Maximum number of patch groups per solver call
+//-------------------------------------------------------------------------------------------------------
+void Bench_Poisson_Allocate( const int MaxNPG )
+{
+
+   Rho_In  = new real [8*MaxNPG][RHO_NXT][RHO_NXT][RHO_NXT];
+   Pot_In  = new real [8*MaxNPG][POT_NXT][POT_NXT][POT_NXT];
+   Pot_Out = new real [8*MaxNPG][GRA_NXT][GRA_NXT][GRA_NXT];
+
+   SOR_Omega          = -1.0;
+   SOR_Max_Iter       = -1;
+   SOR_Min_Iter       = -1;
+   MG_Max_Iter        = -1;
+   MG_NPre_Smooth     = -1;
+   MG_NPost_Smooth    = -1;
+   MG_Tolerated_Error = -1.0;
+
+#  if   ( POT_SCHEME == SOR )
+   Init_Set_Default_SOR_Parameter( SOR_Omega, SOR_Max_Iter, SOR_Min_Iter );
+#  elif ( POT_SCHEME == MG  )
+   Init_Set_Default_MG_Parameter( MG_Max_Iter, MG_NPre_Smooth, MG_NPost_Smooth, MG_Tolerated_Error );
+#  endif
+
+} // FUNCTION : Bench_Poisson_Allocate
+
+
+
+void Bench_Poisson_Free()
+{
+
+   delete [] Rho_In;    Rho_In  = NULL;
+   delete [] Pot_In;    Pot_In  = NULL;
+   delete [] Pot_Out;   Pot_Out = NULL;
+
+} // FUNCTION : Bench_Poisson_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Poisson_SetInput
+// Description :  Fill the input arrays of the Poisson solver with the target synthetic input
+//
+// Note        :  1. Density is the same as Bench_Fluid_SetInput()
+//                2. The coarse-grid potential providing the boundary condition is the softened point-mass
+//                   potential centered at each patch group
+//                3. The local patch IDs in each patch group follow the Morton order
+//
+// Parameter   :  Input : Target synthetic input
+//                NPG   : Number of patch groups
+//-------------------------------------------------------------------------------------------------------
+void Bench_Poisson_SetInput( const BenchInput_t Input, const int NPG )
+{
+
+   const int    NGhost_Pot = ( POT_NXT - PS1/2 )/2;
+   const double dh_Pot     = 2.0*dh;
+
+   for (int PG=0; PG<NPG; PG++)
+   for (int LocalID=0; LocalID<8; LocalID++)
+   {
+      const int    p  = 8*PG + LocalID;
+      const double x0 = PS1*dh*( (LocalID   )&1 );
+      const double y0 = PS1*dh*( (LocalID>>1)&1 );
+      const double z0 = PS1*dh*( (LocalID>>2)&1 );
+
+      for (int k=0; k<RHO_NXT; k++)    {  const double z = z0 + ( k - RHO_GHOST_SIZE + 0.5 )*dh;
+      for (int j=0; j<RHO_NXT; j++)    {  const double y = y0 + ( j - RHO_GHOST_SIZE + 0.5 )*dh;
+      for (int i=0; i<RHO_NXT; i++)    {  const double x = x0 + ( i - RHO_GHOST_SIZE + 0.5 )*dh;
+
+         double Dens, Vel[3], Pres;
+
+         Bench_GetFluid( Input, PG, x, y, z, Dens, Vel, Pres );
+
+         Rho_In[p][k][j][i] = Dens;
+      }}}
+
+      for (int k=0; k<POT_NXT; k++)    {  const double z = z0 + ( k - NGhost_Pot + 0.5 )*dh_Pot;
+      for (int j=0; j<POT_NXT; j++)    {  const double y = y0 + ( j - NGhost_Pot + 0.5 )*dh_Pot;
+      for (int i=0; i<POT_NXT; i++)    {  const double x = x0 + ( i - NGhost_Pot + 0.5 )*dh_Pot;
+
+         const double r2 = SQR(x-0.5) + SQR(y-0.5) + SQR(z-0.5);
+
+         Pot_In[p][k][j][i] = -1.0/sqrt( r2 + 0.1 );
+      }}}
+   } // for PG, LocalID
+
+} // FUNCTION : Bench_Poisson_SetInput
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Poisson_Run
+// Description :  Invoke the CPU Poisson solver (without the gravity solver) once
+//
+// Parameter   :  NPG : Number of patch groups
+//-------------------------------------------------------------------------------------------------------
+void Bench_Poisson_Run( const int NPG )
+{
+
+   CPU_PoissonGravitySolver( Rho_In, Pot_In, Pot_Out, NULL, NULL, NULL, NULL, NULL, NULL,
+                             NPG, NULL_REAL, dh, SOR_Min_Iter, SOR_Max_Iter, SOR_Omega,
+                             MG_Max_Iter, MG_NPre_Smooth, MG_NPost_Smooth, MG_Tolerated_Error,
+                             Poi_Coeff, IntScheme, false, NULL_REAL, NULL_REAL, true, false,
+                             GRAVITY_SELF, 0.0, 0.0, false, NULL_REAL );
+
+} // FUNCTION : Bench_Poisson_Run
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Poisson_Check
+// Description :  Compare the outputs of the first BENCH_REF_NPG patch groups with the reference outputs
+//
+// Parameter   :  See Bench_Fluid_Check()
+//
+// Return      :  true/false --> pass/fail
+//-------------------------------------------------------------------------------------------------------
+bool Bench_Poisson_Check( const char *Label, const int NPG, const double TolErr, double &MaxErr )
+{
+
+   const long NPG_Ref = MIN( NPG, BENCH_REF_NPG );
+
+   return Bench_Reference_Check( Label, Pot_Out[0][0][0], NPG_Ref*8*CUBE(GRA_NXT), TolErr, MaxErr );
+
+} // FUNCTION : Bench_Poisson_Check
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Poisson_NByte
+// Description :  Return the number of bytes per cell that the Poisson solver must at least read from and
+//                write to the main memory
+//-------------------------------------------------------------------------------------------------------
+double Bench_Poisson_NByte()
+{
+
+   const double NByte = sizeof(real)*( (double)CUBE(RHO_NXT) + (double)CUBE(POT_NXT) + (double)CUBE(GRA_NXT) );
+
+   return NByte/CUBE(PS1);
+
+} // FUNCTION : Bench_Poisson_NByte
+
+
+
+#endif // #if ( MODEL == HYDRO  &&  defined GRAVITY )
@@ -0,0 +1,294 @@
+#include "Benchmark.h"
+
+
+
+// maximum number of records and length of the record labels in the reference file
+#define BENCH_REF_NREC_MAX    1024
+#define BENCH_REF_LABEL_LEN   64
+
+static FILE *File_Ref = NULL;
+static bool  WriteRef = false;
+static int   NRecord  = 0;
+static char  RecordLabel[BENCH_REF_NREC_MAX][BENCH_REF_LABEL_LEN];
+static long  RecordNData[BENCH_REF_NREC_MAX];
+static real *RecordData [BENCH_REF_NREC_MAX];
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_GetConfig
+// Description :  Return a string describing the compile-time configuration of the solvers
+//
+// Note        :  1. Reference outputs can only be compared between builds with the same configuration
+//-------------------------------------------------------------------------------------------------------
+const char* Bench_GetConfig()
+{
+
+   static char Config[MAX_STRING];
+
+   int FluScheme=-1, LRScheme=-1, RSolver=-1, DualEnergy=0, UseMHD=0, UseGravity=0, PotScheme=-1, Float8=0;
+
+   FluScheme  = FLU_SCHEME;
+#  ifdef LR_SCHEME
+   LRScheme   = LR_SCHEME;
+#  endif
+#  ifdef RSOLVER
+   RSolver    = RSOLVER;
+#  endif
+#  ifdef DUAL_ENERGY
+   DualEnergy = DUAL_ENERGY;
+#  endif
+#  ifdef MHD
+   UseMHD     = 1;
+#  endif
+#  ifdef GRAVITY
+   UseGravity = 1;
+   PotScheme  = POT_SCHEME;
+#  endif
+#  ifdef FLOAT8
+   Float8     = 1;
+#  endif
+
+   sprintf( Config, "MODEL=%d FLU_SCHEME=%d LR_SCHEME=%d RSOLVER=%d DUAL_ENERGY=%d MHD=%d NCOMP_PASSIVE=%d "
+                    "PATCH_SIZE=%d FLU_GHOST_SIZE=%d GRAVITY=%d POT_SCHEME=%d FLOAT8=%d",
+            MODEL, FluScheme, LRScheme, RSolver, DualEnergy, UseMHD, NCOMP_PASSIVE,
+            PATCH_SIZE, FLU_GHOST_SIZE, UseGravity, PotScheme, Float8 );
+
+   return Config;
+
+} // FUNCTION : Bench_GetConfig
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_GetVariant
+// Description :  Return a string describing the compile-time variants of the CPU solvers that are expected
+//                to give identical results
+//
+// Note        :  1. Not included in Bench_GetConfig() so that the outputs of different variants can be compared
+//                   with the same reference file
+//                   --> e.g., write the reference file with the default build and compare it with a build
+//                       using -DRSOLVER_BATCH=0
+//-------------------------------------------------------------------------------------------------------
+const char* Bench_GetVariant()
+{
+
+   static char Variant[MAX_STRING];
+
+   int RSolverBatch=0, LRPencil=0;
+
+#  ifdef RSOLVER_BATCH
+   RSolverBatch = RSOLVER_BATCH;
+#  endif
+#  ifdef LR_PENCIL
+   LRPencil     = 1;
+#  endif
+
+   sprintf( Variant, "RSOLVER_BATCH=%d LR_PENCIL=%d", RSolverBatch, LRPencil );
+
+   return Variant;
+
+} // FUNCTION : Bench_GetVariant
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Reference_Open
+// Description :  Open the reference file for writing or load all records from it
+//
+// Note        :  1. File format:
+//                      int  : BENCH_REF_MAGIC
+//                      int  : BENCH_REF_VERSION
+//                      char : Bench_GetConfig() [MAX_STRING]
+//                   followed by the records:
+//                      char : label [BENCH_REF_LABEL_LEN]
+//                      long : number of elements N
+//                      real : data [N]
+//                2. Terminate the program if the configuration or precision does not match
+//
+// Parameter   :  FileName : Name of the reference file
+//                Write    : true/false --> write/load
+//-------------------------------------------------------------------------------------------------------
+void Bench_Reference_Open( const char *FileName, const bool Write )
+{
+
+   char Config[MAX_STRING];
+   int  Magic, Version;
+
+   WriteRef = Write;
+   NRecord  = 0;
+
+   if ( WriteRef )
+   {
+      File_Ref = fopen( FileName, "wb" );
+
+      if ( File_Ref == NULL )    Aux_Error( ERROR_INFO, "cannot create the reference file \"%s\" !!\n", FileName );
+
+      Magic   = BENCH_REF_MAGIC;
+      Version = BENCH_REF_VERSION;
+      memset( Config, 0, sizeof(Config) );
+      strcpy( Config, Bench_GetConfig() );
+
+      fwrite( &Magic,   sizeof(int),  1,          File_Ref );
+      fwrite( &Version, sizeof(int),  1,          File_Ref );
+      fwrite( Config,   sizeof(char), MAX_STRING, File_Ref );
+   }
+
+   else
+   {
+      FILE *File = fopen( FileName, "rb" );
+
+      if ( File == NULL )  Aux_Error( ERROR_INFO, "reference file \"%s\" does not exist !!\n", FileName );
+
+      if (  fread( &Magic,   sizeof(int),  1,          File ) != 1  ||  Magic != BENCH_REF_MAGIC  ||
+            fread( &Version, sizeof(int),  1,          File ) != 1  ||  Version != BENCH_REF_VERSION  ||
+            fread( Config,   sizeof(char), MAX_STRING, File ) != MAX_STRING  )
+         Aux_Error( ERROR_INFO, "\"%s\" is not a reference file of the current version !!\n", FileName );
+
+      if ( strcmp( Config, Bench_GetConfig() ) != 0 )
+         Aux_Error( ERROR_INFO, "inconsistent configuration in the reference file \"%s\" !!\n"
+                    "        reference : %s\n        current   : %s\n", FileName, Config, Bench_GetConfig() );
+
+      while ( NRecord < BENCH_REF_NREC_MAX  &&
+              fread( RecordLabel[NRecord], sizeof(char), BENCH_REF_LABEL_LEN, File ) == BENCH_REF_LABEL_LEN )
+      {
+         long NData;
+
+         if ( fread( &NData, sizeof(long), 1, File ) != 1 )
+            Aux_Error( ERROR_INFO, "reference file \"%s\" is truncated !!\n", FileName );
+
+         RecordNData[NRecord] = NData;
+         RecordData [NRecord] = new real [NData];
+
+         if ( fread( RecordData[NRecord], sizeof(real), NData, File ) != (size_t)NData )
+            Aux_Error( ERROR_INFO, "reference file \"%s\" is truncated !!\n", FileName );
+
+         NRecord ++;
+      }
+
+      fclose( File );
+   } // if ( WriteRef ) ... else ...
+
+} // FUNCTION : Bench_Reference_Open
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Reference_Close
+// Description :  Close the reference file and free the loaded records
+//-------------------------------------------------------------------------------------------------------
+void Bench_Reference_Close()
+{
+
+   if ( File_Ref != NULL )
+   {
+      fclose( File_Ref );
+      File_Ref = NULL;
+   }
+
+   if ( !WriteRef )
+      for (int t=0; t<NRecord; t++)    delete [] RecordData[t];
+
+   NRecord = 0;
+
+} // FUNCTION : Bench_Reference_Close
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_Reference_Check
+// Description :  Write the target data as a new record or compare them with the record of the same label
+//
+// Note        :  1. Do nothing if no reference file is opened
+//                2. Writing : only the first occurrence of each label is written
+//                3. Comparing : the error is the maximum difference normalized by the maximum magnitude of the
+//                               record, evaluated over the first min( NData, number of stored elements )
+//                               elements
+//                               --> Reference outputs of BENCH_REF_NPG patch groups can be compared with the
+//                                   outputs of any number of patch groups
+//                               --> Non-finite outputs always fail
+//                4. MaxErr < 0.0 if the target data are not compared
+//
+// Parameter   :  Label  : Label of the target data
+//                Data   : Target data
+//                NData  : Number of elements in Data[]
+//                TolErr : Maximum allowed error
+//                MaxErr : Error to be returned
+//
+// Return      :  true/false --> pass/fail
+//-------------------------------------------------------------------------------------------------------
+bool Bench_Reference_Check( const char *Label, const real *Data, const long NData, const double TolErr,
+                            double &MaxErr )
+{
+
+   MaxErr = -1.0;
+
+   if ( File_Ref == NULL  &&  NRecord == 0 )    return true;
+
+   if ( strlen(Label) >= BENCH_REF_LABEL_LEN )
+      Aux_Error( ERROR_INFO, "label \"%s\" is too long (>= %d) !!\n", Label, BENCH_REF_LABEL_LEN );
+
+
+// look for the target label
+   int Rec = -1;
+   for (int t=0; t<NRecord; t++)
+   {
+      if ( strcmp( RecordLabel[t], Label ) == 0 )
+      {
+         Rec = t;
+         break;
+      }
+   }
+
+
+// write
+   if ( WriteRef )
+   {
+      if ( Rec != -1 )  return true;
+
+      if ( NRecord >= BENCH_REF_NREC_MAX )
+         Aux_Error( ERROR_INFO, "number of reference records exceeds the limit (%d) !!\n", BENCH_REF_NREC_MAX );
+
+      memset( RecordLabel[NRecord], 0, BENCH_REF_LABEL_LEN );
+      strcpy( RecordLabel[NRecord], Label );
+
+      fwrite( RecordLabel[NRecord], sizeof(char), BENCH_REF_LABEL_LEN, File_Ref );
+      fwrite( &NData,               sizeof(long), 1,                   File_Ref );
+      fwrite( Data,                 sizeof(real), NData,               File_Ref );
+
+      NRecord ++;
+      MaxErr = 0.0;
+
+      return true;
+   }
+
+
+// compare
+   if ( Rec == -1 )
+   {
+      Aux_Message( stderr, "WARNING : no reference outputs for \"%s\" !!\n", Label );
+      return true;
+   }
+
+   const long  N   = MIN( NData, RecordNData[Rec] );
+   const real *Ref = RecordData[Rec];
+   double MaxRef = 0.0, MaxDiff = 0.0;
+
+   for (long t=0; t<N; t++)
+   {
+      if ( !Aux_IsFinite(Data[t]) )
+      {
+         MaxErr = __FLT_MAX__;
+         return false;
+      }
+
+      MaxRef  = MAX( MaxRef,  fabs( (double)Ref[t] ) );
+      MaxDiff = MAX( MaxDiff, fabs( (double)Data[t] - (double)Ref[t] ) );
+   }
+
+   MaxErr = ( MaxRef > 0.0 ) ? MaxDiff/MaxRef : MaxDiff;
+
+   return ( MaxErr <= TolErr );
+
+} // FUNCTION : Bench_Reference_Check
@@ -0,0 +1,172 @@
+#include "Benchmark.h"
+
+#if ( MODEL == HYDRO )
+
+
+
+// input and output arrays of the benchmark
+static real (*Flu_In)[NCOMP_FLUID][ CUBE(PS1) ]           = NULL;
+static real (*Mag_In)[NCOMP_MAG][ PS1P1*SQR(PS1) ]        = NULL;
+static real  *dt_Out                                      = NULL;
+
+// parameters of the dt solver
+static const real Gamma  = 5.0/3.0;
+static const real Safety = 0.5;
+static const real dh     = 1.0/PS2;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_dt_Allocate / Bench_dt_Free
+// Description :  Allocate/free the arrays of the dt solver benchmark
+//
+// Parameter   :  MaxNPG : Maximum number of patch groups per solver call
+//-------------------------------------------------------------------------------------------------------
+void Bench_dt_Allocate( const int MaxNPG )
+{
+
+   Flu_In = new real [8*MaxNPG][NCOMP_FLUID][ CUBE(PS1) ];
+   dt_Out = new real [8*MaxNPG];
+#  ifdef MHD
+   Mag_In = new real [8*MaxNPG][NCOMP_MAG][ PS1P1*SQR(PS1) ];
+#  endif
+
+} // FUNCTION : Bench_dt_Allocate
+
+
+
+void Bench_dt_Free()
+{
+
+   delete [] Flu_In;    Flu_In = NULL;
+   delete [] Mag_In;    Mag_In = NULL;
+   delete [] dt_Out;    dt_Out = NULL;
+
+} // FUNCTION : Bench_dt_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_dt_SetInput
+// Description :  Fill the input arrays of the dt solver with the target synthetic input
+//
+// Note        :  1. Same fluid as Bench_Fluid_SetInput() without ghost zones
+//                2. The local patch IDs in each patch group follow the Morton order
+//
+// Parameter   :  Input : Target synthetic input
+//                NPG   : Number of patch groups
+//-------------------------------------------------------------------------------------------------------
+void Bench_dt_SetInput( const BenchInput_t Input, const int NPG )
+{
+
+   const real Gamma_m1 = Gamma - (real)1.0;
+
+   for (int PG=0; PG<NPG; PG++)
+   for (int LocalID=0; LocalID<8; LocalID++)
+   {
+      const int    p     = 8*PG + LocalID;
+      const double x0    = PS1*dh*( (LocalID   )&1 );
+      const double y0    = PS1*dh*( (LocalID>>1)&1 );
+      const double z0    = PS1*dh*( (LocalID>>2)&1 );
+
+#     ifdef MHD
+      for (int v=0; v<NCOMP_MAG; v++)
+      {
+         const int Nx = ( v == MAGX ) ? PS1P1 : PS1;
+         const int Ny = ( v == MAGY ) ? PS1P1 : PS1;
+         const int Nz = ( v == MAGZ ) ? PS1P1 : PS1;
+
+         for (int k=0; k<Nz; k++)   {  const double z = z0 + ( k + ( v == MAGZ ? 0.0 : 0.5 ) )*dh;
+         for (int j=0; j<Ny; j++)   {  const double y = y0 + ( j + ( v == MAGY ? 0.0 : 0.5 ) )*dh;
+         for (int i=0; i<Nx; i++)   {  const double x = x0 + ( i + ( v == MAGX ? 0.0 : 0.5 ) )*dh;
+
+            double B[NCOMP_MAG];
+            Bench_GetMag( Input, PG, x, y, z, B );
+
+            Mag_In[p][v][ IDX321(i,j,k,Nx,Ny) ] = B[v];
+         }}}
+      }
+#     endif // #ifdef MHD
+
+      for (int k=0; k<PS1; k++)  {  const double z = z0 + ( k + 0.5 )*dh;
+      for (int j=0; j<PS1; j++)  {  const double y = y0 + ( j + 0.5 )*dh;
+      for (int i=0; i<PS1; i++)  {  const double x = x0 + ( i + 0.5 )*dh;
+
+         const int idx = IDX321( i, j, k, PS1, PS1 );
+         double Dens, Vel[3], Pres, EngyB=0.0;
+
+         Bench_GetFluid( Input, PG, x, y, z, Dens, Vel, Pres );
+
+#        ifdef MHD
+         EngyB = MHD_GetCellCenteredBEnergy( Mag_In[p][MAGX], Mag_In[p][MAGY], Mag_In[p][MAGZ],
+                                             PS1, PS1, PS1, i, j, k );
+#        endif
+
+         Flu_In[p][DENS][idx] = Dens;
+         Flu_In[p][MOMX][idx] = Dens*Vel[0];
+         Flu_In[p][MOMY][idx] = Dens*Vel[1];
+         Flu_In[p][MOMZ][idx] = Dens*Vel[2];
+         Flu_In[p][ENGY][idx] = Pres/Gamma_m1 + 0.5*Dens*( SQR(Vel[0]) + SQR(Vel[1]) + SQR(Vel[2]) ) + EngyB;
+      }}}
+   } // for PG, LocalID
+
+} // FUNCTION : Bench_dt_SetInput
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_dt_Run
+// Description :  Invoke the CPU CFL dt solver once
+//
+// Parameter   :  NPG : Number of patch groups
+//-------------------------------------------------------------------------------------------------------
+void Bench_dt_Run( const int NPG )
+{
+
+   CPU_dtSolver( DT_FLU_SOLVER, dt_Out, Flu_In, Mag_In, NULL, NULL, NPG, dh, Safety, Gamma, (real)0.0,
+                 false, GRAVITY_NONE, false, 0.0 );
+
+} // FUNCTION : Bench_dt_Run
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_dt_Check
+// Description :  Compare the outputs of the first BENCH_REF_NPG patch groups with the reference outputs
+//
+// Parameter   :  See Bench_Fluid_Check()
+//
+// Return      :  true/false --> pass/fail
+//-------------------------------------------------------------------------------------------------------
+bool Bench_dt_Check( const char *Label, const int NPG, const double TolErr, double &MaxErr )
+{
+
+   const long NPG_Ref = MIN( NPG, BENCH_REF_NPG );
+
+   return Bench_Reference_Check( Label, dt_Out, NPG_Ref*8, TolErr, MaxErr );
+
+} // FUNCTION : Bench_dt_Check
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Bench_dt_NByte
+// Description :  Return the number of bytes per cell that the dt solver must at least read from and write to
+//                the main memory
+//-------------------------------------------------------------------------------------------------------
+double Bench_dt_NByte()
+{
+
+   double NByte = sizeof(real)*( (double)NCOMP_FLUID*CUBE(PS1) + 1.0 );
+#  ifdef MHD
+   NByte += sizeof(real)*( (double)NCOMP_MAG*PS1P1*SQR(PS1) );
+#  endif
+
+   return NByte/CUBE(PS1);
+
+} // FUNCTION : Bench_dt_NByte
+
+
+
+#endif // #if ( MODEL == HYDRO )
@@ -22,6 +22,7 @@ void CPU_FluidSolver_RTVD(
    const int NPatchGroup, const real dt, const real dh, const real Gamma,
    const bool StoreFlux, const bool XYZ, const real MinDens, const real MinPres );
 #elif ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+template <int LR, int RS>
 void CPU_FluidSolver_MHM(
    const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],
          real   g_Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],
@@ -32,10 +33,10 @@ void CPU_FluidSolver_MHM(
          real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
-         real   g_PriVar       []   [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT) ],
-         real   g_Slope_PPM    [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-         real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const int NPatchGroup, const real dt, const real dh, const real Gamma,
@@ -44,8 +45,9 @@ void CPU_FluidSolver_MHM(
    const double Time, const OptGravityType_t GravityType,
    const double c_ExtAcc_AuxArray[], const real MinDens, const real MinPres,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int c_NormIdx[],
-   const bool JeansMinPres, const real JeansMinPres_Coeff );
+   const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab );
 #elif ( FLU_SCHEME == CTU )
+template <int LR, int RS>
 void CPU_FluidSolver_CTU(
    const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],
          real   g_Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],
@@ -56,10 +58,10 @@ void CPU_FluidSolver_CTU(
          real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
-         real   g_PriVar       []   [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT) ],
-         real   g_Slope_PPM    [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-         real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const int NPatchGroup, const real dt, const real dh, const real Gamma,
@@ -68,9 +70,37 @@ void CPU_FluidSolver_CTU(
    const double Time, const OptGravityType_t GravityType,
    const double c_ExtAcc_AuxArray[], const real MinDens, const real MinPres,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int c_NormIdx[],
-   const bool JeansMinPres, const real JeansMinPres_Coeff );
+   const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab );
 #endif // FLU_SCHEME
 
+#if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+typedef void (*HydroSolver_t)(
+   const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],
+         real   g_Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],
+   const real   g_Mag_Array_In [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
+         real   g_Mag_Array_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
+         char   g_DE_Array_Out [][ CUBE(PS2) ],
+         real   g_Flux_Array   [][9][NCOMP_TOTAL][ SQR(PS2) ],
+         real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
+   const double g_Corner_Array [][3],
+   const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],
+         real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
+         real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
+   const int NPatchGroup, const real dt, const real dh, const real Gamma,
+   const bool StoreFlux, const bool StoreElectric,
+   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+   const double Time, const OptGravityType_t GravityType,
+   const double c_ExtAcc_AuxArray[], const real MinDens, const real MinPres,
+   const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int c_NormIdx[],
+   const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab );
+
+static HydroSolver_t GetHydroSolver( const OptLRScheme_t LR_Scheme, const OptRSolver_t RSolver );
+#endif
+
 #elif ( MODEL == ELBDM )
 void CPU_ELBDMSolver( real Flu_Array_In [][FLU_NIN    ][ FLU_NXT*FLU_NXT*FLU_NXT ],
                       real Flu_Array_Out[][FLU_NOUT   ][ PS2*PS2*PS2 ],
@@ -84,10 +114,10 @@ void CPU_ELBDMSolver( real Flu_Array_In [][FLU_NIN    ][ FLU_NXT*FLU_NXT*FLU_NXT
 
 
 #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-extern real (*h_PriVar)      [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT)     ];
-extern real (*h_Slope_PPM)[3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ];
-extern real (*h_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
-extern real (*h_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
+extern real (*h_PriVar)      [NCOMP_LR][ CUBE(FLU_NXT)     ];
+extern real (*h_Slope_PPM)[3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ];
+extern real (*h_FC_Var)   [6][NCOMP_LR][ CUBE(N_FC_VAR)    ];
+extern real (*h_FC_Flux)  [3][NCOMP_LR][ CUBE(N_FC_FLUX)   ];
 #ifdef MHD
 extern real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
 extern real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ];
@@ -134,6 +164,9 @@ static real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ] = NULL;
 //                                       (0/1/2/3/4) = (vanLeer/generalized MinMod/vanAlbada/
 //                                                      vanLeer + generalized MinMod/extrema-preserving) limiter
 //                MinMod_Coeff         : Coefficient of the generalized MinMod limiter
+//                LR_Scheme            : Data reconstruction scheme in the MHM/MHM_RP/CTU schemes (PLM/PPM)
+//                                       --> See GetHydroSolver()
+//                RSolver              : Riemann solver in the MHM/MHM_RP/CTU schemes (EXACT/ROE/HLLE/HLLC/HLLD)
 //                ELBDM_Eta            : Particle mass / Planck constant
 //                ELBDM_Taylor3_Coeff  : Coefficient in front of the third term in the Taylor expansion for ELBDM
 //                ELBDM_Taylor3_Auto   : true --> Determine ELBDM_Taylor3_Coeff automatically by invoking the
@@ -150,9 +183,12 @@ static real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ] = NULL;
 //                                       --> Should be set to the global variable "PassiveNorm_VarIdx"
 //                JeansMinPres         : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff   : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
+//                FusedSlab            : Thickness of the slabs evaluated by the fused MHM/CTU solvers
+//                                       --> <= 0: disable the fused solvers
+//                                       --> See CPU_FluidSolver_MHM/CTU()
 //
 // Useless parameters in HYDRO : ELBDM_Eta, ELBDM_Taylor3_Coeff, ELBDM_Taylor3_Auto
-// Useless parameters in ELBDM : Gamma, LR_Limiter, MinMod_Coeff, MinPres
+// Useless parameters in ELBDM : Gamma, LR_Limiter, MinMod_Coeff, LR_Scheme, RSolver, MinPres, FusedSlab
 //-------------------------------------------------------------------------------------------------------
 void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       real h_Flu_Array_Out[][FLU_NOUT][ CUBE(PS2) ],
@@ -166,11 +202,12 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                       const int NPatchGroup, const real dt, const real dh, const real Gamma,
                       const bool StoreFlux, const bool StoreElectric,
                       const bool XYZ, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                      const OptLRScheme_t LR_Scheme, const OptRSolver_t RSolver,
                       const real ELBDM_Eta, real ELBDM_Taylor3_Coeff, const bool ELBDM_Taylor3_Auto,
                       const double Time, const OptGravityType_t GravityType,
                       const real MinDens, const real MinPres, const real DualEnergySwitch,
                       const bool NormPassive, const int NNorm, const int NormIdx[],
-                      const bool JeansMinPres, const real JeansMinPres_Coeff )
+                      const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab )
 {
 
 // check
@@ -203,23 +240,17 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
       CPU_FluidSolver_RTVD( h_Flu_Array_In, h_Flu_Array_Out, h_Flux_Array, h_Corner_Array, h_Pot_Array_USG,
                             NPatchGroup, dt, dh, Gamma, StoreFlux, XYZ, MinDens, MinPres );
 
-#     elif ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+#     elif ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
 
-      CPU_FluidSolver_MHM ( h_Flu_Array_In, h_Flu_Array_Out, h_Mag_Array_In, h_Mag_Array_Out,
-                            h_DE_Array_Out, h_Flux_Array, h_Ele_Array, h_Corner_Array, h_Pot_Array_USG,
-                            h_PriVar, h_Slope_PPM, h_FC_Var, h_FC_Flux, h_FC_Mag_Half, h_EC_Ele,
-                            NPatchGroup, dt, dh, Gamma, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff, Time,
-                            GravityType, ExtAcc_AuxArray, MinDens, MinPres, DualEnergySwitch,
-                            NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff );
-
-#     elif ( FLU_SCHEME == CTU )
+//    the data reconstruction scheme and the Riemann solver are selected once per invocation
+      const HydroSolver_t HydroSolver = GetHydroSolver( LR_Scheme, RSolver );
 
-      CPU_FluidSolver_CTU ( h_Flu_Array_In, h_Flu_Array_Out, h_Mag_Array_In, h_Mag_Array_Out,
+      HydroSolver         ( h_Flu_Array_In, h_Flu_Array_Out, h_Mag_Array_In, h_Mag_Array_Out,
                             h_DE_Array_Out, h_Flux_Array, h_Ele_Array, h_Corner_Array, h_Pot_Array_USG,
                             h_PriVar, h_Slope_PPM, h_FC_Var, h_FC_Flux, h_FC_Mag_Half, h_EC_Ele,
                             NPatchGroup, dt, dh, Gamma, StoreFlux, StoreElectric, LR_Limiter, MinMod_Coeff, Time,
                             GravityType, ExtAcc_AuxArray, MinDens, MinPres, DualEnergySwitch,
-                            NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff );
+                            NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff, FusedSlab );
 
 #     else
 
@@ -243,4 +274,43 @@ void CPU_FluidSolver( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_NXT) ],
 
 
 
+#if ( MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU ) )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetHydroSolver
+// Description :  Return the CPU MHM/MHM_RP/CTU solver instantiated for the target data reconstruction scheme
+//                and Riemann solver
+//
+// Note        :  1. All valid combinations are instantiated by HYDRO_FOR_EACH_SCHEME() in CUFLU.h
+//                2. PPM is only available when LR_SCHEME == PPM since it requires the larger ghost zones
+//                   --> Already checked by Aux_Check_Parameter()
+//
+// Parameter   :  LR_Scheme : Data reconstruction scheme (LR_SCHEME_PLM/PPM)
+//                RSolver   : Riemann solver (RSOLVER_EXACT/ROE/HLLE/HLLC/HLLD)
+//
+// Return      :  Function pointer to the target solver
+//-------------------------------------------------------------------------------------------------------
+HydroSolver_t GetHydroSolver( const OptLRScheme_t LR_Scheme, const OptRSolver_t RSolver )
+{
+
+#  if   ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+#  define HYDRO_SOLVER     CPU_FluidSolver_MHM
+#  elif ( FLU_SCHEME == CTU )
+#  define HYDRO_SOLVER     CPU_FluidSolver_CTU
+#  endif
+#  define GET_SOLVER( LR, RS )   if ( LR_Scheme == LR  &&  RSolver == RS )  return HYDRO_SOLVER <LR, RS>;
+
+   HYDRO_FOR_EACH_SCHEME( GET_SOLVER )
+
+#  undef GET_SOLVER
+#  undef HYDRO_SOLVER
+
+   Aux_Error( ERROR_INFO, "unsupported OPT__LR_SCHEME (%d) and OPT__RSOLVER (%d) !!\n", LR_Scheme, RSolver );
+
+   return NULL;
+
+} // FUNCTION : GetHydroSolver
+#endif // #if ( MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU ) )
+
+
+
 #endif // #ifndef GPU
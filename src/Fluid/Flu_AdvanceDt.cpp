@@ -22,6 +22,9 @@ extern void (*Flu_ResetByUser_API_Ptr)( const int lv, const int FluSg, const dou
 // Note        :  1. Invoke InvokeSolver()
 //                2. Currently the updated data can only be stored in the different sandglass from the
 //                   input data
+//                3. For OverlapMPI, this function is invoked twice (first Overlap_Sync=true and then false)
+//                   --> Operations applied to the entire level are done only before advancing the Sync patches
+//                       and after advancing the Async patches
 //
 // Parameter   :  lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
@@ -42,13 +45,17 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
                    const int SaveSg_Flu, const int SaveSg_Mag, const bool OverlapMPI, const bool Overlap_Sync )
 {
 
+   const bool FirstCall = ( !OverlapMPI  ||   Overlap_Sync );
+   const bool LastCall  = ( !OverlapMPI  ||  !Overlap_Sync );
+
+
 // initialize flux_tmp[] (and electric_tmp[] in MHD) on the parent level for AUTO_REDUCE_DT
-   if ( AUTO_REDUCE_DT  &&  lv != 0 )  Flu_InitFixUpTempArray( lv-1 );
+   if ( AUTO_REDUCE_DT  &&  lv != 0  &&  FirstCall )  Flu_InitFixUpTempArray( lv-1 );
 
 
 // initialize patch->ele_corrected[] for correcting the coarse-grid electric field
 #  ifdef MHD
-   if ( OPT__FIXUP_ELECTRIC  &&  lv != 0 )
+   if ( OPT__FIXUP_ELECTRIC  &&  lv != 0  &&  FirstCall )
    {
       const int FaLv = lv - 1;
 
@@ -75,7 +82,7 @@ int Flu_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, con
 
 
 // note that we always have FluStatus == GAMER_SUCCESS if AUTO_REDUCE_DT is disabled
-   if ( FluStatus_AllRank == GAMER_SUCCESS )
+   if ( FluStatus_AllRank == GAMER_SUCCESS  &&  LastCall )
    {
 //    reset the fluxes and electric field in the buffer patches at lv as zeros
 //    --> for accumulating the coarse-fine fluxes and electric field later when evolving lv+1
@@ -11,15 +11,21 @@ static void StoreFlux( const int lv, const real Flux_Array[][9][NFLUX_TOTAL][ SQ
 static void CorrectFlux( const int SonLv, const real Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                          const int NPG, const int *PID0_List, const real dt );
 #if ( MODEL == HYDRO )
-static bool Unphysical( const real Fluid[], const real Gamma_m1, const int CheckMinEngyOrPres, const real EngyB );
-static void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
-                               const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
-                               real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
-                               char h_DE_Array_F_Out[][ CUBE(PS2) ],
-                               real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
-                               const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
-                               const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
-                               const real dt );
+bool Unphysical( const real Fluid[], const real Gamma_m1, const int CheckMinEngyOrPres, const real EngyB );
+void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
+                        const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
+                        real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                        char h_DE_Array_F_Out[][ CUBE(PS2) ],
+                        real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                        const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
+                        const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
+                        const real dt, bool PGFailed[] );
+void Flu_RetryPatchGroup( const int lv, const int NPG, const int *PID0_List, const bool PGFailed[],
+                          const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
+                          real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                          char h_DE_Array_F_Out[][ CUBE(PS2) ],
+                          real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                          const real dt );
 #ifdef MHD
 void StoreElectric( const int lv, const real h_Ele_Array[][9][NCOMP_ELE][ PS2P1*PS2 ],
                     const int NPG, const int *PID0_List, const real dt );
@@ -42,7 +48,7 @@ extern void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real
 // Description :  1. Save the fluxes across the coarse-fine boundaries at level "lv"
 //                2. Correct the fluxes across the coarse-fine boundaries at level "lv-1"
 //                3. Copy the data from the "h_Flu_Array_F_Out" and "h_DE_Array_F_Out" arrays to the "amr->patch" pointers
-//                4. Get the minimum time-step information of the fluid solver
+//                4. Cache the maximum CFL speed of the updated patches for OPT__DT_CFL_CACHE
 //
 // Parameter   :  lv                : Target refinement level
 //                SaveSg_Flu        : Sandglass to store the updated fluid data
@@ -73,8 +79,20 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
 // try to correct the unphysical results in h_Flu_Array_F_Out (e.g., negative density)
 // --> must be done BEFORE invoking both StoreFlux() and CorrectFlux() since CorrectUnphysical() might modify the flux array
 #  if ( MODEL == HYDRO )
+// for AUTO_REDUCE_DT_LOCAL, patch groups which cannot be corrected are first retried with local sub-steps
+// --> the entire level is re-advanced with a smaller dt only if the retry fails as well
+   bool *PGFailed = ( AUTO_REDUCE_DT  &&  AUTO_REDUCE_DT_LOCAL > 1 ) ? new bool [NPG] : NULL;
+
    CorrectUnphysical( lv, NPG, PID0_List, h_Flu_Array_F_In, h_Flu_Array_F_Out, h_DE_Array_F_Out, h_Flux_Array,
-                      h_Mag_Array_F_In, h_Mag_Array_F_Out, dt );
+                      h_Mag_Array_F_In, h_Mag_Array_F_Out, dt, PGFailed );
+
+   if ( PGFailed != NULL )
+   {
+      Flu_RetryPatchGroup( lv, NPG, PID0_List, PGFailed, h_Flu_Array_F_In, h_Flu_Array_F_Out, h_DE_Array_F_Out,
+                           h_Flux_Array, dt );
+
+      delete [] PGFailed;
+   }
 #  endif
 
 
@@ -167,6 +185,11 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
          } // for (int v=0; v<NCOMP_MAG; v++)
 #        endif // #ifdef MHD
 
+//       maximum CFL speed for the next hydro time-step
+#        if ( MODEL == HYDRO )
+         if ( OPT__DT_CFL_CACHE )   dt_CFLCache_Update( lv, SaveSg_Flu, PID );
+#        endif
+
       } // for (int LocalID=0; LocalID<8; LocalID++)
    } // for (int TID=0; TID<NPG; TID++)
 
@@ -351,6 +374,7 @@ void CorrectFlux( const int SonLv, const real h_Flux_Array[][9][NFLUX_TOTAL][ SQ
 //                   --> It also checks if any variable is -inf, +inf, or nan
 //                   --> It does NOT check if passive scalars are negative
 //                       --> We already apply a floor value in Hydro_Shared_FullStepUpdate()
+//                3. Also invoked by Flu_Close_Cluster() to decide which clusters must be recalculated
 //
 // Parameter   :  Fluid              : Input fluid variable array with size FLU_NOUT
 //                Gamma_m1           : Gamma - 1
@@ -434,7 +458,8 @@ bool Unphysical( const real Fluid[], const real Gamma_m1, const int CheckMinEngy
 //
 //                      if ( still_found_unphysical )
 //                         if ( AUTO_REDUCE_DT )
-//                            Invoke the fluid solver again on the same level but with a smaller dt
+//                            Retry the failed patch groups with local sub-steps (if PGFailed != NULL)
+//                            or invoke the fluid solver again on the same level but with a smaller dt
 //                         else
 //                            Print debug messages and abort
 //                      else
@@ -451,6 +476,9 @@ bool Unphysical( const real Fluid[], const real Gamma_m1, const int CheckMinEngy
 //                h_Mag_Array_F_In  : Input B field array
 //                h_Mag_Array_F_Out : Output B field array
 //                dt                : Evolution time-step
+//                PGFailed          : Array to record the patch groups which cannot be corrected (for AUTO_REDUCE_DT_LOCAL)
+//                                    --> If it is not NULL, failed patch groups are only recorded here and
+//                                        FluStatus_ThisRank is left unchanged
 //-------------------------------------------------------------------------------------------------------
 void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
                         const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
@@ -459,7 +487,7 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
                         real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                         const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                         const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
-                        const real dt )
+                        const real dt, bool PGFailed[] )
 {
 
    const real dh           = (real)amr->dh[lv];
@@ -513,6 +541,8 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
 #  pragma omp for reduction( +:NCorrThisTime ) schedule( runtime )
    for (int TID=0; TID<NPG; TID++)
    {
+      if ( PGFailed != NULL )    PGFailed[TID] = false;
+
       for (ijk_out[2]=0; ijk_out[2]<PS2; ijk_out[2]++)
       for (ijk_out[1]=0; ijk_out[1]<PS2; ijk_out[1]++)
       for (ijk_out[0]=0; ijk_out[0]<PS2; ijk_out[0]++)
@@ -778,6 +808,8 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
 #              pragma omp critical
                CorrectUnphy = GAMER_FAILED;
 
+               if ( PGFailed != NULL )    PGFailed[TID] = true;
+
 
 //             output the debug information (only if AUTO_REDUCE_DT is disabled)
                if ( !AUTO_REDUCE_DT )
@@ -964,7 +996,8 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
 
 
 // operations when CorrectUnphysical() fails
-   if ( CorrectUnphy == GAMER_FAILED )
+// --> for PGFailed != NULL, the caller is responsible for handling the failed patch groups
+   if ( CorrectUnphy == GAMER_FAILED  &&  PGFailed == NULL )
    {
 //    if AUTO_REDUCE_DT is enabled, set FluStatus_ThisRank as GAMER_FAILED to rerun Flu_AdvancedDt() with a smaller dt
       if ( AUTO_REDUCE_DT )
@@ -979,6 +1012,8 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
 // accumulate the total number of corrected cells in one global time-step if CorrectUnphysical() works
    else
    {
+//    atomic since the closing steps of different patch-group chunks may run concurrently for OPT__TASK_GRAPH
+#     pragma omp atomic
       NCorrUnphy[lv] += NCorrThisTime;
    }
 
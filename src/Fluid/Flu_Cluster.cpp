@@ -0,0 +1,408 @@
+#include "GAMER.h"
+
+#ifdef FLU_CLUSTER
+
+
+
+// number of patches in each direction of a cluster including the patches providing the ghost zones
+#define FLU_CLU_NBOX    ( 2*FLU_CLU_NPG + 2 )
+
+#if ( FLU_GHOST_SIZE > PATCH_SIZE )
+#  error : ERROR : FLU_GHOST_SIZE > PATCH_SIZE is not supported by OPT__FLU_CLUSTER !!
+#endif
+
+static bool GetClusterBox( const int lv, const int *Clu_PID0, int BoxPID[] );
+bool Unphysical( const real Fluid[], const real Gamma_m1, const int CheckMinEngyOrPres, const real EngyB );
+void SetTempIntPara( const int lv, const int Sg_Current, const double PrepTime, const double Time0, const double Time1,
+                     bool &IntTime, int &Sg, int &Sg_IntT, real &Weighting, real &Weighting_IntT );
+
+// LocalID of the patch at the relative position [k][j][i] in a patch group
+static const int LocalID[2][2][2] = { 0, 1, 2, 4, 3, 6, 5, 7 };
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FindCluster
+// Description :  Find the clusters of FLU_CLU_NPG^3 patch groups which can be advanced as single blocks by
+//                CPU_FluidSolver_Cluster()
+//
+// Note        :  1. Invoked by InvokeSolver() when OPT__FLU_CLUSTER is on
+//                2. A cluster is composed of the target patch groups whose corners are multiples of FLU_CLU_NPG
+//                   patch groups relative to the first patch group (i.e., the "anchor") and must satisfy
+//                   (a) all member patch groups are in the input list PID0_List[]
+//                   (b) all sibling patches required for the ghost zones exist at the same level
+//                       --> no interpolation and no coarse-fine boundary
+//                   (c) no member patch has flux arrays
+//                       --> no coarse-fine fluxes to be stored
+//                3. PID0_List[] is compacted to the remaining patch groups in their original order
+//                   --> NPG is reset accordingly
+//                4. Clu_PID0_List[] stores the PID0 of the FLU_CLU_NPG^3 patch groups of each cluster with
+//                   the x index varying fastest
+//                   --> Its size must be at least the input NPG
+//                5. No clusters are selected if PrepTime requires temporal interpolation
+//
+// Parameter   :  lv             : Target refinement level
+//                PrepTime       : Target physical time to prepare the input data
+//                NPG            : Number of target patch groups (call-by-reference)
+//                PID0_List      : List recording the target patch indices with LocalID==0
+//                Clu_PID0_List  : List to store the patch indices with LocalID==0 of all clusters
+//
+// Return      :  Number of clusters, NPG, PID0_List[], Clu_PID0_List[]
+//-------------------------------------------------------------------------------------------------------
+int Flu_FindCluster( const int lv, const double PrepTime, int &NPG, int *PID0_List, int *Clu_PID0_List )
+{
+
+   const int NPG_Clu  = CUBE( FLU_CLU_NPG );
+   const int NReal_PG = amr->NPatchComma[lv][1] / 8;
+   const int PGScale  = PS2*amr->scale[lv];
+
+   bool IntTime;
+   int  FluSg, FluSg_IntT;
+   real FluWeighting, FluWeighting_IntT;
+
+   SetTempIntPara( lv, amr->FluSg[lv], PrepTime, amr->FluSgTime[lv][0], amr->FluSgTime[lv][1],
+                   IntTime, FluSg, FluSg_IntT, FluWeighting, FluWeighting_IntT );
+
+   if ( IntTime  ||  NPG < NPG_Clu )   return 0;
+
+
+// record the target patch groups
+   bool *Target = new bool [NReal_PG];
+
+   for (int t=0; t<NReal_PG; t++)   Target[t] = false;
+   for (int t=0; t<NPG; t++)        Target[ PID0_List[t]/8 ] = true;
+
+
+// find clusters
+   int NClu = 0;
+   int BoxPID[ CUBE(FLU_CLU_NBOX) ];
+
+   for (int t=0; t<NPG; t++)
+   {
+      const int  PID0   = PID0_List[t];
+      const int *Corner = amr->patch[0][lv][PID0]->corner;
+
+      if (  ( Corner[0]/PGScale ) % FLU_CLU_NPG != 0  ||
+            ( Corner[1]/PGScale ) % FLU_CLU_NPG != 0  ||
+            ( Corner[2]/PGScale ) % FLU_CLU_NPG != 0  )
+         continue;
+
+//    collect the member patch groups by following the sibling patches
+//    --> the +x/+y/+z patch groups of PID0 are the sibling[1/3/5] of the patches with LocalID 1/2/3
+      int *Clu_PID0 = Clu_PID0_List + NClu*NPG_Clu;
+      bool Valid    = true;
+
+      for (int k=0; k<FLU_CLU_NPG  &&  Valid; k++)
+      for (int j=0; j<FLU_CLU_NPG  &&  Valid; j++)
+      for (int i=0; i<FLU_CLU_NPG  &&  Valid; i++)
+      {
+         const int m = ( k*FLU_CLU_NPG + j )*FLU_CLU_NPG + i;
+         int MemPID0;
+
+         if      ( i > 0 )  MemPID0 = amr->patch[0][lv][ Clu_PID0[m-1                       ] + 1 ]->sibling[1];
+         else if ( j > 0 )  MemPID0 = amr->patch[0][lv][ Clu_PID0[m-FLU_CLU_NPG             ] + 2 ]->sibling[3];
+         else if ( k > 0 )  MemPID0 = amr->patch[0][lv][ Clu_PID0[m-FLU_CLU_NPG*FLU_CLU_NPG ] + 3 ]->sibling[5];
+         else               MemPID0 = PID0;
+
+//       exclude the periodic images and the patch groups already assigned to other clusters
+         if (  MemPID0 < 0  ||  MemPID0 >= 8*NReal_PG  ||  !Target[ MemPID0/8 ]  ||
+               amr->patch[0][lv][MemPID0]->corner[0] != Corner[0] + i*PGScale  ||
+               amr->patch[0][lv][MemPID0]->corner[1] != Corner[1] + j*PGScale  ||
+               amr->patch[0][lv][MemPID0]->corner[2] != Corner[2] + k*PGScale  )
+         {
+            Valid = false;
+            break;
+         }
+
+         for (int LocalID=0; LocalID<8  &&  Valid; LocalID++)
+         for (int s=0; s<6; s++)
+         {
+            if ( amr->patch[0][lv][ MemPID0 + LocalID ]->flux[s] != NULL )
+            {
+               Valid = false;
+               break;
+            }
+         }
+
+         Clu_PID0[m] = MemPID0;
+      } // i,j,k
+
+      if ( !Valid  ||  !GetClusterBox( lv, Clu_PID0, BoxPID ) )   continue;
+
+      for (int m=0; m<NPG_Clu; m++)    Target[ Clu_PID0[m]/8 ] = false;
+
+      NClu ++;
+   } // for (int t=0; t<NPG; t++)
+
+
+// remove the clustered patch groups from PID0_List[]
+   int NPG_Left = 0;
+
+   for (int t=0; t<NPG; t++)
+      if ( Target[ PID0_List[t]/8 ] )  PID0_List[ NPG_Left ++ ] = PID0_List[t];
+
+   NPG = NPG_Left;
+
+   delete [] Target;
+
+   return NClu;
+
+} // FUNCTION : Flu_FindCluster
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_Prepare_Cluster
+// Description :  Prepare the input array of the cluster fluid solver
+//
+// Note        :  1. Invoked by InvokeSolver() when OPT__FLU_CLUSTER is on
+//                2. All data are copied directly from the patches at the same level (see Flu_FindCluster())
+//                   --> Same as Prepare_PatchData() invoked by Flu_Prepare() for patch groups without
+//                       coarse-fine boundaries, including the minimum density check
+//
+// Parameter   :  lv               : Target refinement level
+//                PrepTime         : Target physical time to prepare the input data
+//                h_Flu_Array_C_In : Host array to store the prepared data
+//                NClu             : Number of clusters to be prepared
+//                Clu_PID0_List    : List recording the patch indices with LocalID==0 of all clusters
+//-------------------------------------------------------------------------------------------------------
+void Flu_Prepare_Cluster( const int lv, const double PrepTime, real h_Flu_Array_C_In[][FLU_NIN][ CUBE(FLU_CLU_NXT) ],
+                          const int NClu, const int *Clu_PID0_List )
+{
+
+#  if ( FLU_NIN != NCOMP_TOTAL )
+#     error : ERROR : FLU_NIN != NCOMP_TOTAL !!
+#  endif
+
+   const real MinDens_No = -1.0;
+   const real MinDens    = ( OPT__OPTIMIZE_AGGRESSIVE ) ? MinDens_No : MIN_DENS;
+
+   bool IntTime;
+   int  FluSg, FluSg_IntT;
+   real FluWeighting, FluWeighting_IntT;
+
+   SetTempIntPara( lv, amr->FluSg[lv], PrepTime, amr->FluSgTime[lv][0], amr->FluSgTime[lv][1],
+                   IntTime, FluSg, FluSg_IntT, FluWeighting, FluWeighting_IntT );
+
+   if ( IntTime )    Aux_Error( ERROR_INFO, "temporal interpolation is not supported (lv %d, PrepTime %20.14e) !!\n",
+                                lv, PrepTime );
+
+
+#  pragma omp parallel for schedule( runtime )
+   for (int c=0; c<NClu; c++)
+   {
+      int BoxPID[ CUBE(FLU_CLU_NBOX) ];
+
+      if ( !GetClusterBox( lv, Clu_PID0_List + c*CUBE(FLU_CLU_NPG), BoxPID ) )
+         Aux_Error( ERROR_INFO, "cluster %d at lv %d has missing sibling patches !!\n", c, lv );
+
+//    copy data patch by patch
+//    --> the patch at box[bk][bj][bi] covers the cells [FLU_GHOST_SIZE+(b-1)*PS1, FLU_GHOST_SIZE+b*PS1) in each direction
+      for (int bk=0; bk<FLU_CLU_NBOX; bk++)
+      for (int bj=0; bj<FLU_CLU_NBOX; bj++)
+      for (int bi=0; bi<FLU_CLU_NBOX; bi++)
+      {
+         const int b = ( bk*FLU_CLU_NBOX + bj )*FLU_CLU_NBOX + bi;
+         const int Start[3] = { FLU_GHOST_SIZE + (bi-1)*PS1, FLU_GHOST_SIZE + (bj-1)*PS1, FLU_GHOST_SIZE + (bk-1)*PS1 };
+         int ijk_min[3], ijk_max[3];
+
+         for (int d=0; d<3; d++)
+         {
+            ijk_min[d] = MAX( Start[d],     0           );
+            ijk_max[d] = MIN( Start[d]+PS1, FLU_CLU_NXT );
+         }
+
+         const patch_t *Patch = amr->patch[FluSg][lv][ BoxPID[b] ];
+
+         for (int v=0; v<FLU_NIN; v++)
+         for (int k=ijk_min[2]; k<ijk_max[2]; k++)
+         for (int j=ijk_min[1]; j<ijk_max[1]; j++)
+         {
+            const real_fld *Src = Patch->fluid[v][ k-Start[2] ][ j-Start[1] ];
+            real       *Dst = h_Flu_Array_C_In[c][v] + ( k*FLU_CLU_NXT + j )*FLU_CLU_NXT;
+
+            for (int i=ijk_min[0]; i<ijk_max[0]; i++)    Dst[i] = Src[ i-Start[0] ];
+         }
+      } // bi,bj,bk
+
+//    apply the minimum density
+      if ( MinDens >= (real)0.0 )
+      {
+         real *ArrayDens = h_Flu_Array_C_In[c][DENS];
+
+         for (int t=0; t<CUBE(FLU_CLU_NXT); t++)   ArrayDens[t] = FMAX( ArrayDens[t], MinDens );
+      }
+   } // for (int c=0; c<NClu; c++)
+
+} // FUNCTION : Flu_Prepare_Cluster
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_Close_Cluster
+// Description :  Copy the data from the output array of the cluster fluid solver to the corresponding patches
+//
+// Note        :  1. Invoked by InvokeSolver() when OPT__FLU_CLUSTER is on
+//                2. Clusters with any unphysical cell (see Unphysical()) are NOT stored
+//                   --> Their patch groups are returned in Fail_PID0_List[] and must be advanced again by
+//                       the patch-group solver so that CorrectUnphysical() and AUTO_REDUCE_DT work as usual
+//                3. Flux fix-up is unnecessary since clusters have no coarse-fine boundaries
+//                4. Also cache the maximum CFL speed of the updated patches for OPT__DT_CFL_CACHE
+//
+// Parameter   :  lv                : Target refinement level
+//                SaveSg_Flu        : Sandglass to store the updated fluid data
+//                h_Flu_Array_C_Out : Host array storing the updated fluid data
+//                h_DE_Array_C_Out  : Host array storing the dual-energy status (for DUAL_ENERGY only)
+//                NClu              : Number of clusters to be stored
+//                Clu_PID0_List     : List recording the patch indices with LocalID==0 of all clusters
+//                Fail_PID0_List    : List to store the patch indices with LocalID==0 of the failed clusters
+//
+// Return      :  Number of patch groups in Fail_PID0_List[]
+//-------------------------------------------------------------------------------------------------------
+int Flu_Close_Cluster( const int lv, const int SaveSg_Flu,
+                       const real h_Flu_Array_C_Out[][FLU_NOUT][ CUBE(FLU_CLU_NOUT) ],
+                       const char h_DE_Array_C_Out[][ CUBE(FLU_CLU_NOUT) ],
+                       const int NClu, const int *Clu_PID0_List, int *Fail_PID0_List )
+{
+
+#  if ( FLU_NOUT != NCOMP_TOTAL )
+#     error : ERROR : FLU_NOUT != NCOMP_TOTAL !!
+#  endif
+
+   const int  NPG_Clu      = CUBE( FLU_CLU_NPG );
+   const real Gamma_m1     = GAMMA - (real)1.0;
+   const int  CheckMinPres = 1;
+
+   bool *Fail = new bool [NClu];
+
+
+#  pragma omp parallel for schedule( runtime )
+   for (int c=0; c<NClu; c++)
+   {
+//    check if the updated values are unphysical
+      real Out[FLU_NOUT];
+
+      Fail[c] = false;
+
+      for (int t=0; t<CUBE(FLU_CLU_NOUT); t++)
+      {
+         for (int v=0; v<FLU_NOUT; v++)   Out[v] = h_Flu_Array_C_Out[c][v][t];
+
+         if ( Unphysical(Out, Gamma_m1, CheckMinPres, NULL_REAL) )
+         {
+            Fail[c] = true;
+            break;
+         }
+      }
+
+      if ( Fail[c] )    continue;
+
+
+//    store the updated data
+      for (int m=0; m<NPG_Clu; m++)
+      {
+         const int PID0   = Clu_PID0_List[ c*NPG_Clu + m ];
+         const int Disp_x = PS2*(   m % FLU_CLU_NPG                 );
+         const int Disp_y = PS2*( ( m / FLU_CLU_NPG ) % FLU_CLU_NPG );
+         const int Disp_z = PS2*(   m / SQR(FLU_CLU_NPG)            );
+
+         for (int LocalID=0; LocalID<8; LocalID++)
+         {
+            const int PID     = PID0 + LocalID;
+            const int Table_x = Disp_x + TABLE_02( LocalID, 'x', 0, PATCH_SIZE );
+            const int Table_y = Disp_y + TABLE_02( LocalID, 'y', 0, PATCH_SIZE );
+            const int Table_z = Disp_z + TABLE_02( LocalID, 'z', 0, PATCH_SIZE );
+
+            for (int v=0; v<FLU_NOUT; v++)
+            for (int k=0; k<PATCH_SIZE; k++)
+            for (int j=0; j<PATCH_SIZE; j++)
+            {
+               const real *Src = h_Flu_Array_C_Out[c][v] + ( (Table_z+k)*FLU_CLU_NOUT + Table_y+j )*FLU_CLU_NOUT + Table_x;
+
+               for (int i=0; i<PATCH_SIZE; i++)    amr->patch[SaveSg_Flu][lv][PID]->fluid[v][k][j][i] = Src[i];
+            }
+
+//          de_status is always stored in Sg=0
+#           ifdef DUAL_ENERGY
+            for (int k=0; k<PATCH_SIZE; k++)
+            for (int j=0; j<PATCH_SIZE; j++)
+            {
+               const char *Src = h_DE_Array_C_Out[c] + ( (Table_z+k)*FLU_CLU_NOUT + Table_y+j )*FLU_CLU_NOUT + Table_x;
+
+               for (int i=0; i<PATCH_SIZE; i++)    amr->patch[0][lv][PID]->de_status[k][j][i] = Src[i];
+            }
+#           endif
+
+//          maximum CFL speed for the next hydro time-step
+            if ( OPT__DT_CFL_CACHE )   dt_CFLCache_Update( lv, SaveSg_Flu, PID );
+         } // for (int LocalID=0; LocalID<8; LocalID++)
+      } // for (int m=0; m<NPG_Clu; m++)
+   } // for (int c=0; c<NClu; c++)
+
+
+// collect the patch groups of the failed clusters
+   int NFail = 0;
+
+   for (int c=0; c<NClu; c++)
+      if ( Fail[c] )
+         for (int m=0; m<NPG_Clu; m++)    Fail_PID0_List[ NFail ++ ] = Clu_PID0_List[ c*NPG_Clu + m ];
+
+   delete [] Fail;
+
+   return NFail;
+
+} // FUNCTION : Flu_Close_Cluster
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetClusterBox
+// Description :  Get the patch indices of the FLU_CLU_NBOX^3 patches covering a cluster and its ghost zones
+//
+// Note        :  1. The patches outside the cluster are found by the sibling patches of the nearest patches
+//                   inside the cluster
+//
+// Parameter   :  lv       : Target refinement level
+//                Clu_PID0 : Patch indices with LocalID==0 of the FLU_CLU_NPG^3 patch groups in the cluster
+//                BoxPID   : Array to store the patch indices
+//
+// Return      :  true/false --> all patches exist/some patches do not exist at lv
+//-------------------------------------------------------------------------------------------------------
+static bool GetClusterBox( const int lv, const int *Clu_PID0, int BoxPID[] )
+{
+
+// sibling index of each relative position [dk+1][dj+1][di+1]
+   int SibID[3][3][3];
+
+   for (int s=0; s<26; s++)
+      SibID[ TABLE_01(s,'z',0,1,2) ][ TABLE_01(s,'y',0,1,2) ][ TABLE_01(s,'x',0,1,2) ] = s;
+
+   SibID[1][1][1] = -1;
+
+
+   for (int bk=0; bk<FLU_CLU_NBOX; bk++)
+   for (int bj=0; bj<FLU_CLU_NBOX; bj++)
+   for (int bi=0; bi<FLU_CLU_NBOX; bi++)
+   {
+//    nearest patch inside the cluster
+      const int pi  = MIN( MAX( bi-1, 0 ), 2*FLU_CLU_NPG-1 );
+      const int pj  = MIN( MAX( bj-1, 0 ), 2*FLU_CLU_NPG-1 );
+      const int pk  = MIN( MAX( bk-1, 0 ), 2*FLU_CLU_NPG-1 );
+      const int m   = ( (pk/2)*FLU_CLU_NPG + pj/2 )*FLU_CLU_NPG + pi/2;
+      const int PID = Clu_PID0[m] + LocalID[pk%2][pj%2][pi%2];
+      const int s   = SibID[ bk-pk ][ bj-pj ][ bi-pi ];
+      const int b   = ( bk*FLU_CLU_NBOX + bj )*FLU_CLU_NBOX + bi;
+
+      BoxPID[b] = ( s == -1 ) ? PID : amr->patch[0][lv][PID]->sibling[s];
+
+      if ( BoxPID[b] < 0 )    return false;
+   }
+
+   return true;
+
+} // FUNCTION : GetClusterBox
+
+
+
+#endif // #ifdef FLU_CLUSTER
@@ -114,8 +114,14 @@ void Flu_FixUp_Flux( const int lv )
          if ( FluxPtr == NULL  )  continue;
 
 
+//       the cached CFL speed must be re-evaluated for the corrected patches
+#        if ( MODEL == HYDRO )
+         if ( OPT__DT_CFL_CACHE )   dt_CFLCache_Invalidate( lv, FluSg, PID );
+#        endif
+
+
 //       set the pointers to the target face
-         real *FluidPtr1D0[NCOMP_TOTAL], *FluidPtr1D[NCOMP_TOTAL];
+         real_fld *FluidPtr1D0[NCOMP_TOTAL], *FluidPtr1D[NCOMP_TOTAL];
          for (int v=0; v<NCOMP_TOTAL; v++)   FluidPtr1D0[v] = amr->patch[FluSg][lv][PID]->fluid[v][0][0] + Offset[s];
 #        ifdef DUAL_ENERGY
          const char *DE_StatusPtr1D0 = amr->patch[0][lv][PID]->de_status[0][0] + Offset[s];
@@ -73,6 +73,17 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
 #  endif
 
 
+// invalidate the cached CFL speed of all real father patches for OPT__DT_CFL_CACHE
+// --> including those with sons living abroad, which will be updated later by LB_GetBufferData() with DATA_RESTRICT
+#  if ( MODEL == HYDRO )
+   if (  OPT__DT_CFL_CACHE  &&  ( TVarCC & _TOTAL )  )
+   {
+      for (int FaPID=0; FaPID<amr->NPatchComma[FaLv][1]; FaPID++)
+         if ( amr->patch[0][FaLv][FaPID]->son != -1 )    dt_CFLCache_Invalidate( FaLv, FaFluSg, FaPID );
+   }
+#  endif
+
+
 // nothing to do if there are no real patches at lv+1
    if ( amr->NPatchComma[SonLv][1] == 0 )    return;
 
@@ -176,8 +187,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
          for (int v=0; v<NFluVar; v++)
          {
             const int TFluVarIdx = TFluVarIdxList[v];
-            const real (*SonPtr)[PS1][PS1] = amr->patch[SonFluSg][SonLv][SonPID]->fluid[TFluVarIdx];
-                  real (* FaPtr)[PS1][PS1] = amr->patch[ FaFluSg][ FaLv][ FaPID]->fluid[TFluVarIdx];
+            const real_fld (*SonPtr)[PS1][PS1] = amr->patch[SonFluSg][SonLv][SonPID]->fluid[TFluVarIdx];
+                  real_fld (* FaPtr)[PS1][PS1] = amr->patch[ FaFluSg][ FaLv][ FaPID]->fluid[TFluVarIdx];
 
             int ii, jj, kk, I, J, K, Ip, Jp, Kp;
 
@@ -185,7 +196,7 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
             for (int j=0; j<PS1_half; j++)  {  J = j*2;  Jp = J+1;  jj = j + Disp_j;
             for (int i=0; i<PS1_half; i++)  {  I = i*2;  Ip = I+1;  ii = i + Disp_i;
 
-               FaPtr[kk][jj][ii] = 0.125*( SonPtr[K ][J ][I ] + SonPtr[K ][J ][Ip] +
+               FaPtr[kk][jj][ii] = 0.125*( (real)SonPtr[K ][J ][I ] + SonPtr[K ][J ][Ip] +
                                            SonPtr[K ][Jp][I ] + SonPtr[Kp][J ][I ] +
                                            SonPtr[K ][Jp][Ip] + SonPtr[Kp][Jp][I ] +
                                            SonPtr[Kp][J ][Ip] + SonPtr[Kp][Jp][Ip] );
@@ -197,8 +208,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
 #        ifdef GRAVITY
          if ( ResPot )
          {
-            const real (*SonPtr)[PS1][PS1] = amr->patch[SonPotSg][SonLv][SonPID]->pot;
-                  real (* FaPtr)[PS1][PS1] = amr->patch[ FaPotSg][ FaLv][ FaPID]->pot;
+            const real_fld (*SonPtr)[PS1][PS1] = amr->patch[SonPotSg][SonLv][SonPID]->pot;
+                  real_fld (* FaPtr)[PS1][PS1] = amr->patch[ FaPotSg][ FaLv][ FaPID]->pot;
 
             int ii, jj, kk, I, J, K, Ip, Jp, Kp;
 
@@ -206,7 +217,7 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
             for (int j=0; j<PS1_half; j++)  {  J = j*2;  Jp = J+1;  jj = j + Disp_j;
             for (int i=0; i<PS1_half; i++)  {  I = i*2;  Ip = I+1;  ii = i + Disp_i;
 
-               FaPtr[kk][jj][ii] = 0.125*( SonPtr[K ][J ][I ] + SonPtr[K ][J ][Ip] +
+               FaPtr[kk][jj][ii] = 0.125*( (real)SonPtr[K ][J ][I ] + SonPtr[K ][J ][Ip] +
                                            SonPtr[K ][Jp][I ] + SonPtr[Kp][J ][I ] +
                                            SonPtr[K ][Jp][Ip] + SonPtr[Kp][Jp][I ] +
                                            SonPtr[Kp][J ][Ip] + SonPtr[Kp][Jp][Ip] );
@@ -225,8 +236,8 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
             int idx_fa, idx_son0, I, J, K;
 
 //          Bx
-            const real *SonBx = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[0];
-                  real * FaBx = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[0];
+            const real_fld *SonBx = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[0];
+                  real_fld * FaBx = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[0];
 
             for (int k=0; k<PS1_half;   k++)  {  K = k*2;
             for (int j=0; j<PS1_half;   j++)  {  J = j*2;
@@ -235,15 +246,15 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
                const int idx_fa   = IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS1P1, PS1 );
                const int idx_son0 = IDX321( I,        J,        K,        PS1P1, PS1 );
 
-               FaBx[idx_fa] = 0.25*( SonBx[ idx_son0                     ] +
+               FaBx[idx_fa] = 0.25*( (real)SonBx[ idx_son0                     ] +
                                      SonBx[ idx_son0 + PS1P1             ] +
                                      SonBx[ idx_son0 + PS1P1*PS1         ] +
                                      SonBx[ idx_son0 + PS1P1*PS1 + PS1P1 ] );
             }}}
 
 //          By
-            const real *SonBy = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[1];
-                  real * FaBy = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[1];
+            const real_fld *SonBy = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[1];
+                  real_fld * FaBy = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[1];
 
             for (int k=0; k<PS1_half;   k++)  {  K = k*2;
             for (int j=0; j<PS1_half+1; j++)  {  J = j*2;
@@ -252,15 +263,15 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
                const int idx_fa   = IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS1, PS1P1 );
                const int idx_son0 = IDX321( I,        J,        K,        PS1, PS1P1 );
 
-               FaBy[idx_fa] = 0.25*( SonBy[ idx_son0                 ] +
+               FaBy[idx_fa] = 0.25*( (real)SonBy[ idx_son0                 ] +
                                      SonBy[ idx_son0 + 1             ] +
                                      SonBy[ idx_son0 + PS1P1*PS1     ] +
                                      SonBy[ idx_son0 + PS1P1*PS1 + 1 ] );
             }}}
 
 //          Bz
-            const real *SonBz = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[2];
-                  real * FaBz = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[2];
+            const real_fld *SonBz = amr->patch[SonMagSg][SonLv][SonPID]->magnetic[2];
+                  real_fld * FaBz = amr->patch[ FaMagSg][ FaLv][ FaPID]->magnetic[2];
 
             for (int k=0; k<PS1_half+1; k++)  {  K = k*2;
             for (int j=0; j<PS1_half;   j++)  {  J = j*2;
@@ -269,7 +280,7 @@ void Flu_FixUp_Restrict( const int FaLv, const int SonFluSg, const int FaFluSg,
                const int idx_fa   = IDX321( i+Disp_i, j+Disp_j, k+Disp_k, PS1, PS1 );
                const int idx_son0 = IDX321( I,        J,        K,        PS1, PS1 );
 
-               FaBz[idx_fa] = 0.25*( SonBz[ idx_son0           ] +
+               FaBz[idx_fa] = 0.25*( (real)SonBz[ idx_son0           ] +
                                      SonBz[ idx_son0 + 1       ] +
                                      SonBz[ idx_son0 + PS1     ] +
                                      SonBz[ idx_son0 + PS1 + 1 ] );
@@ -0,0 +1,403 @@
+#include "GAMER.h"
+
+
+// statistics of the patch groups retried by AUTO_REDUCE_DT_LOCAL (recorded by Flu_RecordRetry())
+static long NRetry_PG     [NLEVEL] = { 0 };   // number of retried patch groups
+static long NRetry_Success[NLEVEL] = { 0 };   // number of patch groups retried successfully
+static long NRetry_SubStep[NLEVEL] = { 0 };   // total number of sub-steps of the successful retries
+
+#if ( MODEL == HYDRO )
+extern int FluStatus_ThisRank;
+
+void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
+                        const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
+                        real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                        char h_DE_Array_F_Out[][ CUBE(PS2) ],
+                        real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                        const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
+                        const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
+                        const real dt, bool PGFailed[] );
+
+#if ( !defined GPU  &&  !defined MHD  &&  !defined UNSPLIT_GRAVITY )
+static bool SyncOuterFlux( real Out[][ CUBE(PS2) ], const char DE_Status[], const real Ref_Flux[][NFLUX_TOTAL][ SQR(PS2) ],
+                           const real Sum_Flux[][NFLUX_TOTAL][ SQR(PS2) ], const int NSub, const real dt, const real dh );
+#endif
+#endif
+
+
+
+
+#if ( MODEL == HYDRO )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_RetryPatchGroup
+// Description :  Re-advance the patch groups failing in CorrectUnphysical() by several smaller sub-steps
+//                within the same dt
+//
+// Note        :  1. Invoked by Flu_Close() when AUTO_REDUCE_DT_LOCAL > 1
+//                2. Each failed patch group is re-advanced by NSub = 2, 4, 8, ... (<= AUTO_REDUCE_DT_LOCAL)
+//                   sub-steps of dt/NSub until all cells pass CorrectUnphysical() in all sub-steps
+//                   --> If it still fails with the maximum number of sub-steps, set FluStatus_ThisRank =
+//                       GAMER_FAILED so that the entire level is re-advanced with a smaller dt as usual
+//                3. Ghost zones are fixed to the values prepared at the beginning of the step
+//                   --> Only first-order accurate in time at the patch group boundaries, which is acceptable
+//                       for the rare patch groups requiring this retry
+//                4. To keep the conservation across the patch group boundaries, the cells adjacent to the six
+//                   outer faces are corrected by the difference between the single-step fluxes, which are the
+//                   fluxes adopted by the same-level neighbours, and the fluxes averaged over all sub-steps
+//                   --> The single-step fluxes are re-evaluated from the same input array and are thus identical
+//                       to those computed by the neighbouring patch groups
+//                   --> Treat the retry as failed if any corrected cell becomes unphysical
+//                   --> h_Flux_Array[] stores the single-step fluxes on the outer faces and the sub-step averages
+//                       on the internal faces, both of which are consistent with the corrected cells, so that
+//                       StoreFlux() and CorrectFlux() (and thus flux_tmp[] for AUTO_REDUCE_DT) remain conservative
+//                5. The failed patch groups are retried one at a time by CPU_FluidSolver(), which must not be
+//                   invoked concurrently since it uses per-thread scratch arrays
+//
+// Parameter   :  lv                : Target refinement level
+//                NPG               : Number of patch groups in the input arrays
+//                PID0_List         : List recording the patch indices with LocalID==0 to be udpated
+//                PGFailed          : Patch groups failing in CorrectUnphysical()
+//                h_Flu_Array_F_In  : Input fluid array
+//                h_Flu_Array_F_Out : Output fluid array
+//                h_DE_Array_F_Out  : Output dual-energy status array
+//                h_Flux_Array      : Output array storing the updated flux data
+//                dt                : Evolution time-step
+//-------------------------------------------------------------------------------------------------------
+void Flu_RetryPatchGroup( const int lv, const int NPG, const int *PID0_List, const bool PGFailed[],
+                          const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
+                          real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                          char h_DE_Array_F_Out[][ CUBE(PS2) ],
+                          real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                          const real dt )
+{
+
+#  if ( defined GPU  ||  defined MHD  ||  defined UNSPLIT_GRAVITY )
+   Aux_Error( ERROR_INFO, "AUTO_REDUCE_DT_LOCAL only supports the CPU HYDRO solvers without MHD and UNSPLIT_GRAVITY !!\n" );
+
+#  else
+
+#  if ( FLU_NIN != NCOMP_TOTAL  ||  FLU_NOUT != NCOMP_TOTAL )
+#     error : ERROR : FLU_NIN != NCOMP_TOTAL or FLU_NOUT != NCOMP_TOTAL !!
+#  endif
+
+   const real dh     = (real)amr->dh[lv];
+   const bool XYZ    = 1 - ( AdvanceCounter[lv]%2 );   // same sweep direction as the original step
+   const int  NFlux  = 9*NFLUX_TOTAL*SQR(PS2);
+
+#  ifndef DUAL_ENERGY
+   const double DUAL_ENERGY_SWITCH = NULL_REAL;
+#  endif
+
+#  ifdef GRAVITY
+   const real JeansMinPres_Coeff = ( JEANS_MIN_PRES ) ?
+                                   NEWTON_G*SQR(JEANS_MIN_PRES_NCELL*amr->dh[JEANS_MIN_PRES_LEVEL])/(GAMMA*M_PI) : NULL_REAL;
+#  else
+   const real JEANS_MIN_PRES     = false;
+   const real JeansMinPres_Coeff = NULL_REAL;
+#  endif
+
+   const bool   StoreFlux_Yes       = true;
+
+// useless parameters without MHD and UNSPLIT_GRAVITY
+   const bool   StoreElectric_No    = false;
+   const double Time_Useless        = NULL_REAL;
+   const real   ELBDM_Eta           = NULL_REAL;
+   const real   ELBDM_Taylor3_Coeff = NULL_REAL;
+   const bool   ELBDM_Taylor3_Auto  = NULL_BOOL;
+
+
+// allocate the arrays of one patch group
+   real (*Sub_In  )[FLU_NIN ][ CUBE(FLU_NXT) ]     = new real [1][FLU_NIN ][ CUBE(FLU_NXT) ];
+   real (*Sub_Out )[FLU_NOUT][ CUBE(PS2) ]         = new real [1][FLU_NOUT][ CUBE(PS2) ];
+   real (*Sub_Flux)[9][NFLUX_TOTAL][ SQR(PS2) ]    = new real [1][9][NFLUX_TOTAL][ SQR(PS2) ];
+   char (*Sub_DE  )[ CUBE(PS2) ]                   = new char [1][ CUBE(PS2) ];
+   real (*Sum_Flux)[9][NFLUX_TOTAL][ SQR(PS2) ]    = new real [1][9][NFLUX_TOTAL][ SQR(PS2) ];
+   real (*Ref_Flux)[9][NFLUX_TOTAL][ SQR(PS2) ]    = new real [1][9][NFLUX_TOTAL][ SQR(PS2) ];
+   real  *Sub_Flux1D                               = Sub_Flux[0][0][0];
+   real  *Sum_Flux1D                               = Sum_Flux[0][0][0];
+   bool   Sub_Failed[1];
+
+
+   for (int TID=0; TID<NPG; TID++)
+   {
+      if ( !PGFailed[TID] )   continue;
+
+      const int *PID0 = PID0_List + TID;
+      bool Success    = false;
+      int  NSub;
+
+      NRetry_PG[lv] ++;
+
+//    re-evaluate the single-step fluxes adopted by the same-level neighbours on the outer faces
+//    --> the output fluid array is discarded
+      memcpy( Sub_In[0], h_Flu_Array_F_In[TID], sizeof(real)*FLU_NIN*CUBE(FLU_NXT) );
+
+      CPU_FluidSolver( Sub_In, Sub_Out, NULL, NULL, Sub_DE, Ref_Flux, NULL, NULL, NULL,
+                       1, dt, dh, GAMMA, StoreFlux_Yes, StoreElectric_No, XYZ, OPT__LR_LIMITER, MINMOD_COEFF,
+                       OPT__LR_SCHEME, OPT__RSOLVER, ELBDM_Eta, ELBDM_Taylor3_Coeff, ELBDM_Taylor3_Auto, Time_Useless, GRAVITY_NONE,
+                       MIN_DENS, MIN_PRES, DUAL_ENERGY_SWITCH,
+                       OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JEANS_MIN_PRES, JeansMinPres_Coeff,
+                       ( OPT__FLU_FUSED ) ? FLU_FUSED_SLAB : 0 );
+
+      for (NSub=2; NSub<=AUTO_REDUCE_DT_LOCAL; NSub*=2)
+      {
+         const real dt_sub = dt / (real)NSub;
+
+//       start from the original input array, which also provides the fixed ghost zones
+         memcpy( Sub_In[0], h_Flu_Array_F_In[TID], sizeof(real)*FLU_NIN*CUBE(FLU_NXT) );
+
+         for (int t=0; t<NFlux; t++)   Sum_Flux1D[t] = (real)0.0;
+
+         Success = true;
+
+         for (int s=0; s<NSub; s++)
+         {
+            CPU_FluidSolver( Sub_In, Sub_Out, NULL, NULL, Sub_DE, Sub_Flux, NULL, NULL, NULL,
+                             1, dt_sub, dh, GAMMA, StoreFlux_Yes, StoreElectric_No, XYZ, OPT__LR_LIMITER, MINMOD_COEFF,
+                             OPT__LR_SCHEME, OPT__RSOLVER, ELBDM_Eta, ELBDM_Taylor3_Coeff, ELBDM_Taylor3_Auto, Time_Useless, GRAVITY_NONE,
+                             MIN_DENS, MIN_PRES, DUAL_ENERGY_SWITCH,
+                             OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JEANS_MIN_PRES, JeansMinPres_Coeff,
+                             ( OPT__FLU_FUSED ) ? FLU_FUSED_SLAB : 0 );
+
+            CorrectUnphysical( lv, 1, PID0, Sub_In, Sub_Out, Sub_DE, Sub_Flux, NULL, NULL, dt_sub, Sub_Failed );
+
+            if ( Sub_Failed[0] )
+            {
+               Success = false;
+               break;
+            }
+
+            for (int t=0; t<NFlux; t++)   Sum_Flux1D[t] += Sub_Flux1D[t];
+
+//          update the interior of the input array for the next sub-step
+            if ( s < NSub-1 )
+            {
+               for (int v=0; v<FLU_NIN; v++)
+               for (int k=0; k<PS2; k++)
+               for (int j=0; j<PS2; j++)
+               {
+                  const int idx_in  = ( (k+FLU_GHOST_SIZE)*FLU_NXT + (j+FLU_GHOST_SIZE) )*FLU_NXT + FLU_GHOST_SIZE;
+                  const int idx_out = ( k*PS2 + j )*PS2;
+
+                  memcpy( Sub_In[0][v]+idx_in, Sub_Out[0][v]+idx_out, sizeof(real)*PS2 );
+               }
+            }
+         } // for (int s=0; s<NSub; s++)
+
+//       replace the sub-step fluxes on the outer faces by the single-step fluxes of the same-level neighbours
+         if ( Success )
+            Success = SyncOuterFlux( Sub_Out[0], Sub_DE[0], Ref_Flux[0], Sum_Flux[0], NSub, dt, dh );
+
+         if ( Success )    break;
+      } // for (NSub=2; NSub<=AUTO_REDUCE_DT_LOCAL; NSub*=2)
+
+
+//    store the results of the successful retry
+      if ( Success )
+      {
+         memcpy( h_Flu_Array_F_Out[TID], Sub_Out[0], sizeof(real)*FLU_NOUT*CUBE(PS2) );
+#        ifdef DUAL_ENERGY
+         memcpy( h_DE_Array_F_Out[TID],  Sub_DE[0],  sizeof(char)*CUBE(PS2) );
+#        endif
+
+//       outer faces: single-step fluxes; internal faces: fluxes averaged over all sub-steps
+         if ( OPT__FIXUP_FLUX )
+         {
+            const real _NSub = (real)1.0 / (real)NSub;
+
+            for (int f=0; f<9; f++)
+            for (int v=0; v<NFLUX_TOTAL; v++)
+            for (int t=0; t<SQR(PS2); t++)
+               h_Flux_Array[TID][f][v][t] = ( f%3 == 1 ) ? _NSub*Sum_Flux[0][f][v][t] : Ref_Flux[0][f][v][t];
+         }
+
+         NRetry_Success[lv] ++;
+         NRetry_SubStep[lv] += NSub;
+      }
+
+//    fall back to reducing dt of the entire level
+      else
+         FluStatus_ThisRank = GAMER_FAILED;
+   } // for (int TID=0; TID<NPG; TID++)
+
+
+   delete [] Sub_In;
+   delete [] Sub_Out;
+   delete [] Sub_Flux;
+   delete [] Sum_Flux;
+   delete [] Ref_Flux;
+   delete [] Sub_DE;
+
+#  endif // #if ( defined GPU  ||  defined MHD  ||  defined UNSPLIT_GRAVITY ) ... else ...
+
+} // FUNCTION : Flu_RetryPatchGroup
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SyncOuterFlux
+// Description :  Correct the cells adjacent to the outer faces of a retried patch group so that they adopt the
+//                single-step fluxes instead of the fluxes averaged over all sub-steps
+//
+// Note        :  1. Invoked by Flu_RetryPatchGroup()
+//                2. Same physical checks as Flu_FixUp_Flux()
+//                   --> But return false instead of skipping the unphysical cells, which would break the
+//                       conservation again
+//                3. Cells adjacent to more than one outer face accumulate the corrections of all these faces
+//
+// Parameter   :  Out       : Output fluid array of one patch group to be corrected
+//                DE_Status : Dual-energy status array of one patch group
+//                Ref_Flux  : Single-step fluxes
+//                Sum_Flux  : Fluxes summed over all sub-steps
+//                NSub      : Number of sub-steps
+//                dt        : Evolution time-step
+//                dh        : Cell size
+//
+// Return      :  true  --> all corrected cells are physical
+//                false --> otherwise (Out[] is left partially updated)
+//-------------------------------------------------------------------------------------------------------
+#if ( !defined GPU  &&  !defined MHD  &&  !defined UNSPLIT_GRAVITY )
+bool SyncOuterFlux( real Out[][ CUBE(PS2) ], const char DE_Status[], const real Ref_Flux[][NFLUX_TOTAL][ SQR(PS2) ],
+                    const real Sum_Flux[][NFLUX_TOTAL][ SQR(PS2) ], const int NSub, const real dt, const real dh )
+{
+
+   const real dt_dh           = dt / dh;
+   const real _NSub           = (real)1.0 / (real)NSub;
+   const real Gamma_m1        = GAMMA - (real)1.0;
+   const real _Gamma_m1       = (real)1.0 / Gamma_m1;
+   const bool CheckMinPres_No = false;
+   const real EngyB           = NULL_REAL;
+
+
+// 1. apply the flux differences on the six outer faces
+//    --> face f = 3*d + {0,2} for the left/right faces along the d direction
+//    --> flux index = TH*PS2 + TL, where (TL,TH) = (y,z), (x,z), and (x,y) for d = 0, 1, and 2, respectively
+   for (int d=0; d<3; d++)
+   for (int LR=0; LR<2; LR++)
+   {
+      const int  f     = 3*d + 2*LR;
+      const int  ijk_d = ( LR == 0 ) ? 0 : PS2-1;
+      const real Coeff = ( LR == 0 ) ? +dt_dh : -dt_dh;
+
+      for (int m=0; m<PS2; m++)
+      for (int n=0; n<PS2; n++)
+      {
+         int i, j, k;
+         switch ( d )
+         {
+            case 0:  i = ijk_d;  j = n;      k = m;      break;
+            case 1:  i = n;      j = ijk_d;  k = m;      break;
+            default: i = n;      j = m;      k = ijk_d;  break;
+         }
+
+         const int idx_out  = ( k*PS2 + j )*PS2 + i;
+         const int idx_flux = m*PS2 + n;
+
+         for (int v=0; v<NFLUX_TOTAL; v++)
+            Out[v][idx_out] += Coeff*( Ref_Flux[f][v][idx_flux] - _NSub*Sum_Flux[f][v][idx_flux] );
+      }
+   }
+
+
+// 2. check and fix the corrected cells
+   for (int k=0; k<PS2; k++)
+   for (int j=0; j<PS2; j++)
+   for (int i=0; i<PS2; i++)
+   {
+      if ( i != 0  &&  i != PS2-1  &&  j != 0  &&  j != PS2-1  &&  k != 0  &&  k != PS2-1 )  continue;
+
+      const int idx = ( k*PS2 + j )*PS2 + i;
+      real CorrVal[NCOMP_TOTAL], Pres;
+
+      for (int v=0; v<NCOMP_TOTAL; v++)   CorrVal[v] = Out[v][idx];
+
+#     if   ( DUAL_ENERGY == DE_ENPY )
+      Pres = ( DE_Status[idx] == DE_UPDATED_BY_ETOT  ||  DE_Status[idx] == DE_UPDATED_BY_ETOT_GRA ) ?
+             Hydro_GetPressure( CorrVal[DENS], CorrVal[MOMX], CorrVal[MOMY], CorrVal[MOMZ], CorrVal[ENGY],
+                                Gamma_m1, CheckMinPres_No, NULL_REAL, EngyB )
+           : Hydro_DensEntropy2Pres( CorrVal[DENS], CorrVal[ENPY], Gamma_m1, CheckMinPres_No, NULL_REAL );
+
+#     elif ( DUAL_ENERGY == DE_EINT )
+#     error : DE_EINT is NOT supported yet !!
+
+#     else
+      Pres = Hydro_GetPressure( CorrVal[DENS], CorrVal[MOMX], CorrVal[MOMY], CorrVal[MOMZ], CorrVal[ENGY],
+                                Gamma_m1, CheckMinPres_No, NULL_REAL, EngyB );
+#     endif
+
+      if ( CorrVal[DENS] <= MIN_DENS  ||  Pres <= MIN_PRES  ||  !Aux_IsFinite(Pres)
+#          if ( DUAL_ENERGY == DE_ENPY )
+           ||  ( (DE_Status[idx] == DE_UPDATED_BY_DUAL || DE_Status[idx] == DE_UPDATED_BY_MIN_PRES)
+                  && CorrVal[ENPY] <= (real)2.0*TINY_NUMBER )
+#          endif
+         )
+         return false;
+
+//    floor and normalize the passive scalars
+#     if ( NCOMP_PASSIVE > 0 )
+      for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)  CorrVal[v] = FMAX( CorrVal[v], TINY_NUMBER );
+
+      if ( OPT__NORMALIZE_PASSIVE )
+         Hydro_NormalizePassive( CorrVal[DENS], CorrVal+NCOMP_FLUID, PassiveNorm_NVar, PassiveNorm_VarIdx );
+#     endif
+
+//    ensure the consistency between pressure, total energy density, and dual-energy variable
+      CorrVal[ENGY] = (real)0.5*( SQR(CorrVal[MOMX]) + SQR(CorrVal[MOMY]) + SQR(CorrVal[MOMZ]) ) / CorrVal[DENS]
+                      + Pres*_Gamma_m1;
+#     if ( DUAL_ENERGY == DE_ENPY )
+      CorrVal[ENPY] = Hydro_DensPres2Entropy( CorrVal[DENS], Pres, Gamma_m1 );
+#     endif
+
+      for (int v=0; v<NCOMP_TOTAL; v++)   Out[v][idx] = CorrVal[v];
+   } // i,j,k
+
+   return true;
+
+} // FUNCTION : SyncOuterFlux
+#endif // #if ( !defined GPU  &&  !defined MHD  &&  !defined UNSPLIT_GRAVITY )
+#endif // #if ( MODEL == HYDRO )
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_RecordRetry
+// Description :  Record the statistics of the patch groups retried by AUTO_REDUCE_DT_LOCAL in the note file
+//                "Record__Note"
+//
+// Note        :  1. Invoked by main() at the end of the simulation
+//                2. Patch groups whose retry failed are re-advanced again together with the entire level,
+//                   and thus they may be counted more than once
+//-------------------------------------------------------------------------------------------------------
+void Flu_RecordRetry()
+{
+
+   long NRetry_PG_AllRank[NLEVEL], NRetry_Success_AllRank[NLEVEL], NRetry_SubStep_AllRank[NLEVEL];
+
+   MPI_Reduce( NRetry_PG,      NRetry_PG_AllRank,      NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( NRetry_Success, NRetry_Success_AllRank, NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( NRetry_SubStep, NRetry_SubStep_AllRank, NLEVEL, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+   if ( MPI_Rank == 0  &&  OPT__RECORD_NOTE )
+   {
+      FILE *Note = fopen( "Record__Note", "a" );
+
+      fprintf( Note, "\n" );
+      fprintf( Note, "Patch Groups Retried by AUTO_REDUCE_DT_LOCAL\n" );
+      fprintf( Note, "***********************************************************************************\n" );
+      fprintf( Note, "%5s  %12s  %12s  %12s  %16s\n", "Level", "NRetry", "NSuccess", "NFail", "Avg(NSubStep)" );
+
+      for (int lv=0; lv<=MAX_LEVEL; lv++)
+      {
+         const long NFail = NRetry_PG_AllRank[lv] - NRetry_Success_AllRank[lv];
+
+         fprintf( Note, "%5d  %12ld  %12ld  %12ld  %16.7e\n",
+                  lv, NRetry_PG_AllRank[lv], NRetry_Success_AllRank[lv], NFail,
+                  ( NRetry_Success_AllRank[lv] > 0 ) ? (double)NRetry_SubStep_AllRank[lv]/NRetry_Success_AllRank[lv] : 0.0 );
+      }
+
+      fprintf( Note, "***********************************************************************************\n" );
+      fclose( Note );
+   }
+
+} // FUNCTION : Flu_RecordRetry
@@ -1,7 +1,7 @@
 #include "GAMER.h"
 
 #ifdef LOAD_BALANCE
-void LB_GetBufferData_MemFree();
+void LB_MPIBuffer_MemFree();
 #endif
 
 
@@ -83,7 +83,7 @@ void End_MemFree()
 
 // 5. MPI buffers used by LOAD_BALANCE
 #  ifdef LOAD_BALANCE
-   LB_GetBufferData_MemFree();
+   LB_MPIBuffer_MemFree();
 #  endif
 
 
@@ -93,6 +93,10 @@ void End_MemFree()
 #  endif
 
 
+// 7. thread-private scratch buffers
+   Aux_Scratch_Free();
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 } // FUNCTION : End_MemFree
@@ -5,10 +5,10 @@
 
 
 #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-extern real (*h_PriVar)      [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT)     ];
-extern real (*h_Slope_PPM)[3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ];
-extern real (*h_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
-extern real (*h_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
+extern real (*h_PriVar)      [NCOMP_LR][ CUBE(FLU_NXT)     ];
+extern real (*h_Slope_PPM)[3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ];
+extern real (*h_FC_Var)   [6][NCOMP_LR][ CUBE(N_FC_VAR)    ];
+extern real (*h_FC_Flux)  [3][NCOMP_LR][ CUBE(N_FC_FLUX)   ];
 #ifdef MHD
 extern real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
 extern real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ];
@@ -62,6 +62,15 @@ void End_MemFree_Fluid()
 #  endif
 #  endif // FLU_SCHEME
 
+#  ifdef FLU_CLUSTER
+   delete [] h_Flu_Array_C_In;    h_Flu_Array_C_In  = NULL;
+   delete [] h_Flu_Array_C_Out;   h_Flu_Array_C_Out = NULL;
+#  ifdef DUAL_ENERGY
+   delete [] h_DE_Array_C_Out;    h_DE_Array_C_Out  = NULL;
+#  endif
+   CPU_FluidSolver_Cluster_MemFree();
+#  endif
+
 } // FUNCTION : End_MemFree_Fluid
 
 
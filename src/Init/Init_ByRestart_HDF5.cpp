@@ -1221,7 +1221,7 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
 // --> excluding all derived variables such as gravitational potential and cell-centered B field
    for (int v=0; v<NCOMP_TOTAL; v++)
    {
-      H5_Status = H5Dread( H5_SetID_Field[v], H5T_GAMER_REAL, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT,
+      H5_Status = H5Dread( H5_SetID_Field[v], H5T_GAMER_REAL_FLD, H5_MemID_Field, H5_SpaceID_Field, H5P_DEFAULT,
                            amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v] );
       if ( H5_Status < 0 )
          Aux_Error( ERROR_INFO, "failed to load a field variable (lv %d, GID %d, v %d) !!\n", lv, GID, v );
@@ -1246,7 +1246,7 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
       if ( H5_Status < 0 )   Aux_Error( ERROR_INFO, "failed to create a hyperslab for the magnetic field %d !!\n", v );
 
 //    load data
-      H5_Status = H5Dread( H5_SetID_FCMag[v], H5T_GAMER_REAL, H5_MemID_FCMag[v], H5_SpaceID_FCMag[v], H5P_DEFAULT,
+      H5_Status = H5Dread( H5_SetID_FCMag[v], H5T_GAMER_REAL_FLD, H5_MemID_FCMag[v], H5_SpaceID_FCMag[v], H5P_DEFAULT,
                            amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[v] );
       if ( H5_Status < 0 )
          Aux_Error( ERROR_INFO, "failed to load magnetic field (lv %d, GID %d, v %d) !!\n", lv, GID, v );
@@ -1414,7 +1414,6 @@ void Check_Makefile( const char *FileName, const int FormatVersion )
    LoadField( "RandomNumber",           &RS.RandomNumber,           SID, TID, NonFatal, &RT.RandomNumber,           1, NonFatal );
 
    LoadField( "NLevel",                 &RS.NLevel,                 SID, TID, NonFatal, &RT.NLevel,                 1, NonFatal );
-   LoadField( "MaxPatch",               &RS.MaxPatch,               SID, TID, NonFatal, &RT.MaxPatch,               1, NonFatal );
 
 #  ifdef GRAVITY
    LoadField( "PotScheme",              &RS.PotScheme,              SID, TID, NonFatal, &RT.PotScheme,              1, NonFatal );
@@ -1797,6 +1796,8 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "MolecularWeight",         &RS.MolecularWeight,         SID, TID, NonFatal, &RT.MolecularWeight,          1, NonFatal );
    LoadField( "MinMod_Coeff",            &RS.MinMod_Coeff,            SID, TID, NonFatal, &RT.MinMod_Coeff,             1, NonFatal );
    LoadField( "Opt__LR_Limiter",         &RS.Opt__LR_Limiter,         SID, TID, NonFatal, &RT.Opt__LR_Limiter,          1, NonFatal );
+   LoadField( "Opt__LR_Scheme",          &RS.Opt__LR_Scheme,          SID, TID, NonFatal, &RT.Opt__LR_Scheme,           1, NonFatal );
+   LoadField( "Opt__RSolver",            &RS.Opt__RSolver,            SID, TID, NonFatal, &RT.Opt__RSolver,             1, NonFatal );
    LoadField( "Opt__1stFluxCorr",        &RS.Opt__1stFluxCorr,        SID, TID, NonFatal, &RT.Opt__1stFluxCorr,         1, NonFatal );
    LoadField( "Opt__1stFluxCorrScheme",  &RS.Opt__1stFluxCorrScheme,  SID, TID, NonFatal, &RT.Opt__1stFluxCorrScheme,   1, NonFatal );
 #  endif
@@ -402,8 +402,18 @@ void Init_ByRestart_v1( const char FileName[] )
                      }
 
                      else
+                     {
+#                       ifdef MIXED_PRECISION
+                        real FluBuf[ PATCH_SIZE*PATCH_SIZE*PATCH_SIZE*NCOMP_TOTAL ];
+
+                        fread( FluBuf, sizeof(real), PATCH_SIZE*PATCH_SIZE*PATCH_SIZE*NCOMP_TOTAL, File );
+                        Mis_CopyArray( amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0], FluBuf,
+                                       PATCH_SIZE*PATCH_SIZE*PATCH_SIZE*NCOMP_TOTAL );
+#                       else
                         fread( amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid, sizeof(real),
                                PATCH_SIZE*PATCH_SIZE*PATCH_SIZE*NCOMP_TOTAL, File );
+#                       endif
+                     }
 
 #                    ifdef GRAVITY
 //                   d3-2. abandon the gravitational potential
@@ -728,10 +738,6 @@ void Load_Parameter_Before_1200( FILE *File, const int FormatVersion, int &NLv_R
          Aux_Message( stderr, "          --> Grid scale will be rescaled\n" );
       }
 
-      if ( max_patch != MAX_PATCH )
-         Aux_Message( stderr, "WARNING : %s : RESTART file (%d) != runtime (%d) !!\n",
-                      "MAX_PATCH", max_patch, MAX_PATCH );
-
       if ( flu_ghost_size != FLU_GHOST_SIZE )
          Aux_Message( stderr, "WARNING : %s : RESTART file (%d) != runtime (%d) !!\n",
                       "FLU_GHOST_SIZE", flu_ghost_size, FLU_GHOST_SIZE );
@@ -1198,8 +1204,6 @@ void Load_Parameter_After_1200( FILE *File, const int FormatVersion, int &NLv_Re
          Aux_Message( stderr, "          --> Grid scale will be rescaled\n" );
       }
 
-      CompareVar( "MAX_PATCH", max_patch, MAX_PATCH, NonFatal );
-
 
 
 //    d-2. check the symbolic constants defined in "Macro.h, CUPOT.h, and CUFLU.h"
@@ -434,6 +434,10 @@ void Init_ByRestart()
 // begin to load data
    long Offset = HeaderSize_Total;
    int  PID;
+#  ifdef MIXED_PRECISION
+// the field data are stored as "real" in the restart file and converted to real_fld after loading
+   real *FieldBuf = new real [ MAX( CUBE(PS1)*NCOMP_TOTAL, PS1P1*SQR(PS1)*NCOMP_MAG ) ];
+#  endif
 #  ifndef LOAD_BALANCE
    int TargetRange_Min[3], TargetRange_Max[3];
 #  endif
@@ -499,7 +503,12 @@ void Init_ByRestart()
 #                    endif
 
 //                   d3-1. load the fluid variables
+#                    ifdef MIXED_PRECISION
+                     fread( FieldBuf, sizeof(real), CUBE(PS1)*NCOMP_TOTAL, File );
+                     Mis_CopyArray( amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0], FieldBuf, CUBE(PS1)*NCOMP_TOTAL );
+#                    else
                      fread( amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid, sizeof(real), CUBE(PS1)*NCOMP_TOTAL, File );
+#                    endif
 
 //                   d3-2. skip gravitational potential
 #                    ifdef GRAVITY
@@ -517,7 +526,12 @@ void Init_ByRestart()
                      if ( LoadCCMag )     fseek( File, CUBE(PS1)*NCOMP_MAG*sizeof(real), SEEK_CUR );
 
 //                   load the face-centered data
+#                    ifdef MIXED_PRECISION
+                     fread( FieldBuf, sizeof(real), PS1P1*SQR(PS1)*NCOMP_MAG, File );
+                     Mis_CopyArray( amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[0], FieldBuf, PS1P1*SQR(PS1)*NCOMP_MAG );
+#                    else
                      fread( amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic, sizeof(real), PS1P1*SQR(PS1)*NCOMP_MAG, File );
+#                    endif
 #                    endif
                   } // if ( *LoadSon == -1 )
                } // within the target range
@@ -564,6 +578,9 @@ void Init_ByRestart()
       } // for (int TRanks=0; TRanks<MPI_NRank; TRanks+=RESTART_LOAD_NRANK)
    } // for (int lv=0; lv<NLv_Restart; lv++)
 
+#  ifdef MIXED_PRECISION
+   delete [] FieldBuf;
+#  endif
 
 // get the total number of real patches at all ranks
    for (int lv=0; lv<NLEVEL; lv++)     Mis_GetTotalPatchNumber( lv );
@@ -1181,8 +1198,6 @@ void Load_Parameter_After_2000( FILE *File, const int FormatVersion, int &NLv_Re
          Aux_Message( stderr, "          --> Grid scale will be rescaled\n" );
       }
 
-      CompareVar( "MAX_PATCH", max_patch, MAX_PATCH, NonFatal );
-
 
 
 //    d-2. check the symbolic constants defined in "Macro.h, CUPOT.h, and CUFLU.h"
@@ -117,10 +117,12 @@ void Init_Load_Parameter()
    ReadPara->Add( "DT__SYNC_CHILDREN_LV",       &DT__SYNC_CHILDREN_LV,            0.1,             0.0,           1.0            );
    ReadPara->Add( "OPT__DT_USER",               &OPT__DT_USER,                    false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__DT_LEVEL",              &OPT__DT_LEVEL,                   3,               1,             3              );
+   ReadPara->Add( "OPT__DT_CFL_CACHE",          &OPT__DT_CFL_CACHE,               false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_DT",             &OPT__RECORD_DT,                  true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "AUTO_REDUCE_DT",             &AUTO_REDUCE_DT,                  true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "AUTO_REDUCE_DT_FACTOR",      &AUTO_REDUCE_DT_FACTOR,           0.8,             Eps_double,    1.0            );
    ReadPara->Add( "AUTO_REDUCE_DT_FACTOR_MIN",  &AUTO_REDUCE_DT_FACTOR_MIN,       0.1,             0.0,           1.0            );
+   ReadPara->Add( "AUTO_REDUCE_DT_LOCAL",       &AUTO_REDUCE_DT_LOCAL,            0,               0,             NoMax_int      );
 
 
 // grid refinement
@@ -161,6 +163,9 @@ void Init_Load_Parameter()
 #  endif
    ReadPara->Add( "OPT__REUSE_MEMORY",          &OPT__REUSE_MEMORY,               2,               0,             2              );
    ReadPara->Add( "OPT__MEMORY_POOL",           &OPT__MEMORY_POOL,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "MEMORY_POOL_WINDOW",         &MEMORY_POOL_WINDOW,              16,              1,             MEMPOOL_MAX_WINDOW );
+   ReadPara->Add( "MEMORY_POOL_SHRINK",         &MEMORY_POOL_SHRINK,              2.0,             1.0,           NoMax_double   );
+   ReadPara->Add( "OPT__FIELD_BANK",            &OPT__FIELD_BANK,                 false,           Useless_bool,  Useless_bool   );
 
 
 // load balance
@@ -169,7 +174,10 @@ void Init_Load_Parameter()
 #  ifdef PARTICLE
    ReadPara->Add( "LB_INPUT__PAR_WEIGHT",       &LB_INPUT__PAR_WEIGHT,            0.0,             0.0,           NoMax_double   );
 #  endif
+   ReadPara->Add( "LB_INPUT__MEASURED_COST",    &LB_INPUT__MEASURED_COST,         false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "LB_INPUT__INCREMENTAL",      &LB_INPUT__INCREMENTAL,           false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RECORD_LOAD_BALANCE",   &OPT__RECORD_LOAD_BALANCE,        true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__LB_CUT_BENCHMARK",      &OPT__LB_CUT_BENCHMARK,           false,           Useless_bool,  Useless_bool   );
 #  endif
    ReadPara->Add( "OPT__MINIMIZE_MPI_BARRIER",  &OPT__MINIMIZE_MPI_BARRIER,       true,            Useless_bool,  Useless_bool   );
 
@@ -214,6 +222,8 @@ void Init_Load_Parameter()
    ReadPara->Add( "MOLECULAR_WEIGHT",           &MOLECULAR_WEIGHT,                0.6,             Eps_double,    NoMax_double   );
    ReadPara->Add( "MINMOD_COEFF",               &MINMOD_COEFF,                    1.5,             1.0,           2.0            );
    ReadPara->Add( "OPT__LR_LIMITER",            &OPT__LR_LIMITER,                 VL_GMINMOD,      0,             5              );
+   ReadPara->Add( "OPT__LR_SCHEME",             &OPT__LR_SCHEME,                 -1,               NoMin_int,     2              );
+   ReadPara->Add( "OPT__RSOLVER",               &OPT__RSOLVER,                   -1,               NoMin_int,     5              );
    ReadPara->Add( "OPT__1ST_FLUX_CORR",         &OPT__1ST_FLUX_CORR,             -1,               NoMin_int,     2              );
    ReadPara->Add( "OPT__1ST_FLUX_CORR_SCHEME",  &OPT__1ST_FLUX_CORR_SCHEME,       RSOLVER_1ST_ROE, 0,             3              );
 #  ifdef DUAL_ENERGY
@@ -248,6 +258,14 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__CORR_AFTER_ALL_SYNC",   &OPT__CORR_AFTER_ALL_SYNC,       -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OPT__NORMALIZE_PASSIVE",     &OPT__NORMALIZE_PASSIVE,          true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OVERLAP_MPI",           &OPT__OVERLAP_MPI,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__CPU_PIPELINE",          &OPT__CPU_PIPELINE,               false,           Useless_bool,  Useless_bool   );
+// do not check CPU_PIPELINE_NTHREAD since it may be reset by Init_ResetDefaultParameter()
+   ReadPara->Add( "CPU_PIPELINE_NTHREAD",       &CPU_PIPELINE_NTHREAD,           -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "OPT__TASK_GRAPH",            &OPT__TASK_GRAPH,                 false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__FLU_FUSED",             &OPT__FLU_FUSED,                  false,           Useless_bool,  Useless_bool   );
+// do not check FLU_FUSED_SLAB since it may be reset by Init_ResetDefaultParameter()
+   ReadPara->Add( "FLU_FUSED_SLAB",             &FLU_FUSED_SLAB,                 -1,               NoMin_int,     NoMax_int      );
+   ReadPara->Add( "OPT__FLU_CLUSTER",           &OPT__FLU_CLUSTER,                false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__RESET_FLUID",           &OPT__RESET_FLUID,                false,           Useless_bool,  Useless_bool   );
 #  if ( MODEL == HYDRO  ||  MODEL == ELBDM )
    ReadPara->Add( "MIN_DENS",                   &MIN_DENS,                        0.0,             0.0,           NoMax_double   );
@@ -308,6 +326,7 @@ void Init_Load_Parameter()
 
 // interpolation schemes
    ReadPara->Add( "OPT__INT_TIME",              &OPT__INT_TIME,                   true,            Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__GHOST_CACHE",           &OPT__GHOST_CACHE,                false,           Useless_bool,  Useless_bool   );
 #  if ( MODEL == ELBDM )
    ReadPara->Add( "OPT__INT_PHASE",             &OPT__INT_PHASE,                  true,            Useless_bool,  Useless_bool   );
 #  endif
@@ -53,9 +53,9 @@ void Init_MemAllocate()
 // c. allocate load-balance variables
 #  ifdef LOAD_BALANCE
 #  ifdef PARTICLE
-   amr->LB = new LB_t( MPI_NRank, LB_INPUT__WLI_MAX, LB_INPUT__PAR_WEIGHT );
+   amr->LB = new LB_t( MPI_NRank, LB_INPUT__WLI_MAX, LB_INPUT__PAR_WEIGHT, LB_INPUT__MEASURED_COST, LB_INPUT__INCREMENTAL );
 #  else
-   amr->LB = new LB_t( MPI_NRank, LB_INPUT__WLI_MAX, NULL_REAL );
+   amr->LB = new LB_t( MPI_NRank, LB_INPUT__WLI_MAX, NULL_REAL, LB_INPUT__MEASURED_COST, LB_INPUT__INCREMENTAL );
 #  endif
 #  endif // #ifdef LOAD_BALANCE
 
@@ -66,6 +66,10 @@ void Init_MemAllocate()
 #  endif
 
 
+// e. thread-private scratch buffers for preparing the ghost-zone data
+   Aux_Scratch_Init();
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
 
 } // FUNCTION : Init_MemAllocate
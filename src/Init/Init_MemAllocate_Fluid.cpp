@@ -5,10 +5,10 @@
 
 
 #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-extern real (*h_PriVar)      [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT)     ];
-extern real (*h_Slope_PPM)[3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ];
-extern real (*h_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
-extern real (*h_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
+extern real (*h_PriVar)      [NCOMP_LR][ CUBE(FLU_NXT)     ];
+extern real (*h_Slope_PPM)[3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ];
+extern real (*h_FC_Var)   [6][NCOMP_LR][ CUBE(N_FC_VAR)    ];
+extern real (*h_FC_Flux)  [3][NCOMP_LR][ CUBE(N_FC_FLUX)   ];
 #ifdef MHD
 extern real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
 extern real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ];
@@ -70,11 +70,11 @@ void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGrou
 
 
 #  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-   h_FC_Var      = new real [Flu_NPatchGroup][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ];
-   h_FC_Flux     = new real [Flu_NPatchGroup][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ];
-   h_PriVar      = new real [Flu_NPatchGroup]   [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT)     ];
+   h_FC_Var      = new real [Flu_NPatchGroup][6][NCOMP_LR][ CUBE(N_FC_VAR)    ];
+   h_FC_Flux     = new real [Flu_NPatchGroup][3][NCOMP_LR][ CUBE(N_FC_FLUX)   ];
+   h_PriVar      = new real [Flu_NPatchGroup]   [NCOMP_LR][ CUBE(FLU_NXT)     ];
 #  if ( LR_SCHEME == PPM )
-   h_Slope_PPM   = new real [Flu_NPatchGroup][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ];
+   h_Slope_PPM   = new real [Flu_NPatchGroup][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ];
 #  endif
 #  ifdef MHD
    h_FC_Mag_Half = new real [Flu_NPatchGroup][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ];
@@ -82,6 +82,23 @@ void Init_MemAllocate_Fluid( const int Flu_NPatchGroup, const int Pot_NPatchGrou
 #  endif
 #  endif // FLU_SCHEME
 
+
+// clusters of patch groups (see InvokeSolver())
+#  ifdef FLU_CLUSTER
+   if ( OPT__FLU_CLUSTER )
+   {
+      const int Flu_NCluster = MAX( 1, Flu_NPatchGroup/CUBE(FLU_CLU_NPG) );
+
+      h_Flu_Array_C_In  = new real [Flu_NCluster][FLU_NIN ][ CUBE(FLU_CLU_NXT) ];
+      h_Flu_Array_C_Out = new real [Flu_NCluster][FLU_NOUT][ CUBE(FLU_CLU_NOUT) ];
+#     ifdef DUAL_ENERGY
+      h_DE_Array_C_Out  = new char [Flu_NCluster][ CUBE(FLU_CLU_NOUT) ];
+#     endif
+
+      CPU_FluidSolver_Cluster_MemAllocate( OMP_NTHREAD );
+   }
+#  endif
+
 } // FUNCTION : Init_MemAllocate_Fluid
 
 
@@ -26,7 +26,12 @@ void Init_OpenMP()
    omp_set_num_threads( OMP_NTHREAD );
 
 // enable/disable nested parallelization
-   omp_set_nested( false );
+// --> OPT__CPU_PIPELINE requires two active levels so that the CPU solvers can run concurrently with the
+//     preparation and closing steps in InvokeSolver()
+// --> OPT__OVERLAP_MPI requires two active levels so that the solvers can run concurrently with
+//     Buf_GetBufferData() in EvolveLevel()
+// --> OPT__TASK_GRAPH does not require nested parallelization since each task runs the solvers with a single thread
+   omp_set_nested( OPT__CPU_PIPELINE || OPT__OVERLAP_MPI );
 
 // schedule
    const int chunk_size = 1;
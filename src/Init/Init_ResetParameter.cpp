@@ -451,7 +451,7 @@ void Init_ResetParameter()
 
 
 // turn off "OPT__OVERLAP_MPI" if (1) OVERLAP_MPI=ff, (2) SERIAL=on, (3) LOAD_BALANCE=off,
-//                                (4) OPENMP=off, (5) MPI thread support=MPI_THREAD_SINGLE
+//                                (4) OPENMP=off, (5) MPI thread support=MPI_THREAD_SINGLE, (6) OMP_NTHREAD<2
 #  ifndef OVERLAP_MPI
    if ( OPT__OVERLAP_MPI )
    {
@@ -500,6 +500,160 @@ void Init_ResetParameter()
    }
 #  endif
 
+   if ( OPT__OVERLAP_MPI  &&  OMP_NTHREAD < 2 )
+   {
+      OPT__OVERLAP_MPI = false;
+
+      PRINT_WARNING( OPT__OVERLAP_MPI, FORMAT_INT, "since OMP_NTHREAD < 2" );
+   }
+
+
+// turn off "OPT__CPU_PIPELINE" if (1) GPU=on, (2) OPENMP=off, (3) OMP_NTHREAD<2
+#  ifdef GPU
+   if ( OPT__CPU_PIPELINE )
+   {
+      OPT__CPU_PIPELINE = false;
+
+      PRINT_WARNING( OPT__CPU_PIPELINE, FORMAT_INT, "since GPU is enabled" );
+   }
+#  endif
+
+#  ifndef OPENMP
+   if ( OPT__CPU_PIPELINE )
+   {
+      OPT__CPU_PIPELINE = false;
+
+      PRINT_WARNING( OPT__CPU_PIPELINE, FORMAT_INT, "since OPENMP is disabled" );
+   }
+#  endif
+
+   if ( OPT__CPU_PIPELINE  &&  OMP_NTHREAD < 2 )
+   {
+      OPT__CPU_PIPELINE = false;
+
+      PRINT_WARNING( OPT__CPU_PIPELINE, FORMAT_INT, "since OMP_NTHREAD < 2" );
+   }
+
+// number of OpenMP threads for the preparation/closing steps in the CPU pipeline (must set OMP_NTHREAD in advance)
+   if ( OPT__CPU_PIPELINE  &&  CPU_PIPELINE_NTHREAD <= 0 )
+   {
+      CPU_PIPELINE_NTHREAD = MAX( 1, OMP_NTHREAD/4 );
+
+      PRINT_WARNING( CPU_PIPELINE_NTHREAD, FORMAT_INT, "" );
+   }
+
+
+// turn off "OPT__TASK_GRAPH" if (1) GPU=on, (2) OPENMP=off, (3) TIMING_SOLVER=on, (4) OMP_NTHREAD<2, (5) OPT__CPU_PIPELINE=on
+#  ifdef GPU
+   if ( OPT__TASK_GRAPH )
+   {
+      OPT__TASK_GRAPH = false;
+
+      PRINT_WARNING( OPT__TASK_GRAPH, FORMAT_INT, "since GPU is enabled" );
+   }
+#  endif
+
+#  ifndef OPENMP
+   if ( OPT__TASK_GRAPH )
+   {
+      OPT__TASK_GRAPH = false;
+
+      PRINT_WARNING( OPT__TASK_GRAPH, FORMAT_INT, "since OPENMP is disabled" );
+   }
+#  endif
+
+// the solver timers are shared by all threads and cannot be started by concurrent tasks
+#  ifdef TIMING_SOLVER
+   if ( OPT__TASK_GRAPH )
+   {
+      OPT__TASK_GRAPH = false;
+
+      PRINT_WARNING( OPT__TASK_GRAPH, FORMAT_INT, "since TIMING_SOLVER is enabled" );
+   }
+#  endif
+
+   if ( OPT__TASK_GRAPH  &&  OMP_NTHREAD < 2 )
+   {
+      OPT__TASK_GRAPH = false;
+
+      PRINT_WARNING( OPT__TASK_GRAPH, FORMAT_INT, "since OMP_NTHREAD < 2" );
+   }
+
+   if ( OPT__TASK_GRAPH  &&  OPT__CPU_PIPELINE )
+   {
+      OPT__TASK_GRAPH = false;
+
+      PRINT_WARNING( OPT__TASK_GRAPH, FORMAT_INT, "since OPT__CPU_PIPELINE is enabled" );
+   }
+
+
+// turn off "OPT__FLU_FUSED" if (1) GPU=on, (2) the fluid scheme is not MHM/CTU in HYDRO, (3) MHD=on
+#  ifdef GPU
+   if ( OPT__FLU_FUSED )
+   {
+      OPT__FLU_FUSED = false;
+
+      PRINT_WARNING( OPT__FLU_FUSED, FORMAT_INT, "since GPU is enabled" );
+   }
+#  endif
+
+#  if ( MODEL != HYDRO  ||  ( FLU_SCHEME != MHM && FLU_SCHEME != CTU ) )
+   if ( OPT__FLU_FUSED )
+   {
+      OPT__FLU_FUSED = false;
+
+      PRINT_WARNING( OPT__FLU_FUSED, FORMAT_INT, "since it only supports the MHM/CTU schemes in HYDRO" );
+   }
+#  endif
+
+#  ifdef MHD
+   if ( OPT__FLU_FUSED )
+   {
+      OPT__FLU_FUSED = false;
+
+      PRINT_WARNING( OPT__FLU_FUSED, FORMAT_INT, "since MHD is enabled" );
+   }
+#  endif
+
+// thickness of the slabs in the fused fluid solver
+   if ( OPT__FLU_FUSED  &&  FLU_FUSED_SLAB <= 0 )
+   {
+      FLU_FUSED_SLAB = 2;
+
+      PRINT_WARNING( FLU_FUSED_SLAB, FORMAT_INT, "" );
+   }
+
+
+// turn off "OPT__FLU_CLUSTER" if the fluid solver does not support clusters (see FLU_CLUSTER in Macro.h)
+#  ifndef FLU_CLUSTER
+   if ( OPT__FLU_CLUSTER )
+   {
+      OPT__FLU_CLUSTER = false;
+
+      PRINT_WARNING( OPT__FLU_CLUSTER, FORMAT_INT, "since it only supports the CPU MHM/MHM_RP/CTU schemes in HYDRO "
+                     "without MHD and UNSPLIT_GRAVITY" );
+   }
+#  endif
+
+
+// turn off "OPT__DT_CFL_CACHE" if the fluid data may be modified without updating the cached CFL speed
+#  if ( MODEL != HYDRO  ||  defined MHD  ||  defined SUPPORT_GRACKLE  ||  defined STAR_FORMATION )
+   if ( OPT__DT_CFL_CACHE )
+   {
+      OPT__DT_CFL_CACHE = false;
+
+      PRINT_WARNING( OPT__DT_CFL_CACHE, FORMAT_INT, "since it only supports HYDRO without MHD, SUPPORT_GRACKLE, "
+                     "and STAR_FORMATION" );
+   }
+#  else
+   if ( OPT__DT_CFL_CACHE  &&  OPT__RESET_FLUID )
+   {
+      OPT__DT_CFL_CACHE = false;
+
+      PRINT_WARNING( OPT__DT_CFL_CACHE, FORMAT_INT, "since it does not support OPT__RESET_FLUID" );
+   }
+#  endif
+
 
 // disable "OPT__CK_FLUX_ALLOCATE" if no flux arrays are going to be allocated
    if ( OPT__CK_FLUX_ALLOCATE  &&  !amr->WithFlux )
@@ -595,6 +749,41 @@ void Init_ResetParameter()
 #  endif
 
 
+// set the default data reconstruction scheme and Riemann solver to the Makefile options
+#  if ( MODEL == HYDRO )
+#  if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
+   if ( OPT__LR_SCHEME < 0 )
+   {
+      OPT__LR_SCHEME = (OptLRScheme_t)LR_SCHEME;
+
+      PRINT_WARNING( OPT__LR_SCHEME, FORMAT_INT, "to be consistent with the Makefile option LR_SCHEME" );
+   }
+
+   if ( OPT__RSOLVER < 0 )
+   {
+      OPT__RSOLVER = (OptRSolver_t)RSOLVER;
+
+      PRINT_WARNING( OPT__RSOLVER, FORMAT_INT, "to be consistent with the Makefile option RSOLVER" );
+   }
+
+#  else
+   if ( OPT__LR_SCHEME != LR_SCHEME_NONE )
+   {
+      OPT__LR_SCHEME = LR_SCHEME_NONE;
+
+      PRINT_WARNING( OPT__LR_SCHEME, FORMAT_INT, "since it's only useful for the MHM/MHM_RP/CTU schemes" );
+   }
+
+   if ( OPT__RSOLVER != RSOLVER_NONE )
+   {
+      OPT__RSOLVER = RSOLVER_NONE;
+
+      PRINT_WARNING( OPT__RSOLVER, FORMAT_INT, "since it's only useful for the MHM/MHM_RP/CTU schemes" );
+   }
+#  endif // #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU ) ... else ...
+#  endif // #if ( MODEL == HYDRO )
+
+
 // disable the refinement flag of Jeans length if GRAVITY is disabled
 #  if ( MODEL == HYDRO  &&  !defined GRAVITY )
    if ( OPT__FLAG_JEANS )
@@ -768,6 +957,40 @@ void Init_ResetParameter()
    }
 
 
+// AUTO_REDUCE_DT_LOCAL only works with AUTO_REDUCE_DT and the CPU hydro solvers without MHD and UNSPLIT_GRAVITY
+// --> it also does not work with OPT__CPU_PIPELINE and OPT__TASK_GRAPH since the sub-steps invoke the CPU solvers
+//     in the closing step, which may run concurrently with the solvers of another batch
+   if ( AUTO_REDUCE_DT_LOCAL > 1 )
+   {
+#     if ( MODEL != HYDRO  ||  defined GPU  ||  defined MHD  ||  defined UNSPLIT_GRAVITY )
+      AUTO_REDUCE_DT_LOCAL = 0;
+
+      PRINT_WARNING( AUTO_REDUCE_DT_LOCAL, FORMAT_INT, "since it only supports the CPU HYDRO solvers without MHD and UNSPLIT_GRAVITY" );
+#     endif
+
+      if      ( !AUTO_REDUCE_DT )
+      {
+         AUTO_REDUCE_DT_LOCAL = 0;
+
+         PRINT_WARNING( AUTO_REDUCE_DT_LOCAL, FORMAT_INT, "since AUTO_REDUCE_DT is disabled" );
+      }
+
+      else if ( OPT__CPU_PIPELINE )
+      {
+         AUTO_REDUCE_DT_LOCAL = 0;
+
+         PRINT_WARNING( AUTO_REDUCE_DT_LOCAL, FORMAT_INT, "since OPT__CPU_PIPELINE is enabled" );
+      }
+
+      else if ( OPT__TASK_GRAPH )
+      {
+         AUTO_REDUCE_DT_LOCAL = 0;
+
+         PRINT_WARNING( AUTO_REDUCE_DT_LOCAL, FORMAT_INT, "since OPT__TASK_GRAPH is enabled" );
+      }
+   }
+
+
 // FLAG_BUFFER_SIZE at the level MAX_LEVEL-1 and MAX_LEVEL-2
    if ( FLAG_BUFFER_SIZE_MAXM1_LV < 0 )
    {
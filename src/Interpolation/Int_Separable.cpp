@@ -0,0 +1,188 @@
+#include "GAMER.h"
+
+
+// maximum number of elements in the temporary arrays TDataX[] + TDataY[] of a block of components
+// --> components are interpolated in blocks so that the temporary arrays remain in cache
+#define INT_BLOCK_NREAL    32768
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_Separable
+// Description :  Perform spatial interpolation by applying the 1D interpolation "Int1D" along x, y, and z in order
+//
+// Note        :  1. Shared by Int_MinMod3D(), Int_vanLeer(), Int_CQuadratic(), Int_Quadratic(), Int_CQuartic(),
+//                   and Int_Quartic(), which only provide the 1D interpolation of a row of coarse cells
+//                   --> Same order of interpolation and unwrapping as the original per-cell implementations, so
+//                       the results are bitwise identical
+//                2. Int1D() is invoked once per row with the contiguous cells of the row
+//                   --> It must not contain any branch inside the loop over cells so that it can be vectorized
+//                   --> For the x direction, the left/right results are stored in RowL/R[] first and then
+//                       interleaved into TDataX[]
+//                3. Components are interpolated in blocks of NBlock components: all components in a block are
+//                   interpolated along x first, then along y, and then along z
+//                4. Temporary arrays are thread-private scratch buffers (see Aux_Scratch_Get())
+//
+// Parameter   :  Int1D       : 1D interpolation (see Int1D_t in Typedef.h)
+//                CGhost      : Number of coarse-grid ghost zones required by Int1D()
+//                CData       : Input coarse-grid array
+//                CSize       : Size of the CData array
+//                CStart      : (x,y,z) starting indices to perform interpolation on the CData array
+//                CRange      : Number of grids in each direction to perform interpolation
+//                FData       : Output fine-grid array
+//                FSize       : Size of the FData array
+//                FStart      : (x,y,z) starting indcies to store the interpolation results
+//                NComp       : Number of components in the CData and FData array
+//                UnwrapPhase : Unwrap phase when OPT__INT_PHASE is on (for ELBDM only)
+//                Monotonic   : Ensure that all interpolation results are monotonic (NULL --> all off)
+//                MonoCoeff   : Slope limiter coefficient for the option "Monotonic"
+//-------------------------------------------------------------------------------------------------------
+void Int_Separable( const Int1D_t Int1D, const int CGhost,
+                    real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                    real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                    const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff )
+{
+
+// index stride of the coarse-grid input array
+   const int Cdx    = 1;
+   const int Cdy    = Cdx*CSize[0];
+   const int Cdz    = Cdy*CSize[1];
+
+// index stride of the temporary arrays storing the data after x and y interpolations
+   const int Tdx    = 1;
+   const int Tdy    = Tdx* CRange[0]*2;
+   const int TdzX   = Tdy*(CRange[1]+2*CGhost);    // array after x interpolation
+   const int TdzY   = Tdy* CRange[1]*2;            // array after y interpolation
+
+// index stride of the fine-grid output array
+   const int Fdx    = 1;
+   const int Fdy    = Fdx*FSize[0];
+   const int Fdz    = Fdy*FSize[1];
+
+// index stride of different components
+   const long CDisp = (long)CSize[0]*CSize[1]*CSize[2];
+   const long FDisp = (long)FSize[0]*FSize[1]*FSize[2];
+   const long TDisp[2] = { (long)(CRange[2]+2*CGhost)*TdzX, (long)(CRange[2]+2*CGhost)*TdzY };
+
+// number of components per block
+   const int NBlock = MAX(  1, MIN( NComp, (int)( INT_BLOCK_NREAL/(TDisp[0]+TDisp[1]) ) )  );
+
+   real *TDataX = (real*)Aux_Scratch_Get( SCRATCH_INT_TDATA_X, NBlock*TDisp[0]*sizeof(real) );
+   real *TDataY = (real*)Aux_Scratch_Get( SCRATCH_INT_TDATA_Y, NBlock*TDisp[1]*sizeof(real) );
+   real *RowL   = (real*)Aux_Scratch_Get( SCRATCH_INT_ROW,     2*CRange[0]*sizeof(real)      );
+   real *RowR   = RowL + CRange[0];
+
+
+   for (int v0=0; v0<NComp; v0+=NBlock)
+   {
+      const int NB = MIN( NBlock, NComp-v0 );
+
+
+//    1. interpolation along x direction
+      for (int b=0; b<NB; b++)
+      {
+         const int  v    = v0 + b;
+         const bool Mono = ( Monotonic == NULL ) ? false : Monotonic[v];
+         real *CPtr      = CData  + v*CDisp;
+         real *TPtr      = TDataX + b*TDisp[0];
+
+//       unwrap phase along x direction
+#        if ( MODEL == ELBDM )
+         if ( UnwrapPhase )
+         {
+            for (int k=CStart[2]-CGhost;    k<CStart[2]+CRange[2]+CGhost;  k++)
+            for (int j=CStart[1]-CGhost;    j<CStart[1]+CRange[1]+CGhost;  j++)
+            for (int i=CStart[0]-CGhost+1;  i<CStart[0]+CRange[0]+CGhost;  i++)
+            {
+               const int Idx_InC = k*Cdz + j*Cdy + i*Cdx;
+               const int Idx_InL = Idx_InC - Cdx;
+               CPtr[Idx_InC] = ELBDM_UnwrapPhase( CPtr[Idx_InL], CPtr[Idx_InC] );
+            }
+         }
+#        endif
+
+         for (int In_z=CStart[2]-CGhost, Out_z=0;  In_z<CStart[2]+CRange[2]+CGhost;  In_z++, Out_z++)
+         for (int In_y=CStart[1]-CGhost, Out_y=0;  In_y<CStart[1]+CRange[1]+CGhost;  In_y++, Out_y++)
+         {
+            real *TRow = TPtr + Out_z*TdzX + Out_y*Tdy;
+
+            Int1D( CPtr + In_z*Cdz + In_y*Cdy + CStart[0]*Cdx, Cdx, RowL, RowR, CRange[0], Mono, MonoCoeff );
+
+#           pragma omp simd
+            for (int i=0; i<CRange[0]; i++)
+            {
+               TRow[ 2*i     ] = RowL[i];
+               TRow[ 2*i + 1 ] = RowR[i];
+            }
+         }
+      } // for (int b=0; b<NB; b++)
+
+
+//    2. interpolation along y direction
+      for (int b=0; b<NB; b++)
+      {
+         const int  v    = v0 + b;
+         const bool Mono = ( Monotonic == NULL ) ? false : Monotonic[v];
+         real *TInPtr    = TDataX + b*TDisp[0];
+         real *TOutPtr   = TDataY + b*TDisp[1];
+
+//       unwrap phase along y direction
+#        if ( MODEL == ELBDM )
+         if ( UnwrapPhase )
+         {
+            for (int k=0;  k<CRange[2]+2*CGhost;  k++)
+            for (int j=1;  j<CRange[1]+2*CGhost;  j++)
+            for (int i=0;  i<2*CRange[0];         i++)
+            {
+               const int Idx_InC = k*TdzX + j*Tdy + i*Tdx;
+               const int Idx_InL = Idx_InC - Tdy;
+               TInPtr[Idx_InC] = ELBDM_UnwrapPhase( TInPtr[Idx_InL], TInPtr[Idx_InC] );
+            }
+         }
+#        endif
+
+         for (int InOut_z=0;             InOut_z<CRange[2]+2*CGhost;  InOut_z++)
+         for (int In_y=CGhost, Out_y=0;  In_y   <CGhost+CRange[1];    In_y++, Out_y+=2)
+         {
+            real *TOut = TOutPtr + InOut_z*TdzY + Out_y*Tdy;
+
+            Int1D( TInPtr + InOut_z*TdzX + In_y*Tdy, Tdy, TOut, TOut+Tdy, 2*CRange[0], Mono, MonoCoeff );
+         }
+      } // for (int b=0; b<NB; b++)
+
+
+//    3. interpolation along z direction
+      for (int b=0; b<NB; b++)
+      {
+         const int  v    = v0 + b;
+         const bool Mono = ( Monotonic == NULL ) ? false : Monotonic[v];
+         real *TInPtr    = TDataY + b*TDisp[1];
+         real *FPtr      = FData  + v*FDisp;
+
+//       unwrap phase along z direction
+#        if ( MODEL == ELBDM )
+         if ( UnwrapPhase )
+         {
+            for (int k=1;  k<CRange[2]+2*CGhost;  k++)
+            for (int j=0;  j<2*CRange[1];         j++)
+            for (int i=0;  i<2*CRange[0];         i++)
+            {
+               const int Idx_InC = k*TdzY + j*Tdy + i*Tdx;
+               const int Idx_InL = Idx_InC - TdzY;
+               TInPtr[Idx_InC] = ELBDM_UnwrapPhase( TInPtr[Idx_InL], TInPtr[Idx_InC] );
+            }
+         }
+#        endif
+
+         for (int In_z=CGhost, Out_z=FStart[2];  In_z<CGhost+CRange[2];  In_z++, Out_z+=2)
+         for (int In_y=0,      Out_y=FStart[1];  In_y<2*CRange[1];       In_y++, Out_y++)
+         {
+            real *FOut = FPtr + Out_z*Fdz + Out_y*Fdy + FStart[0]*Fdx;
+
+            Int1D( TInPtr + In_z*TdzY + In_y*Tdy, TdzY, FOut, FOut+Fdz, 2*CRange[0], Mono, MonoCoeff );
+         }
+      } // for (int b=0; b<NB; b++)
+   } // for (int v0=0; v0<NComp; v0+=NBlock)
+
+} // FUNCTION : Int_Separable
@@ -0,0 +1,89 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_AccumulateCost
+// Description :  Add the measured wall-clock time of a batch of patch groups to their load-balance cost
+//                (i.e., patch_t::LB_Cost)
+//
+// Note        :  1. Invoked by InvokeSolver() for all solvers and by Par_UpdateParticle() for each patch group
+//                   --> Cost is distributed evenly over all patches in the target patch groups since the solvers
+//                       process a batch of patch groups at a time
+//                2. Accumulated costs are used by LB_EstimateWorkload_AllPatchGroup() when LB_INPUT__MEASURED_COST
+//                   is on
+//                   --> Normalized by the number of steps counted by LB_CountCostStep()
+//                   --> Reset by LB_ResetCost() after each rebalance
+//                3. Do nothing if LB_INPUT__MEASURED_COST is off
+//                4. Thread-safe as long as different threads work on different patch groups
+//
+// Parameter   :  lv        : Target refinement level
+//                NPG       : Number of patch groups in PID0_List
+//                PID0_List : List recording the patch indices with LocalID==0 of the target patch groups
+//                Cost      : Measured wall-clock time (in seconds) of all target patch groups
+//-------------------------------------------------------------------------------------------------------
+void LB_AccumulateCost( const int lv, const int NPG, const int *PID0_List, const double Cost )
+{
+
+   if ( !amr->LB->MeasuredCost  ||  NPG <= 0 )  return;
+
+   const double Cost_Patch = Cost / (8.0*NPG);
+
+   for (int t=0; t<NPG; t++)
+   for (int LocalID=0; LocalID<8; LocalID++)
+      amr->patch[0][lv][ PID0_List[t] + LocalID ]->LB_Cost += Cost_Patch;
+
+} // FUNCTION : LB_AccumulateCost
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_CountCostStep
+// Description :  Increment the number of steps accumulated in the load-balance cost (i.e., patch_t::LB_NStep)
+//                of all real patches at the target level
+//
+// Note        :  1. Invoked by EvolveLevel() once per sub-step at lv
+//                   --> LB_Cost/LB_NStep then gives the measured cost per step, which does not grow with the
+//                       time elapsed since the last reset
+//                2. Do nothing if LB_INPUT__MEASURED_COST is off
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void LB_CountCostStep( const int lv )
+{
+
+   if ( !amr->LB->MeasuredCost )    return;
+
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)   amr->patch[0][lv][PID]->LB_NStep ++;
+
+} // FUNCTION : LB_CountCostStep
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_ResetCost
+// Description :  Reset the measured load-balance cost (i.e., patch_t::LB_Cost and LB_NStep) of all real
+//                patches at the target level
+//
+// Note        :  1. Invoked by main() after each rebalance so that the costs measured with the previous
+//                   distribution are not carried over
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void LB_ResetCost( const int lv )
+{
+
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   {
+      amr->patch[0][lv][PID]->LB_Cost  = 0.0;
+      amr->patch[0][lv][PID]->LB_NStep = 0;
+   }
+
+} // FUNCTION : LB_ResetCost
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -21,6 +21,10 @@
 //                           Record__ParticleCount. The latter only considers particles in the leaf patches
 //                4. Invoked by main() to determine whether we should redistribute all patches
 //                   (by calling LB_Init_LoadBalance()) to improve the load balance
+//                5. For LB_INPUT__MEASURED_COST, the workload at each level is the measured wall-clock time per step,
+//                   which is multiplied by "amr->NUpdateLv" as well
+//                   --> Levels without any measurement fall back to the estimated workload, which is converted to
+//                       seconds by the average cost per patch update of all measured levels
 //
 // Return      :  amr->LB->WLI
 //-------------------------------------------------------------------------------------------------------
@@ -35,6 +39,7 @@ double LB_EstimateLoadImbalance()
 #  endif
 
    double Load_ThisRank[NLEVEL];
+   bool   Measured[NLEVEL];   // whether the workload at each level is the measured cost
 
    for (int lv=0; lv<NLEVEL; lv++)
    {
@@ -42,7 +47,7 @@ double LB_EstimateLoadImbalance()
 
       double *Load_AllPG = new double [NPG];
 
-      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_AllPG );
+      Measured[lv] = LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_AllPG );
 
       Load_ThisRank[lv] = 0.0;
       for (int t=0; t<NPG; t++)  Load_ThisRank[lv] += Load_AllPG[t];
@@ -62,6 +67,33 @@ double LB_EstimateLoadImbalance()
 
    if ( MPI_Rank == 0 )
    {
+//    2-1. convert the estimated workload to seconds if it is mixed with the measured cost
+//         --> assuming the workload of one patch is 1.0 in the estimation (i.e., ignoring particles)
+      double Cost_Measured=0.0, NUpdate_Measured=0.0;
+      bool   Mixed=false;
+
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         if ( Measured[lv] )
+         {
+            for (int r=0; r<MPI_NRank; r++)  Cost_Measured += Load_AllRank[r][lv];
+
+            NUpdate_Measured += (double)NPatchTotal[lv]*amr->NUpdateLv[lv];
+         }
+
+         else if ( NPatchTotal[lv] > 0 )  Mixed = true;
+      }
+
+      if ( Mixed  &&  NUpdate_Measured > 0.0 )
+      {
+         const double Cost_PerUpdate = Cost_Measured / NUpdate_Measured;
+
+         for (int lv=0; lv<NLEVEL; lv++)
+            if ( !Measured[lv] )
+               for (int r=0; r<MPI_NRank; r++)  Load_AllRank[r][lv] *= Cost_PerUpdate;
+      }
+
+
 //    3. estimate the weighted load-imbalance (WLI) factor
       double Load_Max[NLEVEL], Load_Ave[NLEVEL], Load_Imb[NLEVEL];   // at each level (Imb : Imbalance)
       double Load_Ave_AllLv, Load_Max_AllLv;                         // weighted sum over all levels
@@ -152,6 +184,13 @@ double LB_EstimateLoadImbalance()
          for (int lv=0; lv<NLEVEL; lv++)     fprintf( File, " %7.2lf%%%10s", 100.0*Load_Imb[lv], "" );
          fprintf( File, "\n" );
 
+         if ( amr->LB->MeasuredCost )
+         {
+            fprintf( File, "%4s", "Mod:" );
+            for (int lv=0; lv<NLEVEL; lv++)  fprintf( File, " %9s%9s", (Measured[lv])?"measured":"estimated", "" );
+            fprintf( File, "\n" );
+         }
+
          fprintf( File, "Weighted load-imbalance factor = %6.2f%%\n", 100.0*amr->LB->WLI );
 
          fprintf( File, "-------------------------------------------------------------------------------------" );
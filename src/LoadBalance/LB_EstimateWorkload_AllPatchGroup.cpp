@@ -17,6 +17,16 @@
 //                   --> For non-leaf patches, this function will collect particles from the leaf patches
 //                3. This function assumes that "NPatchTotal[lv]" has already been set by invoking the
 //                   function "Mis_GetTotalPatchNumber( lv )"
+//                4. For LB_INPUT__MEASURED_COST, workload of each patch group is set to the measured wall-clock
+//                   time per step accumulated by LB_AccumulateCost() (i.e., the sum of patch_t::LB_Cost/LB_NStep)
+//                   instead
+//                   --> Patch groups without any measurement (e.g., newly-allocated patches) are assigned the
+//                       average cost of all measured patch groups at the same level among all ranks
+//                   --> Particle weighting is not added since the cost of the particle routines has already
+//                       been measured
+//                   --> Fall back to the estimation above if no patch groups at this level have been measured
+//                       (e.g., right after redistributing all patches)
+//                   --> Must be invoked by all ranks since it calls MPI_Allreduce()
 //
 // Parameter   :  lv        : Target refinement level
 //                ParWeight : Relative workload weighting of particles
@@ -24,18 +34,58 @@
 //                Load_PG   : Estimated workload of all patch groups in this rank
 //                            --> Must be preallocated with th size "amr->NPatchComma[lv][1]/8"
 //
-// Return      :  Load_PG
+// Return      :  1. Load_PG
+//                2. true  --> Load_PG[] is the measured cost per step in seconds
+//                   false --> Load_PG[] is the estimated workload normalized to 1.0 per patch
 //-------------------------------------------------------------------------------------------------------
-void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG )
+bool LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, double *Load_PG )
 {
 
 // check
    if ( Load_PG == NULL )  Aux_Error( ERROR_INFO, "Load_PG == NULL !!\n" );
 
 
-// 1. workload of cells --> assuming the weighting of each patch == 1.0
    const int NPG_ThisRank = amr->NPatchComma[lv][1] / 8;
 
+
+// 0. measured cost
+   if ( amr->LB->MeasuredCost )
+   {
+//    Cost_ThisRank/AllRank[0/1] = sum of cost/number of the measured patch groups
+      double Cost_ThisRank[2] = { 0.0, 0.0 }, Cost_AllRank[2];
+
+      for (int t=0; t<NPG_ThisRank; t++)
+      {
+         Load_PG[t] = 0.0;
+         for (int PID=t*8; PID<(t+1)*8; PID++)
+         {
+            const patch_t *Patch = amr->patch[0][lv][PID];
+
+            if ( Patch->LB_NStep > 0 )    Load_PG[t] += Patch->LB_Cost / Patch->LB_NStep;
+         }
+
+         if ( Load_PG[t] > 0.0 )
+         {
+            Cost_ThisRank[0] += Load_PG[t];
+            Cost_ThisRank[1] += 1.0;
+         }
+      }
+
+      MPI_Allreduce( Cost_ThisRank, Cost_AllRank, 2, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+      if ( Cost_AllRank[1] > 0.0 )
+      {
+         const double Cost_Ave = Cost_AllRank[0] / Cost_AllRank[1];
+
+         for (int t=0; t<NPG_ThisRank; t++)
+            if ( Load_PG[t] == 0.0 )   Load_PG[t] = Cost_Ave;
+
+         return true;
+      }
+   } // if ( amr->LB->MeasuredCost )
+
+
+// 1. workload of cells --> assuming the weighting of each patch == 1.0
    for (int t=0; t<NPG_ThisRank; t++)  Load_PG[t] = 8.0; // 8 patches per patch group
 
 
@@ -80,6 +130,8 @@ void LB_EstimateWorkload_AllPatchGroup( const int lv, const double ParWeight, do
    } // if ( ParWeight_Norm > 0.0 )
 #  endif // #ifdef PARTICLE
 
+   return false;
+
 } // FUNCTION : LB_EstimateWorkload_AllPatchGroup
 
 
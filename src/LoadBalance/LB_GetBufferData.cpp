@@ -3,14 +3,6 @@
 #ifdef LOAD_BALANCE
 
 
-const real BufSizeFactor = 1.2;  // Send/RecvBufSize = int(NSend/NRecv*BufSizeFactor) --> must be >= 1.0
-
-// MPI buffers are shared by some particle routines
-static real *MPI_SendBuf_Shared = NULL;
-static real *MPI_RecvBuf_Shared = NULL;
-static int   SendBufSize        = -1;
-static int   RecvBufSize        = -1;
-
 #ifdef TIMING
 extern Timer_t *Timer_MPI[3];
 #endif
@@ -187,10 +179,6 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    int  *RecvY_NList=NULL, **RecvY_IDList=NULL, **RecvY_SibList=NULL;
 #  endif
 
-   int *Send_NCount = new int [MPI_NRank];
-   int *Recv_NCount = new int [MPI_NRank];
-   int *Send_NDisp  = new int [MPI_NRank];
-   int *Recv_NDisp  = new int [MPI_NRank];
 
 
 // 1. set up the number of elements to be sent and received in each cell and the send/recv lists
@@ -293,6 +281,53 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    } // switch ( GetBufMode )
 
 
+// get the MPI count and displacement arrays and the tables for packing and unpacking data from the persistent MPI buffer
+// --> each entry in the send/recv lists (referred to as a "slab") is packed and unpacked by a separate OpenMP iteration
+//     so that all threads are kept busy even when there are only a few neighbor ranks
+//     --> [Send/Recv]_SlabRank/SlabDisp: target rank and buffer offset of each slab
+//         [Send/Recv]_SlabStart        : index of the first slab of each rank
+// --> DATA_AFTER_FIXUP is still parallelized over ranks only since the same patch can appear in more than
+//     one of its sub-lists (for the restriction, flux, and electric field fix-up)
+   const bool SlabParallel = ( GetBufMode != DATA_AFTER_FIXUP );
+   int NSendSlab = 0, NRecvSlab = 0;
+
+   if ( SlabParallel )
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      NSendSlab += Send_NList[r];
+      NRecvSlab += Recv_NList[r];
+   }
+
+   int *Send_NCount    = (int*)LB_MPIBuffer_Get( MPIBUF_TABLE, ( 6L*MPI_NRank + 2L*NSendSlab + 2L*NRecvSlab )*sizeof(int) );
+   int *Recv_NCount    = Send_NCount    + MPI_NRank;
+   int *Send_NDisp     = Recv_NCount    + MPI_NRank;
+   int *Recv_NDisp     = Send_NDisp     + MPI_NRank;
+   int *Send_SlabStart = Recv_NDisp     + MPI_NRank;
+   int *Recv_SlabStart = Send_SlabStart + MPI_NRank;
+   int *Send_SlabRank  = Recv_SlabStart + MPI_NRank;
+   int *Send_SlabDisp  = Send_SlabRank  + NSendSlab;
+   int *Recv_SlabRank  = Send_SlabDisp  + NSendSlab;
+   int *Recv_SlabDisp  = Recv_SlabRank  + NRecvSlab;
+
+   if ( SlabParallel )
+   {
+      Send_SlabStart[0] = 0;
+      Recv_SlabStart[0] = 0;
+
+      for (int r=1; r<MPI_NRank; r++)
+      {
+         Send_SlabStart[r] = Send_SlabStart[r-1] + Send_NList[r-1];
+         Recv_SlabStart[r] = Recv_SlabStart[r-1] + Recv_NList[r-1];
+      }
+
+      for (int r=0; r<MPI_NRank; r++)
+      {
+         for (int t=0; t<Send_NList[r]; t++)    Send_SlabRank[ Send_SlabStart[r] + t ] = r;
+         for (int t=0; t<Recv_NList[r]; t++)    Recv_SlabRank[ Recv_SlabStart[r] + t ] = r;
+      }
+   }
+
+
 
 // 2. set up the loop range, MPI count and displacement arrays, and allocate data for send and recv buffers
 // ============================================================================================================
@@ -367,6 +402,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
             for (int t=0; t<Send_NList[r]; t++)
             {
+               Send_SlabDisp[ Send_SlabStart[r] + t ] = Send_NCount[r];
+
                if ( Send_SibList[r][t] != 0 )
                for (int s=0; s<27; s++)
                   if ( Send_SibList[r][t] & (1<<s) )  Send_NCount[r] += DataUnit_Buf[s];
@@ -374,6 +411,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
             for (int t=0; t<Recv_NList[r]; t++)
             {
+               Recv_SlabDisp[ Recv_SlabStart[r] + t ] = Recv_NCount[r];
+
                if ( Recv_SibList[r][t] != 0 )
                for (int s=0; s<27; s++)
                   if ( Recv_SibList[r][t] & (1<<s) )  Recv_NCount[r] += DataUnit_Buf[s];
@@ -531,15 +570,21 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
       case DATA_RESTRICT :
 //    ----------------------------------------------
+      {
+         int DataUnit_Res = CUBE( PS1 )*NVarCC_Tot;
+#        ifdef MHD
+         DataUnit_Res += SQR( PS1 )*PS1P1*NVarFC_Mag;
+#        endif
+
          for (int r=0; r<MPI_NRank; r++)
          {
-            Send_NCount[r]  = Send_NList[r]*CUBE( PS1 )*NVarCC_Tot;
-            Recv_NCount[r]  = Recv_NList[r]*CUBE( PS1 )*NVarCC_Tot;
-#           ifdef MHD
-            Send_NCount[r] += Send_NList[r]*SQR( PS1 )*PS1P1*NVarFC_Mag;
-            Recv_NCount[r] += Recv_NList[r]*SQR( PS1 )*PS1P1*NVarFC_Mag;
-#           endif
+            Send_NCount[r] = Send_NList[r]*DataUnit_Res;
+            Recv_NCount[r] = Recv_NList[r]*DataUnit_Res;
+
+            for (int t=0; t<Send_NList[r]; t++)    Send_SlabDisp[ Send_SlabStart[r] + t ] = t*DataUnit_Res;
+            for (int t=0; t<Recv_NList[r]; t++)    Recv_SlabDisp[ Recv_SlabStart[r] + t ] = t*DataUnit_Res;
          }
+      }
          break; // case DATA_RESTRICT
 
 
@@ -549,6 +594,9 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
          {
             Send_NCount[r] = Send_NList[r]*DataUnit_Flux;
             Recv_NCount[r] = Recv_NList[r]*DataUnit_Flux;
+
+            for (int t=0; t<Send_NList[r]; t++)    Send_SlabDisp[ Send_SlabStart[r] + t ] = t*DataUnit_Flux;
+            for (int t=0; t<Recv_NList[r]; t++)    Recv_SlabDisp[ Recv_SlabStart[r] + t ] = t*DataUnit_Flux;
          }
          break; // case COARSE_FINE_FLUX
 
@@ -561,8 +609,17 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
             Send_NCount[r] = 0;
             Recv_NCount[r] = 0;
 
-            for(int t=0; t<Send_NList[r]; t++)  Send_NCount[r] += ( Send_SibList[r][t] < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
-            for(int t=0; t<Recv_NList[r]; t++)  Recv_NCount[r] += ( Recv_SibList[r][t] < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+            for (int t=0; t<Send_NList[r]; t++)
+            {
+               Send_SlabDisp[ Send_SlabStart[r] + t ] = Send_NCount[r];
+               Send_NCount[r] += ( Send_SibList[r][t] < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+            }
+
+            for (int t=0; t<Recv_NList[r]; t++)
+            {
+               Recv_SlabDisp[ Recv_SlabStart[r] + t ] = Recv_NCount[r];
+               Recv_NCount[r] += ( Recv_SibList[r][t] < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+            }
          }
          break; // case COARSE_FINE_ELECTRIC
 #     endif
@@ -582,10 +639,35 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    NSend_Total = Send_NDisp[ MPI_NRank-1 ] + Send_NCount[ MPI_NRank-1 ];
    NRecv_Total = Recv_NDisp[ MPI_NRank-1 ] + Recv_NCount[ MPI_NRank-1 ];
 
+// convert the slab offsets from per-rank to global
+   if ( SlabParallel )
+   {
+      for (int p=0; p<NSendSlab; p++)  Send_SlabDisp[p] += Send_NDisp[ Send_SlabRank[p] ];
+      for (int p=0; p<NRecvSlab; p++)  Recv_SlabDisp[p] += Recv_NDisp[ Recv_SlabRank[p] ];
+   }
+
 
 // allocate send/recv buffers (only when the current buffer size is not large enough --> improve performance)
-   real *SendBuf = LB_GetBufferData_MemAllocate_Send( NSend_Total );
-   real *RecvBuf = LB_GetBufferData_MemAllocate_Recv( NRecv_Total );
+// --> field data are exchanged in their storage type "real_fld" so that MIXED_PRECISION also halves the message
+//     volume, while the fix-up fluxes and electric field are always exchanged in "real"
+#  ifdef MHD
+   const bool   FldBuf      = ( GetBufMode != COARSE_FINE_FLUX  &&  GetBufMode != COARSE_FINE_ELECTRIC );
+#  else
+   const bool   FldBuf      = ( GetBufMode != COARSE_FINE_FLUX );
+#  endif
+   const size_t ElmSize     = ( FldBuf ) ? sizeof(real_fld) : sizeof(real);
+#  ifdef FLOAT8
+   MPI_Datatype MPI_ElmType = ( FldBuf ) ? MPI_GAMER_REAL_FLD : MPI_DOUBLE;
+#  else
+   MPI_Datatype MPI_ElmType = ( FldBuf ) ? MPI_GAMER_REAL_FLD : MPI_FLOAT;
+#  endif
+
+   char     *SendBuf      = (char*)LB_MPIBuffer_Get( MPIBUF_SEND, (long)NSend_Total*ElmSize );
+   char     *RecvBuf      = (char*)LB_MPIBuffer_Get( MPIBUF_RECV, (long)NRecv_Total*ElmSize );
+   real_fld *SendBuf_Fld  = (real_fld*)SendBuf;
+   real_fld *RecvBuf_Fld  = (real_fld*)RecvBuf;
+   real     *SendBuf_Flux = (real    *)SendBuf;
+   real     *RecvBuf_Flux = (real    *)RecvBuf;
 
 
 
@@ -603,133 +685,132 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #     endif
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
-         for (int r=0; r<MPI_NRank; r++)
+         for (int p=0; p<NSendSlab; p++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
-            int   Counter = 0;
+            const int r       = Send_SlabRank[p];
+            const int t       = p - Send_SlabStart[r];
+            real_fld *SendPtr = SendBuf_Fld + Send_SlabDisp[p];
+            int       Counter = 0;
 
-            for (int t=0; t<Send_NList[r]; t++)
+            const int SPID = Send_IDList [r][t];   // both SPID and SSib are sorted
+            const int SSib = Send_SibList[r][t];
+
+#           ifdef GAMER_DEBUG
+            if ( ExchangeFlu )
             {
-               const int SPID = Send_IDList [r][t];   // both SPID and SSib are sorted
-               const int SSib = Send_SibList[r][t];
+               if ( amr->patch[FluSg][lv][SPID]->fluid == NULL )
+                  Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->fluid has not been allocated !!\n",
+                             GetBufMode, FluSg, lv, SPID );
 
-#              ifdef GAMER_DEBUG
-               if ( ExchangeFlu )
-               {
-                  if ( amr->patch[FluSg][lv][SPID]->fluid == NULL )
-                     Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->fluid has not been allocated !!\n",
-                                GetBufMode, FluSg, lv, SPID );
+               if ( SSib == 0  &&  GetBufMode != DATA_AFTER_REFINE )
+                  Aux_Error( ERROR_INFO, "Send mode %d, t %d, TRank %d, SPID %d, SSib == 0 !!\n",
+                             GetBufMode, t, r, SPID );
+            }
 
-                  if ( SSib == 0  &&  GetBufMode != DATA_AFTER_REFINE )
-                     Aux_Error( ERROR_INFO, "Send mode %d, t %d, TRank %d, SPID %d, SSib == 0 !!\n",
-                                GetBufMode, t, r, SPID );
-               }
+#           ifdef GRAVITY
+            if ( ExchangePot )
+            {
+               if ( amr->patch[PotSg][lv][SPID]->pot == NULL )
+                  Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->pot has not been allocated !!\n",
+                             GetBufMode, PotSg, lv, SPID );
 
-#              ifdef GRAVITY
-               if ( ExchangePot )
-               {
-                  if ( amr->patch[PotSg][lv][SPID]->pot == NULL )
-                     Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->pot has not been allocated !!\n",
-                                GetBufMode, PotSg, lv, SPID );
+               if ( SSib == 0  &&  GetBufMode != POT_AFTER_REFINE )
+                  Aux_Error( ERROR_INFO, "Send mode %d, t %d, TRank %d, SPID %d, SSib == 0 !!\n",
+                             GetBufMode, t, r, SPID );
+            }
+#           endif // #ifdef GRAVITY
 
-                  if ( SSib == 0  &&  GetBufMode != POT_AFTER_REFINE )
-                     Aux_Error( ERROR_INFO, "Send mode %d, t %d, TRank %d, SPID %d, SSib == 0 !!\n",
-                                GetBufMode, t, r, SPID );
-               }
-#              endif // #ifdef GRAVITY
+#           ifdef MHD
+            if ( ExchangeMag )
+            {
+               if ( amr->patch[MagSg][lv][SPID]->magnetic == NULL )
+                  Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->magnetic has not been allocated !!\n",
+                             GetBufMode, MagSg, lv, SPID );
 
-#              ifdef MHD
-               if ( ExchangeMag )
-               {
-                  if ( amr->patch[MagSg][lv][SPID]->magnetic == NULL )
-                     Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->magnetic has not been allocated !!\n",
-                                GetBufMode, MagSg, lv, SPID );
-
-                  if ( SSib == 0  &&  GetBufMode != DATA_AFTER_REFINE )
-                     Aux_Error( ERROR_INFO, "Send mode %d, t %d, TRank %d, SPID %d, SSib == 0 !!\n",
-                                GetBufMode, t, r, SPID );
-               }
-#              endif // #ifdef MHD
-#              endif // #ifdef GAMER_DEBUG
+               if ( SSib == 0  &&  GetBufMode != DATA_AFTER_REFINE )
+                  Aux_Error( ERROR_INFO, "Send mode %d, t %d, TRank %d, SPID %d, SSib == 0 !!\n",
+                             GetBufMode, t, r, SPID );
+            }
+#           endif // #ifdef MHD
+#           endif // #ifdef GAMER_DEBUG
 
-               if ( SSib )
-               for (int s=0; s<27; s++)
+            if ( SSib )
+            for (int s=0; s<27; s++)
+            {
+               if ( SSib & (1<<s) )
                {
-                  if ( SSib & (1<<s) )
+//                fluid data
+                  if ( ExchangeFlu )
+                  for (int v=0; v<NVarCC_Flu; v++)
                   {
-//                   fluid data
-                     if ( ExchangeFlu )
-                     for (int v=0; v<NVarCC_Flu; v++)
-                     {
-                        const int TFluVarIdx = TFluVarIdxList[v];
+                     const int TFluVarIdx = TFluVarIdxList[v];
 
-                        for (int k=LoopStart[s][2]; k<LoopEnd[s][2]; k++)
-                        for (int j=LoopStart[s][1]; j<LoopEnd[s][1]; j++)
-                        for (int i=LoopStart[s][0]; i<LoopEnd[s][0]; i++)
-                           SendPtr[ Counter ++ ] = amr->patch[FluSg][lv][SPID]->fluid[TFluVarIdx][k][j][i];
-                     }
+                     for (int k=LoopStart[s][2]; k<LoopEnd[s][2]; k++)
+                     for (int j=LoopStart[s][1]; j<LoopEnd[s][1]; j++)
+                     for (int i=LoopStart[s][0]; i<LoopEnd[s][0]; i++)
+                        SendPtr[ Counter ++ ] = amr->patch[FluSg][lv][SPID]->fluid[TFluVarIdx][k][j][i];
+                  }
 
-//                   potential data
-#                    ifdef GRAVITY
-                     if ( ExchangePot )
-                     {
-                        for (int k=LoopStart[s][2]; k<LoopEnd[s][2]; k++)
-                        for (int j=LoopStart[s][1]; j<LoopEnd[s][1]; j++)
-                        for (int i=LoopStart[s][0]; i<LoopEnd[s][0]; i++)
-                           SendPtr[ Counter ++ ] = amr->patch[PotSg][lv][SPID]->pot[k][j][i];
-                     }
-#                    endif
+//                potential data
+#                 ifdef GRAVITY
+                  if ( ExchangePot )
+                  {
+                     for (int k=LoopStart[s][2]; k<LoopEnd[s][2]; k++)
+                     for (int j=LoopStart[s][1]; j<LoopEnd[s][1]; j++)
+                     for (int i=LoopStart[s][0]; i<LoopEnd[s][0]; i++)
+                        SendPtr[ Counter ++ ] = amr->patch[PotSg][lv][SPID]->pot[k][j][i];
+                  }
+#                 endif
+
+//                magnetic field data
+#                 ifdef MHD
+                  if ( ExchangeMag )
+                  for (int v=0; v<NVarFC_Mag; v++)
+                  {
+                     const int TMagVarIdx = TMagVarIdxList[v];
 
-//                   magnetic field data
-#                    ifdef MHD
-                     if ( ExchangeMag )
-                     for (int v=0; v<NVarFC_Mag; v++)
+                     switch ( TMagVarIdx )
                      {
-                        const int TMagVarIdx = TMagVarIdxList[v];
-
-                        switch ( TMagVarIdx )
-                        {
-                           case MAGX :
-                              for (int k=LoopStart[s][2]; k< LoopEnd[s][2]; k++)
-                              for (int j=LoopStart[s][1]; j< LoopEnd[s][1]; j++)
-                              for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
-                              {
-                                 const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
-                              }
-                              break;
-
-                           case MAGY :
-                              for (int k=LoopStart[s][2]; k< LoopEnd[s][2]; k++)
-                              for (int j=LoopStart[s][1]; j<=LoopEnd[s][1]; j++)
-                              for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
-                              {
-                                 const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
-                              }
-                              break;
-
-                            case MAGZ :
-                              for (int k=LoopStart[s][2]; k<=LoopEnd[s][2]; k++)
-                              for (int j=LoopStart[s][1]; j< LoopEnd[s][1]; j++)
-                              for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
-                              {
-                                 const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
-                                 SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
-                              }
-                              break;
-
-                            default:
-                              Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TMagVarIdx", TMagVarIdx );
-                              break;
-                        } // switch ( TMagVarIdx )
-                     } // for (int v=0; v<NVarFC_Mag; v++)
-#                    endif // #ifdef MHD
-
-                  } // if ( SSib & (1<<s) )
-               } // for (int s=0; s<27; s++)
-            } // for (int t=0; t<Send_NList[r]; t++)
-         } // for (int r=0; r<MPI_NRank; r++)
+                        case MAGX :
+                           for (int k=LoopStart[s][2]; k< LoopEnd[s][2]; k++)
+                           for (int j=LoopStart[s][1]; j< LoopEnd[s][1]; j++)
+                           for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
+                           {
+                              const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
+                              SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                           }
+                           break;
+
+                        case MAGY :
+                           for (int k=LoopStart[s][2]; k< LoopEnd[s][2]; k++)
+                           for (int j=LoopStart[s][1]; j<=LoopEnd[s][1]; j++)
+                           for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
+                           {
+                              const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
+                              SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                           }
+                           break;
+
+                         case MAGZ :
+                           for (int k=LoopStart[s][2]; k<=LoopEnd[s][2]; k++)
+                           for (int j=LoopStart[s][1]; j< LoopEnd[s][1]; j++)
+                           for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
+                           {
+                              const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
+                              SendPtr[ Counter ++ ] = amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][idxB];
+                           }
+                           break;
+
+                         default:
+                           Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TMagVarIdx", TMagVarIdx );
+                           break;
+                     } // switch ( TMagVarIdx )
+                  } // for (int v=0; v<NVarFC_Mag; v++)
+#                 endif // #ifdef MHD
+
+               } // if ( SSib & (1<<s) )
+            } // for (int s=0; s<27; s++)
+         } // for (int p=0; p<NSendSlab; p++)
          break; // cases DATA_GENERAL, DATA_AFTER_REFINE, POT_FOR_POISSON, POT_AFTER_REFINE
 
 
@@ -738,7 +819,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
+            real_fld *SendPtr = SendBuf_Fld + Send_NDisp[r];
             int   Counter = 0;
 
 //          for restriction fix-up
@@ -959,102 +1040,100 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
       case DATA_RESTRICT :
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
-         for (int r=0; r<MPI_NRank; r++)
+         for (int p=0; p<NSendSlab; p++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
+            const int r       = Send_SlabRank[p];
+            const int t       = p - Send_SlabStart[r];
+            real_fld *SendPtr = SendBuf_Fld + Send_SlabDisp[p];
 
-            for (int t=0; t<Send_NList[r]; t++)
-            {
-               const int SPID = Send_IDList[r][ Send_IDList_IdxTable[r][t] ];
+            const int SPID = Send_IDList[r][ Send_IDList_IdxTable[r][t] ];
 
-#              ifdef GAMER_DEBUG
-               if ( ExchangeFlu  &&  amr->patch[FluSg][lv][SPID]->fluid == NULL )
-                  Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->fluid has not been allocated !!\n",
-                             GetBufMode, FluSg, lv, SPID );
-
-#              ifdef GRAVITY
-               if ( ExchangePot  &&  amr->patch[PotSg][lv][SPID]->pot == NULL )
-                  Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->pot has not been allocated !!\n",
-                             GetBufMode, PotSg, lv, SPID );
-#              endif
-#              ifdef MHD
-               if ( ExchangeMag  &&  amr->patch[MagSg][lv][SPID]->magnetic == NULL )
-                  Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->magnetic has not been allocated !!\n",
-                             GetBufMode, MagSg, lv, SPID );
-#              endif
-#              endif // #ifdef GAMER_DEBUG
+#           ifdef GAMER_DEBUG
+            if ( ExchangeFlu  &&  amr->patch[FluSg][lv][SPID]->fluid == NULL )
+               Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->fluid has not been allocated !!\n",
+                          GetBufMode, FluSg, lv, SPID );
+
+#           ifdef GRAVITY
+            if ( ExchangePot  &&  amr->patch[PotSg][lv][SPID]->pot == NULL )
+               Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->pot has not been allocated !!\n",
+                          GetBufMode, PotSg, lv, SPID );
+#           endif
+#           ifdef MHD
+            if ( ExchangeMag  &&  amr->patch[MagSg][lv][SPID]->magnetic == NULL )
+               Aux_Error( ERROR_INFO, "Send mode %d, patch[%d][%d][%d]->magnetic has not been allocated !!\n",
+                          GetBufMode, MagSg, lv, SPID );
+#           endif
+#           endif // #ifdef GAMER_DEBUG
 
-//             fluid data
-               if ( ExchangeFlu )
-               for (int v=0; v<NVarCC_Flu; v++)
-               {
-                  const int TFluVarIdx = TFluVarIdxList[v];
+//          fluid data
+            if ( ExchangeFlu )
+            for (int v=0; v<NVarCC_Flu; v++)
+            {
+               const int TFluVarIdx = TFluVarIdxList[v];
 
-                  memcpy( SendPtr, &amr->patch[FluSg][lv][SPID]->fluid[TFluVarIdx][0][0][0],
-                          PS1*PS1*PS1*sizeof(real) );
+               Mis_CopyArray( SendPtr, &amr->patch[FluSg][lv][SPID]->fluid[TFluVarIdx][0][0][0],
+                              PS1*PS1*PS1 );
 
-                  SendPtr += CUBE( PS1 );
-               }
+               SendPtr += CUBE( PS1 );
+            }
 
-//             potential data
-#              ifdef GRAVITY
-               if ( ExchangePot )
-               {
-                  memcpy( SendPtr, &amr->patch[PotSg][lv][SPID]->pot[0][0][0],
-                          PS1*PS1*PS1*sizeof(real) );
+//          potential data
+#           ifdef GRAVITY
+            if ( ExchangePot )
+            {
+               Mis_CopyArray( SendPtr, &amr->patch[PotSg][lv][SPID]->pot[0][0][0],
+                              PS1*PS1*PS1 );
 
-                  SendPtr += CUBE( PS1 );
-               }
-#              endif
+               SendPtr += CUBE( PS1 );
+            }
+#           endif
 
-//             magnetic field data
-#              ifdef MHD
-               if ( ExchangeMag )
-               for (int v=0; v<NVarFC_Mag; v++)
-               {
-                  const int TMagVarIdx = TMagVarIdxList[v];
+//          magnetic field data
+#           ifdef MHD
+            if ( ExchangeMag )
+            for (int v=0; v<NVarFC_Mag; v++)
+            {
+               const int TMagVarIdx = TMagVarIdxList[v];
 
-                  memcpy( SendPtr, &amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][0],
-                          SQR(PS1)*PS1P1*sizeof(real) );
+               Mis_CopyArray( SendPtr, &amr->patch[MagSg][lv][SPID]->magnetic[TMagVarIdx][0],
+                              SQR(PS1)*PS1P1 );
 
-                  SendPtr += SQR( PS1 )*PS1P1;
-               }
-#              endif
-            } // for (int t=0; t<Send_NList[r]; t++)
-         } // for (int r=0; r<MPI_NRank; r++)
+               SendPtr += SQR( PS1 )*PS1P1;
+            }
+#           endif
+         } // for (int p=0; p<NSendSlab; p++)
          break; // case DATA_RESTRICT
 
 
       case COARSE_FINE_FLUX :
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
-         for (int r=0; r<MPI_NRank; r++)
+         for (int p=0; p<NSendSlab; p++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
-            int   Counter = 0;
+            const int r       = Send_SlabRank[p];
+            const int t       = p - Send_SlabStart[r];
+            real     *SendPtr = SendBuf_Flux + Send_SlabDisp[p];
+            int       Counter = 0;
 
-            for (int t=0; t<Send_NList[r]; t++)
-            {
-               const int SPID = Send_IDList [r][t];
-               const int SSib = Send_SibList[r][t];
-               const real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][SPID]->flux[SSib];
+            const int SPID = Send_IDList [r][t];
+            const int SSib = Send_SibList[r][t];
+            const real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][SPID]->flux[SSib];
 
-#              ifdef GAMER_DEBUG
-               if ( FluxPtr == NULL )
-                  Aux_Error( ERROR_INFO, "Send mode %d, patch[0][%d][%d]->flux[%d] has not been allocated !!\n",
-                             GetBufMode, lv, SPID, SSib );
-#              endif
+#           ifdef GAMER_DEBUG
+            if ( FluxPtr == NULL )
+               Aux_Error( ERROR_INFO, "Send mode %d, patch[0][%d][%d]->flux[%d] has not been allocated !!\n",
+                          GetBufMode, lv, SPID, SSib );
+#           endif
 
-               for (int v=0; v<NVarCC_Flu; v++)
-               {
-                  const int TFluVarIdx = TFluVarIdxList[v];
+            for (int v=0; v<NVarCC_Flu; v++)
+            {
+               const int TFluVarIdx = TFluVarIdxList[v];
 
-                  memcpy( SendPtr, FluxPtr[TFluVarIdx], PS1*PS1*sizeof(real) );
+               memcpy( SendPtr, FluxPtr[TFluVarIdx], PS1*PS1*sizeof(real) );
 
-                  SendPtr += SQR( PS1 );
-               }
-            } // for (int t=0; t<Send_NList[r]; t++)
-         } // for (int r=0; r<MPI_NRank; r++)
+               SendPtr += SQR( PS1 );
+            }
+         } // for (int p=0; p<NSendSlab; p++)
          break; // case COARSE_FINE_FLUX
 
 
@@ -1062,29 +1141,28 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
       case COARSE_FINE_ELECTRIC :
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
-         for (int r=0; r<MPI_NRank; r++)
+         for (int p=0; p<NSendSlab; p++)
          {
-            real *SendPtr = SendBuf + Send_NDisp[r];
+            const int r       = Send_SlabRank[p];
+            const int t       = p - Send_SlabStart[r];
+            real     *SendPtr = SendBuf_Flux + Send_SlabDisp[p];
 
-            for (int t=0; t<Send_NList[r]; t++)
-            {
-               const int SPID  = Send_IDList [r][t];
-               const int SSib  = Send_SibList[r][t];
-               const int SSize = ( SSib < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+            const int SPID  = Send_IDList [r][t];
+            const int SSib  = Send_SibList[r][t];
+            const int SSize = ( SSib < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
 
-               const real *ElePtr = amr->patch[0][lv][SPID]->electric[SSib];
+            const real *ElePtr = amr->patch[0][lv][SPID]->electric[SSib];
 
-#              ifdef GAMER_DEBUG
-               if ( ElePtr == NULL )
-                  Aux_Error( ERROR_INFO, "Send mode %d, patch[0][%d][%d]->electric[%d] has not been allocated !!\n",
-                             GetBufMode, lv, SPID, SSib );
-#              endif
+#           ifdef GAMER_DEBUG
+            if ( ElePtr == NULL )
+               Aux_Error( ERROR_INFO, "Send mode %d, patch[0][%d][%d]->electric[%d] has not been allocated !!\n",
+                          GetBufMode, lv, SPID, SSib );
+#           endif
 
-               memcpy( SendPtr, ElePtr, SSize*sizeof(real) );
+            memcpy( SendPtr, ElePtr, SSize*sizeof(real) );
 
-               SendPtr += SSize;
-            } // for (int t=0; t<Send_NList[r]; t++)
-         } // for (int r=0; r<MPI_NRank; r++)
+            SendPtr += SSize;
+         } // for (int p=0; p<NSendSlab; p++)
          break; // case COARSE_FINE_ELECTRIC
 #     endif // #ifdef MHD
 
@@ -1099,8 +1177,26 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 
 
-// 4. transfer data by MPI_Alltoallv
+// 4. transfer data by non-blocking point-to-point communication with the neighbor ranks only
+//    --> the neighbor ranks are recorded by LB_RecordExchangeNeighborRank() after each regrid so that the
+//        communication cost scales with the number of neighbor ranks instead of MPI_NRank
 // ============================================================================================================
+   const int  NbrRank_N    = amr->LB->NbrRank_N   [lv];
+   const int *NbrRank_List = amr->LB->NbrRank_List[lv];
+
+// check that all ranks to communicate with are recorded in the neighbor list
+#  ifdef GAMER_DEBUG
+   for (int r=0, t=0; r<MPI_NRank; r++)
+   {
+      const bool IsNbr = ( t < NbrRank_N  &&  NbrRank_List[t] == r );
+
+      if ( IsNbr )   t ++;
+      else if ( Send_NCount[r] != 0  ||  Recv_NCount[r] != 0 )
+         Aux_Error( ERROR_INFO, "lv %d, GetBufMode %d, rank %d is not a neighbor (NSend %d, NRecv %d) !!\n",
+                    lv, GetBufMode, r, Send_NCount[r], Recv_NCount[r] );
+   }
+#  endif
+
 #  ifdef TIMING
 // it's better to add barrier before timing transferring data through MPI
 // --> so that the timing results (i.e., the MPI bandwidth reported by OPT__TIMING_MPI ) does NOT include
@@ -1111,13 +1207,33 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Start();
 #  endif
 
-#  ifdef FLOAT8
-   MPI_Alltoallv( SendBuf, Send_NCount, Send_NDisp, MPI_DOUBLE,
-                  RecvBuf, Recv_NCount, Recv_NDisp, MPI_DOUBLE, MPI_COMM_WORLD );
-#  else
-   MPI_Alltoallv( SendBuf, Send_NCount, Send_NDisp, MPI_FLOAT,
-                  RecvBuf, Recv_NCount, Recv_NDisp, MPI_FLOAT,  MPI_COMM_WORLD );
-#  endif
+// post all receives before sends
+// --> the ordering of messages between the same pair of ranks is guaranteed by MPI, and each rank sends
+//     at most one message to another rank here, so a single tag is sufficient
+   const int Tag = 0;
+
+   MPI_Request *Req = new MPI_Request [ 2*NbrRank_N ];
+   int NReq = 0;
+
+   for (int t=0; t<NbrRank_N; t++)
+   {
+      const int r = NbrRank_List[t];
+
+      if ( Recv_NCount[r] > 0 )
+      MPI_Irecv( RecvBuf+Recv_NDisp[r]*ElmSize, Recv_NCount[r], MPI_ElmType, r, Tag, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+   for (int t=0; t<NbrRank_N; t++)
+   {
+      const int r = NbrRank_List[t];
+
+      if ( Send_NCount[r] > 0 )
+      MPI_Isend( SendBuf+Send_NDisp[r]*ElmSize, Send_NCount[r], MPI_ElmType, r, Tag, MPI_COMM_WORLD, &Req[ NReq ++ ] );
+   }
+
+   MPI_Waitall( NReq, Req, MPI_STATUSES_IGNORE );
+
+   delete [] Req;
 
 #  ifdef TIMING
    if ( OPT__TIMING_MPI )  Timer_MPI[1]->Stop();
@@ -1139,133 +1255,132 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #     endif
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
-         for (int r=0; r<MPI_NRank; r++)
+         for (int p=0; p<NRecvSlab; p++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
-            int   Counter = 0;
+            const int r       = Recv_SlabRank[p];
+            const int t       = p - Recv_SlabStart[r];
+            real_fld *RecvPtr = RecvBuf_Fld + Recv_SlabDisp[p];
+            int       Counter = 0;
 
-            for (int t=0; t<Recv_NList[r]; t++)
+            const int RPID = Recv_IDList [r][ Recv_IDList_IdxTable[r][t] ];   // Recv_IDList is unsorted
+            const int RSib = Recv_SibList[r][t];                              // Recv_SibList is sorted
+
+#           ifdef GAMER_DEBUG
+            if ( ExchangeFlu )
             {
-               const int RPID = Recv_IDList [r][ Recv_IDList_IdxTable[r][t] ];   // Recv_IDList is unsorted
-               const int RSib = Recv_SibList[r][t];                              // Recv_SibList is sorted
+               if ( amr->patch[FluSg][lv][RPID]->fluid == NULL )
+                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->fluid has not been allocated !!\n",
+                             GetBufMode, FluSg, lv, RPID );
 
-#              ifdef GAMER_DEBUG
-               if ( ExchangeFlu )
-               {
-                  if ( amr->patch[FluSg][lv][RPID]->fluid == NULL )
-                     Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->fluid has not been allocated !!\n",
-                                GetBufMode, FluSg, lv, RPID );
+               if ( RSib == 0  &&  GetBufMode != DATA_AFTER_REFINE )
+                  Aux_Error( ERROR_INFO, "Recv mode %d, t %d, TRank %d, RPID %d, RSib == 0 !!\n",
+                             GetBufMode, t, r, RPID );
+            }
 
-                  if ( RSib == 0  &&  GetBufMode != DATA_AFTER_REFINE )
-                     Aux_Error( ERROR_INFO, "Recv mode %d, t %d, TRank %d, RPID %d, RSib == 0 !!\n",
-                                GetBufMode, t, r, RPID );
-               }
+#           ifdef GRAVITY
+            if ( ExchangePot )
+            {
+               if ( amr->patch[PotSg][lv][RPID]->pot == NULL )
+                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->pot has not been allocated !!\n",
+                             GetBufMode, PotSg, lv, RPID );
 
-#              ifdef GRAVITY
-               if ( ExchangePot )
-               {
-                  if ( amr->patch[PotSg][lv][RPID]->pot == NULL )
-                     Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->pot has not been allocated !!\n",
-                                GetBufMode, PotSg, lv, RPID );
+               if ( RSib == 0  &&  GetBufMode != POT_AFTER_REFINE )
+                  Aux_Error( ERROR_INFO, "Recv mode %d, t %d, TRank %d, RPID %d, RSib == 0 !!\n",
+                             GetBufMode, t, r, RPID );
+            }
+#           endif // #ifdef GRAVITY
 
-                  if ( RSib == 0  &&  GetBufMode != POT_AFTER_REFINE )
-                     Aux_Error( ERROR_INFO, "Recv mode %d, t %d, TRank %d, RPID %d, RSib == 0 !!\n",
-                                GetBufMode, t, r, RPID );
-               }
-#              endif // #ifdef GRAVITY
+#           ifdef MHD
+            if ( ExchangeMag )
+            {
+               if ( amr->patch[MagSg][lv][RPID]->magnetic == NULL )
+                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->magnetic has not been allocated !!\n",
+                             GetBufMode, MagSg, lv, RPID );
 
-#              ifdef MHD
-               if ( ExchangeMag )
-               {
-                  if ( amr->patch[MagSg][lv][RPID]->magnetic == NULL )
-                     Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->magnetic has not been allocated !!\n",
-                                GetBufMode, MagSg, lv, RPID );
-
-                  if ( RSib == 0  &&  GetBufMode != DATA_AFTER_REFINE )
-                     Aux_Error( ERROR_INFO, "Recv mode %d, t %d, TRank %d, RPID %d, RSib == 0 !!\n",
-                                GetBufMode, t, r, RPID );
-               }
-#              endif // #ifdef MHD
-#              endif // #ifdef GAMER_DEBUG
+               if ( RSib == 0  &&  GetBufMode != DATA_AFTER_REFINE )
+                  Aux_Error( ERROR_INFO, "Recv mode %d, t %d, TRank %d, RPID %d, RSib == 0 !!\n",
+                             GetBufMode, t, r, RPID );
+            }
+#           endif // #ifdef MHD
+#           endif // #ifdef GAMER_DEBUG
 
-               if ( RSib )
-               for (int s=0; s<27; s++)
+            if ( RSib )
+            for (int s=0; s<27; s++)
+            {
+               if ( RSib & (1<<s) )
                {
-                  if ( RSib & (1<<s) )
+//                fluid data
+                  if ( ExchangeFlu )
+                  for (int v=0; v<NVarCC_Flu; v++)
                   {
-//                   fluid data
-                     if ( ExchangeFlu )
-                     for (int v=0; v<NVarCC_Flu; v++)
-                     {
-                        const int TFluVarIdx = TFluVarIdxList[v];
+                     const int TFluVarIdx = TFluVarIdxList[v];
 
-                        for (int k=LoopStart[s][2]; k<LoopEnd[s][2]; k++)
-                        for (int j=LoopStart[s][1]; j<LoopEnd[s][1]; j++)
-                        for (int i=LoopStart[s][0]; i<LoopEnd[s][0]; i++)
-                           amr->patch[FluSg][lv][RPID]->fluid[TFluVarIdx][k][j][i] = RecvPtr[ Counter ++ ];
-                     }
+                     for (int k=LoopStart[s][2]; k<LoopEnd[s][2]; k++)
+                     for (int j=LoopStart[s][1]; j<LoopEnd[s][1]; j++)
+                     for (int i=LoopStart[s][0]; i<LoopEnd[s][0]; i++)
+                        amr->patch[FluSg][lv][RPID]->fluid[TFluVarIdx][k][j][i] = RecvPtr[ Counter ++ ];
+                  }
 
-//                   potential data
-#                    ifdef GRAVITY
-                     if ( ExchangePot )
-                     {
-                        for (int k=LoopStart[s][2]; k<LoopEnd[s][2]; k++)
-                        for (int j=LoopStart[s][1]; j<LoopEnd[s][1]; j++)
-                        for (int i=LoopStart[s][0]; i<LoopEnd[s][0]; i++)
-                           amr->patch[PotSg][lv][RPID]->pot[k][j][i] = RecvPtr[ Counter ++ ];
-                     }
-#                    endif
+//                potential data
+#                 ifdef GRAVITY
+                  if ( ExchangePot )
+                  {
+                     for (int k=LoopStart[s][2]; k<LoopEnd[s][2]; k++)
+                     for (int j=LoopStart[s][1]; j<LoopEnd[s][1]; j++)
+                     for (int i=LoopStart[s][0]; i<LoopEnd[s][0]; i++)
+                        amr->patch[PotSg][lv][RPID]->pot[k][j][i] = RecvPtr[ Counter ++ ];
+                  }
+#                 endif
+
+//                magnetic field data
+#                 ifdef MHD
+                  if ( ExchangeMag )
+                  for (int v=0; v<NVarFC_Mag; v++)
+                  {
+                     const int TMagVarIdx = TMagVarIdxList[v];
 
-//                   magnetic field data
-#                    ifdef MHD
-                     if ( ExchangeMag )
-                     for (int v=0; v<NVarFC_Mag; v++)
+                     switch ( TMagVarIdx )
                      {
-                        const int TMagVarIdx = TMagVarIdxList[v];
-
-                        switch ( TMagVarIdx )
-                        {
-                           case MAGX :
-                              for (int k=LoopStart[s][2]; k< LoopEnd[s][2]; k++)
-                              for (int j=LoopStart[s][1]; j< LoopEnd[s][1]; j++)
-                              for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
-                              {
-                                 const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
-                              }
-                              break;
-
-                           case MAGY :
-                              for (int k=LoopStart[s][2]; k< LoopEnd[s][2]; k++)
-                              for (int j=LoopStart[s][1]; j<=LoopEnd[s][1]; j++)
-                              for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
-                              {
-                                 const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
-                              }
-                              break;
-
-                           case MAGZ :
-                              for (int k=LoopStart[s][2]; k<=LoopEnd[s][2]; k++)
-                              for (int j=LoopStart[s][1]; j< LoopEnd[s][1]; j++)
-                              for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
-                              {
-                                 const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
-                                 amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
-                              }
-                              break;
-
-                           default:
-                              Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TMagVarIdx", TMagVarIdx );
-                              break;
-                         } // switch ( TMagVarIdx )
-                     } //for (int v=0; v<NVarFC_Mag; v++)
-#                    endif // #ifdef MHD
-
-                  } // if ( RSib & (1<<s) )
-               } // for (int s=0; s<27; s++)
-            } // for (int t=0; t<Recv_NList[r]; t++)
-         } // for (int r=0; r<MPI_NRank; r++)
+                        case MAGX :
+                           for (int k=LoopStart[s][2]; k< LoopEnd[s][2]; k++)
+                           for (int j=LoopStart[s][1]; j< LoopEnd[s][1]; j++)
+                           for (int i=LoopStart[s][0]; i<=LoopEnd[s][0]; i++)
+                           {
+                              const int idxB = IDX321_BX( i, j, k, PS1, PS1 );
+                              amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                           }
+                           break;
+
+                        case MAGY :
+                           for (int k=LoopStart[s][2]; k< LoopEnd[s][2]; k++)
+                           for (int j=LoopStart[s][1]; j<=LoopEnd[s][1]; j++)
+                           for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
+                           {
+                              const int idxB = IDX321_BY( i, j, k, PS1, PS1 );
+                              amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                           }
+                           break;
+
+                        case MAGZ :
+                           for (int k=LoopStart[s][2]; k<=LoopEnd[s][2]; k++)
+                           for (int j=LoopStart[s][1]; j< LoopEnd[s][1]; j++)
+                           for (int i=LoopStart[s][0]; i< LoopEnd[s][0]; i++)
+                           {
+                              const int idxB = IDX321_BZ( i, j, k, PS1, PS1 );
+                              amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][idxB] = RecvPtr[ Counter ++ ];
+                           }
+                           break;
+
+                        default:
+                           Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TMagVarIdx", TMagVarIdx );
+                           break;
+                      } // switch ( TMagVarIdx )
+                  } //for (int v=0; v<NVarFC_Mag; v++)
+#                 endif // #ifdef MHD
+
+               } // if ( RSib & (1<<s) )
+            } // for (int s=0; s<27; s++)
+         } // for (int p=0; p<NRecvSlab; p++)
          break; // cases DATA_GENERAL, DATA_AFTER_REFINE, POT_FOR_POISSON, POT_AFTER_REFINE
 
 
@@ -1274,7 +1389,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 #        pragma omp parallel for schedule( runtime )
          for (int r=0; r<MPI_NRank; r++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
+            real_fld *RecvPtr = RecvBuf_Fld + Recv_NDisp[r];
             int   Counter = 0;
 
 //          for restriction fix-up
@@ -1495,96 +1610,94 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
       case DATA_RESTRICT :
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
-         for (int r=0; r<MPI_NRank; r++)
+         for (int p=0; p<NRecvSlab; p++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
-
-            for (int t=0; t<Recv_NList[r]; t++)
-            {
-               const int RPID = Recv_IDList[r][t];
+            const int r       = Recv_SlabRank[p];
+            const int t       = p - Recv_SlabStart[r];
+            real_fld *RecvPtr = RecvBuf_Fld + Recv_SlabDisp[p];
 
-#              ifdef GAMER_DEBUG
-               if ( ExchangeFlu  &&  amr->patch[FluSg][lv][RPID]->fluid == NULL )
-                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->fluid has not been allocated !!\n",
-                             GetBufMode, FluSg, lv, RPID );
+            const int RPID = Recv_IDList[r][t];
 
-#              ifdef GRAVITY
-               if ( ExchangePot  &&  amr->patch[PotSg][lv][RPID]->pot == NULL )
-                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->pot has not been allocated !!\n",
-                             GetBufMode, PotSg, lv, RPID );
-#              endif
+#           ifdef GAMER_DEBUG
+            if ( ExchangeFlu  &&  amr->patch[FluSg][lv][RPID]->fluid == NULL )
+               Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->fluid has not been allocated !!\n",
+                          GetBufMode, FluSg, lv, RPID );
+
+#           ifdef GRAVITY
+            if ( ExchangePot  &&  amr->patch[PotSg][lv][RPID]->pot == NULL )
+               Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->pot has not been allocated !!\n",
+                          GetBufMode, PotSg, lv, RPID );
+#           endif
 
-#              ifdef MHD
-               if ( ExchangeMag  &&  amr->patch[MagSg][lv][RPID]->magnetic == NULL )
-                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->magnetic has not been allocated !!\n",
-                             GetBufMode, MagSg, lv, RPID );
-#              endif
-#              endif // #ifdef GAMER_DEBUG
+#           ifdef MHD
+            if ( ExchangeMag  &&  amr->patch[MagSg][lv][RPID]->magnetic == NULL )
+               Aux_Error( ERROR_INFO, "Recv mode %d, patch[%d][%d][%d]->magnetic has not been allocated !!\n",
+                          GetBufMode, MagSg, lv, RPID );
+#           endif
+#           endif // #ifdef GAMER_DEBUG
 
-//             fluid data
-               if ( ExchangeFlu )
-               for (int v=0; v<NVarCC_Flu; v++)
-               {
-                  const int TFluVarIdx = TFluVarIdxList[v];
-                  memcpy( &amr->patch[FluSg][lv][RPID]->fluid[TFluVarIdx][0][0][0], RecvPtr, CUBE(PS1)*sizeof(real) );
-                  RecvPtr += CUBE( PS1 );
-               }
+//          fluid data
+            if ( ExchangeFlu )
+            for (int v=0; v<NVarCC_Flu; v++)
+            {
+               const int TFluVarIdx = TFluVarIdxList[v];
+               Mis_CopyArray( &amr->patch[FluSg][lv][RPID]->fluid[TFluVarIdx][0][0][0], RecvPtr, CUBE(PS1) );
+               RecvPtr += CUBE( PS1 );
+            }
 
-//             potential data
-#              ifdef GRAVITY
-               if ( ExchangePot )
-               {
-                  memcpy( &amr->patch[PotSg][lv][RPID]->pot[0][0][0], RecvPtr, CUBE(PS1)*sizeof(real) );
-                  RecvPtr += CUBE( PS1 );
-               }
-#              endif
+//          potential data
+#           ifdef GRAVITY
+            if ( ExchangePot )
+            {
+               Mis_CopyArray( &amr->patch[PotSg][lv][RPID]->pot[0][0][0], RecvPtr, CUBE(PS1) );
+               RecvPtr += CUBE( PS1 );
+            }
+#           endif
 
-//             magnetic field data
-#              ifdef MHD
-               if ( ExchangeMag )
-               for (int v=0; v<NVarFC_Mag; v++)
-               {
-                  const int TMagVarIdx = TMagVarIdxList[v];
-                  memcpy( &amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][0], RecvPtr, SQR(PS1)*PS1P1*sizeof(real) );
-                  RecvPtr += SQR( PS1 )*PS1P1;
-               }
-#              endif
-            } // for (int t=0; t<Recv_NList[r]; t++)
-         } // for (int r=0; r<MPI_NRank; r++)
+//          magnetic field data
+#           ifdef MHD
+            if ( ExchangeMag )
+            for (int v=0; v<NVarFC_Mag; v++)
+            {
+               const int TMagVarIdx = TMagVarIdxList[v];
+               Mis_CopyArray( &amr->patch[MagSg][lv][RPID]->magnetic[TMagVarIdx][0], RecvPtr, SQR(PS1)*PS1P1 );
+               RecvPtr += SQR( PS1 )*PS1P1;
+            }
+#           endif
+         } // for (int p=0; p<NRecvSlab; p++)
          break; // case DATA_RESTRICT
 
 
       case COARSE_FINE_FLUX :
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
-         for (int r=0; r<MPI_NRank; r++)
+         for (int p=0; p<NRecvSlab; p++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
-            int   Counter = 0;
+            const int r       = Recv_SlabRank[p];
+            const int t       = p - Recv_SlabStart[r];
+            real     *RecvPtr = RecvBuf_Flux + Recv_SlabDisp[p];
+            int       Counter = 0;
 
-            for (int t=0; t<Recv_NList[r]; t++)
-            {
-               const int RPID = Recv_IDList [r][ Recv_IDList_IdxTable[r][t] ];
-               const int RSib = Recv_SibList[r][t];
-               real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][RPID]->flux[RSib];
+            const int RPID = Recv_IDList [r][ Recv_IDList_IdxTable[r][t] ];
+            const int RSib = Recv_SibList[r][t];
+            real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][RPID]->flux[RSib];
 
-#              ifdef GAMER_DEBUG
-               if ( FluxPtr == NULL )
-                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[0][%d][%d]->flux[%d] has not been allocated !!\n",
-                             GetBufMode, lv, RPID, RSib );
-#              endif
+#           ifdef GAMER_DEBUG
+            if ( FluxPtr == NULL )
+               Aux_Error( ERROR_INFO, "Recv mode %d, patch[0][%d][%d]->flux[%d] has not been allocated !!\n",
+                          GetBufMode, lv, RPID, RSib );
+#           endif
 
-//             add (not replace) flux array with the received flux
-               for (int v=0; v<NVarCC_Flu; v++)
-               {
-                  const int TFluVarIdx = TFluVarIdxList[v];
+//          add (not replace) flux array with the received flux
+            for (int v=0; v<NVarCC_Flu; v++)
+            {
+               const int TFluVarIdx = TFluVarIdxList[v];
 
-                  for (int m=0; m<PS1; m++)
-                  for (int n=0; n<PS1; n++)
-                     FluxPtr[TFluVarIdx][m][n] += RecvPtr[ Counter ++ ];
-               }
-            } // for (int t=0; t<Recv_NList[r]; t++)
-         } // for (int r=0; r<MPI_NRank; r++)
+               for (int m=0; m<PS1; m++)
+               for (int n=0; n<PS1; n++)
+                  FluxPtr[TFluVarIdx][m][n] += RecvPtr[ Counter ++ ];
+            }
+         } // for (int p=0; p<NRecvSlab; p++)
          break; // case COARSE_FINE_FLUX
 
 
@@ -1592,38 +1705,37 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
       case COARSE_FINE_ELECTRIC :
 //    ----------------------------------------------
 #        pragma omp parallel for schedule( runtime )
-         for (int r=0; r<MPI_NRank; r++)
+         for (int p=0; p<NRecvSlab; p++)
          {
-            real *RecvPtr = RecvBuf + Recv_NDisp[r];
+            const int r       = Recv_SlabRank[p];
+            const int t       = p - Recv_SlabStart[r];
+            real     *RecvPtr = RecvBuf_Flux + Recv_SlabDisp[p];
 
-            for (int t=0; t<Recv_NList[r]; t++)
-            {
-               const int RPID  = Recv_IDList [r][ Recv_IDList_IdxTable[r][t] ];  // Recv_IDList is unsorted
-               const int RSib  = Recv_SibList[r][t];                             // Recv_SibList is sorted
-               const int RSize = ( RSib < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
+            const int RPID  = Recv_IDList [r][ Recv_IDList_IdxTable[r][t] ];  // Recv_IDList is unsorted
+            const int RSib  = Recv_SibList[r][t];                             // Recv_SibList is sorted
+            const int RSize = ( RSib < 6 ) ? NCOMP_ELE*PS1M1*PS1 : PS1;
 
-               real *ElePtr = amr->patch[0][lv][RPID]->electric[RSib];
+            real *ElePtr = amr->patch[0][lv][RPID]->electric[RSib];
 
-#              ifdef GAMER_DEBUG
-               if ( ElePtr == NULL )
-                  Aux_Error( ERROR_INFO, "Recv mode %d, patch[0][%d][%d]->electric[%d] has not been allocated !!\n",
-                             GetBufMode, lv, RPID, RSib );
+#           ifdef GAMER_DEBUG
+            if ( ElePtr == NULL )
+               Aux_Error( ERROR_INFO, "Recv mode %d, patch[0][%d][%d]->electric[%d] has not been allocated !!\n",
+                          GetBufMode, lv, RPID, RSib );
 
-               if ( RSib >= 6  &&  amr->patch[0][lv][RPID]->ele_corrected[RSib-6] )
-                  Aux_Error( ERROR_INFO, "Recv mode %d, electric field has been corrected already (lv %d, RPID %d, RSib %d) !!\n",
-                             GetBufMode, lv, RPID, RSib );
-#              endif
+            if ( RSib >= 6  &&  amr->patch[0][lv][RPID]->ele_corrected[RSib-6] )
+               Aux_Error( ERROR_INFO, "Recv mode %d, electric field has been corrected already (lv %d, RPID %d, RSib %d) !!\n",
+                          GetBufMode, lv, RPID, RSib );
+#           endif
 
-//             add (not replace) electric field array with the received data
-               for (int i=0; i<RSize; i++)   ElePtr[i] += RecvPtr[i];
+//          add (not replace) electric field array with the received data
+            for (int i=0; i<RSize; i++)   ElePtr[i] += RecvPtr[i];
 
-               RecvPtr += RSize;
+            RecvPtr += RSize;
 
-#              ifdef GAMER_DEBUG
-               if ( RSib >= 6 )  amr->patch[0][lv][RPID]->ele_corrected[RSib-6] = true;
-#              endif
-            } // for (int t=0; t<Recv_NList[r]; t++)
-         } // for (int r=0; r<MPI_NRank; r++)
+#           ifdef GAMER_DEBUG
+            if ( RSib >= 6 )  amr->patch[0][lv][RPID]->ele_corrected[RSib-6] = true;
+#           endif
+         } // for (int p=0; p<NRecvSlab; p++)
          break; // case COARSE_FINE_ELECTRIC
 #     endif // #ifdef MHD
 
@@ -1669,8 +1781,8 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
                                  "Send(MB/s)", "Recv(MB/s)" );
       FirstTime = false;
 
-      const double SendMB = NSend_Total*sizeof(real)*1.0e-6;
-      const double RecvMB = NRecv_Total*sizeof(real)*1.0e-6;
+      const double SendMB = NSend_Total*ElmSize*1.0e-6;
+      const double RecvMB = NRecv_Total*ElmSize*1.0e-6;
 
       fprintf( File, "%3d %15s %4d %4d %10.5f %10.5f %10.5f %8.3f %8.3f %10.3f %10.3f\n",
                lv, ModeName, NVarCC_Tot, (GetBufMode==DATA_RESTRICT || GetBufMode==COARSE_FINE_FLUX)?-1:ParaBuf,
@@ -1688,10 +1800,6 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 // 7. free memory
 // ============================================================================================================
-   delete [] Send_NCount;
-   delete [] Recv_NCount;
-   delete [] Send_NDisp;
-   delete [] Recv_NDisp;
    delete [] TFluVarIdxList;
 #  ifdef MHD
    delete [] TMagVarIdxList;
@@ -1796,10 +1904,11 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_GetBufferData_MemAllocate_Send
-// Description :  Allocate the MPI send buffer used by LG_GetBufferData (and Par_LB_SendParticleData)
+// Description :  Return the MPI send buffer of the type "real" used by the particle routines
 //
-// Note        :  1. Call LB_GetBufferData_MemFree to free memory
-//                2. This function is used by some particle routines as well
+// Note        :  1. The buffer is managed by LB_MPIBuffer_Get() and freed by LB_MPIBuffer_MemFree()
+//                2. LB_GetBufferData() shares the same buffer but calls LB_MPIBuffer_Get() directly since
+//                   it may exchange either "real" or "real_fld"
 //                3. We reallocate send/recv buffers only when the current buffer size is not large enough
 //                   --> It greatly improves MPI performance
 //
@@ -1810,16 +1919,7 @@ void LB_GetBufferData( const int lv, const int FluSg, const int MagSg, const int
 real *LB_GetBufferData_MemAllocate_Send( const int NSend )
 {
 
-   if ( NSend > SendBufSize )
-   {
-      if ( MPI_SendBuf_Shared != NULL )   delete [] MPI_SendBuf_Shared;
-
-//    allocate BufSizeFactor more memory to sustain longer
-      SendBufSize        = int(NSend*BufSizeFactor);
-      MPI_SendBuf_Shared = new real [SendBufSize];
-   }
-
-   return MPI_SendBuf_Shared;
+   return (real*)LB_MPIBuffer_Get( MPIBUF_SEND, (long)NSend*sizeof(real) );
 
 } // FUNCTION : LB_GetBufferData_MemAllocate_Send
 
@@ -1827,60 +1927,25 @@ real *LB_GetBufferData_MemAllocate_Send( const int NSend )
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_GetBufferData_MemAllocate_Recv
-// Description :  Allocate the MPI recv buffer used by LG_GetBufferData (and Par_LB_SendParticleData)
+// Description :  Return the MPI recv buffer of the type "real" used by the particle routines
 //
-// Note        :  1. Call LB_GetBufferData_MemFree to free memory
-//                2. This function is used by some particle routines as well
+// Note        :  1. The buffer is managed by LB_MPIBuffer_Get() and freed by LB_MPIBuffer_MemFree()
+//                2. LB_GetBufferData() shares the same buffer but calls LB_MPIBuffer_Get() directly since
+//                   it may exchange either "real" or "real_fld"
 //                3. We reallocate send/recv buffers only when the current buffer size is not large enough
 //                   --> It greatly improves MPI performance
 //
-// Parameter   :  NRecv : Number of elements (with the type "real") to be sent
+// Parameter   :  NRecv : Number of elements (with the type "real") to be received
 //
 // Return      :  Pointer to the MPI recv buffer
 //-------------------------------------------------------------------------------------------------------
 real *LB_GetBufferData_MemAllocate_Recv( const int NRecv )
 {
 
-   if ( NRecv > RecvBufSize )
-   {
-      if ( MPI_RecvBuf_Shared != NULL )   delete [] MPI_RecvBuf_Shared;
-
-//    allocate BufSizeFactor more memory to sustain longer
-      RecvBufSize        = int(NRecv*BufSizeFactor);
-      MPI_RecvBuf_Shared = new real [RecvBufSize];
-   }
-
-   return MPI_RecvBuf_Shared;
+   return (real*)LB_MPIBuffer_Get( MPIBUF_RECV, (long)NRecv*sizeof(real) );
 
 } // FUNCTION : LB_GetBufferData_MemAllocate_Recv
 
 
 
-//-------------------------------------------------------------------------------------------------------
-// Function    :  LB_GetBufferData_MemFree
-// Description :  Free the MPI send and recv buffers
-//
-// Note        :  This function is invoked by "End_MemFree"
-//
-// Parameter   :  None
-//-------------------------------------------------------------------------------------------------------
-void LB_GetBufferData_MemFree()
-{
-
-   if ( MPI_SendBuf_Shared != NULL )
-   {
-      delete [] MPI_SendBuf_Shared;
-      MPI_SendBuf_Shared = NULL;
-   }
-
-   if ( MPI_RecvBuf_Shared != NULL )
-   {
-      delete [] MPI_RecvBuf_Shared;
-      MPI_RecvBuf_Shared = NULL;
-   }
-
-} // FUNCTION : LB_GetBufferData_MemFree
-
-
-
 #endif // #ifdef LOAD_BALANCE
@@ -0,0 +1,606 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+static void   LB_MigrateRealPatch( const int lv );
+static long   LB_PatchDataSize();
+static double LB_LevelImbalance( const int lv, const double ParWeight );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_Incremental_LoadBalance
+// Description :  Improve the load balance incrementally by shifting the cut points only between neighboring
+//                ranks on the space-filling curve
+//
+// Note        :  1. Alternative to LB_Init_LoadBalance( Redistribute_Yes, ParWeight, ResetLB_Yes, AllLv ) for
+//                   LB_INPUT__INCREMENTAL
+//                   --> Invoked by main() when the load-imbalance factor exceeds LB_INPUT__WLI_MAX
+//                2. Procedure at each level:
+//                   (0) Skip the level if its own load-imbalance factor does not exceed LB_INPUT__WLI_MAX
+//                       --> Levels whose workload has not changed since the last rebalance are left untouched
+//                           even if other levels trigger the rebalance
+//                       --> For LB_INPUT__MEASURED_COST, the imbalance is evaluated from the measured cost per step
+//                           since the last rebalance (see LB_EstimateWorkload_AllPatchGroup())
+//                   (1) Compute the optimal cut points by LB_SetCutPoint()
+//                   (2) Restrict each cut point CutPoint[r] to the range [CutPoint_Old[r-1], CutPoint_Old[r+1]]
+//                       --> Real patches are only migrated between ranks adjacent on the curve
+//                       --> Large imbalance is removed diffusively over several rebalancing steps
+//                   (3) Skip the level if no cut point has changed
+//                   (4) Migrate only the patch groups (and their particles) changing owners by LB_MigrateRealPatch()
+//                       --> Patches staying on the same rank are neither copied nor reallocated
+//                   (5) Reconstruct the buffer patches, patch relation, and MPI lists at this level and the
+//                       levels just above and below by LB_Init_LoadBalance() with Redistribute_No and TLv=lv
+//                3. Levels are processed from coarse to fine so that LB_SetCutPoint() at lv can use the
+//                   particle lists of lv reconstructed when processing lv-1
+//
+// Parameter   :  ParWeight : Relative load-balance weighting of particles
+//
+// Return      :  Number of levels with patches migrated
+//-------------------------------------------------------------------------------------------------------
+int LB_Incremental_LoadBalance( const double ParWeight )
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   %s ...\n", __FUNCTION__ );
+
+
+// check
+   if ( amr->LB == NULL )  Aux_Error( ERROR_INFO, "amr->LB has not been allocated !!\n" );
+
+
+   const bool InputLBIdxAndLoad_No = false;
+   const bool Redistribute_No      = false;
+   const bool ResetLB_No           = false;
+
+   long *CutPoint_Old = new long [MPI_NRank+1];
+   int   NLv_Moved    = 0;
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      if ( NPatchTotal[lv] == 0 )   continue;
+
+      long *CutPoint = amr->LB->CutPoint[lv];
+
+//    0. skip levels that are already balanced
+      if ( LB_LevelImbalance(lv, ParWeight) <= amr->LB->WLI_Max )    continue;
+
+
+//    1. set the new cut points
+      for (int r=0; r<=MPI_NRank; r++)    CutPoint_Old[r] = CutPoint[r];
+
+      LB_SetCutPoint( lv, NPatchTotal[lv]/8, CutPoint, InputLBIdxAndLoad_No, NULL, NULL, ParWeight );
+
+
+//    2. restrict the cut points to the segments of the neighboring ranks
+//       --> cut points remain monotonic since both bounds are monotonic
+//       --> cut points are identical in all ranks and so is "Moved"
+      bool Moved = false;
+
+      for (int r=1; r<MPI_NRank; r++)
+      {
+         CutPoint[r] = MAX( CutPoint[r], CutPoint_Old[r-1] );
+         CutPoint[r] = MIN( CutPoint[r], CutPoint_Old[r+1] );
+         CutPoint[r] = MAX( CutPoint[r], CutPoint[r-1] );
+         CutPoint[r] = MIN( CutPoint[r], CutPoint[MPI_NRank] );
+
+         if ( CutPoint[r] != CutPoint_Old[r] )  Moved = true;
+      }
+
+      if ( !Moved )  continue;
+
+      NLv_Moved ++;
+
+      if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+      {
+         Aux_Message( stdout, "      Lv %2d: cut points", lv );
+         for (int r=1; r<MPI_NRank; r++)  Aux_Message( stdout, " %ld(%+ld)", CutPoint[r], CutPoint[r]-CutPoint_Old[r] );
+         Aux_Message( stdout, "\n" );
+      }
+
+
+//    3. migrate patch groups between neighboring ranks
+      LB_MigrateRealPatch( lv );
+
+
+//    4. reconstruct buffer patches, patch relation, and MPI lists around lv and fill the buffer data
+//       --> do not reset the load-balance variables since IdxList_Real[lv] has been reconstructed
+//           by LB_MigrateRealPatch() and all MPI lists will be overwritten anyway
+      LB_Init_LoadBalance( Redistribute_No, ParWeight, ResetLB_No, lv );
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   delete [] CutPoint_Old;
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   %s ... done (%d level(s) updated)\n", __FUNCTION__, NLv_Moved );
+
+   return NLv_Moved;
+
+} // FUNCTION : LB_Incremental_LoadBalance
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_LevelImbalance
+// Description :  Return the load-imbalance factor "(Load_Max - Load_Ave)/Load_Ave" of the target level
+//
+// Note        :  1. Workload of each patch group is given by LB_EstimateWorkload_AllPatchGroup()
+//                2. Must be invoked by all ranks
+//                   --> All ranks get the same result
+//
+// Parameter   :  lv        : Target refinement level
+//                ParWeight : Relative load-balance weighting of particles
+//
+// Return      :  Load-imbalance factor at lv
+//-------------------------------------------------------------------------------------------------------
+double LB_LevelImbalance( const int lv, const double ParWeight )
+{
+
+   const int NPG = amr->NPatchComma[lv][1] / 8;
+
+   double *Load_PG = new double [NPG];
+   double  Load_ThisRank = 0.0, Load_Max, Load_Sum;
+
+   LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_PG );
+
+   for (int t=0; t<NPG; t++)  Load_ThisRank += Load_PG[t];
+
+   MPI_Allreduce( &Load_ThisRank, &Load_Max, 1, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
+   MPI_Allreduce( &Load_ThisRank, &Load_Sum, 1, MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD );
+
+   delete [] Load_PG;
+
+   const double Load_Ave = Load_Sum / MPI_NRank;
+
+   return ( Load_Ave == 0.0 ) ? 0.0 : ( Load_Max - Load_Ave ) / Load_Ave;
+
+} // FUNCTION : LB_LevelImbalance
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_MigrateRealPatch
+// Description :  Send the real patch groups at lv no longer belonging to this rank to the neighboring ranks
+//                on the space-filling curve and receive the patch groups migrating to this rank
+//
+// Note        :  1. Cut points amr->LB->CutPoint[lv] must be updated in advance
+//                   --> All patch groups changing owners must move to the rank just before or after this rank
+//                2. All buffer patches at lv are removed
+//                   --> LB_Init_LoadBalance() with Redistribute_No must be invoked afterwards to reconstruct them
+//                3. Holes left by the migrated patch groups are filled by the last real patch groups so that
+//                   no patch indices are skipped (similar to DeallocateSonPatch() in LB_Refine_AllocateNewPatch())
+//                   --> Patch relation at lv, lv-1, and lv+1 becomes invalid and must be reconstructed
+//                4. Particles are migrated along with their home patches
+//                5. Use non-blocking point-to-point communication and the persistent buffers of LB_MPIBuffer_Get()
+//                   --> Buffer patches are removed while the data are in transit
+//                6. Message layout for each neighbor: LB_Idx of each patch group (long), number of particles
+//                   in each patch (int), patch data (real), and particle data (real)
+//                7. Also reconstruct amr->LB->IdxList_Real[lv] and update amr->LB->Moved_NPatch/NByte
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void LB_MigrateRealPatch( const int lv )
+{
+
+   const int  FluSize1v    = CUBE( PS1 );
+#  ifdef STORE_POT_GHOST
+   const int  GraNxtSize   = CUBE( GRA_NXT );
+#  endif
+#  ifdef MHD
+   const int  MagSize1v    = PS1P1*SQR( PS1 );
+#  endif
+   const int  FluSg        = amr->FluSg[lv];
+#  ifdef GRAVITY
+   const int  PotSg        = amr->PotSg[lv];
+#  endif
+#  ifdef MHD
+   const int  MagSg        = amr->MagSg[lv];
+#  endif
+   const long PatchSize    = LB_PatchDataSize();
+   const int  NReal        = amr->NPatchComma[lv][1];
+   const int  NbrRank[2]   = { ( MPI_Rank > 0           ) ? MPI_Rank-1 : MPI_PROC_NULL,    // 0/1 = left/right
+                               ( MPI_Rank < MPI_NRank-1 ) ? MPI_Rank+1 : MPI_PROC_NULL };
+   const int  Tag_Count    = 300;
+   const int  Tag_Data     = 301;
+#  ifdef PARTICLE
+   const bool RemoveAllParticle = true;
+#  endif
+
+   long NSend[2][2] = { {0,0}, {0,0} };   // [neighbor][number of patch groups / number of particle data]
+   long NRecv[2][2] = { {0,0}, {0,0} };
+   long SendByte[2], RecvByte[2], SendDisp[2], RecvDisp[2];
+   int *SendPID0 = new int [NReal/8];     // sorted patch indices with LocalID==0 to be sent
+   int  NSendPG_Total = 0;
+
+   MPI_Request Req[4];
+
+
+// 1. collect the patch groups to be sent
+// ==========================================================================================
+   for (int PID0=0; PID0<NReal; PID0+=8)
+   {
+      const int TRank = LB_Index2Rank( lv, amr->patch[0][lv][PID0]->LB_Idx, CHECK_ON );
+
+      if ( TRank == MPI_Rank )   continue;
+
+      if ( TRank != MPI_Rank-1  &&  TRank != MPI_Rank+1 )
+         Aux_Error( ERROR_INFO, "lv %d, PID0 %d migrates to a non-neighboring rank (%d -> %d) !!\n",
+                    lv, PID0, MPI_Rank, TRank );
+
+      const int s = ( TRank < MPI_Rank ) ? 0 : 1;
+
+      NSend[s][0] ++;
+#     ifdef PARTICLE
+      for (int PID=PID0; PID<PID0+8; PID++)  NSend[s][1] += (long)amr->patch[0][lv][PID]->NPar*PAR_NATT_TOTAL;
+#     endif
+
+      SendPID0[ NSendPG_Total ++ ] = PID0;
+   }
+
+
+// 2. exchange the number of patch groups and particle data
+// ==========================================================================================
+   for (int s=0; s<2; s++)
+   {
+      MPI_Irecv( NRecv[s], 2, MPI_LONG, NbrRank[s], Tag_Count, MPI_COMM_WORLD, &Req[s  ] );
+      MPI_Isend( NSend[s], 2, MPI_LONG, NbrRank[s], Tag_Count, MPI_COMM_WORLD, &Req[s+2] );
+   }
+
+   MPI_Waitall( 4, Req, MPI_STATUSES_IGNORE );
+
+
+// message size in bytes (aligned to 8 bytes)
+   for (int s=0; s<2; s++)
+   {
+      SendByte[s] = NSend[s][0]*sizeof(long) + 8*NSend[s][0]*PatchSize*sizeof(real_fld) + NSend[s][1]*sizeof(real);
+      RecvByte[s] = NRecv[s][0]*sizeof(long) + 8*NRecv[s][0]*PatchSize*sizeof(real_fld) + NRecv[s][1]*sizeof(real);
+#     ifdef PARTICLE
+      SendByte[s] += 8*NSend[s][0]*sizeof(int);
+      RecvByte[s] += 8*NRecv[s][0]*sizeof(int);
+#     endif
+   }
+
+   SendDisp[0] = 0;
+   RecvDisp[0] = 0;
+   SendDisp[1] = ( SendByte[0] + 7 ) / 8 * 8;
+   RecvDisp[1] = ( RecvByte[0] + 7 ) / 8 * 8;
+
+   char *SendBuf = (char*)LB_MPIBuffer_Get( MPIBUF_SEND, SendDisp[1]+SendByte[1] );
+   char *RecvBuf = (char*)LB_MPIBuffer_Get( MPIBUF_RECV, RecvDisp[1]+RecvByte[1] );
+
+
+// 3. prepare the send buffers and detach particles from the patches to be sent
+// ==========================================================================================
+   for (int s=0; s<2; s++)
+   {
+      long *SendPtr_LBIdx = (long*)( SendBuf + SendDisp[s] );
+#     ifdef PARTICLE
+      int      *SendPtr_NPar  = (int     *)( SendPtr_LBIdx + NSend[s][0] );
+      real_fld *SendPtr_Data  = (real_fld*)( SendPtr_NPar  + 8*NSend[s][0] );
+#     else
+      real_fld *SendPtr_Data  = (real_fld*)( SendPtr_LBIdx + NSend[s][0] );
+#     endif
+      real     *SendPtr_Par   = (real    *)( SendPtr_Data  + 8*NSend[s][0]*PatchSize );
+
+      for (int t=0; t<NSendPG_Total; t++)
+      {
+         const int PID0  = SendPID0[t];
+         const int TRank = LB_Index2Rank( lv, amr->patch[0][lv][PID0]->LB_Idx, CHECK_ON );
+
+         if (  ( s == 0 ) != ( TRank < MPI_Rank )  )  continue;
+
+         *SendPtr_LBIdx++ = amr->patch[0][lv][PID0]->LB_Idx;
+
+         for (int PID=PID0; PID<PID0+8; PID++)
+         {
+//          fluid
+            Mis_CopyArray( SendPtr_Data, amr->patch[FluSg][lv][PID]->fluid[0][0][0], NCOMP_TOTAL*FluSize1v );
+            SendPtr_Data += NCOMP_TOTAL*FluSize1v;
+
+#           ifdef GRAVITY
+//          potential
+            Mis_CopyArray( SendPtr_Data, amr->patch[PotSg][lv][PID]->pot[0][0], FluSize1v );
+            SendPtr_Data += FluSize1v;
+
+//          potential with ghost zones
+#           ifdef STORE_POT_GHOST
+            Mis_CopyArray( SendPtr_Data, amr->patch[PotSg][lv][PID]->pot_ext[0][0], GraNxtSize );
+            SendPtr_Data += GraNxtSize;
+#           endif
+#           endif // GRAVITY
+
+//          magnetic field
+#           ifdef MHD
+            Mis_CopyArray( SendPtr_Data, amr->patch[MagSg][lv][PID]->magnetic[0], NCOMP_MAG*MagSize1v );
+            SendPtr_Data += NCOMP_MAG*MagSize1v;
+#           endif
+
+//          particle
+#           ifdef PARTICLE
+            *SendPtr_NPar++ = amr->patch[0][lv][PID]->NPar;
+
+            for (int p=0; p<amr->patch[0][lv][PID]->NPar; p++)
+            {
+               const long ParID = amr->patch[0][lv][PID]->ParList[p];
+
+               for (int v=0; v<PAR_NATT_TOTAL; v++)   *SendPtr_Par++ = amr->Par->Attribute[v][ParID];
+
+               amr->Par->RemoveOneParticle( ParID, PAR_INACTIVE_MPI );
+            }
+
+            amr->patch[0][lv][PID]->RemoveParticle( NULL_INT, NULL, &amr->Par->NPar_Lv[lv], RemoveAllParticle );
+#           endif
+         } // for (int PID=PID0; PID<PID0+8; PID++)
+      } // for (int t=0; t<NSendPG_Total; t++)
+   } // for (int s=0; s<2; s++)
+
+
+// 4. start transferring data
+// ==========================================================================================
+   for (int s=0; s<2; s++)
+   {
+      MPI_Irecv( RecvBuf+RecvDisp[s], (int)RecvByte[s], MPI_BYTE, NbrRank[s], Tag_Data, MPI_COMM_WORLD, &Req[s  ] );
+      MPI_Isend( SendBuf+SendDisp[s], (int)SendByte[s], MPI_BYTE, NbrRank[s], Tag_Data, MPI_COMM_WORLD, &Req[s+2] );
+   }
+
+
+// 5. remove all buffer patches and the real patches just sent while the data are in transit
+// ==========================================================================================
+// 5.1 buffer patches
+   const int NPatch = amr->num[lv];
+
+   for (int PID=NReal; PID<NPatch; PID++)
+   {
+      amr->patch[0][lv][PID]->son = -1;
+      amr->pdelete( lv, PID, OPT__REUSE_MEMORY );
+   }
+
+   for (int m=2; m<28; m++)   amr->NPatchComma[lv][m] = NReal;
+
+// 5.2 real patches sent abroad (from the last to the first one)
+//     --> relink the last patch group to fill the hole so that no patch indices are skipped
+//     --> the last patch group will never be sent since we remove patch groups in descending order
+   for (int t=NSendPG_Total-1; t>=0; t--)
+   {
+      const int NewPID0 = SendPID0[t];
+      const int OldPID0 = amr->num[lv] - 8;
+
+      for (int PID=NewPID0; PID<NewPID0+8; PID++)
+      {
+         amr->patch[0][lv][PID]->son = -1;
+         amr->pdelete( lv, PID, OPT__REUSE_MEMORY );
+      }
+
+      if ( NewPID0 != OldPID0 )
+      for (int LocalID=0; LocalID<8; LocalID++)
+      for (int Sg=0; Sg<2; Sg++)
+         Aux_SwapPointer( (void**)&amr->patch[Sg][lv][OldPID0+LocalID], (void**)&amr->patch[Sg][lv][NewPID0+LocalID] );
+   }
+
+   delete [] SendPID0;
+
+
+// 6. allocate the patches just received
+// ==========================================================================================
+   MPI_Waitall( 4, Req, MPI_STATUSES_IGNORE );
+
+   const int PScale = PATCH_SIZE*amr->scale[lv];
+   int Cr0[3];
+
+#  ifdef PARTICLE
+   int   ParListSizeMax = 0;
+   long *ParList        = NULL;
+
+   for (int s=0; s<2; s++)
+   {
+      const int *RecvPtr_NPar = (int*)( (long*)(RecvBuf+RecvDisp[s]) + NRecv[s][0] );
+      for (int t=0; t<8*NRecv[s][0]; t++)    ParListSizeMax = MAX( ParListSizeMax, RecvPtr_NPar[t] );
+   }
+
+   ParList = new long [ParListSizeMax];
+#  endif
+
+   for (int s=0; s<2; s++)
+   {
+      const long *RecvPtr_LBIdx = (long*)( RecvBuf + RecvDisp[s] );
+#     ifdef PARTICLE
+      const int      *RecvPtr_NPar  = (int     *)( RecvPtr_LBIdx + NRecv[s][0] );
+      const real_fld *RecvPtr_Data  = (real_fld*)( RecvPtr_NPar  + 8*NRecv[s][0] );
+#     else
+      const real_fld *RecvPtr_Data  = (real_fld*)( RecvPtr_LBIdx + NRecv[s][0] );
+#     endif
+      const real     *RecvPtr_Par   = (real    *)( RecvPtr_Data  + 8*NRecv[s][0]*PatchSize );
+
+      for (int t=0; t<NRecv[s][0]; t++)
+      {
+         const int PID0 = amr->num[lv];
+
+         LB_Index2Corner( lv, RecvPtr_LBIdx[t], Cr0, CHECK_ON );
+
+//       6.1 allocate patches (father patch is still unknown)
+         amr->pnew( lv, Cr0[0],        Cr0[1],        Cr0[2],        -1, true, true, true );
+         amr->pnew( lv, Cr0[0]+PScale, Cr0[1],        Cr0[2],        -1, true, true, true );
+         amr->pnew( lv, Cr0[0],        Cr0[1]+PScale, Cr0[2],        -1, true, true, true );
+         amr->pnew( lv, Cr0[0],        Cr0[1],        Cr0[2]+PScale, -1, true, true, true );
+         amr->pnew( lv, Cr0[0]+PScale, Cr0[1]+PScale, Cr0[2],        -1, true, true, true );
+         amr->pnew( lv, Cr0[0],        Cr0[1]+PScale, Cr0[2]+PScale, -1, true, true, true );
+         amr->pnew( lv, Cr0[0]+PScale, Cr0[1],        Cr0[2]+PScale, -1, true, true, true );
+         amr->pnew( lv, Cr0[0]+PScale, Cr0[1]+PScale, Cr0[2]+PScale, -1, true, true, true );
+
+//       6.2 assign data
+         for (int PID=PID0; PID<PID0+8; PID++)
+         {
+            Mis_CopyArray( amr->patch[FluSg][lv][PID]->fluid[0][0][0], RecvPtr_Data, NCOMP_TOTAL*FluSize1v );
+            RecvPtr_Data += NCOMP_TOTAL*FluSize1v;
+
+#           ifdef GRAVITY
+            Mis_CopyArray( amr->patch[PotSg][lv][PID]->pot[0][0], RecvPtr_Data, FluSize1v );
+            RecvPtr_Data += FluSize1v;
+
+#           ifdef STORE_POT_GHOST
+            Mis_CopyArray( amr->patch[PotSg][lv][PID]->pot_ext[0][0], RecvPtr_Data, GraNxtSize );
+            RecvPtr_Data += GraNxtSize;
+#           endif
+#           endif // GRAVITY
+
+#           ifdef MHD
+            Mis_CopyArray( amr->patch[MagSg][lv][PID]->magnetic[0], RecvPtr_Data, NCOMP_MAG*MagSize1v );
+            RecvPtr_Data += NCOMP_MAG*MagSize1v;
+#           endif
+
+//          6.3 add particles to the particle repository and associate them with their home patches
+#           ifdef PARTICLE
+            const int NPar = *RecvPtr_NPar++;
+
+            for (int p=0; p<NPar; p++)
+            {
+               ParList[p]   = amr->Par->AddOneParticle( RecvPtr_Par );
+               RecvPtr_Par += PAR_NATT_TOTAL;
+            }
+
+#           ifdef DEBUG_PARTICLE
+            const real *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+            char Comment[100];
+            sprintf( Comment, "%s, PID %d, NPar %d", __FUNCTION__, PID, NPar );
+            amr->patch[0][lv][PID]->AddParticle( NPar, ParList, &amr->Par->NPar_Lv[lv],
+                                                 ParPos, amr->Par->NPar_AcPlusInac, Comment );
+#           else
+            amr->patch[0][lv][PID]->AddParticle( NPar, ParList, &amr->Par->NPar_Lv[lv] );
+#           endif
+#           endif // #ifdef PARTICLE
+         } // for (int PID=PID0; PID<PID0+8; PID++)
+      } // for (int t=0; t<NRecv[s][0]; t++)
+   } // for (int s=0; s<2; s++)
+
+#  ifdef PARTICLE
+   delete [] ParList;
+#  endif
+
+// 6.4 reset NPatchComma
+   for (int m=1; m<28; m++)   amr->NPatchComma[lv][m] = amr->num[lv];
+
+
+// 7. record LB_IdxList_Real
+// ==========================================================================================
+   const int NReal_New = amr->NPatchComma[lv][1];
+
+   if ( amr->LB->IdxList_Real         [lv] != NULL )  delete [] amr->LB->IdxList_Real         [lv];
+   if ( amr->LB->IdxList_Real_IdxTable[lv] != NULL )  delete [] amr->LB->IdxList_Real_IdxTable[lv];
+
+   amr->LB->IdxList_Real         [lv] = new long [NReal_New];
+   amr->LB->IdxList_Real_IdxTable[lv] = new int  [NReal_New];
+
+   for (int PID=0; PID<NReal_New; PID++)  amr->LB->IdxList_Real[lv][PID] = amr->patch[0][lv][PID]->LB_Idx;
+
+   Mis_Heapsort( NReal_New, amr->LB->IdxList_Real[lv], amr->LB->IdxList_Real_IdxTable[lv] );
+
+
+// 8. record the amount of data sent to other ranks
+   for (int s=0; s<2; s++)
+   {
+      amr->LB->Moved_NPatch += 8*NSend[s][0];
+      amr->LB->Moved_NByte  += SendByte[s];
+   }
+
+} // FUNCTION : LB_MigrateRealPatch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_PatchDataSize
+// Description :  Return the number of real_fld-type elements transferred for each patch when migrating patches
+//
+// Note        :  1. Including fluid, potential (with and without ghost zones), and magnetic field
+//                   --> Same as the data transferred by LB_RedistributeRealPatch() in LB_Init_LoadBalance.cpp
+//-------------------------------------------------------------------------------------------------------
+long LB_PatchDataSize()
+{
+
+   long Size = NCOMP_TOTAL*CUBE( PS1 );
+
+#  ifdef GRAVITY
+   Size += CUBE( PS1 );
+#  ifdef STORE_POT_GHOST
+   Size += CUBE( GRA_NXT );
+#  endif
+#  endif
+
+#  ifdef MHD
+   Size += NCOMP_MAG*PS1P1*SQR( PS1 );
+#  endif
+
+   return Size;
+
+} // FUNCTION : LB_PatchDataSize
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_Record_Rebalance
+// Description :  Record the cost of redistributing patches in the file "Record__LBRebalance"
+//
+// Note        :  1. Invoked by main() after LB_Init_LoadBalance() or LB_Incremental_LoadBalance() when
+//                   OPT__RECORD_LOAD_BALANCE is on
+//                2. Amount of data moved is taken from amr->LB->Moved_NPatch/NByte, which must be reset
+//                   before redistributing patches
+//                3. "AllData" is the amount of data packed and transferred by a full redistribution
+//                   (i.e., LB_Init_LoadBalance()), which sends all real patches regardless of their owners
+//                   --> Useful for comparing the incremental and full redistributions
+//
+// Parameter   :  NLv            : Number of levels redistributed (<0 for all levels)
+//                Time_Rebalance : Elapsed wall-clock time of the redistribution in this rank
+//-------------------------------------------------------------------------------------------------------
+void LB_Record_Rebalance( const int NLv, const double Time_Rebalance )
+{
+
+   long   Moved_NPatch, Moved_NByte, NPatchAll=0;
+   double Time_Max;
+
+   MPI_Reduce( &amr->LB->Moved_NPatch, &Moved_NPatch, 1, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( &amr->LB->Moved_NByte,  &Moved_NByte,  1, MPI_LONG,   MPI_SUM, 0, MPI_COMM_WORLD );
+   MPI_Reduce( &Time_Rebalance,        &Time_Max,     1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+
+   if ( MPI_Rank == 0 )
+   {
+      const char FileName[] = "Record__LBRebalance";
+      static bool FirstTime = true;
+
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FILE *File = fopen( FileName, "a" );
+         fprintf( File, "#%12s %8s %12s %4s %12s %14s %14s %14s\n",
+                  "Time", "Step", "Mode", "NLv", "NPatch_Moved", "Moved(MB)", "AllData(MB)", "Time(s)" );
+         fclose( File );
+
+         FirstTime = false;
+      }
+
+//    data volume of a full redistribution
+      for (int lv=0; lv<NLEVEL; lv++)  NPatchAll += NPatchTotal[lv];
+
+      double AllData = (double)NPatchAll*( LB_PatchDataSize()*sizeof(real_fld) + sizeof(long) );
+#     ifdef PARTICLE
+      AllData += (double)NPatchAll*sizeof(int) + (double)amr->Par->NPar_Active_AllRank*PAR_NATT_TOTAL*sizeof(real);
+#     endif
+
+      char NLv_str[MAX_STRING];
+      if ( NLv < 0 )    sprintf( NLv_str, "%s", "all" );
+      else              sprintf( NLv_str, "%d", NLv );
+
+      FILE *File = fopen( FileName, "a" );
+      fprintf( File, "%13.7e %8ld %12s %4s %12ld %14.4e %14.4e %14.4e\n",
+               Time[0], Step, (amr->LB->Incremental)?"incremental":"full", NLv_str, Moved_NPatch,
+               Moved_NByte*1.0e-6, AllData*1.0e-6, Time_Max );
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+} // FUNCTION : LB_Record_Rebalance
+
+
+
+#endif // #ifdef LOAD_BALANCE
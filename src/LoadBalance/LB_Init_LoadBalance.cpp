@@ -230,11 +230,15 @@ void LB_Init_LoadBalance( const bool Redistribute, const double ParWeight, const
 //        --> see the comments 5.2 above
       LB_RecordExchangeFixUpDataPatchID( lv );
 
-//    5.6 list for overlapping MPI time with CPU/GPU computation
+//    5.6 list of ranks exchanging buffer data with this rank
+//        --> must be invoked after constructing all the lists above
+      LB_RecordExchangeNeighborRank( lv );
+
+//    5.7 list for overlapping MPI time with CPU/GPU computation
       if ( OPT__OVERLAP_MPI )
       LB_RecordOverlapMPIPatchID( lv );
 
-//    5.7 list for exchanging particles
+//    5.8 list for exchanging particles
 #     ifdef PARTICLE
       Par_LB_RecordExchangeParticlePatchID( lv );
 #     endif
@@ -379,6 +383,32 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
    for (int r=0; r<MPI_NRank; r++)  Send_NCount_ParData[r] *= PAR_NATT_TOTAL;
 #  endif
 
+// record the amount of data actually sent to other ranks (see LB_Record_Rebalance())
+   long PatchByte = ( NCOMP_TOTAL*FluSize1v )*sizeof(real_fld) + sizeof(long);
+#  ifdef GRAVITY
+   PatchByte += FluSize1v*sizeof(real_fld);
+#  ifdef STORE_POT_GHOST
+   PatchByte += GraNxtSize*sizeof(real_fld);
+#  endif
+#  endif
+#  ifdef MHD
+   PatchByte += NCOMP_MAG*MagSize1v*sizeof(real_fld);
+#  endif
+#  ifdef PARTICLE
+   PatchByte += sizeof(int);
+#  endif
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( r == MPI_Rank )    continue;
+
+      amr->LB->Moved_NPatch += Send_NCount_Patch[r];
+      amr->LB->Moved_NByte  += Send_NCount_Patch[r]*PatchByte;
+#     ifdef PARTICLE
+      amr->LB->Moved_NByte  += (long)Send_NCount_ParData[r]*sizeof(real);
+#     endif
+   }
+
 // 1.2 receive count
    MPI_Alltoall( Send_NCount_Patch,   1, MPI_INT, Recv_NCount_Patch,   1, MPI_INT, MPI_COMM_WORLD );
 #  ifdef PARTICLE
@@ -456,21 +486,22 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
    const int RecvDataSizeMag1v  = NRecv_Total_Patch*MagSize1v;
 #  endif
 
-   real *SendPtr         = NULL;
-   long *SendBuf_LBIdx   = new long [ NSend_Total_Patch ];
-   real *SendBuf_Flu     = new real [ SendDataSizeFlu1v*NCOMP_TOTAL ];
+   real_fld *SendPtr_Grid    = NULL;
+   long     *SendBuf_LBIdx   = new long     [ NSend_Total_Patch ];
+   real_fld *SendBuf_Flu     = new real_fld [ SendDataSizeFlu1v*NCOMP_TOTAL ];
 #  ifdef GRAVITY
-   real *SendBuf_Pot     = new real [ SendDataSizeFlu1v ];
+   real_fld *SendBuf_Pot     = new real_fld [ SendDataSizeFlu1v ];
 #  ifdef STORE_POT_GHOST
-   real *SendBuf_PotExt  = new real [ SendDataSizePotExt ];
+   real_fld *SendBuf_PotExt  = new real_fld [ SendDataSizePotExt ];
 #  endif
 #  endif // GRAVITY
 #  ifdef MHD
-   real *SendBuf_Mag     = new real [ SendDataSizeMag1v*NCOMP_MAG ];
+   real_fld *SendBuf_Mag     = new real_fld [ SendDataSizeMag1v*NCOMP_MAG ];
 #  endif
 #  ifdef PARTICLE
-   real *SendBuf_ParData = new real [ NSend_Total_ParData ];
-   int  *SendBuf_NPar    = new int  [ NSend_Total_Patch ];
+   real     *SendPtr         = NULL;
+   real     *SendBuf_ParData = new real     [ NSend_Total_ParData ];
+   int      *SendBuf_NPar    = new int      [ NSend_Total_Patch ];
 #  endif
 
    for (int r=0; r<MPI_NRank; r++)
@@ -492,19 +523,19 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 //    2.2 fluid
       for (int v=0; v<NCOMP_TOTAL; v++)
       {
-         SendPtr = SendBuf_Flu + v*SendDataSizeFlu1v + Send_NDisp_Flu1v[TRank] + NDone_Patch[TRank]*FluSize1v;
-         memcpy( SendPtr, &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], FluSize1v*sizeof(real) );
+         SendPtr_Grid = SendBuf_Flu + v*SendDataSizeFlu1v + Send_NDisp_Flu1v[TRank] + NDone_Patch[TRank]*FluSize1v;
+         Mis_CopyArray( SendPtr_Grid, &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], FluSize1v );
       }
 
 #     ifdef GRAVITY
 //    2.3 potential
-      SendPtr = SendBuf_Pot + Send_NDisp_Flu1v[TRank] + NDone_Patch[TRank]*FluSize1v;
-      memcpy( SendPtr, &amr->patch[PotSg][lv][PID]->pot[0][0][0], FluSize1v*sizeof(real) );
+      SendPtr_Grid = SendBuf_Pot + Send_NDisp_Flu1v[TRank] + NDone_Patch[TRank]*FluSize1v;
+      Mis_CopyArray( SendPtr_Grid, &amr->patch[PotSg][lv][PID]->pot[0][0][0], FluSize1v );
 
 //    2.4 potential with ghost zones
 #     ifdef STORE_POT_GHOST
-      SendPtr = SendBuf_PotExt + Send_NDisp_PotExt[TRank] + NDone_Patch[TRank]*GraNxtSize;
-      memcpy( SendPtr, &amr->patch[PotSg][lv][PID]->pot_ext[0][0][0], GraNxtSize*sizeof(real) );
+      SendPtr_Grid = SendBuf_PotExt + Send_NDisp_PotExt[TRank] + NDone_Patch[TRank]*GraNxtSize;
+      Mis_CopyArray( SendPtr_Grid, &amr->patch[PotSg][lv][PID]->pot_ext[0][0][0], GraNxtSize );
 #     endif
 #     endif
 
@@ -512,8 +543,8 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 #     ifdef MHD
       for (int v=0; v<NCOMP_MAG; v++)
       {
-         SendPtr = SendBuf_Mag + v*SendDataSizeMag1v + Send_NDisp_Mag1v[TRank] + NDone_Patch[TRank]*MagSize1v;
-         memcpy( SendPtr, &amr->patch[MagSg][lv][PID]->magnetic[v][0], MagSize1v*sizeof(real) );
+         SendPtr_Grid = SendBuf_Mag + v*SendDataSizeMag1v + Send_NDisp_Mag1v[TRank] + NDone_Patch[TRank]*MagSize1v;
+         Mis_CopyArray( SendPtr_Grid, &amr->patch[MagSg][lv][PID]->magnetic[v][0], MagSize1v );
       }
 #     endif
 
@@ -564,20 +595,20 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
    amr->Lvdelete( lv, OPT__REUSE_MEMORY==2 );
 
 // allocate recv buffers AFTER deleting old patches
-   long *RecvBuf_LBIdx   = new long [ NRecv_Total_Patch ];
-   real *RecvBuf_Flu     = new real [ RecvDataSizeFlu1v*NCOMP_TOTAL ];
+   long     *RecvBuf_LBIdx   = new long     [ NRecv_Total_Patch ];
+   real_fld *RecvBuf_Flu     = new real_fld [ RecvDataSizeFlu1v*NCOMP_TOTAL ];
 #  ifdef GRAVITY
-   real *RecvBuf_Pot     = new real [ RecvDataSizeFlu1v ];
+   real_fld *RecvBuf_Pot     = new real_fld [ RecvDataSizeFlu1v ];
 #  ifdef STORE_POT_GHOST
-   real *RecvBuf_PotExt  = new real [ RecvDataSizePotExt ];
+   real_fld *RecvBuf_PotExt  = new real_fld [ RecvDataSizePotExt ];
 #  endif
 #  endif // GRAVITY
 #  ifdef MHD
-   real *RecvBuf_Mag     = new real [ RecvDataSizeMag1v*NCOMP_MAG ];
+   real_fld *RecvBuf_Mag     = new real_fld [ RecvDataSizeMag1v*NCOMP_MAG ];
 #  endif
 #  ifdef PARTICLE
-   real *RecvBuf_ParData = new real [ NRecv_Total_ParData ];
-   int  *RecvBuf_NPar    = new int  [ NRecv_Total_Patch ];
+   real     *RecvBuf_ParData = new real     [ NRecv_Total_ParData ];
+   int      *RecvBuf_NPar    = new int      [ NRecv_Total_Patch ];
 #  endif
 
 
@@ -590,13 +621,8 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 // 4.2 fluid (transfer one component at a time to avoid exceeding the maximum allowed transfer size in MPI)
    for (int v=0; v<NCOMP_TOTAL; v++)
    {
-#     ifdef FLOAT8
-      MPI_Alltoallv( SendBuf_Flu + v*SendDataSizeFlu1v, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_DOUBLE,
-                     RecvBuf_Flu + v*RecvDataSizeFlu1v, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_DOUBLE, MPI_COMM_WORLD );
-#     else
-      MPI_Alltoallv( SendBuf_Flu + v*SendDataSizeFlu1v, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_FLOAT,
-                     RecvBuf_Flu + v*RecvDataSizeFlu1v, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_FLOAT,  MPI_COMM_WORLD );
-#     endif
+      MPI_Alltoallv( SendBuf_Flu + v*SendDataSizeFlu1v, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_GAMER_REAL_FLD,
+                     RecvBuf_Flu + v*RecvDataSizeFlu1v, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_GAMER_REAL_FLD, MPI_COMM_WORLD );
    }
 
 #  ifdef GRAVITY
@@ -604,23 +630,13 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 // --> debugger may report that the potential data are NOT initialized when calling LB_Init_LoadBalance()
 //     during initialization
 // --> it's fine since we will calculate potential AFTER invoking LB_Init_LoadBalance() in Init_GAMER()
-#  ifdef FLOAT8
-   MPI_Alltoallv( SendBuf_Pot, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_DOUBLE,
-                  RecvBuf_Pot, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_DOUBLE, MPI_COMM_WORLD );
-#  else
-   MPI_Alltoallv( SendBuf_Pot, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_FLOAT,
-                  RecvBuf_Pot, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_FLOAT,  MPI_COMM_WORLD );
-#  endif
+   MPI_Alltoallv( SendBuf_Pot, Send_NCount_Flu1v, Send_NDisp_Flu1v, MPI_GAMER_REAL_FLD,
+                  RecvBuf_Pot, Recv_NCount_Flu1v, Recv_NDisp_Flu1v, MPI_GAMER_REAL_FLD, MPI_COMM_WORLD );
 
 // 4.4 potential with ghost zones
 #  ifdef STORE_POT_GHOST
-#  ifdef FLOAT8
-   MPI_Alltoallv( SendBuf_PotExt, Send_NCount_PotExt, Send_NDisp_PotExt, MPI_DOUBLE,
-                  RecvBuf_PotExt, Recv_NCount_PotExt, Recv_NDisp_PotExt, MPI_DOUBLE, MPI_COMM_WORLD );
-#  else
-   MPI_Alltoallv( SendBuf_PotExt, Send_NCount_PotExt, Send_NDisp_PotExt, MPI_FLOAT,
-                  RecvBuf_PotExt, Recv_NCount_PotExt, Recv_NDisp_PotExt, MPI_FLOAT,  MPI_COMM_WORLD );
-#  endif
+   MPI_Alltoallv( SendBuf_PotExt, Send_NCount_PotExt, Send_NDisp_PotExt, MPI_GAMER_REAL_FLD,
+                  RecvBuf_PotExt, Recv_NCount_PotExt, Recv_NDisp_PotExt, MPI_GAMER_REAL_FLD, MPI_COMM_WORLD );
 #  endif // STORE_POT_GHOST
 #  endif // GRAVITY
 
@@ -628,13 +644,8 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 #  ifdef MHD
    for (int v=0; v<NCOMP_MAG; v++)
    {
-#     ifdef FLOAT8
-      MPI_Alltoallv( SendBuf_Mag + v*SendDataSizeMag1v, Send_NCount_Mag1v, Send_NDisp_Mag1v, MPI_DOUBLE,
-                     RecvBuf_Mag + v*RecvDataSizeMag1v, Recv_NCount_Mag1v, Recv_NDisp_Mag1v, MPI_DOUBLE, MPI_COMM_WORLD );
-#     else
-      MPI_Alltoallv( SendBuf_Mag + v*SendDataSizeMag1v, Send_NCount_Mag1v, Send_NDisp_Mag1v, MPI_FLOAT,
-                     RecvBuf_Mag + v*RecvDataSizeMag1v, Recv_NCount_Mag1v, Recv_NDisp_Mag1v, MPI_FLOAT,  MPI_COMM_WORLD );
-#     endif
+      MPI_Alltoallv( SendBuf_Mag + v*SendDataSizeMag1v, Send_NCount_Mag1v, Send_NDisp_Mag1v, MPI_GAMER_REAL_FLD,
+                     RecvBuf_Mag + v*RecvDataSizeMag1v, Recv_NCount_Mag1v, Recv_NDisp_Mag1v, MPI_GAMER_REAL_FLD, MPI_COMM_WORLD );
    }
 #  endif
 
@@ -692,7 +703,7 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
 // 6. allocate new patches with the data just received (use "patch group" as the basic unit)
 //    --> also add particles to the particle repository and associate them with home patches
 // ==========================================================================================
-   const real *RecvPtr_Grid = NULL;
+   const real_fld *RecvPtr_Grid = NULL;
    const int   PScale       = PATCH_SIZE*amr->scale[lv];
    const int   PGScale      = 2*PScale;
    int PID, Cr0[3];
@@ -743,18 +754,18 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
          for (int v=0; v<NCOMP_TOTAL; v++)
          {
             RecvPtr_Grid = RecvBuf_Flu + v*RecvDataSizeFlu1v + PID*FluSize1v;
-            memcpy( &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], RecvPtr_Grid, FluSize1v*sizeof(real) );
+            Mis_CopyArray( &amr->patch[FluSg][lv][PID]->fluid[v][0][0][0], RecvPtr_Grid, FluSize1v );
          }
 
 #        ifdef GRAVITY
 //       potential
          RecvPtr_Grid = RecvBuf_Pot + PID*FluSize1v;
-         memcpy( &amr->patch[PotSg][lv][PID]->pot[0][0][0], RecvPtr_Grid, FluSize1v*sizeof(real) );
+         Mis_CopyArray( &amr->patch[PotSg][lv][PID]->pot[0][0][0], RecvPtr_Grid, FluSize1v );
 
 //       potential with ghost zones
 #        ifdef STORE_POT_GHOST
          RecvPtr_Grid = RecvBuf_PotExt + PID*GraNxtSize;
-         memcpy( &amr->patch[PotSg][lv][PID]->pot_ext[0][0][0], RecvPtr_Grid, GraNxtSize*sizeof(real) );
+         Mis_CopyArray( &amr->patch[PotSg][lv][PID]->pot_ext[0][0][0], RecvPtr_Grid, GraNxtSize );
 #        endif
 #        endif // GRAVITY
 
@@ -763,7 +774,7 @@ void LB_RedistributeRealPatch( const int lv, real **ParAtt_Old, const bool Remov
          for (int v=0; v<NCOMP_MAG; v++)
          {
             RecvPtr_Grid = RecvBuf_Mag + v*RecvDataSizeMag1v + PID*MagSize1v;
-            memcpy( &amr->patch[MagSg][lv][PID]->magnetic[v][0], RecvPtr_Grid, MagSize1v*sizeof(real) );
+            Mis_CopyArray( &amr->patch[MagSg][lv][PID]->magnetic[v][0], RecvPtr_Grid, MagSize1v );
          }
 #        endif
 
@@ -0,0 +1,152 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+#include <stdlib.h>
+
+
+const double MPIBuf_SizeFactor = 1.2;     // buffer size = NByte*MPIBuf_SizeFactor when growing --> must be >= 1.0
+const size_t MPIBuf_Align      = 4096;    // alignment of all buffers (i.e., memory page size)
+
+// persistent buffers and their statistics
+static void *MPIBuf      [MPIBUF_NTYPE] = { NULL };
+static long  MPIBuf_Cap  [MPIBUF_NTYPE] = { 0 };  // current capacity in bytes
+static long  MPIBuf_NCall[MPIBUF_NTYPE] = { 0 };  // number of requests
+static long  MPIBuf_NGrow[MPIBUF_NTYPE] = { 0 };  // number of reallocations
+static long  MPIBuf_MaxB [MPIBUF_NTYPE] = { 0 };  // maximum requested size in bytes
+static long  MPIBuf_SumB [MPIBUF_NTYPE] = { 0 };  // accumulated requested size in bytes
+
+static const char *MPIBuf_Name[MPIBUF_NTYPE] =
+   { "Send", "Recv", "Table", "SendNPar", "SendLBIdx", "RecvNPatch", "RecvNPar", "RecvLBIdx" };
+
+static void LB_MPIBuffer_Record();
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_MPIBuffer_Get
+// Description :  Return a persistent, page-aligned MPI buffer with at least NByte bytes
+//
+// Note        :  1. Shared by all MPI routines of LOAD_BALANCE, including LB_GetBufferData() and the particle
+//                   routines Par_LB_SendParticleData() and Par_LB_ExchangeParticleBetweenPatch()
+//                   --> Callers must NOT free the returned pointer. Call LB_MPIBuffer_MemFree() to free all buffers.
+//                2. Buffers are reallocated only when the current capacity is not large enough, in which case
+//                   MPIBuf_SizeFactor more memory is allocated to sustain longer
+//                   --> Data stored previously are NOT preserved after reallocation
+//                3. Buffers with the same BufID must not be used by two routines at the same time
+//                   --> See MPIBuf_t in Typedef.h for the available buffers
+//                4. Not thread-safe --> must be called outside OpenMP parallel regions
+//
+// Parameter   :  BufID : Target buffer (MPIBUF_SEND, MPIBUF_RECV, ...)
+//                NByte : Minimum number of bytes required
+//
+// Return      :  Pointer to the target buffer
+//-------------------------------------------------------------------------------------------------------
+void *LB_MPIBuffer_Get( const MPIBuf_t BufID, const long NByte )
+{
+
+// check
+   if ( BufID < 0  ||  BufID >= MPIBUF_NTYPE )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "BufID", BufID );
+
+   if ( NByte < 0 )
+      Aux_Error( ERROR_INFO, "BufID %d, NByte = %ld < 0 !!\n", BufID, NByte );
+
+
+// record statistics
+   MPIBuf_NCall[BufID] ++;
+   MPIBuf_SumB [BufID] += NByte;
+   MPIBuf_MaxB [BufID]  = MAX( MPIBuf_MaxB[BufID], NByte );
+
+
+// reallocate the buffer only when it's not large enough
+   if ( NByte > MPIBuf_Cap[BufID]  ||  MPIBuf[BufID] == NULL )
+   {
+      if ( MPIBuf[BufID] != NULL )  free( MPIBuf[BufID] );
+
+      long NewCap = (long)( NByte*MPIBuf_SizeFactor );
+      NewCap = ( NewCap + MPIBuf_Align - 1 ) / MPIBuf_Align * MPIBuf_Align;
+      NewCap = MAX( NewCap, (long)MPIBuf_Align );
+
+      if (  posix_memalign( &MPIBuf[BufID], MPIBuf_Align, NewCap ) != 0  )
+         Aux_Error( ERROR_INFO, "failed to allocate the MPI buffer %s (%ld bytes) !!\n", MPIBuf_Name[BufID], NewCap );
+
+      MPIBuf_Cap  [BufID] = NewCap;
+      MPIBuf_NGrow[BufID] ++;
+   }
+
+   return MPIBuf[BufID];
+
+} // FUNCTION : LB_MPIBuffer_Get
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_MPIBuffer_Record
+// Description :  Record the statistics of all MPI buffers
+//
+// Note        :  1. Output to the same log file as LB_GetBufferData() (i.e., "Record__TimingMPI_RankXXXXX")
+//                2. Invoked by LB_MPIBuffer_MemFree() when OPT__TIMING_MPI is on
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+static void LB_MPIBuffer_Record()
+{
+
+   char FileName[100];
+   sprintf( FileName, "Record__TimingMPI_Rank%05d", MPI_Rank );
+
+   FILE *File = fopen( FileName, "a" );
+
+   fprintf( File, "\n# MPI buffer statistics\n" );
+   fprintf( File, "# %10s %12s %8s %14s %14s %14s\n",
+            "Buffer", "NCall", "NGrow", "Capacity(MB)", "Max(MB)", "Average(MB)" );
+
+   for (int b=0; b<MPIBUF_NTYPE; b++)
+      fprintf( File, "  %10s %12ld %8ld %14.3f %14.3f %14.3f\n",
+               MPIBuf_Name[b], MPIBuf_NCall[b], MPIBuf_NGrow[b], MPIBuf_Cap[b]*1.0e-6, MPIBuf_MaxB[b]*1.0e-6,
+               ( MPIBuf_NCall[b] > 0 ) ? MPIBuf_SumB[b]*1.0e-6/MPIBuf_NCall[b] : 0.0 );
+
+   fclose( File );
+
+} // FUNCTION : LB_MPIBuffer_Record
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_MPIBuffer_MemFree
+// Description :  Free all MPI buffers allocated by LB_MPIBuffer_Get()
+//
+// Note        :  1. Invoked by End_MemFree()
+//                2. Record the buffer statistics first if OPT__TIMING_MPI is on
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void LB_MPIBuffer_MemFree()
+{
+
+#  ifdef TIMING
+   if ( OPT__TIMING_MPI )  LB_MPIBuffer_Record();
+#  endif
+
+   for (int b=0; b<MPIBUF_NTYPE; b++)
+   {
+      if ( MPIBuf[b] != NULL )
+      {
+         free( MPIBuf[b] );
+         MPIBuf[b] = NULL;
+      }
+
+      MPIBuf_Cap  [b] = 0;
+      MPIBuf_NCall[b] = 0;
+      MPIBuf_NGrow[b] = 0;
+      MPIBuf_MaxB [b] = 0;
+      MPIBuf_SumB [b] = 0;
+   }
+
+} // FUNCTION : LB_MPIBuffer_MemFree
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -0,0 +1,56 @@
+#include "GAMER.h"
+
+#ifdef LOAD_BALANCE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_RecordExchangeNeighborRank
+// Description :  Construct the list of ranks exchanging any buffer data with this rank at the target level
+//
+// Note        :  1. Must be invoked AFTER all the MPI send and recv lists at Lv have been constructed
+//                   --> LB_RecordExchangeDataPatchID(), LB_RecordExchangeRestrictDataPatchID(),
+//                       LB_AllocateFluxArray(), MHD_LB_AllocateElectricArray(), and
+//                       LB_RecordExchangeFixUpDataPatchID()
+//                2. Used by LB_GetBufferData() to communicate with these neighbor ranks only by
+//                   point-to-point MPI calls
+//                   --> The list is reused until the next time the patches at Lv are rebuilt
+//                3. This rank itself is included if it sends data to itself (e.g., periodic B.C.)
+//
+// Parameter   :  Lv : Target refinement level for recording the neighbor ranks
+//-------------------------------------------------------------------------------------------------------
+void LB_RecordExchangeNeighborRank( const int Lv )
+{
+
+   const LB_t *LB = amr->LB;
+
+   int *NbrRank_List = LB->NbrRank_List[Lv];
+   int  NbrRank_N    = 0;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      bool IsNbr = false;
+
+      if ( LB->SendH_NList[Lv][r] > 0  ||  LB->RecvH_NList[Lv][r] > 0 )   IsNbr = true;
+      if ( LB->SendX_NList[Lv][r] > 0  ||  LB->RecvX_NList[Lv][r] > 0 )   IsNbr = true;
+      if ( LB->SendR_NList[Lv][r] > 0  ||  LB->RecvR_NList[Lv][r] > 0 )   IsNbr = true;
+      if ( LB->SendF_NList[Lv][r] > 0  ||  LB->RecvF_NList[Lv][r] > 0 )   IsNbr = true;
+#     ifdef MHD
+      if ( LB->SendY_NList[Lv][r] > 0  ||  LB->RecvY_NList[Lv][r] > 0 )   IsNbr = true;
+      if ( LB->SendE_NList[Lv][r] > 0  ||  LB->RecvE_NList[Lv][r] > 0 )   IsNbr = true;
+#     endif
+#     ifdef GRAVITY
+      if ( LB->SendG_NList[Lv][r] > 0  ||  LB->RecvG_NList[Lv][r] > 0 )   IsNbr = true;
+#     endif
+
+      if ( IsNbr )   NbrRank_List[ NbrRank_N ++ ] = r;
+   }
+
+   amr->LB->NbrRank_N[Lv] = NbrRank_N;
+
+} // FUNCTION : LB_RecordExchangeNeighborRank
+
+
+
+#endif // #ifdef LOAD_BALANCE
@@ -148,14 +148,19 @@ void LB_Refine( const int FaLv )
    LB_RecordExchangeFixUpDataPatchID(  FaLv );
    LB_RecordExchangeFixUpDataPatchID( SonLv );
 
-// 5.6 list for overlapping MPI time with CPU/GPU computation
+// 5.6 list of ranks exchanging buffer data with this rank
+//     --> must be invoked after constructing all the lists above
+   LB_RecordExchangeNeighborRank(  FaLv );
+   LB_RecordExchangeNeighborRank( SonLv );
+
+// 5.7 list for overlapping MPI time with CPU/GPU computation
    if ( OPT__OVERLAP_MPI )
    {
       LB_RecordOverlapMPIPatchID(  FaLv );
       LB_RecordOverlapMPIPatchID( SonLv );
    }
 
-// 5.7 list for exchanging particles
+// 5.8 list for exchanging particles
 #  ifdef PARTICLE
    Par_LB_RecordExchangeParticlePatchID( SonLv );
 
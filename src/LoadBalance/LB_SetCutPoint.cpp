@@ -4,6 +4,19 @@
 
 
 
+static void SetCutPoint_Serial( const int NPG_Total, long *CutPoint, long *LBIdx0_AllRank, const double *Load_AllRank,
+                                double *Load_Record );
+static void SetCutPoint_Gather( const int NPG_Total, long *CutPoint, const int NPG_ThisRank, const long *LBIdx0_ThisRank,
+                                const double *Load_ThisRank, double *Load_Record );
+static bool SetCutPoint_Parallel( const int NPG_Total, long *CutPoint, const int NPG_ThisRank, long *LBIdx0_ThisRank,
+                                  double *Load_ThisRank, double *Load_Record );
+static void Output_CutPoint( const int lv, const int NPG_Total, const long *CutPoint, double *Load_Record,
+                             const bool Measured );
+static void Benchmark_CutPoint( const int lv, const int NPG_Total, const long *CutPoint, const int NPG_ThisRank,
+                                const long *LBIdx0_ThisRank, const double *Load_ThisRank, const double Time_Parallel );
+
+
+
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  LB_SetCutPoint
@@ -17,6 +30,18 @@
 //                   particle information yet ...)
 //                   --> See the description of "InputLBIdx0AndLoad, LBIdx0_AllRank_Input, and
 //                       Load_AllRank_Input" below
+//                   --> Cut points are computed by rank 0 alone in this case (see SetCutPoint_Serial())
+//                4. For LB_INPUT__MEASURED_COST, the cut points are set according to the measured cost of each
+//                   patch group (see LB_EstimateWorkload_AllPatchGroup())
+//                   --> The workload of each rank after redistribution is recorded in the file "Record__LoadBalance"
+//                       if OPT__RECORD_LOAD_BALANCE is on
+//                5. Otherwise the cut points are computed by all ranks together without collecting the
+//                   information of all patch groups to rank 0 (see SetCutPoint_Parallel())
+//                   --> Fall back to SetCutPoint_Gather() if the patch groups are not distributed along the
+//                       space-filling curve in the order of MPI ranks, which should never happen
+//                6. OPT__LB_CUT_BENCHMARK compares the cut points and the elapsed time of SetCutPoint_Parallel()
+//                   with those of SetCutPoint_Gather()
+//                   --> Recorded in the file "Record__LBCutPoint"
 //
 // Parameter   :  lv                   : Target refinement level
 //                NPG_Total            : Total number of patch groups on level "lv"
@@ -56,244 +81,682 @@ void LB_SetCutPoint( const int lv, const int NPG_Total, long *CutPoint, const bo
       Aux_Error( ERROR_INFO, "NPG_Total (%d) < 0 !!\n", NPG_Total );
 
 
-// 1. collect the load-balance weighting and LB_Idx of all patch groups from all ranks
-   long   *LBIdx0_AllRank = NULL;
-   double *Load_AllRank   = NULL;
-   int    *IdxTable       = ( MPI_Rank == 0 ) ? new int [NPG_Total] : NULL;
+   bool    Measured    = false;   // whether the load-balance weighting is the measured cost
+   bool    RecordLoad;            // whether to record the workload of each rank
+   double *Load_Record = NULL;    // accumulated workload up to each cut point
+
 
-// use the input tables directly
+// 1. use the input tables directly
 // --> useful during RESTART, where we have very limited information
 //     (e.g., we don't know the number of patches in each rank, amr->NPatchComma, and any particle information yet ...)
    if ( InputLBIdx0AndLoad )
    {
+      RecordLoad = OPT__VERBOSE;
+
       if ( MPI_Rank == 0 )
       {
-         LBIdx0_AllRank = LBIdx0_AllRank_Input;
-         Load_AllRank   = Load_AllRank_Input;
+         if ( RecordLoad )    Load_Record = new double [MPI_NRank];
+
+         SetCutPoint_Serial( NPG_Total, CutPoint, LBIdx0_AllRank_Input, Load_AllRank_Input, Load_Record );
       }
+
+      MPI_Bcast( CutPoint, MPI_NRank+1, MPI_LONG, 0, MPI_COMM_WORLD );
    }
 
+
+// 2. compute the cut points from the patch groups in all ranks
    else
    {
-//    allocate memory
-      int NPG_ThisRank = amr->NPatchComma[lv][1] / 8;
+//    2-1. get the minimum LBIdx and the load-balance weighting of each patch group in this rank
+//         --> assuming patches within the same patch group have consecutive LBIdx
+      const int NPG_ThisRank = amr->NPatchComma[lv][1] / 8;
 
-      long   *LBIdx0_ThisRank = new long   [ NPG_ThisRank ];
-      double *Load_ThisRank   = new double [ NPG_ThisRank ];
-      int    *NPG_EachRank    = NULL;
-      int    *Recv_Disp       = NULL;
+      long   *LBIdx0_ThisRank = new long   [NPG_ThisRank];
+      double *Load_ThisRank   = new double [NPG_ThisRank];
 
-      if ( MPI_Rank == 0 )
+      for (int t=0; t<NPG_ThisRank; t++)
       {
-         NPG_EachRank   = new int    [ MPI_NRank ];
-         Recv_Disp      = new int    [ MPI_NRank ];
-         LBIdx0_AllRank = new long   [ NPG_Total ];
-         Load_AllRank   = new double [ NPG_Total ];
+         const int PID0 = t*8;
+
+         LBIdx0_ThisRank[t]  = amr->patch[0][lv][PID0]->LB_Idx;
+         LBIdx0_ThisRank[t] -= LBIdx0_ThisRank[t] % 8;         // get the **minimum** LBIdx in this patch group
       }
 
+      Measured   = LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank );
+      RecordLoad = ( OPT__VERBOSE  ||  ( OPT__RECORD_LOAD_BALANCE && Measured ) );
 
-//    collect the number of patch groups in each rank
-      MPI_Gather( &NPG_ThisRank, 1, MPI_INT, NPG_EachRank, 1, MPI_INT, 0, MPI_COMM_WORLD );
+      if ( RecordLoad )    Load_Record = new double [MPI_NRank];
 
-      if ( MPI_Rank == 0 )
-      {
-         Recv_Disp[0] = 0;
-         for (int r=0; r<MPI_NRank-1; r++)   Recv_Disp[r+1] = Recv_Disp[r] + NPG_EachRank[r];
-      }
 
+//    2-2. back up the input arrays for OPT__LB_CUT_BENCHMARK since SetCutPoint_Parallel() sorts them in place
+      long   *LBIdx0_Ref = NULL;
+      double *Load_Ref   = NULL;
 
-//    collect the minimum LBIdx in each patch group
-//    --> assuming patches within the same patch group have consecutive LBIdx
-      for (int t=0; t<NPG_ThisRank; t++)
+      if ( OPT__LB_CUT_BENCHMARK )
       {
-         const int PID0 = t*8;
+         LBIdx0_Ref = new long   [NPG_ThisRank];
+         Load_Ref   = new double [NPG_ThisRank];
 
-         LBIdx0_ThisRank[t]  = amr->patch[0][lv][PID0]->LB_Idx;
-         LBIdx0_ThisRank[t] -= LBIdx0_ThisRank[t] % 8;         // get the **minimum** LBIdx in this patch group
+         memcpy( LBIdx0_Ref, LBIdx0_ThisRank, NPG_ThisRank*sizeof(long)   );
+         memcpy( Load_Ref,   Load_ThisRank,   NPG_ThisRank*sizeof(double) );
+
+         MPI_Barrier( MPI_COMM_WORLD );
       }
 
-      MPI_Gatherv( LBIdx0_ThisRank, NPG_ThisRank, MPI_LONG, LBIdx0_AllRank, NPG_EachRank, Recv_Disp,
-                   MPI_LONG, 0, MPI_COMM_WORLD );
 
+//    2-3. compute the cut points
+      const double Time_Start = MPI_Wtime();
 
-//    collect the load-balance weighting in each patch group
-      LB_EstimateWorkload_AllPatchGroup( lv, ParWeight, Load_ThisRank );
+      if (  ! SetCutPoint_Parallel( NPG_Total, CutPoint, NPG_ThisRank, LBIdx0_ThisRank, Load_ThisRank, Load_Record )  )
+      {
+         if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+            Aux_Message( stdout, "         Lv %2d: patch groups are not sorted by MPI ranks --> gather them to rank 0\n", lv );
 
-      MPI_Gatherv( Load_ThisRank, NPG_ThisRank, MPI_DOUBLE, Load_AllRank, NPG_EachRank, Recv_Disp,
-                   MPI_DOUBLE, 0, MPI_COMM_WORLD );
+         SetCutPoint_Gather( NPG_Total, CutPoint, NPG_ThisRank, LBIdx0_ThisRank, Load_ThisRank, Load_Record );
+      }
+
+      const double Time_Parallel = MPI_Wtime() - Time_Start;
+
+      if ( OPT__LB_CUT_BENCHMARK )
+      {
+         Benchmark_CutPoint( lv, NPG_Total, CutPoint, NPG_ThisRank, LBIdx0_Ref, Load_Ref, Time_Parallel );
 
+         delete [] LBIdx0_Ref;
+         delete [] Load_Ref;
+      }
 
-//    free memory
       delete [] LBIdx0_ThisRank;
       delete [] Load_ThisRank;
+   } // if ( InputLBIdx0AndLoad ) ... else ...
 
-      if ( MPI_Rank == 0 )
+
+// 3. output the cut points and workload of each MPI rank
+   if ( RecordLoad  &&  MPI_Rank == 0 )   Output_CutPoint( lv, NPG_Total, CutPoint, Load_Record, Measured );
+
+   delete [] Load_Record;
+
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+      Aux_Message( stdout, "      %s at Lv %2d ... done\n", __FUNCTION__, lv );
+
+} // FUNCTION : LB_SetCutPoint
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetCutPoint_Serial
+// Description :  Set the cut points from the information of all patch groups stored in this rank
+//
+// Note        :  1. Invoked by LB_SetCutPoint() and SetCutPoint_Gather() on rank 0 only
+//                2. Find the LBIdx with an accumulated workload closest to the average workload of each rank
+//                   after sorting all patch groups by LBIdx
+//                3. LBIdx0_AllRank[] will be sorted in place
+//
+// Parameter   :  NPG_Total      : Total number of patch groups
+//                CutPoint       : Cut point array to be set
+//                LBIdx0_AllRank : Minimum LBIdx of all patch groups (can be unsorted)
+//                Load_AllRank   : Load-balance weighting of all patch groups
+//                Load_Record    : Accumulated workload up to each cut point (i.e., CutPoint[1 ... MPI_NRank])
+//                                 --> Not recorded if Load_Record == NULL
+//
+// Return      :  CutPoint[], LBIdx0_AllRank[], Load_Record[]
+//-------------------------------------------------------------------------------------------------------
+void SetCutPoint_Serial( const int NPG_Total, long *CutPoint, long *LBIdx0_AllRank, const double *Load_AllRank,
+                         double *Load_Record )
+{
+
+   int   *IdxTable = new int [NPG_Total];
+   double Load_Ave;
+
+// 1. sort LB_Idx
+// --> after sorting, we must use IdxTable to access the Load_AllRank[] array
+   Mis_Heapsort( NPG_Total, LBIdx0_AllRank, IdxTable );
+
+
+// 2. set the cut points
+   for (int t=0; t<MPI_NRank+1; t++)   CutPoint[t] = -1;
+
+// 2-1. take care of the case with no patches at all
+   if ( NPG_Total == 0 )
+   {
+      Load_Ave = 0.0;
+   }
+
+   else
+   {
+//    2-2. get the average workload for each rank
+      Load_Ave = 0.0;
+      for (int t=0; t<NPG_Total; t++)  Load_Ave += Load_AllRank[t];
+      Load_Ave /= (double)MPI_NRank;
+
+//    2-3. set the min and max cut points
+      const long LBIdx0_Min = LBIdx0_AllRank[             0 ];
+      const long LBIdx0_Max = LBIdx0_AllRank[ NPG_Total - 1 ];
+      CutPoint[        0] = LBIdx0_Min;
+      CutPoint[MPI_NRank] = LBIdx0_Max + 8;  // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
+
+//    2-4. find the LBIdx with an accumulated workload (LoadAcc) closest to the average workload of each rank (LoadTarget)
+      int    CutIdx     = 1;                 // target array index for CutPoint[]
+                                             // --> note that CutPoint[CutIdx] is the **exclusive** upper bound of rank "CutIdx-1"
+      double LoadAcc    = 0.0;               // accumulated workload
+      double LoadTarget = CutIdx*Load_Ave;   // target accumulated workload for the rank "CutIdx-1"
+      double LoadThisPG;                     // workload of the target patch group
+
+      for (int PG=0; PG<NPG_Total; PG++)
       {
-         delete [] NPG_EachRank;
-         delete [] Recv_Disp;
+//       nothing to do if all cut points have been set already
+         if ( CutIdx == MPI_NRank )    break;
+
+//       remember to use IdxTable to access Load_AllRank
+         LoadThisPG = Load_AllRank[ IdxTable[PG] ];
+
+//       check if adding a new patch group will exceed the target accumulated workload
+         if ( LoadAcc+LoadThisPG >= LoadTarget )
+         {
+//          determine the cut point with an accumulated workload **closest** to the target accumulated workload
+//          (a) if adding a new patch group will exceed the target accumulated workload too much
+//              --> exclude this patch group from the rank "CutIdx-1"
+//          note that both "LoadAcc > LoadTarget" and "LoadAcc <= LoadTaget" can happen
+            if ( fabs(LoadAcc-LoadTarget) < LoadAcc+LoadThisPG-LoadTarget )
+            {
+               CutPoint[CutIdx] = LBIdx0_AllRank[PG];
+
+               PG --;   // because this patch group has been **excluded** from this cut point
+            }
+
+//          (b) if adding a new patch group will NOT exceed the target accumulated workload too much
+//              --> include this patch group in the rank "CutIdx-1"
+            else
+            {
+//             be careful about the special case "PG == NPG_Total-1"
+               CutPoint[CutIdx] = ( PG == NPG_Total-1 ) ? CutPoint[MPI_NRank] : LBIdx0_AllRank[PG+1];
+
+               LoadAcc += LoadThisPG;
+            }
+
+//          record the **accumulated** workload of each rank
+            if ( Load_Record != NULL )    Load_Record[ CutIdx - 1 ] = LoadAcc;
+
+            CutIdx ++;
+            LoadTarget = CutIdx*Load_Ave;
+         } // if ( LoadAcc+LoadThisPG >= LoadTarget )
+
+         else
+         {
+            LoadAcc += LoadThisPG;
+         } // if ( LoadAcc+LoadThisPG >= LoadTarget ) ... else ...
+
+      } // for (int PG=0; PG<NPG_Total; PG++)
+
+//    2-5. take care of the special case where the last several ranks have no patches at all
+      for (int t=CutIdx; t<MPI_NRank; t++)
+      {
+         CutPoint[t] = CutPoint[MPI_NRank];
+
+         if ( Load_Record != NULL )    Load_Record[ t - 1 ] = Load_Ave*MPI_NRank;
       }
-   } // if ( InputLBIdx0AndLoad ) ... else ...
+
+//    2-6. check
+#     ifdef GAMER_DEBUG
+//    all cut points must be set properly
+      for (int t=0; t<MPI_NRank+1; t++)
+         if ( CutPoint[t] == -1 )
+            Aux_Error( ERROR_INFO, "CutPoint[%d] == -1 !!\n", t );
+
+//    monotonicity
+      for (int t=0; t<MPI_NRank; t++)
+         if ( CutPoint[t+1] < CutPoint[t] )
+            Aux_Error( ERROR_INFO, "CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
+                       t+1, CutPoint[t+1], t, CutPoint[t] );
+#     endif
+   } // if ( NPG_Total == 0 ) ... else ...
+
+   if ( Load_Record != NULL )
+   {
+      if ( NPG_Total == 0 )
+         for (int r=0; r<MPI_NRank; r++)  Load_Record[r] = 0.0;
+      else
+         Load_Record[ MPI_NRank - 1 ] = Load_Ave*MPI_NRank;
+   }
+
+   delete [] IdxTable;
+
+} // FUNCTION : SetCutPoint_Serial
+
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetCutPoint_Gather
+// Description :  Collect the information of all patch groups to rank 0, set the cut points by SetCutPoint_Serial(),
+//                and then broadcast the cut points to all ranks
+//
+// Note        :  1. Reference implementation of SetCutPoint_Parallel()
+//                   --> Memory consumption and computation time of rank 0 scale with the total number of
+//                       patch groups
+//                2. Load_Record[] is only set on rank 0
+//
+// Parameter   :  NPG_Total       : Total number of patch groups
+//                CutPoint        : Cut point array to be set
+//                NPG_ThisRank    : Number of patch groups in this rank
+//                LBIdx0_ThisRank : Minimum LBIdx of all patch groups in this rank
+//                Load_ThisRank   : Load-balance weighting of all patch groups in this rank
+//                Load_Record     : See SetCutPoint_Serial()
+//
+// Return      :  CutPoint[], Load_Record[]
+//-------------------------------------------------------------------------------------------------------
+void SetCutPoint_Gather( const int NPG_Total, long *CutPoint, const int NPG_ThisRank, const long *LBIdx0_ThisRank,
+                         const double *Load_ThisRank, double *Load_Record )
+{
+
+// allocate memory
+   long   *LBIdx0_AllRank = NULL;
+   double *Load_AllRank   = NULL;
+   int    *NPG_EachRank   = NULL;
+   int    *Recv_Disp      = NULL;
+
    if ( MPI_Rank == 0 )
    {
-      double *Load_Record = ( OPT__VERBOSE ) ? new double [MPI_NRank] : NULL;
-      double  Load_Ave;
+      NPG_EachRank   = new int    [ MPI_NRank ];
+      Recv_Disp      = new int    [ MPI_NRank ];
+      LBIdx0_AllRank = new long   [ NPG_Total ];
+      Load_AllRank   = new double [ NPG_Total ];
+   }
 
-//    3. sort LB_Idx
-//    --> after sorting, we must use IdxTable to access the Load_AllRank[] array
-      Mis_Heapsort( NPG_Total, LBIdx0_AllRank, IdxTable );
 
+// collect the number of patch groups in each rank
+   MPI_Gather( &NPG_ThisRank, 1, MPI_INT, NPG_EachRank, 1, MPI_INT, 0, MPI_COMM_WORLD );
 
-//    4. set the cut points
-      for (int t=0; t<MPI_NRank+1; t++)   CutPoint[t] = -1;
+   if ( MPI_Rank == 0 )
+   {
+      Recv_Disp[0] = 0;
+      for (int r=0; r<MPI_NRank-1; r++)   Recv_Disp[r+1] = Recv_Disp[r] + NPG_EachRank[r];
+   }
 
-//    4-1. take care of the case with no patches at all
-      if ( NPG_Total == 0 )
-      {
-         Load_Ave = 0.0;
 
-         if ( OPT__VERBOSE )
-            for (int r=0; r<MPI_NRank; r++)  Load_Record[r] = 0.0;
+// collect the minimum LBIdx and the load-balance weighting of each patch group
+   MPI_Gatherv( LBIdx0_ThisRank, NPG_ThisRank, MPI_LONG, LBIdx0_AllRank, NPG_EachRank, Recv_Disp,
+                MPI_LONG, 0, MPI_COMM_WORLD );
+
+   MPI_Gatherv( Load_ThisRank, NPG_ThisRank, MPI_DOUBLE, Load_AllRank, NPG_EachRank, Recv_Disp,
+                MPI_DOUBLE, 0, MPI_COMM_WORLD );
+
+
+// set and broadcast the cut points
+   if ( MPI_Rank == 0 )    SetCutPoint_Serial( NPG_Total, CutPoint, LBIdx0_AllRank, Load_AllRank, Load_Record );
+
+   MPI_Bcast( CutPoint, MPI_NRank+1, MPI_LONG, 0, MPI_COMM_WORLD );
+
+
+// free memory
+   if ( MPI_Rank == 0 )
+   {
+      delete [] NPG_EachRank;
+      delete [] Recv_Disp;
+      delete [] LBIdx0_AllRank;
+      delete [] Load_AllRank;
+   }
+
+} // FUNCTION : SetCutPoint_Gather
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetCutPoint_Parallel
+// Description :  Set the cut points by all ranks together using a parallel prefix sum of the workload along the
+//                space-filling curve
+//
+// Note        :  1. Real patches of each rank always lie within its own cut-point range, so the patch groups in
+//                   each rank are already a contiguous segment of the space-filling curve and the segments are
+//                   sorted by MPI ranks
+//                   --> Each rank only sorts its own patch groups, and the accumulated workload at the start of
+//                       each segment is obtained from the workload sum of all preceding ranks
+//                   --> Return false without setting any cut point if this assumption is violated
+//                2. Produce the same cut points as SetCutPoint_Serial()
+//                   --> With the accumulated workload "S_{i-1}" before and "S_i" after patch group "i", each target
+//                       workload "T_k = k*Load_Ave" satisfying "S_{i-1} < T_k <= S_i" sets the cut point "k" to
+//                       either patch group "i" (if T_k is closer to S_{i-1}) or the next patch group
+//                   --> It assumes that all patch groups have positive load-balance weighting
+//                   --> Accumulated workloads can differ from the serial version by round-off errors, which only
+//                       matters for target workloads lying exactly on a patch-group boundary
+//                3. Memory consumption of each rank is proportional to NPG_ThisRank+MPI_NRank and does not depend on
+//                   the total number of patch groups
+//                4. LBIdx0_ThisRank[] and Load_ThisRank[] will be sorted in place
+//                5. Load_Record[] is set on all ranks
+//
+// Parameter   :  See SetCutPoint_Gather()
+//
+// Return      :  true/false, CutPoint[], LBIdx0_ThisRank[], Load_ThisRank[], Load_Record[]
+//-------------------------------------------------------------------------------------------------------
+bool SetCutPoint_Parallel( const int NPG_Total, long *CutPoint, const int NPG_ThisRank, long *LBIdx0_ThisRank,
+                           double *Load_ThisRank, double *Load_Record )
+{
+
+// 1. sort the patch groups in this rank
+   int    *IdxTable  = new int    [NPG_ThisRank];
+   double *Load_Sort = new double [NPG_ThisRank];
+
+   Mis_Heapsort( NPG_ThisRank, LBIdx0_ThisRank, IdxTable );
+
+   for (int t=0; t<NPG_ThisRank; t++)  Load_Sort[t] = Load_ThisRank[ IdxTable[t] ];
+   for (int t=0; t<NPG_ThisRank; t++)  Load_ThisRank[t] = Load_Sort[t];
+
+   delete [] IdxTable;
+   delete [] Load_Sort;
+
+
+// 2. collect the LBIdx range and the total workload of each rank
+//    --> Range_EachRank[r][0/1/2] = number of patch groups/minimum LBIdx0/maximum LBIdx0
+   long   Range_ThisRank[3] = { NPG_ThisRank, -1, -1 };
+   double Load_Sum_ThisRank = 0.0;
+
+   if ( NPG_ThisRank > 0 )
+   {
+      Range_ThisRank[1] = LBIdx0_ThisRank[                0 ];
+      Range_ThisRank[2] = LBIdx0_ThisRank[ NPG_ThisRank - 1 ];
+   }
+
+   for (int t=0; t<NPG_ThisRank; t++)  Load_Sum_ThisRank += Load_ThisRank[t];
+
+   long   (*Range_EachRank)[3] = new long [MPI_NRank][3];
+   double  *Load_EachRank      = new double [MPI_NRank];
+
+   MPI_Allgather( Range_ThisRank,     3, MPI_LONG,   Range_EachRank, 3, MPI_LONG,   MPI_COMM_WORLD );
+   MPI_Allgather( &Load_Sum_ThisRank, 1, MPI_DOUBLE, Load_EachRank,  1, MPI_DOUBLE, MPI_COMM_WORLD );
+
+
+// 3. check whether the patch groups are sorted by MPI ranks
+   long LBIdx0_Min = -1, LBIdx0_Max = -1;
+   bool Sorted     = true;
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      if ( Range_EachRank[r][0] == 0 )    continue;
+
+      if ( LBIdx0_Max >= Range_EachRank[r][1] )
+      {
+         Sorted = false;
+         break;
       }
 
-      else
+      if ( LBIdx0_Min == -1 )    LBIdx0_Min = Range_EachRank[r][1];
+      LBIdx0_Max = Range_EachRank[r][2];
+   }
+
+   if ( !Sorted )
+   {
+      delete [] Range_EachRank;
+      delete [] Load_EachRank;
+
+      return false;
+   }
+
+
+// 4. set the cut points
+   for (int t=0; t<MPI_NRank+1; t++)   CutPoint[t] = -1;
+
+   if ( NPG_Total > 0 )
+   {
+//    4-1. get the accumulated workload at the start (LoadAcc_Start) and the end (LoadAcc_End) of this rank
+//         and the average workload for each rank
+//         --> accumulate in the same order on all ranks so that the segments of adjacent ranks are consistent
+      double LoadAcc_Start = 0.0, LoadAcc_End, Load_Ave;
+
+      for (int r=0; r<MPI_Rank; r++)   LoadAcc_Start += Load_EachRank[r];
+
+      LoadAcc_End = LoadAcc_Start + Load_EachRank[MPI_Rank];
+      Load_Ave    = LoadAcc_End;
+      for (int r=MPI_Rank+1; r<MPI_NRank; r++)  Load_Ave += Load_EachRank[r];
+      Load_Ave /= (double)MPI_NRank;
+
+//    4-2. minimum LBIdx0 of the patch group following this rank
+      long LBIdx0_Next = LBIdx0_Max + 8;  // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
+
+      for (int r=MPI_Rank+1; r<MPI_NRank; r++)
       {
-//       4-2. get the average workload for each rank
-         Load_Ave = 0.0;
-         for (int t=0; t<NPG_Total; t++)  Load_Ave += Load_AllRank[t];
-         Load_Ave /= (double)MPI_NRank;
-
-//       4-3. set the min and max cut points
-         const long LBIdx0_Min = LBIdx0_AllRank[             0 ];
-         const long LBIdx0_Max = LBIdx0_AllRank[ NPG_Total - 1 ];
-         CutPoint[        0] = LBIdx0_Min;
-         CutPoint[MPI_NRank] = LBIdx0_Max + 8;  // +8 since the maximum LBIdx in all patches is LBIdx0_Max + 7
-
-//       4-4. find the LBIdx with an accumulated workload (LoadAcc) closest to the average workload of each rank (LoadTarget)
-         int    CutIdx     = 1;                 // target array index for CutPoint[]
-                                                // --> note that CutPoint[CutIdx] is the **exclusive** upper bound of rank "CutIdx-1"
-         double LoadAcc    = 0.0;               // accumulated workload
-         double LoadTarget = CutIdx*Load_Ave;   // target accumulated workload for the rank "CutIdx-1"
-         double LoadThisPG;                     // workload of the target patch group
-
-         for (int PG=0; PG<NPG_Total; PG++)
+         if ( Range_EachRank[r][0] > 0 )
          {
-//          nothing to do if all cut points have been set already
-            if ( CutIdx == MPI_NRank )    break;
+            LBIdx0_Next = Range_EachRank[r][1];
+            break;
+         }
+      }
+
+//    4-3. find the first target workload larger than LoadAcc_Start
+      int CutIdx = MAX( 1, (int)( LoadAcc_Start/Load_Ave ) );
+
+      while ( CutIdx > 1  &&  (CutIdx-1)*Load_Ave > LoadAcc_Start )   CutIdx --;
+      while ( CutIdx < MPI_NRank  &&  CutIdx*Load_Ave <= LoadAcc_Start )   CutIdx ++;
 
-//          remember to use IdxTable to access Load_AllRank
-            LoadThisPG = Load_AllRank[ IdxTable[PG] ];
+//    4-4. set the cut points whose target workload lies in the segment of each patch group
+//         --> "Load_Record" temporarily stores the accumulated workload of the cut points set by this rank
+//             and -1.0 for all other cut points
+      if ( Load_Record != NULL )
+         for (int r=0; r<MPI_NRank; r++)  Load_Record[r] = -1.0;
 
-//          check if adding a new patch group will exceed the target accumulated workload
-            if ( LoadAcc+LoadThisPG >= LoadTarget )
+      double LoadAcc_Prev = LoadAcc_Start;   // accumulated workload before the target patch group
+
+      for (int PG=0; PG<NPG_ThisRank; PG++)
+      {
+         if ( CutIdx == MPI_NRank )    break;
+
+         const double LoadAcc    = ( PG == NPG_ThisRank-1 ) ? LoadAcc_End : LoadAcc_Prev+Load_ThisRank[PG];
+         const long   LBIdx0_Aft = ( PG == NPG_ThisRank-1 ) ? LBIdx0_Next : LBIdx0_ThisRank[PG+1];
+         bool         Included   = false;
+
+         while ( CutIdx < MPI_NRank  &&  CutIdx*Load_Ave <= LoadAcc )
+         {
+            const double LoadTarget = CutIdx*Load_Ave;
+
+//          exclude this patch group from the rank "CutIdx-1" if its target workload is closer to LoadAcc_Prev
+//          --> once this patch group is included, it will also be included in all the remaining target ranks
+            if ( !Included  &&  fabs(LoadAcc_Prev-LoadTarget) < LoadAcc-LoadTarget )
             {
-//             determine the cut point with an accumulated workload **closest** to the target accumulated workload
-//             (a) if adding a new patch group will exceed the target accumulated workload too much
-//                 --> exclude this patch group from the rank "CutIdx-1"
-//             note that both "LoadAcc > LoadTarget" and "LoadAcc <= LoadTaget" can happen
-               if ( fabs(LoadAcc-LoadTarget) < LoadAcc+LoadThisPG-LoadTarget )
-               {
-                  CutPoint[CutIdx] = LBIdx0_AllRank[PG];
-
-                  PG --;   // because this patch group has been **excluded** from this cut point
-               }
-
-//             (b) if adding a new patch group will NOT exceed the target accumulated workload too much
-//                 --> include this patch group in the rank "CutIdx-1"
-               else
-               {
-//                be careful about the special case "PG == NPG_Total-1"
-                  CutPoint[CutIdx] = ( PG == NPG_Total-1 ) ? CutPoint[MPI_NRank] : LBIdx0_AllRank[PG+1];
-
-                  LoadAcc += LoadThisPG;
-               }
-
-//             record the **accumulated** workload of each rank
-               if ( OPT__VERBOSE )  Load_Record[ CutIdx - 1 ] = LoadAcc;
-
-               CutIdx ++;
-               LoadTarget = CutIdx*Load_Ave;
-            } // if ( LoadAcc+LoadThisPG >= LoadTarget )
+               CutPoint[CutIdx] = LBIdx0_ThisRank[PG];
+               if ( Load_Record != NULL )    Load_Record[ CutIdx - 1 ] = LoadAcc_Prev;
+            }
 
             else
             {
-               LoadAcc += LoadThisPG;
-            } // if ( LoadAcc+LoadThisPG >= LoadTarget ) ... else ...
+               Included         = true;
+               CutPoint[CutIdx] = LBIdx0_Aft;
+               if ( Load_Record != NULL )    Load_Record[ CutIdx - 1 ] = LoadAcc;
+            }
 
-         } // for (int PG=0; PG<NPG_Total; PG++)
+            CutIdx ++;
+         }
+
+         LoadAcc_Prev = LoadAcc;
+      } // for (int PG=0; PG<NPG_ThisRank; PG++)
+
+//    4-5. collect the cut points set by all ranks
+      MPI_Allreduce( MPI_IN_PLACE, CutPoint, MPI_NRank+1, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+
+      if ( Load_Record != NULL )
+         MPI_Allreduce( MPI_IN_PLACE, Load_Record, MPI_NRank, MPI_DOUBLE, MPI_MAX, MPI_COMM_WORLD );
 
-//       4.5 take care of the special case where the last several ranks have no patches at all
-         for (int t=CutIdx; t<MPI_NRank; t++)
+//    4-6. set the min and max cut points and take care of the special case where the last several ranks
+//         have no patches at all
+      CutPoint[        0] = LBIdx0_Min;
+      CutPoint[MPI_NRank] = LBIdx0_Max + 8;
+
+      for (int t=1; t<MPI_NRank; t++)
+      {
+         if ( CutPoint[t] == -1 )
          {
             CutPoint[t] = CutPoint[MPI_NRank];
-
-            if ( OPT__VERBOSE )  Load_Record[ t - 1 ] = Load_Ave*MPI_NRank;
+            if ( Load_Record != NULL )    Load_Record[ t - 1 ] = Load_Ave*MPI_NRank;
          }
+      }
 
-//       4.6 check
-#        ifdef GAMER_DEBUG
-//       all cut points must be set properly
-         for (int t=0; t<MPI_NRank+1; t++)
-            if ( CutPoint[t] == -1 )
-               Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] == -1 !!\n", lv, t );
+      if ( Load_Record != NULL )    Load_Record[ MPI_NRank - 1 ] = Load_Ave*MPI_NRank;
 
-//       monotonicity
-         for (int t=0; t<MPI_NRank; t++)
-            if ( CutPoint[t+1] < CutPoint[t] )
-               Aux_Error( ERROR_INFO, "lv %d, CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
-                          lv, t+1, CutPoint[t+1], t, CutPoint[t] );
-#        endif
-      } // if ( NPG_Total == 0 ) ... else ...
+//    4-7. check
+#     ifdef GAMER_DEBUG
+//    all cut points must be set properly
+      for (int t=0; t<MPI_NRank+1; t++)
+         if ( CutPoint[t] == -1 )
+            Aux_Error( ERROR_INFO, "CutPoint[%d] == -1 !!\n", t );
 
+//    monotonicity
+      for (int t=0; t<MPI_NRank; t++)
+         if ( CutPoint[t+1] < CutPoint[t] )
+            Aux_Error( ERROR_INFO, "CutPoint[%d] (%ld) < CutPoint[%d] (%ld) !!\n",
+                       t+1, CutPoint[t+1], t, CutPoint[t] );
+#     endif
+   } // if ( NPG_Total > 0 )
 
-//    5. output the cut points and workload of each MPI rank
-      if ( OPT__VERBOSE )
-      {
-//       convert the accumulated workload to the actual workload of each rank
-         Load_Record[ MPI_NRank - 1 ] = Load_Ave*MPI_NRank;
-         for (int r=MPI_NRank-1; r>=1; r--)  Load_Record[r] -= Load_Record[r-1];
+   else if ( Load_Record != NULL )
+   {
+      for (int r=0; r<MPI_NRank; r++)  Load_Record[r] = 0.0;
+   }
 
-         double Load_Max = -1.0;
 
-         for (int r=0; r<MPI_NRank; r++)
-         {
-            Aux_Message( stdout, "         Lv %2d: Rank %4d, Cut %15ld -> %15ld, Load_Weighted %9.3e\n",
-                         lv, r, CutPoint[r], CutPoint[r+1], Load_Record[r] );
+   delete [] Range_EachRank;
+   delete [] Load_EachRank;
 
-            if ( Load_Record[r] > Load_Max )    Load_Max = Load_Record[r];
-         }
+   return true;
 
-         Aux_Message( stdout, "         Load_Ave %9.3e, Load_Max %9.3e --> Load_Imbalance = %6.2f%%\n",
-                      Load_Ave, Load_Max, (NPG_Total == 0) ? 0.0 : 100.0*(Load_Max-Load_Ave)/Load_Ave );
-         Aux_Message( stdout, "         =============================================================================\n" );
+} // FUNCTION : SetCutPoint_Parallel
 
-         delete [] Load_Record;
-      }
-   } // if ( MPI_Rank == 0 )
 
 
-// 6. broadcast the cut points
-   MPI_Bcast( CutPoint, MPI_NRank+1, MPI_LONG, 0, MPI_COMM_WORLD );
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_CutPoint
+// Description :  Output the cut points and the workload of each MPI rank
+//
+// Note        :  1. Output to stdout if OPT__VERBOSE is on
+//                2. Output to the file "Record__LoadBalance" if OPT__RECORD_LOAD_BALANCE is on and the cut points
+//                   are set according to the measured cost
+//                3. Invoked by LB_SetCutPoint() on rank 0 only
+//
+// Parameter   :  lv          : Target refinement level
+//                NPG_Total   : Total number of patch groups on level "lv"
+//                CutPoint    : Cut points
+//                Load_Record : Accumulated workload up to each cut point
+//                              --> Will be converted to the workload of each rank
+//                Measured    : Whether the workload is the measured cost
+//-------------------------------------------------------------------------------------------------------
+void Output_CutPoint( const int lv, const int NPG_Total, const long *CutPoint, double *Load_Record, const bool Measured )
+{
 
+// convert the accumulated workload to the actual workload of each rank
+   const double Load_Ave = Load_Record[ MPI_NRank - 1 ] / MPI_NRank;
 
-// free memory
+   for (int r=MPI_NRank-1; r>=1; r--)  Load_Record[r] -= Load_Record[r-1];
+
+   double Load_Max = -1.0;
+
+   for (int r=0; r<MPI_NRank; r++)
+      if ( Load_Record[r] > Load_Max )    Load_Max = Load_Record[r];
+
+   const double Load_Imb = (NPG_Total == 0) ? 0.0 : 100.0*(Load_Max-Load_Ave)/Load_Ave;
+
+   if ( OPT__VERBOSE )
+   {
+      for (int r=0; r<MPI_NRank; r++)
+         Aux_Message( stdout, "         Lv %2d: Rank %4d, Cut %15ld -> %15ld, Load_Weighted %9.3e\n",
+                      lv, r, CutPoint[r], CutPoint[r+1], Load_Record[r] );
+
+      Aux_Message( stdout, "         Load_Ave %9.3e, Load_Max %9.3e --> Load_Imbalance = %6.2f%%\n",
+                   Load_Ave, Load_Max, Load_Imb );
+      Aux_Message( stdout, "         =============================================================================\n" );
+   }
+
+// record the expected workload of each rank based on the measured cost
+   if ( OPT__RECORD_LOAD_BALANCE  &&  Measured )
+   {
+      FILE *File = fopen( "Record__LoadBalance", "a" );
+
+      fprintf( File, "Time %13.7e,  Step %7ld,  Lv %2d: set cut points by the measured cost\n", Time[0], Step, lv );
+      fprintf( File, "%4s %15s %15s %12s %10s\n", "Rank", "Cut_Start", "Cut_End", "Cost(sec)", "Imb" );
+
+      for (int r=0; r<MPI_NRank; r++)
+         fprintf( File, "%4d %15ld %15ld %12.5e %+9.2lf%%\n", r, CutPoint[r], CutPoint[r+1], Load_Record[r],
+                  (Load_Ave==0.0)?0.0:100.0*(Load_Record[r]-Load_Ave)/Load_Ave );
+
+      fprintf( File, "Load_Ave %12.5e, Load_Max %12.5e --> Load_Imbalance = %6.2f%%\n\n\n", Load_Ave, Load_Max, Load_Imb );
+
+      fclose( File );
+   }
+
+} // FUNCTION : Output_CutPoint
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Benchmark_CutPoint
+// Description :  Compare the cut points and the elapsed time of SetCutPoint_Parallel() with those of
+//                SetCutPoint_Gather()
+//
+// Note        :  1. Invoked by LB_SetCutPoint() when OPT__LB_CUT_BENCHMARK is on
+//                2. Elapsed time is the maximum among all ranks
+//                3. Record to the file "Record__LBCutPoint"
+//                   --> Compare runs with different numbers of MPI ranks for the scaling of both versions
+//
+// Parameter   :  lv              : Target refinement level
+//                NPG_Total       : Total number of patch groups on level "lv"
+//                CutPoint        : Cut points set by SetCutPoint_Parallel()
+//                NPG_ThisRank    : Number of patch groups in this rank
+//                LBIdx0_ThisRank : Unsorted minimum LBIdx of all patch groups in this rank
+//                Load_ThisRank   : Unsorted load-balance weighting of all patch groups in this rank
+//                Time_Parallel   : Elapsed time of SetCutPoint_Parallel() in this rank
+//-------------------------------------------------------------------------------------------------------
+void Benchmark_CutPoint( const int lv, const int NPG_Total, const long *CutPoint, const int NPG_ThisRank,
+                         const long *LBIdx0_ThisRank, const double *Load_ThisRank, const double Time_Parallel )
+{
+
+   const char FileName[] = "Record__LBCutPoint";
+   static bool FirstTime = true;
+
+   long *CutPoint_Ref = new long [MPI_NRank+1];
+   double Time_EachVer[2], Time_EachVer_Max[2];   // [0/1] = parallel/gather version
+
+
+// 1. set the reference cut points
+   MPI_Barrier( MPI_COMM_WORLD );
+
+   const double Time_Start = MPI_Wtime();
+
+   SetCutPoint_Gather( NPG_Total, CutPoint_Ref, NPG_ThisRank, LBIdx0_ThisRank, Load_ThisRank, NULL );
+
+   Time_EachVer[0] = Time_Parallel;
+   Time_EachVer[1] = MPI_Wtime() - Time_Start;
+
+   MPI_Reduce( Time_EachVer, Time_EachVer_Max, 2, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD );
+
+
+// 2. compare and record
    if ( MPI_Rank == 0 )
    {
-      delete [] IdxTable;
+      int NDiff = 0;
+      for (int t=0; t<MPI_NRank+1; t++)   if ( CutPoint[t] != CutPoint_Ref[t] )   NDiff ++;
+
+      if ( NDiff > 0 )
+         Aux_Message( stderr, "WARNING : %d cut points at Lv %d differ from the reference values !!\n", NDiff, lv );
 
-      if ( !InputLBIdx0AndLoad )
+      if ( FirstTime )
       {
-         delete [] LBIdx0_AllRank;
-         delete [] Load_AllRank;
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FILE *File = fopen( FileName, "a" );
+         fprintf( File, "#%12s %8s %3s %6s %12s %14s %14s %10s %6s\n",
+                  "Time", "Step", "Lv", "NRank", "NPG_Total", "Time_Para(s)", "Time_Gath(s)", "Speedup", "NDiff" );
+         fclose( File );
+
+         FirstTime = false;
       }
-   }
 
+      FILE *File = fopen( FileName, "a" );
+      fprintf( File, "%13.7e %8ld %3d %6d %12d %14.7e %14.7e %10.3f %6d\n",
+               Time[0], Step, lv, MPI_NRank, NPG_Total, Time_EachVer_Max[0], Time_EachVer_Max[1],
+               ( Time_EachVer_Max[0] > 0.0 ) ? Time_EachVer_Max[1]/Time_EachVer_Max[0] : 0.0, NDiff );
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
 
-   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
-      Aux_Message( stdout, "      %s at Lv %2d ... done\n", __FUNCTION__, lv );
 
-} // FUNCTION : LB_SetCutPoint
+   delete [] CutPoint_Ref;
+
+} // FUNCTION : Benchmark_CutPoint
 
 
 
@@ -51,6 +51,21 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
    double dTime_SoFar, dTime_SubStep, dt_SubStep, TimeOld, TimeNew, AutoReduceDtCoeff;
 
 
+// start caching the coarse-fine ghost zones at this level for OPT__GHOST_CACHE
+   Prepare_PatchData_GhostCache_Begin( lv );
+
+
+// whether the fluid data will be further modified after the fluid and gravity solvers in each sub-step
+// --> if so, the fluid data in the buffer patches cannot be exchanged during OPT__OVERLAP_MPI
+   bool FluUpdatedLater = false;
+#  ifdef SUPPORT_GRACKLE
+   if ( GRACKLE_ACTIVATE )                                     FluUpdatedLater = true;
+#  endif
+#  ifdef STAR_FORMATION
+   if ( SF_CREATE_STAR_SCHEME != SF_CREATE_STAR_SCHEME_NONE )  FluUpdatedLater = true;
+#  endif
+
+
 // reset the workload weighting at each level to be recorded later
    if ( lv == 0 ) {
       for (int TLv=0; TLv<NLEVEL; TLv++)  amr->NUpdateLv[TLv] = 0; }
@@ -147,48 +162,84 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
          Aux_Message( stdout, "   Lv %2d: Flu_AdvanceDt, counter = %8ld ... ", lv, AdvanceCounter[lv] );
 
+//    overlap the buffer-data exchange with advancing the patches not needed to be sent
+//    --> at lv>0 with self-gravity, the density required by the Poisson solver is exchanged here
+//    --> with gravity, the full fluid data are exchanged after the gravity solver instead since they will be
+//        modified by the gravity solver; this is done in the gravity stage except on the root level, where the
+//        FFT Poisson solver does not support overlapping
+//    --> the full fluid data can be exchanged early only if they will not be modified by the additional physics
+#     ifdef GRAVITY
+      const bool OverlapFlu = ( OPT__OVERLAP_MPI  &&  lv > 0  &&  SelfGravity );
+#     else
+      const bool OverlapFlu = ( OPT__OVERLAP_MPI  &&  !FluUpdatedLater );
+#     endif
+
+//    advance the fluid, Poisson, and gravity solvers in one task graph for OPT__TASK_GRAPH (see FluGra_AdvanceDt())
+#     if ( defined GRAVITY  &&  defined SERIAL  &&  !defined PARTICLE  &&  !defined MHD  &&  !defined GPU  &&  defined OPENMP )
+      const bool FuseFluGra = ( OPT__TASK_GRAPH  &&  lv > 0  &&  !AUTO_REDUCE_DT  &&  !OPT__FLU_CLUSTER  &&  !OPT__GRAVITY_EXTRA_MASS );
+#     else
+      const bool FuseFluGra = false;
+#     endif
+
+//    record whether the buffer data have already been exchanged during the overlapped updates
+      bool FluBuf_Done = false;
+#     ifdef GRAVITY
+      bool RhoBuf_Done = false;
+      bool PotBuf_Done = false;
+#     endif
+
       if ( false ) {}
-      /*
-      if ( OPT__OVERLAP_MPI )
-      {
-//       enable OpenMP nested parallelism
-#        ifdef OPENMP
-         omp_set_nested( true );
-#        endif
 
+#     ifdef OVERLAP_MPI
+      else if ( OverlapFlu )
+      {
 //       advance patches needed to be sent
          TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, true ),
                         Timer_Flu_Advance[lv]   );
 
-#        pragma omp parallel sections num_threads(2)
+//       one thread transfers data while the remaining threads advance patches not needed to be sent
+//       --> MPI calls are made by only one thread at a time (MPI_THREAD_SERIALIZED)
+#        pragma omp parallel sections num_threads( 2 )
          {
 #           pragma omp section
             {
-//             transfer data simultaneously
+               omp_set_num_threads( 1 );
+
 #              ifdef GRAVITY
-               if ( SelfGravity )
-               TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT,   NULL_INT, DATA_GENERAL, _DENS,  _NONE, Rho_ParaBuf, USELB_YES ),
+               TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL,
+                                                 _DENS, _NONE, Rho_ParaBuf, USELB_YES ),
                               Timer_GetBuf[lv][0]   );
+
+               RhoBuf_Done = true;
 #              else
-               TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL, _TOTAL, _MAG,  Flu_ParaBuf, USELB_YES ),
+               TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
+                                                 _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
                               Timer_GetBuf[lv][2]   );
+
+               FluBuf_Done = true;
 #              endif
             }
 
 #           pragma omp section
             {
-//             advance patches not needed to be sent
+               omp_set_num_threads( MAX( OMP_NTHREAD-1, 1 ) );
+
                TIMING_FUNC(   Flu_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, true, false ),
                               Timer_Flu_Advance[lv]   );
             }
          } // OpenMP parallel sections
+      } // if ( OverlapFlu )
+#     endif // #ifdef OVERLAP_MPI
 
-//       disable OpenMP nested parallelism
-#        ifdef OPENMP
-         omp_set_nested( false );
-#        endif
-      } // if ( OPT__OVERLAP_MPI )
-      */
+#     if ( defined GRAVITY  &&  !defined GPU  &&  defined OPENMP )
+      else if ( FuseFluGra )
+      {
+         const int SaveSg_Pot = 1 - amr->PotSg[lv];
+
+         TIMING_FUNC(   FluGra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot, SelfGravity ),
+                        Timer_Flu_Advance[lv]   );
+      } // if ( FuseFluGra )
+#     endif
 
       else
       {
@@ -238,7 +289,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
                continue;
             }
          } // if ( AUTO_REDUCE_DT )
-      } // if ( OPT__OVERLAP_MPI ) ... else ...
+      } // if ( OverlapFlu ) ... else ...
 
       amr->FluSg    [lv]             = SaveSg_Flu;
       amr->FluSgTime[lv][SaveSg_Flu] = TimeNew;
@@ -294,62 +345,78 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
       else // lv > 0
       {
+//       overlap the potential (and fluid) buffer-data exchange with advancing the patches not needed to be sent
+         const bool OverlapGra = ( OPT__OVERLAP_MPI  &&  ( SelfGravity || !FluUpdatedLater ) );
+
          if ( false ) {}
-         /*
-         if ( OPT__OVERLAP_MPI )
+
+#        ifdef OVERLAP_MPI
+         else if ( OverlapGra )
          {
-//          enable OpenMP nested parallelism
-#           ifdef OPENMP
-            omp_set_nested( true );
-#           endif
+//          exchange the updated density field in the buffer patches for the Poisson solver if it has not been done
+//          during the fluid solver
+            if ( SelfGravity  &&  !RhoBuf_Done )
+            TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL,
+                                              _DENS, _NONE, Rho_ParaBuf, USELB_YES ),
+                           Timer_GetBuf[lv][0]   );
 
 //          advance patches needed to be sent
             TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                           SelfGravity, true, true, true ),
+                                          SelfGravity, true, true, true ),
                            Timer_Gra_Advance[lv]   );
 
-#           pragma omp parallel sections num_threads(2)
+#           pragma omp parallel sections num_threads( 2 )
             {
 #              pragma omp section
                {
-//                transfer data simultaneously
+                  omp_set_num_threads( 1 );
+
                   if ( SelfGravity )
-                  TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
-                                                    _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
-                                 Timer_GetBuf[lv][1]   );
+                  {
+                     TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
+                                                       _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
+                                    Timer_GetBuf[lv][1]   );
+
+                     PotBuf_Done = true;
+                  }
+
+                  if ( !FluUpdatedLater )
+                  {
+                     TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
+                                                       _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
+                                    Timer_GetBuf[lv][2]   );
 
-                  TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
-                                                    _TOTAL, _MAG,  Flu_ParaBuf, USELB_YES ),
-                                 Timer_GetBuf[lv][2]   );
+                     FluBuf_Done = true;
+                  }
                }
 
 #              pragma omp section
                {
-//                advance patches not needed to be sent
+                  omp_set_num_threads( MAX( OMP_NTHREAD-1, 1 ) );
+
                   TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                                                SelfGravity, true, true, false),
+                                                SelfGravity, true, true, false ),
                                  Timer_Gra_Advance[lv]   );
                }
             } // OpenMP parallel sections
-
-//          disable OpenMP nested parallelism
-#           ifdef OPENMP
-            omp_set_nested( false );
-#           endif
-         } // if ( OPT__OVERLAP_MPI )
-         */
+         } // if ( OverlapGra )
+#        endif // #ifdef OVERLAP_MPI
 
          else
          {
-//          exchange the updated density field in the buffer patches for the Poisson solver
-            if ( SelfGravity )
-            TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL,
-                                              _DENS, _NONE, Rho_ParaBuf, USELB_YES ),
-                           Timer_GetBuf[lv][0]   );
+//          the Poisson and gravity solvers have been invoked by FluGra_AdvanceDt() if FuseFluGra is on
+            if ( !FuseFluGra )
+            {
+//             exchange the updated density field in the buffer patches for the Poisson solver
+               if ( SelfGravity  &&  !RhoBuf_Done )
+               TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL,
+                                                 _DENS, _NONE, Rho_ParaBuf, USELB_YES ),
+                              Timer_GetBuf[lv][0]   );
 
-            TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
-                                          SelfGravity, true, false, false ),
-                           Timer_Gra_Advance[lv]   );
+               TIMING_FUNC(   Gra_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Pot,
+                                             SelfGravity, true, false, false ),
+                              Timer_Gra_Advance[lv]   );
+            }
 
 //          exchange the updated potential in the buffer patches
 //          --> we will do this after all other operations (e.g., star formation) if OPT__MINIMIZE_MPI_BARRIER is adopted
@@ -359,7 +426,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
             TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
                                               _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
                            Timer_GetBuf[lv][1]   );
-         } // if ( OPT__OVERLAP_MPI ) ... else ...
+
+            PotBuf_Done = ( SelfGravity  &&  !OPT__MINIMIZE_MPI_BARRIER );
+         } // if ( OverlapGra ) ... else ...
 
 //       note that the current implementation of external potential does NOT use PotSg/PotSgTime
          if ( SelfGravity )
@@ -486,14 +555,16 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 // ===============================================================================================
 
 
-//    exchange the updated fluid field in the buffer patches
+//    exchange the updated fluid field in the buffer patches if it has not been done during OPT__OVERLAP_MPI
+      if ( !FluBuf_Done )
       TIMING_FUNC(   Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL,
                                         _TOTAL, _MAG, Flu_ParaBuf, USELB_YES ),
                      Timer_GetBuf[lv][2]   );
 
 //    exchange the updated potential in the buffer patches here if OPT__MINIMIZE_MPI_BARRIER is adopted
+//    (and it has not been done during OPT__OVERLAP_MPI)
 #     ifdef GRAVITY
-      if ( lv > 0  &&  SelfGravity  &&  OPT__MINIMIZE_MPI_BARRIER )
+      if ( lv > 0  &&  SelfGravity  &&  !PotBuf_Done )
       TIMING_FUNC(   Buf_GetBufferData( lv, NULL_INT, NULL_INT, SaveSg_Pot, POT_FOR_POISSON,
                                         _POTE, _NONE, Pot_ParaBuf, USELB_YES ),
                      Timer_GetBuf[lv][1]   );
@@ -505,6 +576,9 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
       Time          [lv] = TimeNew;
       AdvanceCounter[lv] ++;
       amr->NUpdateLv[lv] ++;
+#     ifdef LOAD_BALANCE
+      LB_CountCostStep( lv );
+#     endif
 
       if ( AdvanceCounter[lv] >= __LONG_MAX__ )    Aux_Message( stderr, "WARNING : AdvanceCounter overflow !!\n" );
 
@@ -615,9 +689,21 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 //       refine
          if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "   Lv %2d: Refine %27s... ", lv, "" );
 
+         if ( OPT__MEMORY_POOL )
+         TIMING_FUNC(   Mis_MemoryPool_Reserve( lv+1 ),
+                        Timer_Refine[lv]   );
+
          TIMING_FUNC(   Refine( lv, USELB_YES ),
                         Timer_Refine[lv]   );
 
+         if ( OPT__MEMORY_POOL )
+         TIMING_FUNC(   Mis_MemoryPool_Update( lv+1 ),
+                        Timer_Refine[lv]   );
+
+         if ( OPT__FIELD_BANK )
+         TIMING_FUNC(   Mis_FieldBank_Bind( lv+1 ),
+                        Timer_Refine[lv]   );
+
          Time          [lv+1]                     = Time[lv];
          amr->FluSgTime[lv+1][ amr->FluSg[lv+1] ] = Time[lv];
 #        ifdef MHD
@@ -671,6 +757,10 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
    } // while()
 
 
+// the coarse-grid data will be modified after returning to the parent level
+   Prepare_PatchData_GhostCache_End( lv );
+
+
 #  ifdef TIMING
    MPI_Barrier( MPI_COMM_WORLD );
    Timer_Lv[lv]->Stop();
@@ -200,13 +200,20 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
 
 
 // coarse-grid data for interpolation (including the ghost zones on each side)
+// --> use the thread-private scratch buffers to avoid allocating memory for each sibling direction
    real *CData_CC_Ptr = NULL;
-   real *CData_CC     = new real [ NVarCC_Tot*CSize3D_CC ];
-   real **CData_FC    = NULL;
+   real *CData_CC     = (real*)Aux_Scratch_Get( SCRATCH_INTGZ_CDATA_CC, (long)NVarCC_Tot*CSize3D_CC*sizeof(real) );
+   real *CData_FC[3]  = { NULL, NULL, NULL };
 
 // assuming NVarFC_Tot = either 0 or 3
-   CData_FC = new real* [NVarFC_Tot];
-   for (int v=0; v<NVarFC_Tot; v++)    CData_FC[v] = new real [ CSize3D_FC[v] ];
+   if ( NVarFC_Tot > 0 )
+   {
+      long CSize3D_FC_Tot = 0;
+      for (int v=0; v<NVarFC_Tot; v++)    CSize3D_FC_Tot += CSize3D_FC[v];
+
+      CData_FC[0] = (real*)Aux_Scratch_Get( SCRATCH_INTGZ_CDATA_FC, CSize3D_FC_Tot*sizeof(real) );
+      for (int v=1; v<NVarFC_Tot; v++)    CData_FC[v] = CData_FC[v-1] + CSize3D_FC[v-1];
+   }
 
 
 // temporal interpolation parameters
@@ -1224,12 +1231,6 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
    } // if ( NVarFC_Tot > 0 )
 
 
-// free memory
-   delete [] CData_CC;
-   for (int v=0; v<NVarFC_Tot; v++)    delete [] CData_FC[v];
-   delete [] CData_FC;
-
-
 
 // d. ensure the consistency between pressure, total energy density, and the dual-energy variable
 //    when DUAL_ENERGY is on
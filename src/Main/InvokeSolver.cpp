@@ -1,15 +1,33 @@
 #include "GAMER.h"
 
 static void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const int NPG,
-                              const int *PID0_List, const int ArrayID );
+                              const int *PID0_List, const int ArrayID, const int ArrayDisp );
 static void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
-                    const int NPG, const int ArrayID, const double dt, const double Poi_Coeff );
+                    const int NPG, const int ArrayID, const int ArrayDisp, const double dt, const double Poi_Coeff );
 static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                          const int NPG, const int *PID0_List, const int ArrayID, const double dt );
+                          const int NPG, const int *PID0_List, const int ArrayID, const int ArrayDisp, const double dt );
+#if ( !defined GPU  &&  defined OPENMP )
+struct TaskGraph_t;
+static void Pipeline_CPU( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
+                          const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
+                          const int NPG_Max, const int NTotal, const int *PID0_List );
+static bool TaskGraph_Supported( const Solver_t TSolver );
+static void TaskGraph_CPU( const int NStage, const Solver_t TSolver[], const int lv, const double TimeNew, const double TimeOld,
+                           const double dt, const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag,
+                           const int SaveSg_Pot, const int NPG_Max, const int NTotal, const int *PID0_List );
+static void TaskGraph_Node( TaskGraph_t *Graph, const int Stage, const int Chunk );
+#endif
+#ifdef FLU_CLUSTER
+static void Flu_AdvanceCluster( const int lv, const double TimeOld, const double dt, const int SaveSg_Flu,
+                                int &NTotal, int *PID0_List );
+#endif
 
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Clo         [NLEVEL][NSOLVER];
+extern Timer_t *Timer_Pipe_Wall   [NLEVEL][NSOLVER];
+extern Timer_t *Timer_Pipe_Sol    [NLEVEL][NSOLVER];
+extern Timer_t *Timer_Pipe_Host   [NLEVEL][NSOLVER];
 #ifdef GRAVITY
 extern Timer_t *Timer_Poi_PreRho  [NLEVEL];
 extern Timer_t *Timer_Poi_PreFlu  [NLEVEL];
@@ -17,6 +35,25 @@ extern Timer_t *Timer_Poi_PrePot_C[NLEVEL];
 extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 #endif
 
+// measure the wall-clock time of a batch of patch groups for LB_INPUT__MEASURED_COST (see LB_AccumulateCost())
+#ifdef LOAD_BALANCE
+#  define MEASURE_COST( call, lv, NPG, PID0_List )                          \
+   {                                                                         \
+      const double Cost_t0 = ( amr->LB->MeasuredCost ) ? MPI_Wtime() : 0.0; \
+      call;                                                                  \
+      if ( amr->LB->MeasuredCost )                                           \
+         LB_AccumulateCost( lv, NPG, PID0_List, MPI_Wtime()-Cost_t0 );       \
+   }
+#else
+#  define MEASURE_COST( call, lv, NPG, PID0_List )   call
+#endif
+
+// host array "h_Array[ArrayID]" starting from the patch group "ArrayDisp" (arrays not allocated remain NULL)
+// --> HOST_ARRAY      : arrays storing one element per patch group (e.g., the fluid solver)
+//     HOST_ARRAY_PATCH: arrays storing one element per patch (e.g., the Poisson/gravity and dt solvers)
+#define HOST_ARRAY( h_Array )          (  ( h_Array[ArrayID] == NULL ) ? NULL : h_Array[ArrayID] +   ArrayDisp  )
+#define HOST_ARRAY_PATCH( h_Array )    (  ( h_Array[ArrayID] == NULL ) ? NULL : h_Array[ArrayID] + 8*ArrayDisp  )
+
 
 
 
@@ -33,6 +70,18 @@ extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 //                   the input data
 //                4. For LOAD_BALANCE, one can turn on the option "OPT__OVERLAP_MPI" to enable the
 //                   overlapping between MPI communication and CPU/GPU computation
+//                5. For CPU-only runs, one can turn on the option "OPT__CPU_PIPELINE" to overlap the CPU solvers
+//                   with the preparation and closing steps of the adjacent patch-group batches
+//                   --> See Pipeline_CPU()
+//                6. For LOAD_BALANCE with LB_INPUT__MEASURED_COST, the wall-clock time of each step is added to the
+//                   load-balance cost of the patch groups in the corresponding batch by LB_AccumulateCost()
+//                   --> For GPU, the solver time only includes the kernel launch since the kernels are asynchronous
+//                7. For the fluid solver with OPT__FLU_CLUSTER, clusters of FLU_CLU_NPG^3 patch groups are advanced
+//                   first as single blocks and the remaining patch groups are then advanced as usual
+//                   --> See Flu_AdvanceCluster()
+//                8. For CPU-only runs, one can turn on the option "OPT__TASK_GRAPH" to replace the level-wide
+//                   preparation, solver, and closing steps by OpenMP tasks on chunks of patch groups
+//                   --> See TaskGraph_CPU()
 //
 // Parameter   :  TSolver      : Target solver
 //                               --> FLUID_SOLVER               : Fluid / ELBDM solver
@@ -183,17 +232,61 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
       for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
    } // if ( OverlapMPI ) ... else ...
 
+// advance the clusters of patch groups first and remove them from PID0_List
+#  ifdef FLU_CLUSTER
+   if ( TSolver == FLUID_SOLVER  &&  OPT__FLU_CLUSTER  &&  AllocateList )
+   {
+      Flu_AdvanceCluster( lv, TimeOld, dt, SaveSg_Flu, NTotal, PID0_List );
+
+      if ( NTotal == 0 )
+      {
+         delete [] PID0_List;
+
+         return;
+      }
+   }
+#  endif
+
+// pipeline the preparation/closing steps with the CPU solvers if there are at least two batches
+#  if ( !defined GPU  &&  defined OPENMP )
+   if ( OPT__CPU_PIPELINE  &&  NTotal > NPG_Max )
+   {
+      Pipeline_CPU( TSolver, lv, TimeNew, TimeOld, dt, Poi_Coeff, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                    NPG_Max, NTotal, PID0_List );
+
+      if ( AllocateList )  delete [] PID0_List;
+
+      return;
+   }
+
+// advance chunks of patch groups as OpenMP tasks
+// --> not for OverlapMPI, where the solvers already run concurrently with Buf_GetBufferData()
+   if ( OPT__TASK_GRAPH  &&  !OverlapMPI  &&  TaskGraph_Supported(TSolver) )
+   {
+      if ( NTotal > 0 )
+         TaskGraph_CPU( 1, &TSolver, lv, TimeNew, TimeOld, dt, Poi_Coeff, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                        NPG_Max, NTotal, PID0_List );
+
+      if ( AllocateList )  delete [] PID0_List;
+
+      return;
+   }
+#  endif
+
+
    NPG[ArrayID] = ( NPG_Max < NTotal ) ? NPG_Max : NTotal;
 
 
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID ),
+   TIMING_SYNC(   MEASURE_COST( Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID, 0 ),
+                                lv, NPG[ArrayID], PID0_List ),
                   Timer_Pre[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, dt, Poi_Coeff ),
+   TIMING_SYNC(   MEASURE_COST( Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, 0, dt, Poi_Coeff ),
+                                lv, NPG[ArrayID], PID0_List ),
                   Timer_Sol[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -206,7 +299,8 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID ),
+      TIMING_SYNC(   MEASURE_COST( Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List+Disp, ArrayID, 0 ),
+                                   lv, NPG[ArrayID], PID0_List+Disp ),
                      Timer_Pre[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -219,14 +313,16 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, dt, Poi_Coeff ),
+      TIMING_SYNC(   MEASURE_COST( Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, 0, dt, Poi_Coeff ),
+                                   lv, NPG[ArrayID], PID0_List+Disp ),
                      Timer_Sol[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
 
 //-------------------------------------------------------------------------------------------------------------
-      TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt ),
+      TIMING_SYNC(   MEASURE_COST( Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                                                 NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, 0, dt ),
+                                   lv, NPG[1-ArrayID], PID0_List+Disp-NPG_Max ),
                      Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -241,8 +337,9 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
-   TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt ),
+   TIMING_SYNC(   MEASURE_COST( Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                                              NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, 0, dt ),
+                                lv, NPG[ArrayID], PID0_List+Disp-NPG_Max ),
                   Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -279,9 +376,10 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 //                NPG       : Number of patch groups to be prepared at a time
 //                PID0_List : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID   : Array index to load and store data ( 0 or 1 )
+//                ArrayDisp : Index of the first patch group in the host arrays (see TaskGraph_CPU())
 //-------------------------------------------------------------------------------------------------------
 void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const int NPG,
-                       const int *PID0_List, const int ArrayID )
+                       const int *PID0_List, const int ArrayID, const int ArrayDisp )
 {
 
 #  ifndef UNSPLIT_GRAVITY
@@ -302,58 +400,58 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
    switch ( TSolver )
    {
       case FLUID_SOLVER :
-         Flu_Prepare( lv, TimeOld, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID],
-                      h_Pot_Array_USG_F[ArrayID], h_Corner_Array_F[ArrayID], NPG, PID0_List );
+         Flu_Prepare( lv, TimeOld, HOST_ARRAY( h_Flu_Array_F_In ), HOST_ARRAY( h_Mag_Array_F_In ),
+                      HOST_ARRAY( h_Pot_Array_USG_F ), HOST_ARRAY( h_Corner_Array_F ), NPG, PID0_List );
       break;
 
 #     ifdef GRAVITY
       case POISSON_SOLVER :
-         TIMING_SYNC(   Poi_Prepare_Rho( lv, TimeNew, h_Rho_Array_P[ArrayID], NPG, PID0_List ),
+         TIMING_SYNC(   Poi_Prepare_Rho( lv, TimeNew, HOST_ARRAY_PATCH( h_Rho_Array_P ), NPG, PID0_List ),
                         Timer_Poi_PreRho[lv]   );
 
-         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], NPG, PID0_List ),
+         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, HOST_ARRAY_PATCH( h_Pot_Array_P_In ), NPG, PID0_List ),
                         Timer_Poi_PrePot_C[lv]   );
       break;
 
       case GRAVITY_SOLVER :
-         TIMING_SYNC(   Gra_Prepare_Flu( lv, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_EngyB_Array_G[ArrayID],
+         TIMING_SYNC(   Gra_Prepare_Flu( lv, HOST_ARRAY_PATCH( h_Flu_Array_G ), HOST_ARRAY_PATCH( h_DE_Array_G ), HOST_ARRAY_PATCH( h_EngyB_Array_G ),
                                          NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 
          if ( OPT__GRAVITY_TYPE == GRAVITY_SELF  ||  OPT__GRAVITY_TYPE == GRAVITY_BOTH )
-         TIMING_SYNC(   Gra_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_Out[ArrayID], NPG, PID0_List ),
+         TIMING_SYNC(   Gra_Prepare_Pot( lv, TimeNew, HOST_ARRAY_PATCH( h_Pot_Array_P_Out ), NPG, PID0_List ),
                         Timer_Poi_PrePot_F[lv]   );
 
          if ( OPT__GRAVITY_TYPE == GRAVITY_EXTERNAL  ||  OPT__GRAVITY_TYPE == GRAVITY_BOTH  ||  OPT__EXTERNAL_POT )
-         TIMING_SYNC(   Gra_Prepare_Corner( lv, h_Corner_Array_G[ArrayID], NPG, PID0_List ),
+         TIMING_SYNC(   Gra_Prepare_Corner( lv, HOST_ARRAY_PATCH( h_Corner_Array_G ), NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 
 #        ifdef UNSPLIT_GRAVITY
 //       use the same timer "Timer_Poi_PreFlu" as Gra_Prepare_Flu and Gra_Prepare_Corner
-         TIMING_SYNC(   Gra_Prepare_USG( lv, TimeOld, h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID],
+         TIMING_SYNC(   Gra_Prepare_USG( lv, TimeOld, HOST_ARRAY_PATCH( h_Pot_Array_USG_G ), HOST_ARRAY_PATCH( h_Flu_Array_USG_G ),
                         NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 #        endif
       break;
 
       case POISSON_AND_GRAVITY_SOLVER :
-         TIMING_SYNC(   Poi_Prepare_Rho( lv, TimeNew, h_Rho_Array_P[ArrayID], NPG, PID0_List ),
+         TIMING_SYNC(   Poi_Prepare_Rho( lv, TimeNew, HOST_ARRAY_PATCH( h_Rho_Array_P ), NPG, PID0_List ),
                         Timer_Poi_PreRho[lv]   );
 
-         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, h_Pot_Array_P_In[ArrayID], NPG, PID0_List ),
+         TIMING_SYNC(   Poi_Prepare_Pot( lv, TimeNew, HOST_ARRAY_PATCH( h_Pot_Array_P_In ), NPG, PID0_List ),
                         Timer_Poi_PrePot_C[lv]   );
 
-         TIMING_SYNC(   Gra_Prepare_Flu( lv, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_EngyB_Array_G[ArrayID],
+         TIMING_SYNC(   Gra_Prepare_Flu( lv, HOST_ARRAY_PATCH( h_Flu_Array_G ), HOST_ARRAY_PATCH( h_DE_Array_G ), HOST_ARRAY_PATCH( h_EngyB_Array_G ),
                                          NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 
          if ( OPT__GRAVITY_TYPE == GRAVITY_EXTERNAL  ||  OPT__GRAVITY_TYPE == GRAVITY_BOTH  ||  OPT__EXTERNAL_POT )
-         TIMING_SYNC(   Gra_Prepare_Corner( lv, h_Corner_Array_G[ArrayID], NPG, PID0_List ),
+         TIMING_SYNC(   Gra_Prepare_Corner( lv, HOST_ARRAY_PATCH( h_Corner_Array_G ), NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 
 #        ifdef UNSPLIT_GRAVITY
 //       use the same timer "Timer_Poi_PreFlu" as Gra_Prepare_Flu and Gra_Prepare_Corner
-         TIMING_SYNC(   Gra_Prepare_USG( lv, TimeOld, h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID],
+         TIMING_SYNC(   Gra_Prepare_USG( lv, TimeOld, HOST_ARRAY_PATCH( h_Pot_Array_USG_G ), HOST_ARRAY_PATCH( h_Flu_Array_USG_G ),
                         NPG, PID0_List ),
                         Timer_Poi_PreFlu[lv]   );
 #        endif
@@ -362,20 +460,20 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 
 #     ifdef SUPPORT_GRACKLE
       case GRACKLE_SOLVER :
-         Grackle_Prepare( lv, h_Che_Array[ArrayID], NPG, PID0_List );
+         Grackle_Prepare( lv, HOST_ARRAY( h_Che_Array ), NPG, PID0_List );
       break;
 #     endif
 
       case DT_FLU_SOLVER:
-         dt_Prepare_Flu( lv, h_Flu_Array_T[ArrayID], h_Mag_Array_T[ArrayID], NPG, PID0_List );
+         dt_Prepare_Flu( lv, HOST_ARRAY_PATCH( h_Flu_Array_T ), HOST_ARRAY_PATCH( h_Mag_Array_T ), NPG, PID0_List );
       break;
 
 #     ifdef GRAVITY
       case DT_GRA_SOLVER:
-         dt_Prepare_Pot( lv, h_Pot_Array_T[ArrayID], NPG, PID0_List, TimeNew );
+         dt_Prepare_Pot( lv, HOST_ARRAY_PATCH( h_Pot_Array_T ), NPG, PID0_List, TimeNew );
 
          if ( OPT__GRAVITY_TYPE == GRAVITY_EXTERNAL  ||  OPT__GRAVITY_TYPE == GRAVITY_BOTH  ||  OPT__EXTERNAL_POT )
-         Gra_Prepare_Corner( lv, h_Corner_Array_G[ArrayID], NPG, PID0_List );
+         Gra_Prepare_Corner( lv, HOST_ARRAY_PATCH( h_Corner_Array_G ), NPG, PID0_List );
       break;
 #     endif
 
@@ -406,11 +504,12 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 //                TimeOld   : Physical time before update   (only useful for adding external potential with UNSPLIT_GRAVITY)
 //                NPG       : Number of patch groups to be updated at a time
 //                ArrayID   : Array index to load and store data ( 0 or 1 )
+//                ArrayDisp : Index of the first patch group in the host arrays (see TaskGraph_CPU())
 //                dt        : Time interval to advance solution (for the fluid, gravity, and Grackle solvers)
 //                Poi_Coeff : Coefficient in front of the RHS in the Poisson eq.
 //-------------------------------------------------------------------------------------------------------
 void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
-             const int NPG, const int ArrayID, const double dt, const double Poi_Coeff )
+             const int NPG, const int ArrayID, const int ArrayDisp, const double dt, const double Poi_Coeff )
 {
 
    const double dh = amr->dh[lv];
@@ -433,6 +532,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 
 #  if ( MODEL != HYDRO )
    const LR_Limiter_t  OPT__LR_LIMITER = LR_LIMITER_NONE;
+   const OptLRScheme_t OPT__LR_SCHEME  = LR_SCHEME_NONE;
+   const OptRSolver_t  OPT__RSOLVER    = RSOLVER_NONE;
    const bool   Flu_XYZ      = true;
    const double GAMMA        = NULL_REAL;
    const double MINMOD_COEFF = NULL_REAL;
@@ -501,23 +602,24 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
       case FLUID_SOLVER :
 
 #        ifdef GPU
-         CUAPI_Asyn_FluidSolver( h_Flu_Array_F_In[ArrayID], h_Flu_Array_F_Out[ArrayID],
-                                 h_Mag_Array_F_In[ArrayID], h_Mag_Array_F_Out[ArrayID],
-                                 h_DE_Array_F_Out[ArrayID], h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
-                                 h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID],
+         CUAPI_Asyn_FluidSolver( HOST_ARRAY( h_Flu_Array_F_In ), HOST_ARRAY( h_Flu_Array_F_Out ),
+                                 HOST_ARRAY( h_Mag_Array_F_In ), HOST_ARRAY( h_Mag_Array_F_Out ),
+                                 HOST_ARRAY( h_DE_Array_F_Out ), HOST_ARRAY( h_Flux_Array ), HOST_ARRAY( h_Ele_Array ),
+                                 HOST_ARRAY( h_Corner_Array_F ), HOST_ARRAY( h_Pot_Array_USG_F ),
                                  NPG, dt, dh, GAMMA, OPT__FIXUP_FLUX, OPT__FIXUP_ELECTRIC, Flu_XYZ, OPT__LR_LIMITER, MINMOD_COEFF,
                                  ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
                                  TimeOld, OPT__GRAVITY_TYPE, GPU_NSTREAM, MIN_DENS, MIN_PRES, DUAL_ENERGY_SWITCH,
                                  OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, JEANS_MIN_PRES, JeansMinPres_Coeff );
 #        else
-         CPU_FluidSolver       ( h_Flu_Array_F_In[ArrayID], h_Flu_Array_F_Out[ArrayID],
-                                 h_Mag_Array_F_In[ArrayID], h_Mag_Array_F_Out[ArrayID],
-                                 h_DE_Array_F_Out[ArrayID], h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
-                                 h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID],
+         CPU_FluidSolver       ( HOST_ARRAY( h_Flu_Array_F_In ), HOST_ARRAY( h_Flu_Array_F_Out ),
+                                 HOST_ARRAY( h_Mag_Array_F_In ), HOST_ARRAY( h_Mag_Array_F_Out ),
+                                 HOST_ARRAY( h_DE_Array_F_Out ), HOST_ARRAY( h_Flux_Array ), HOST_ARRAY( h_Ele_Array ),
+                                 HOST_ARRAY( h_Corner_Array_F ), HOST_ARRAY( h_Pot_Array_USG_F ),
                                  NPG, dt, dh, GAMMA, OPT__FIXUP_FLUX, OPT__FIXUP_ELECTRIC, Flu_XYZ, OPT__LR_LIMITER, MINMOD_COEFF,
-                                 ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
+                                 OPT__LR_SCHEME, OPT__RSOLVER, ELBDM_ETA, ELBDM_TAYLOR3_COEFF, ELBDM_TAYLOR3_AUTO,
                                  TimeOld, OPT__GRAVITY_TYPE, MIN_DENS, MIN_PRES, DUAL_ENERGY_SWITCH,
-                                 OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JEANS_MIN_PRES, JeansMinPres_Coeff );
+                                 OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx, JEANS_MIN_PRES, JeansMinPres_Coeff,
+                                 ( OPT__FLU_FUSED ) ? FLU_FUSED_SLAB : 0 );
 #        endif
       break;
 
@@ -526,8 +628,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
       case POISSON_SOLVER :
 
 #        ifdef GPU
-         CUAPI_Asyn_PoissonGravitySolver( h_Rho_Array_P[ArrayID], h_Pot_Array_P_In[ArrayID],
-                                          h_Pot_Array_P_Out[ArrayID], NULL, NULL,
+         CUAPI_Asyn_PoissonGravitySolver( HOST_ARRAY_PATCH( h_Rho_Array_P ), HOST_ARRAY_PATCH( h_Pot_Array_P_In ),
+                                          HOST_ARRAY_PATCH( h_Pot_Array_P_Out ), NULL, NULL,
                                           NULL, NULL, NULL, NULL,
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
                                           SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
@@ -535,8 +637,8 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           NULL_BOOL, ELBDM_ETA, NULL_REAL, POISSON_ON, GRAVITY_OFF, GPU_NSTREAM,
                                           GRAVITY_NONE, NULL_REAL, NULL_REAL, NULL_BOOL, NULL_REAL );
 #        else
-         CPU_PoissonGravitySolver       ( h_Rho_Array_P[ArrayID], h_Pot_Array_P_In[ArrayID],
-                                          h_Pot_Array_P_Out[ArrayID], NULL, NULL,
+         CPU_PoissonGravitySolver       ( HOST_ARRAY_PATCH( h_Rho_Array_P ), HOST_ARRAY_PATCH( h_Pot_Array_P_In ),
+                                          HOST_ARRAY_PATCH( h_Pot_Array_P_Out ), NULL, NULL,
                                           NULL, NULL, NULL, NULL,
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
                                           SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
@@ -551,9 +653,9 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 
 #        ifdef GPU
          CUAPI_Asyn_PoissonGravitySolver( NULL, NULL,
-                                          h_Pot_Array_P_Out[ArrayID], h_Flu_Array_G[ArrayID], h_Corner_Array_G[ArrayID],
-                                          h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
-                                          h_EngyB_Array_G[ArrayID],
+                                          HOST_ARRAY_PATCH( h_Pot_Array_P_Out ), HOST_ARRAY_PATCH( h_Flu_Array_G ), HOST_ARRAY_PATCH( h_Corner_Array_G ),
+                                          HOST_ARRAY_PATCH( h_Pot_Array_USG_G ), HOST_ARRAY_PATCH( h_Flu_Array_USG_G ), HOST_ARRAY_PATCH( h_DE_Array_G ),
+                                          HOST_ARRAY_PATCH( h_EngyB_Array_G ),
                                           NPG, dt, dh, NULL_INT, NULL_INT,
                                           NULL_REAL, NULL_INT, NULL_INT, NULL_INT,
                                           NULL_REAL, NULL_REAL, (IntScheme_t)NULL_INT,
@@ -561,9 +663,9 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
                                           OPT__GRAVITY_TYPE, TimeNew, TimeOld, OPT__EXTERNAL_POT, MinEint );
 #        else
          CPU_PoissonGravitySolver       ( NULL, NULL,
-                                          h_Pot_Array_P_Out[ArrayID], h_Flu_Array_G[ArrayID], h_Corner_Array_G[ArrayID],
-                                          h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
-                                          h_EngyB_Array_G[ArrayID],
+                                          HOST_ARRAY_PATCH( h_Pot_Array_P_Out ), HOST_ARRAY_PATCH( h_Flu_Array_G ), HOST_ARRAY_PATCH( h_Corner_Array_G ),
+                                          HOST_ARRAY_PATCH( h_Pot_Array_USG_G ), HOST_ARRAY_PATCH( h_Flu_Array_USG_G ), HOST_ARRAY_PATCH( h_DE_Array_G ),
+                                          HOST_ARRAY_PATCH( h_EngyB_Array_G ),
                                           NPG, dt, dh, NULL_INT, NULL_INT,
                                           NULL_REAL, NULL_INT, NULL_INT, NULL_INT,
                                           NULL_REAL, NULL_REAL, (IntScheme_t)NULL_INT,
@@ -576,20 +678,20 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
       case POISSON_AND_GRAVITY_SOLVER :
 
 #        ifdef GPU
-         CUAPI_Asyn_PoissonGravitySolver( h_Rho_Array_P[ArrayID], h_Pot_Array_P_In[ArrayID],
-                                          h_Pot_Array_P_Out[ArrayID], h_Flu_Array_G[ArrayID], h_Corner_Array_G[ArrayID],
-                                          h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
-                                          h_EngyB_Array_G[ArrayID],
+         CUAPI_Asyn_PoissonGravitySolver( HOST_ARRAY_PATCH( h_Rho_Array_P ), HOST_ARRAY_PATCH( h_Pot_Array_P_In ),
+                                          HOST_ARRAY_PATCH( h_Pot_Array_P_Out ), HOST_ARRAY_PATCH( h_Flu_Array_G ), HOST_ARRAY_PATCH( h_Corner_Array_G ),
+                                          HOST_ARRAY_PATCH( h_Pot_Array_USG_G ), HOST_ARRAY_PATCH( h_Flu_Array_USG_G ), HOST_ARRAY_PATCH( h_DE_Array_G ),
+                                          HOST_ARRAY_PATCH( h_EngyB_Array_G ),
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
                                           SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
                                           MG_TOLERATED_ERROR, Poi_Coeff, OPT__POT_INT_SCHEME,
                                           OPT__GRA_P5_GRADIENT, ELBDM_ETA, ELBDM_LAMBDA, POISSON_ON, GRAVITY_ON, GPU_NSTREAM,
                                           OPT__GRAVITY_TYPE, TimeNew, TimeOld, OPT__EXTERNAL_POT, MinEint );
 #        else
-         CPU_PoissonGravitySolver       ( h_Rho_Array_P[ArrayID], h_Pot_Array_P_In[ArrayID],
-                                          h_Pot_Array_P_Out[ArrayID], h_Flu_Array_G[ArrayID], h_Corner_Array_G[ArrayID],
-                                          h_Pot_Array_USG_G[ArrayID], h_Flu_Array_USG_G[ArrayID], h_DE_Array_G[ArrayID],
-                                          h_EngyB_Array_G[ArrayID],
+         CPU_PoissonGravitySolver       ( HOST_ARRAY_PATCH( h_Rho_Array_P ), HOST_ARRAY_PATCH( h_Pot_Array_P_In ),
+                                          HOST_ARRAY_PATCH( h_Pot_Array_P_Out ), HOST_ARRAY_PATCH( h_Flu_Array_G ), HOST_ARRAY_PATCH( h_Corner_Array_G ),
+                                          HOST_ARRAY_PATCH( h_Pot_Array_USG_G ), HOST_ARRAY_PATCH( h_Flu_Array_USG_G ), HOST_ARRAY_PATCH( h_DE_Array_G ),
+                                          HOST_ARRAY_PATCH( h_EngyB_Array_G ),
                                           NPG, dt, dh, SOR_MIN_ITER, SOR_MAX_ITER,
                                           SOR_OMEGA, MG_MAX_ITER, MG_NPRE_SMOOTH, MG_NPOST_SMOOTH,
                                           MG_TOLERATED_ERROR, Poi_Coeff, OPT__POT_INT_SCHEME,
@@ -611,11 +713,11 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 #     if   ( MODEL == HYDRO )
       case DT_FLU_SOLVER:
 #        ifdef GPU
-         CUAPI_Asyn_dtSolver( TSolver, h_dt_Array_T[ArrayID], h_Flu_Array_T[ArrayID], h_Mag_Array_T[ArrayID], NULL, NULL,
+         CUAPI_Asyn_dtSolver( TSolver, HOST_ARRAY_PATCH( h_dt_Array_T ), HOST_ARRAY_PATCH( h_Flu_Array_T ), HOST_ARRAY_PATCH( h_Mag_Array_T ), NULL, NULL,
                               NPG, dh, (Step==0)?DT__FLUID_INIT:DT__FLUID, GAMMA, MIN_PRES,
                               NULL_BOOL, GRAVITY_NONE, NULL_BOOL, NULL_REAL, GPU_NSTREAM );
 #        else
-         CPU_dtSolver       ( TSolver, h_dt_Array_T[ArrayID], h_Flu_Array_T[ArrayID], h_Mag_Array_T[ArrayID], NULL, NULL,
+         CPU_dtSolver       ( TSolver, HOST_ARRAY_PATCH( h_dt_Array_T ), HOST_ARRAY_PATCH( h_Flu_Array_T ), HOST_ARRAY_PATCH( h_Mag_Array_T ), NULL, NULL,
                               NPG, dh, (Step==0)?DT__FLUID_INIT:DT__FLUID, GAMMA, MIN_PRES,
                               NULL_BOOL, GRAVITY_NONE, NULL_BOOL, NULL_REAL );
 #        endif
@@ -624,11 +726,11 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 #     ifdef GRAVITY
       case DT_GRA_SOLVER:
 #        ifdef GPU
-         CUAPI_Asyn_dtSolver( TSolver, h_dt_Array_T[ArrayID], NULL, NULL, h_Pot_Array_T[ArrayID], h_Corner_Array_G[ArrayID],
+         CUAPI_Asyn_dtSolver( TSolver, HOST_ARRAY_PATCH( h_dt_Array_T ), NULL, NULL, HOST_ARRAY_PATCH( h_Pot_Array_T ), HOST_ARRAY_PATCH( h_Corner_Array_G ),
                               NPG, dh, DT__GRAVITY, NULL_REAL, NULL_REAL, OPT__GRA_P5_GRADIENT, OPT__GRAVITY_TYPE, NULL_BOOL,
                               TimeNew, GPU_NSTREAM );
 #        else
-         CPU_dtSolver       ( TSolver, h_dt_Array_T[ArrayID], NULL, NULL, h_Pot_Array_T[ArrayID], h_Corner_Array_G[ArrayID],
+         CPU_dtSolver       ( TSolver, HOST_ARRAY_PATCH( h_dt_Array_T ), NULL, NULL, HOST_ARRAY_PATCH( h_Pot_Array_T ), HOST_ARRAY_PATCH( h_Corner_Array_G ),
                               NPG, dh, DT__GRAVITY, NULL_REAL, NULL_REAL, OPT__GRA_P5_GRADIENT, OPT__GRAVITY_TYPE, NULL_BOOL,
                               TimeNew );
 #        endif
@@ -676,10 +778,11 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 //                NPG        : Number of patch groups to be evaluated at a time
 //                PID0_List  : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID    : Array index to load and store data ( 0 or 1 )
+//                ArrayDisp  : Index of the first patch group in the host arrays (see TaskGraph_CPU())
 //                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR in Flu_Close())
 //-------------------------------------------------------------------------------------------------------
 void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                   const int NPG, const int *PID0_List, const int ArrayID, const double dt )
+                   const int NPG, const int *PID0_List, const int ArrayID, const int ArrayDisp, const double dt )
 {
 
 #  ifndef DUAL_ENERGY
@@ -700,41 +803,41 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
    switch ( TSolver )
    {
       case FLUID_SOLVER :
-         Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
-                    h_Flu_Array_F_Out[ArrayID], h_Mag_Array_F_Out[ArrayID], h_DE_Array_F_Out[ArrayID],
-                    NPG, PID0_List, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID], dt );
+         Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, HOST_ARRAY( h_Flux_Array ), HOST_ARRAY( h_Ele_Array ),
+                    HOST_ARRAY( h_Flu_Array_F_Out ), HOST_ARRAY( h_Mag_Array_F_Out ), HOST_ARRAY( h_DE_Array_F_Out ),
+                    NPG, PID0_List, HOST_ARRAY( h_Flu_Array_F_In ), HOST_ARRAY( h_Mag_Array_F_In ), dt );
       break;
 
 #     ifdef GRAVITY
       case POISSON_SOLVER :
-         Poi_Close( lv, SaveSg_Pot, h_Pot_Array_P_Out[ArrayID], NPG, PID0_List );
+         Poi_Close( lv, SaveSg_Pot, HOST_ARRAY_PATCH( h_Pot_Array_P_Out ), NPG, PID0_List );
       break;
 
       case GRAVITY_SOLVER :
-         Gra_Close( lv, SaveSg_Flu, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_EngyB_Array_G[ArrayID],
+         Gra_Close( lv, SaveSg_Flu, HOST_ARRAY_PATCH( h_Flu_Array_G ), HOST_ARRAY_PATCH( h_DE_Array_G ), HOST_ARRAY_PATCH( h_EngyB_Array_G ),
                     NPG, PID0_List );
       break;
 
       case POISSON_AND_GRAVITY_SOLVER :
-         Poi_Close( lv, SaveSg_Pot, h_Pot_Array_P_Out[ArrayID], NPG, PID0_List );
-         Gra_Close( lv, SaveSg_Flu, h_Flu_Array_G[ArrayID], h_DE_Array_G[ArrayID], h_EngyB_Array_G[ArrayID],
+         Poi_Close( lv, SaveSg_Pot, HOST_ARRAY_PATCH( h_Pot_Array_P_Out ), NPG, PID0_List );
+         Gra_Close( lv, SaveSg_Flu, HOST_ARRAY_PATCH( h_Flu_Array_G ), HOST_ARRAY_PATCH( h_DE_Array_G ), HOST_ARRAY_PATCH( h_EngyB_Array_G ),
                     NPG, PID0_List );
       break;
 #     endif
 
 #     ifdef SUPPORT_GRACKLE
       case GRACKLE_SOLVER :
-         Grackle_Close( lv, SaveSg_Flu, h_Che_Array[ArrayID], NPG, PID0_List );
+         Grackle_Close( lv, SaveSg_Flu, HOST_ARRAY( h_Che_Array ), NPG, PID0_List );
       break;
 #     endif
 
       case DT_FLU_SOLVER:
-         dt_Close( h_dt_Array_T[ArrayID], NPG );
+         dt_Close( HOST_ARRAY_PATCH( h_dt_Array_T ), NPG );
       break;
 
 #     ifdef GRAVITY
       case DT_GRA_SOLVER:
-         dt_Close( h_dt_Array_T[ArrayID], NPG );
+         dt_Close( HOST_ARRAY_PATCH( h_dt_Array_T ), NPG );
       break;
 #     endif
 
@@ -746,3 +849,578 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
 } // FUNCTION : Closing_Step
 
 
+
+
+
+#if ( !defined GPU  &&  defined OPENMP )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Pipeline_CPU
+// Description :  Pipelined version of the preparation --> solver --> closing sequence for the CPU solvers
+//
+// Note        :  1. Invoked by InvokeSolver() when OPT__CPU_PIPELINE is on and there are at least two batches
+//                   of patch groups
+//                2. Batch "b" is solved concurrently with closing batch "b-1" and then preparing batch "b+1"
+//                   --> Batches b-1 and b+1 share the same host array (1-ArrayID) while batch b uses ArrayID
+//                   --> The solvers only access the host arrays, and the preparation and closing steps of
+//                       different batches access different patches, so the two stages never touch the same data
+//                3. Use nested OpenMP with two outer threads
+//                   --> Outer thread 0 (i.e., the master thread) runs the preparation and closing steps with
+//                       CPU_PIPELINE_NTHREAD threads so that MPI calls (e.g., MPI_Barrier in TIMING_SYNC)
+//                       are still issued by the master thread
+//                   --> Outer thread 1 runs the solver with the remaining OMP_NTHREAD-CPU_PIPELINE_NTHREAD threads
+//                   --> The thread indices in the inner solver team never exceed OMP_NTHREAD, so the per-thread
+//                       scratch arrays of the CPU solvers remain valid
+//                4. Timing of the overlapped stages is recorded separately by Timer_Pipe_Wall/Sol/Host
+//                5. For LB_INPUT__MEASURED_COST, the two outer threads add the measured time of each stage to
+//                   different patch groups, so LB_AccumulateCost() can be called concurrently
+//
+// Parameter   :  TSolver ~ SaveSg_Pot : See InvokeSolver()
+//                NPG_Max              : Maximum number of patch groups in one batch
+//                NTotal               : Total number of patch groups to be updated
+//                PID0_List            : List recording the patch indices with LocalID==0 to be updated
+//-------------------------------------------------------------------------------------------------------
+void Pipeline_CPU( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld, const double dt,
+                   const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
+                   const int NPG_Max, const int NTotal, const int *PID0_List )
+{
+
+   const int NThread_Host = CPU_PIPELINE_NTHREAD;
+   const int NThread_Sol  = OMP_NTHREAD - CPU_PIPELINE_NTHREAD;
+   const int NBatch       = ( NTotal + NPG_Max - 1 ) / NPG_Max;
+
+   int ArrayID = 0;  // array index storing the batch being solved
+   int NPG[2];       // number of patch groups stored in each array
+
+
+// 1. prepare the first batch
+   NPG[ArrayID] = MIN( NPG_Max, NTotal );
+
+   TIMING_SYNC(   MEASURE_COST( Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], PID0_List, ArrayID, 0 ),
+                                lv, NPG[ArrayID], PID0_List ),
+                  Timer_Pre[lv][TSolver]  );
+
+
+// 2. solve batch b while closing batch b-1 and preparing batch b+1
+   for (int b=0; b<NBatch; b++)
+   {
+      const int Disp = b*NPG_Max;
+
+#     ifdef TIMING_SOLVER
+      Timer_Pipe_Wall[lv][TSolver]->Start();
+#     endif
+
+#     pragma omp parallel num_threads( 2 )
+      {
+//       2-1. preparation and closing steps on the master thread
+         if ( omp_get_thread_num() == 0 )
+         {
+#           ifdef TIMING_SOLVER
+            Timer_Pipe_Host[lv][TSolver]->Start();
+#           endif
+
+            omp_set_num_threads( NThread_Host );
+
+            if ( b > 0 )
+               MEASURE_COST( Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                                           NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, 0, dt ),
+                             lv, NPG[1-ArrayID], PID0_List+Disp-NPG_Max );
+
+            if ( b < NBatch-1 )
+            {
+               NPG[1-ArrayID] = MIN( NPG_Max, NTotal-Disp-NPG_Max );
+
+               MEASURE_COST( Preparation_Step( TSolver, lv, TimeNew, TimeOld, NPG[1-ArrayID], PID0_List+Disp+NPG_Max, 1-ArrayID, 0 ),
+                             lv, NPG[1-ArrayID], PID0_List+Disp+NPG_Max );
+            }
+
+#           ifdef TIMING_SOLVER
+            Timer_Pipe_Host[lv][TSolver]->Stop();
+#           endif
+         }
+
+//       2-2. solver
+         else
+         {
+#           ifdef TIMING_SOLVER
+            Timer_Pipe_Sol[lv][TSolver]->Start();
+#           endif
+
+            omp_set_num_threads( NThread_Sol );
+
+            MEASURE_COST( Solver( TSolver, lv, TimeNew, TimeOld, NPG[ArrayID], ArrayID, 0, dt, Poi_Coeff ),
+                          lv, NPG[ArrayID], PID0_List+Disp );
+
+#           ifdef TIMING_SOLVER
+            Timer_Pipe_Sol[lv][TSolver]->Stop();
+#           endif
+         }
+      } // OpenMP parallel region
+
+#     ifdef TIMING_SOLVER
+      Timer_Pipe_Wall[lv][TSolver]->Stop();
+#     endif
+
+      ArrayID = 1 - ArrayID;
+   } // for (int b=0; b<NBatch; b++)
+
+
+// 3. close the last batch, which is now stored in 1-ArrayID
+   TIMING_SYNC(   MEASURE_COST( Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                                              NPG[1-ArrayID], PID0_List+(NBatch-1)*NPG_Max, 1-ArrayID, 0, dt ),
+                                lv, NPG[1-ArrayID], PID0_List+(NBatch-1)*NPG_Max ),
+                  Timer_Clo[lv][TSolver]  );
+
+} // FUNCTION : Pipeline_CPU
+#endif // #if ( !defined GPU  &&  defined OPENMP )
+
+
+
+#if ( !defined GPU  &&  defined OPENMP )
+// maximum number of solvers chained in one task graph
+#define TASK_NSTAGE_MAX       2
+
+// minimum number of chunks per OpenMP thread in the task graph for load balancing
+#define TASK_NCHUNK_THREAD    4
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  TaskGraph_t
+// Description :  Task graph evaluated by TaskGraph_CPU()
+//
+// Data Member :  NStage ~ SaveSg_Pot : Solvers of all stages and their parameters (see TaskGraph_CPU())
+//                NPG_Chunk           : Maximum number of patch groups in one chunk
+//                NTotal              : Total number of patch groups to be updated
+//                PID0_List           : List recording the patch indices with LocalID==0 to be updated
+//                NChunk              : Number of chunks
+//                NbrBeg/List         : Chunks adjacent to the chunk "c" (including "c" itself)
+//                                      --> NbrList[ NbrBeg[c] ... NbrBeg[c+1]-1 ]
+//                NDep                : Number of unfinished dependencies of the chunk "c" at the stage "s"
+//                                      --> NDep[ s*NChunk + c ]
+//-------------------------------------------------------------------------------------------------------
+struct TaskGraph_t
+{
+   int        NStage;
+   Solver_t   TSolver[TASK_NSTAGE_MAX];
+   int        lv;
+   double     TimeNew, TimeOld, dt, Poi_Coeff;
+   int        SaveSg_Flu, SaveSg_Mag, SaveSg_Pot;
+
+   int        NPG_Chunk, NTotal;
+   const int *PID0_List;
+
+   int        NChunk;
+   int       *NbrBeg, *NbrList;
+   int       *NDep;
+};
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  TaskGraph_Supported
+// Description :  Return whether the target solver can be invoked by TaskGraph_CPU()
+//
+// Note        :  1. The closing steps of different chunks run concurrently, so solvers accumulating results in
+//                   shared variables (e.g., the dt solvers) or in global solver arrays (e.g., the Grackle solver)
+//                   are not supported
+//                2. With particles, the Poisson solver is not supported since Prepare_PatchData() deposits particle
+//                   mass onto the rho_ext[] arrays of the sibling patches, which may be shared by different chunks
+//                3. For MHD, the fluid solver is not supported since CorrectElectric() in the closing step updates
+//                   the coarse-grid E field on the patch edges shared by the fine patch groups of different chunks
+//                4. With OPT__GRAVITY_EXTRA_MASS, the Poisson solver is not supported since Poi_Prepare_Rho()
+//                   invokes the user-specified Poi_AddExtraMassForGravity_Ptr(), which is not required to be thread-safe
+//
+// Parameter   :  TSolver : Target solver
+//-------------------------------------------------------------------------------------------------------
+bool TaskGraph_Supported( const Solver_t TSolver )
+{
+
+   switch ( TSolver )
+   {
+      case FLUID_SOLVER:
+#        ifdef MHD
+                                          return false;
+#        else
+                                          return true;
+#        endif
+
+#     ifdef GRAVITY
+      case GRAVITY_SOLVER:                return true;
+
+      case POISSON_SOLVER:
+      case POISSON_AND_GRAVITY_SOLVER:
+#        ifdef PARTICLE
+                                          return false;
+#        else
+                                          return !OPT__GRAVITY_EXTRA_MASS;
+#        endif
+#     endif
+
+      default:                            return false;
+   }
+
+} // FUNCTION : TaskGraph_Supported
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  TaskGraph_CPU
+// Description :  Dependency-driven version of the preparation --> solver --> closing sequence for the CPU solvers
+//
+// Note        :  1. Invoked by InvokeSolver() and InvokeSolver_TaskGraph() when OPT__TASK_GRAPH is on
+//                2. Patch groups are divided into chunks of at most NPG_Chunk patch groups, and each stage of each
+//                   chunk is an OpenMP task running the preparation, solver, and closing steps of TSolver[Stage]
+//                   --> There is no barrier between the steps of different chunks, so a thread finishing a chunk
+//                       moves on to the next ready chunk instead of waiting for the slowest thread in each step
+//                3. Stage "s>0" of a chunk depends on stage "s-1" of all chunks containing its sibling patch groups
+//                   --> Each task counts down the dependencies of the adjacent chunks at the next stage when it
+//                       finishes and spawns the chunks with no dependency left
+//                   --> The adjacency is symmetric since the sibling relation between real patches is symmetric
+//                   --> Sibling patch groups not in PID0_List[] (e.g., buffer patches) are ignored
+//                4. The task running on thread "t" uses the patch groups [t*NPG_Chunk, (t+1)*NPG_Chunk-1] in the
+//                   host arrays of ArrayID=0 (NPG_Chunk*OMP_NTHREAD <= NPG_Max)
+//                   --> The host arrays storing one element per patch (e.g., the Poisson/gravity solvers) are
+//                       offset by 8*ArrayDisp instead of ArrayDisp (see HOST_ARRAY_PATCH)
+//                   --> Tasks are tied and the only task scheduling points in a task are after its closing step,
+//                       so no two tasks use the same patch groups in the host arrays at the same time
+//                   --> Each task invokes the preparation, solver, and closing steps with a single thread, and the
+//                       CPU solvers use the per-thread arrays of the thread running the task
+//                5. The CPU solvers evaluate each patch group independently, so the results are bitwise identical
+//                   to those of InvokeSolver() without OPT__TASK_GRAPH
+//                6. For LB_INPUT__MEASURED_COST, different tasks add the measured time to different patch groups,
+//                   so LB_AccumulateCost() can be called concurrently
+//
+// Parameter   :  NStage               : Number of solvers invoked in sequence on each chunk
+//                TSolver              : Solvers of all stages
+//                lv ~ SaveSg_Pot      : See InvokeSolver()
+//                NPG_Max              : Maximum number of patch groups stored in one host array
+//                NTotal               : Total number of patch groups to be updated
+//                PID0_List            : List recording the patch indices with LocalID==0 to be updated
+//-------------------------------------------------------------------------------------------------------
+void TaskGraph_CPU( const int NStage, const Solver_t TSolver[], const int lv, const double TimeNew, const double TimeOld,
+                    const double dt, const double Poi_Coeff, const int SaveSg_Flu, const int SaveSg_Mag,
+                    const int SaveSg_Pot, const int NPG_Max, const int NTotal, const int *PID0_List )
+{
+
+#  ifdef GAMER_DEBUG
+   if ( NStage < 1  ||  NStage > TASK_NSTAGE_MAX )
+      Aux_Error( ERROR_INFO, "incorrect NStage (%d) !!\n", NStage );
+
+   if ( NPG_Max < OMP_NTHREAD )
+      Aux_Error( ERROR_INFO, "NPG_Max (%d) < OMP_NTHREAD (%d) !!\n", NPG_Max, OMP_NTHREAD );
+#  endif
+
+
+// 1. set the parameters
+   TaskGraph_t Graph;
+
+   Graph.NStage     = NStage;
+   for (int s=0; s<NStage; s++)  Graph.TSolver[s] = TSolver[s];
+   Graph.lv         = lv;
+   Graph.TimeNew    = TimeNew;
+   Graph.TimeOld    = TimeOld;
+   Graph.dt         = dt;
+   Graph.Poi_Coeff  = Poi_Coeff;
+   Graph.SaveSg_Flu = SaveSg_Flu;
+   Graph.SaveSg_Mag = SaveSg_Mag;
+   Graph.SaveSg_Pot = SaveSg_Pot;
+   Graph.NPG_Chunk  = MAX(  1, MIN( NPG_Max/OMP_NTHREAD, NTotal/(TASK_NCHUNK_THREAD*OMP_NTHREAD) )  );
+   Graph.NTotal     = NTotal;
+   Graph.PID0_List  = PID0_List;
+   Graph.NChunk     = ( NTotal + Graph.NPG_Chunk - 1 ) / Graph.NPG_Chunk;
+   Graph.NbrBeg     = new int [ Graph.NChunk + 1 ];
+   Graph.NbrList    = NULL;
+   Graph.NDep       = new int [ NStage*Graph.NChunk ];
+
+
+// 2. find the adjacent chunks of each chunk (only necessary for multiple stages)
+   for (int c=0; c<=Graph.NChunk; c++)    Graph.NbrBeg[c] = 0;
+
+   if ( NStage > 1 )
+   {
+      const int NPG_All    = amr->num[lv] / 8;
+      int *PG2Chunk        = new int [NPG_All];
+      int *LastNbr         = new int [Graph.NChunk];
+
+      for (int t=0; t<NPG_All;      t++)   PG2Chunk[t] = -1;
+      for (int t=0; t<NTotal;       t++)   PG2Chunk[ PID0_List[t]/8 ] = t / Graph.NPG_Chunk;
+
+//    count the adjacent chunks in the first pass and record them in the second pass
+      for (int Pass=0; Pass<2; Pass++)
+      {
+         if ( Pass == 1 )
+         {
+            for (int c=0; c<Graph.NChunk; c++)  Graph.NbrBeg[c+1] += Graph.NbrBeg[c];
+
+            Graph.NbrList = new int [ Graph.NbrBeg[Graph.NChunk] ];
+         }
+
+         for (int c=0; c<Graph.NChunk; c++)  LastNbr[c] = -1;
+
+         for (int c=0; c<Graph.NChunk; c++)
+         {
+            int NNbr = 0;
+
+            for (int t=c*Graph.NPG_Chunk; t<MIN( (c+1)*Graph.NPG_Chunk, NTotal ); t++)
+            for (int PID=PID0_List[t]; PID<PID0_List[t]+8; PID++)
+            for (int s=-1; s<26; s++)
+            {
+//             s == -1 --> the patch itself
+               const int SibPID = ( s < 0 ) ? PID : amr->patch[0][lv][PID]->sibling[s];
+               if ( SibPID < 0 )    continue;
+
+               const int NbrChunk = PG2Chunk[ SibPID/8 ];
+               if ( NbrChunk < 0  ||  LastNbr[NbrChunk] == c )    continue;
+
+               LastNbr[NbrChunk] = c;
+
+               if ( Pass == 0 )  Graph.NbrBeg[c+1] ++;
+               else              Graph.NbrList[ Graph.NbrBeg[c] + NNbr ] = NbrChunk;
+
+               NNbr ++;
+            }
+         } // for (int c=0; c<Graph.NChunk; c++)
+      } // for (int Pass=0; Pass<2; Pass++)
+
+      delete [] PG2Chunk;
+      delete [] LastNbr;
+   } // if ( NStage > 1 )
+
+
+// 3. initialize the number of dependencies
+   for (int s=0; s<NStage; s++)
+   for (int c=0; c<Graph.NChunk; c++)
+      Graph.NDep[ s*Graph.NChunk + c ] = ( s == 0 ) ? 0 : Graph.NbrBeg[c+1] - Graph.NbrBeg[c];
+
+
+// 4. spawn the first stage of all chunks
+//    --> later stages are spawned by TaskGraph_Node()
+#  pragma omp parallel num_threads( OMP_NTHREAD )
+   {
+#     pragma omp single
+      {
+         for (int c=0; c<Graph.NChunk; c++)
+         {
+#           pragma omp task firstprivate( c )
+            TaskGraph_Node( &Graph, 0, c );
+         }
+      }
+   } // OpenMP parallel region
+
+
+// 5. check that all tasks have been executed
+#  ifdef GAMER_DEBUG
+   for (int t=0; t<NStage*Graph.NChunk; t++)
+      if ( Graph.NDep[t] != 0 )
+         Aux_Error( ERROR_INFO, "stage %d of chunk %d has %d unfinished dependencies !!\n",
+                    t/Graph.NChunk, t%Graph.NChunk, Graph.NDep[t] );
+#  endif
+
+   delete [] Graph.NbrBeg;
+   delete [] Graph.NbrList;
+   delete [] Graph.NDep;
+
+} // FUNCTION : TaskGraph_CPU
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  TaskGraph_Node
+// Description :  Advance one stage of one chunk in TaskGraph_CPU() and spawn the chunks of the next stage
+//                depending on it
+//
+// Note        :  1. Invoked by TaskGraph_CPU() and itself as OpenMP tasks
+//
+// Parameter   :  Graph : Task graph
+//                Stage : Target stage
+//                Chunk : Target chunk
+//-------------------------------------------------------------------------------------------------------
+void TaskGraph_Node( TaskGraph_t *Graph, const int Stage, const int Chunk )
+{
+
+   const Solver_t TSolver   = Graph->TSolver[Stage];
+   const int      lv        = Graph->lv;
+   const int      ArrayID   = 0;
+   const int      ArrayDisp = omp_get_thread_num()*Graph->NPG_Chunk;
+   const int      Disp      = Chunk*Graph->NPG_Chunk;
+   const int      NPG       = MIN( Graph->NPG_Chunk, Graph->NTotal-Disp );
+   const int     *PID0_List = Graph->PID0_List + Disp;
+
+
+// 1. advance this chunk
+//    --> the OpenMP parallel regions in the following steps are executed by the thread running this task only
+   omp_set_num_threads( 1 );
+
+   MEASURE_COST( Preparation_Step( TSolver, lv, Graph->TimeNew, Graph->TimeOld, NPG, PID0_List, ArrayID, ArrayDisp ),
+                 lv, NPG, PID0_List );
+
+   MEASURE_COST( Solver( TSolver, lv, Graph->TimeNew, Graph->TimeOld, NPG, ArrayID, ArrayDisp, Graph->dt, Graph->Poi_Coeff ),
+                 lv, NPG, PID0_List );
+
+   MEASURE_COST( Closing_Step( TSolver, lv, Graph->SaveSg_Flu, Graph->SaveSg_Mag, Graph->SaveSg_Pot,
+                               NPG, PID0_List, ArrayID, ArrayDisp, Graph->dt ),
+                 lv, NPG, PID0_List );
+
+
+// 2. count down the dependencies of the adjacent chunks at the next stage
+   if ( Stage+1 < Graph->NStage )
+   {
+      for (int t=Graph->NbrBeg[Chunk]; t<Graph->NbrBeg[Chunk+1]; t++)
+      {
+         const int NbrChunk = Graph->NbrList[t];
+         int NDep_Left;
+
+#        pragma omp atomic capture
+         NDep_Left = -- Graph->NDep[ (Stage+1)*Graph->NChunk + NbrChunk ];
+
+         if ( NDep_Left == 0 )
+         {
+#           pragma omp task firstprivate( NbrChunk )
+            TaskGraph_Node( Graph, Stage+1, NbrChunk );
+         }
+      }
+   }
+
+} // FUNCTION : TaskGraph_Node
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  InvokeSolver_TaskGraph
+// Description :  Invoke two CPU solvers at the same level in one task graph so that the second solver starts on
+//                a chunk of patch groups as soon as the first solver has updated the chunk and its adjacent chunks
+//
+// Note        :  1. Invoked by FluGra_AdvanceDt() for OPT__TASK_GRAPH
+//                2. The caller must ensure that
+//                   --> The second solver only requires the data updated by the first solver in the sibling
+//                       patch groups
+//                   --> No other operation (e.g., buffer-data exchange) is required between the two solvers
+//                   --> Prepare_PatchData() can find the input data of both solvers
+//                       (e.g., by setting FluSg/FluSgTime to the updated fluid data in advance)
+//                3. Does not support OverlapMPI and OPT__FLU_CLUSTER
+//                4. See TaskGraph_CPU() for the task graph
+//
+// Parameter   :  TSolver1        : Solver of the first stage
+//                TSolver2        : Solver of the second stage
+//                lv ~ SaveSg_Pot : See InvokeSolver()
+//-------------------------------------------------------------------------------------------------------
+void InvokeSolver_TaskGraph( const Solver_t TSolver1, const Solver_t TSolver2, const int lv, const double TimeNew,
+                             const double TimeOld, const double dt, const double Poi_Coeff, const int SaveSg_Flu,
+                             const int SaveSg_Mag, const int SaveSg_Pot )
+{
+
+   const Solver_t TSolver[2] = { TSolver1, TSolver2 };
+
+// check
+   if ( !OPT__TASK_GRAPH )
+      Aux_Error( ERROR_INFO, "%s requires OPT__TASK_GRAPH !!\n", __FUNCTION__ );
+
+   for (int s=0; s<2; s++)
+      if ( !TaskGraph_Supported(TSolver[s]) )
+         Aux_Error( ERROR_INFO, "solver %d does not support OPT__TASK_GRAPH !!\n", TSolver[s] );
+
+
+// use the smaller number of patch groups of the host arrays of the two solvers
+   int NPG_Max = FLU_GPU_NPGROUP;
+
+#  ifdef GRAVITY
+   for (int s=0; s<2; s++)
+      if ( TSolver[s] != FLUID_SOLVER )   NPG_Max = MIN( NPG_Max, POT_GPU_NPGROUP );
+#  endif
+
+   const int NTotal    = amr->NPatchComma[lv][1] / 8;
+   int      *PID0_List = new int [NTotal];
+
+   for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
+
+   if ( NTotal > 0 )
+      TaskGraph_CPU( 2, TSolver, lv, TimeNew, TimeOld, dt, Poi_Coeff, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
+                     NPG_Max, NTotal, PID0_List );
+
+   delete [] PID0_List;
+
+} // FUNCTION : InvokeSolver_TaskGraph
+#endif // #if ( !defined GPU  &&  defined OPENMP )
+
+
+
+#ifdef FLU_CLUSTER
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_AdvanceCluster
+// Description :  Advance the clusters of FLU_CLU_NPG^3 patch groups by the cluster fluid solver
+//
+// Note        :  1. Invoked by InvokeSolver() when OPT__FLU_CLUSTER is on
+//                2. The patch groups advanced successfully are removed from PID0_List[]
+//                   --> The remaining patch groups, including those in the clusters with unphysical results,
+//                       must be advanced by the patch-group solver afterwards
+//                3. Clusters are evaluated in batches of at most FLU_GPU_NPGROUP patch groups
+//
+// Parameter   :  lv         : Target refinement level
+//                TimeOld    : Physical time before update
+//                dt         : Time interval to advance solution
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//                NTotal     : Total number of patch groups to be updated (call-by-reference)
+//                PID0_List  : List recording the patch indices with LocalID==0 to be updated
+//-------------------------------------------------------------------------------------------------------
+void Flu_AdvanceCluster( const int lv, const double TimeOld, const double dt, const int SaveSg_Flu,
+                         int &NTotal, int *PID0_List )
+{
+
+   const int  NPG_Clu  = CUBE( FLU_CLU_NPG );
+   const int  NClu_Max = MAX( 1, FLU_GPU_NPGROUP/NPG_Clu );
+   const real dh       = amr->dh[lv];
+
+#  ifndef DUAL_ENERGY
+   const double DUAL_ENERGY_SWITCH = NULL_REAL;
+   char (*h_DE_Array_C_Out)[ CUBE(FLU_CLU_NOUT) ] = NULL;
+#  endif
+
+#  ifdef GRAVITY
+   const real JeansMinPres_Coeff = ( JEANS_MIN_PRES ) ?
+                                   NEWTON_G*SQR(JEANS_MIN_PRES_NCELL*amr->dh[JEANS_MIN_PRES_LEVEL])/(GAMMA*M_PI) : NULL_REAL;
+#  else
+   const real JEANS_MIN_PRES     = false;
+   const real JeansMinPres_Coeff = NULL_REAL;
+#  endif
+
+
+   int *Clu_PID0_List = new int [NTotal];
+   const int NClu     = Flu_FindCluster( lv, TimeOld, NTotal, PID0_List, Clu_PID0_List );
+
+   for (int Disp=0; Disp<NClu; Disp+=NClu_Max)
+   {
+      const int  NClu_Batch = MIN( NClu_Max, NClu-Disp );
+      const int  NPG_Batch  = NClu_Batch*NPG_Clu;
+      const int *Clu_PID0   = Clu_PID0_List + Disp*NPG_Clu;
+
+//-------------------------------------------------------------------------------------------------------------
+      TIMING_SYNC(   MEASURE_COST( Flu_Prepare_Cluster( lv, TimeOld, h_Flu_Array_C_In, NClu_Batch, Clu_PID0 ),
+                                   lv, NPG_Batch, Clu_PID0 ),
+                     Timer_Pre[lv][FLUID_SOLVER]  );
+//-------------------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------------------
+      TIMING_SYNC(   MEASURE_COST( CPU_FluidSolver_Cluster( h_Flu_Array_C_In, h_Flu_Array_C_Out, h_DE_Array_C_Out,
+                                                            NClu_Batch, dt, dh, GAMMA, OPT__LR_LIMITER, MINMOD_COEFF,
+                                                            OPT__LR_SCHEME, OPT__RSOLVER,
+                                                            MIN_DENS, MIN_PRES, DUAL_ENERGY_SWITCH,
+                                                            OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx,
+                                                            JEANS_MIN_PRES, JeansMinPres_Coeff,
+                                                            ( OPT__FLU_FUSED ) ? FLU_FUSED_SLAB : 0 ),
+                                   lv, NPG_Batch, Clu_PID0 ),
+                     Timer_Sol[lv][FLUID_SOLVER]  );
+//-------------------------------------------------------------------------------------------------------------
+
+
+//-------------------------------------------------------------------------------------------------------------
+//    the patch groups of the failed clusters are appended to PID0_List to be advanced again
+      TIMING_SYNC(   MEASURE_COST( NTotal += Flu_Close_Cluster( lv, SaveSg_Flu, h_Flu_Array_C_Out, h_DE_Array_C_Out,
+                                                                NClu_Batch, Clu_PID0, PID0_List+NTotal ),
+                                   lv, NPG_Batch, Clu_PID0 ),
+                     Timer_Clo[lv][FLUID_SOLVER]  );
+//-------------------------------------------------------------------------------------------------------------
+   } // for (int Disp=0; Disp<NClu; Disp+=NClu_Max)
+
+   delete [] Clu_PID0_List;
+
+} // FUNCTION : Flu_AdvanceCluster
+#endif // #ifdef FLU_CLUSTER
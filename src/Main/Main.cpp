@@ -52,16 +52,20 @@ double               OUTPUT_PART_X, OUTPUT_PART_Y, OUTPUT_PART_Z, AUTO_REDUCE_DT
 double               OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_V, UNIT_D, UNIT_E, UNIT_P;
 int                  OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK, OPT__GPUID_SELECT, OPT__PATCH_COUNT;
 int                  INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK;
+int                  CPU_PIPELINE_NTHREAD, MEMORY_POOL_WINDOW, FLU_FUSED_SLAB, AUTO_REDUCE_DT_LOCAL;
+double               MEMORY_POOL_SHRINK;
 bool                 OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION;
-bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+bool                 OPT__DT_USER, OPT__DT_CFL_CACHE, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+bool                 OPT__FIELD_BANK;
 bool                 OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
-bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
+bool                 OPT__INT_TIME, OPT__GHOST_CACHE, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 bool                 OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 bool                 OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
 bool                 OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
 bool                 OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
 bool                 OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
-bool                 OPT__RECORD_NOTE, OPT__RECORD_UNPHY;
+bool                 OPT__RECORD_NOTE, OPT__RECORD_UNPHY, OPT__CPU_PIPELINE, OPT__FLU_FUSED, OPT__TASK_GRAPH;
+bool                 OPT__FLU_CLUSTER;
 UM_IC_Format_t       OPT__UM_IC_FORMAT;
 TestProbID_t         TESTPROB_ID;
 OptInit_t            OPT__INIT;
@@ -81,6 +85,8 @@ OptTimeStepLevel_t   OPT__DT_LEVEL;
 double               FlagTable_PresGradient[NLEVEL-1], FlagTable_Vorticity[NLEVEL-1], FlagTable_Jeans[NLEVEL-1];
 double               GAMMA, MINMOD_COEFF, MOLECULAR_WEIGHT;
 LR_Limiter_t         OPT__LR_LIMITER;
+OptLRScheme_t        OPT__LR_SCHEME;
+OptRSolver_t         OPT__RSOLVER;
 Opt1stFluxCorr_t     OPT__1ST_FLUX_CORR;
 OptRSolver1st_t      OPT__1ST_FLUX_CORR_SCHEME;
 bool                 OPT__FLAG_PRES_GRADIENT, OPT__FLAG_LOHNER_ENGY, OPT__FLAG_LOHNER_PRES, OPT__FLAG_LOHNER_TEMP;
@@ -144,7 +150,9 @@ double               LB_INPUT__WLI_MAX;
 #ifdef PARTICLE
 double               LB_INPUT__PAR_WEIGHT;
 #endif
-bool                 OPT__RECORD_LOAD_BALANCE;
+bool                 LB_INPUT__MEASURED_COST;
+bool                 LB_INPUT__INCREMENTAL;
+bool                 OPT__RECORD_LOAD_BALANCE, OPT__LB_CUT_BENCHMARK;
 #endif
 bool                 OPT__MINIMIZE_MPI_BARRIER;
 
@@ -209,11 +217,18 @@ real (*h_Mag_Array_F_In [2])[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ] = { NULL, NUL
 real (*h_Mag_Array_F_Out[2])[NCOMP_MAG][ PS2P1*SQR(PS2)          ] = { NULL, NULL };
 real (*h_Ele_Array      [2])[9][NCOMP_ELE][ PS2P1*PS2 ]            = { NULL, NULL };
 #endif
+#ifdef FLU_CLUSTER
+real (*h_Flu_Array_C_In )[FLU_NIN ][ CUBE(FLU_CLU_NXT) ]           = NULL;
+real (*h_Flu_Array_C_Out)[FLU_NOUT][ CUBE(FLU_CLU_NOUT) ]          = NULL;
+#ifdef DUAL_ENERGY
+char (*h_DE_Array_C_Out )[ CUBE(FLU_CLU_NOUT) ]                    = NULL;
+#endif
+#endif
 #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-real (*h_PriVar)      [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT)     ]  = NULL;
-real (*h_Slope_PPM)[3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ]  = NULL;
-real (*h_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ]  = NULL;
-real (*h_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ]  = NULL;
+real (*h_PriVar)      [NCOMP_LR][ CUBE(FLU_NXT)     ]  = NULL;
+real (*h_Slope_PPM)[3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ]  = NULL;
+real (*h_FC_Var)   [6][NCOMP_LR][ CUBE(N_FC_VAR)    ]  = NULL;
+real (*h_FC_Flux)  [3][NCOMP_LR][ CUBE(N_FC_FLUX)   ]  = NULL;
 #ifdef MHD
 real (*h_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ]        = NULL;
 real (*h_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ]        = NULL;
@@ -277,10 +292,10 @@ real (*d_Mag_Array_F_Out)[NCOMP_MAG][ PS2P1*SQR(PS2)          ]   = NULL;
 real (*d_Ele_Array      )[9][NCOMP_ELE][ PS2P1*PS2 ]              = NULL;
 #endif
 #if ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP  ||  FLU_SCHEME == CTU )
-real (*d_PriVar)      [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT)     ] = NULL;
-real (*d_Slope_PPM)[3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ] = NULL;
-real (*d_FC_Var)   [6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = NULL;
-real (*d_FC_Flux)  [3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = NULL;
+real (*d_PriVar)      [NCOMP_LR][ CUBE(FLU_NXT)     ] = NULL;
+real (*d_Slope_PPM)[3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ] = NULL;
+real (*d_FC_Var)   [6][NCOMP_LR][ CUBE(N_FC_VAR)    ] = NULL;
+real (*d_FC_Flux)  [3][NCOMP_LR][ CUBE(N_FC_FLUX)   ] = NULL;
 #ifdef MHD
 real (*d_FC_Mag_Half)[NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ]       = NULL;
 real (*d_EC_Ele     )[NCOMP_MAG][ CUBE(N_EC_ELE)          ]       = NULL;
@@ -353,6 +368,9 @@ Timer_t *Timer_Poi_PreRho  [NLEVEL];
 Timer_t *Timer_Poi_PreFlu  [NLEVEL];
 Timer_t *Timer_Poi_PrePot_C[NLEVEL];
 Timer_t *Timer_Poi_PrePot_F[NLEVEL];
+Timer_t *Timer_Pipe_Wall   [NLEVEL][NSOLVER];
+Timer_t *Timer_Pipe_Sol    [NLEVEL][NSOLVER];
+Timer_t *Timer_Pipe_Host   [NLEVEL][NSOLVER];
 #endif
 
 
@@ -502,6 +520,9 @@ int main( int argc, char *argv[] )
          {
             Aux_Message( stdout, "Weighted load-imbalance factor (%13.7e) > threshold (%13.7e) ",
                          amr->LB->WLI, amr->LB->WLI_Max );
+            if ( amr->LB->Incremental )
+            Aux_Message( stdout, "--> migrating patches between neighboring ranks ...\n" );
+            else
             Aux_Message( stdout, "--> redistributing all patches ...\n" );
          }
 
@@ -513,8 +534,21 @@ int main( int argc, char *argv[] )
          const double ParWeight        = 0.0;
 #        endif
          const int    AllLv            = -1;
+         const double Time_LB0         = MPI_Wtime();
+         int          NLv_LB           = AllLv;
+
+         amr->LB->Moved_NPatch = 0;
+         amr->LB->Moved_NByte  = 0;
 
-         LB_Init_LoadBalance( Redistribute_Yes, ParWeight, ResetLB_Yes, AllLv );
+         if ( amr->LB->Incremental )
+            NLv_LB = LB_Incremental_LoadBalance( ParWeight );
+         else
+            LB_Init_LoadBalance( Redistribute_Yes, ParWeight, ResetLB_Yes, AllLv );
+
+//       start a new measurement window for LB_INPUT__MEASURED_COST
+         for (int lv=0; lv<NLEVEL; lv++)     LB_ResetCost( lv );
+
+         if ( OPT__RECORD_LOAD_BALANCE )     LB_Record_Rebalance( NLv_LB, MPI_Wtime()-Time_LB0 );
 
          if ( OPT__PATCH_COUNT > 0 )         Aux_Record_PatchCount();
 
@@ -572,6 +606,9 @@ int main( int argc, char *argv[] )
    Aux_AccumulatedTiming( Timer_Total.GetValue(), Timer_Init.GetValue(), Timer_Other.GetValue() );
 #  endif
 
+// record the statistics of the patch groups retried by AUTO_REDUCE_DT_LOCAL
+   if ( AUTO_REDUCE_DT  &&  AUTO_REDUCE_DT_LOCAL > 1 )   Flu_RecordRetry();
+
    if ( MPI_Rank == 0  &&  OPT__RECORD_NOTE )
    {
       FILE *Note = fopen( "Record__Note", "a" );
@@ -10,9 +10,9 @@ void InterpolateGhostZone( const int lv, const int PID, real IntData_CC[], real
                            const bool IntPhase, const OptFluBC_t FluBC[], const OptPotBC_t PotBC,
                            const int BC_Face[], const real MinPres, const bool DE_Consistency,
                            const real *FInterface[6] );
-static void SetTargetSibling( int NTSib[], int *TSib[] );
+static void SetTargetSibling( int NTSib[], int *TSib[], int TSib_Data[] );
 static int Table_01( const int SibID, const char dim, const int Count, const int GhostSize );
-static int Table_02( const int lv, const int PID, const int Side );
+int Table_02( const int lv, const int PID, const int Side );
 void SetTempIntPara( const int lv, const int Sg_Current, const double PrepTime, const double Time0, const double Time1,
                      bool &IntTime, int &Sg, int &Sg_IntT, real &Weighting, real &Weighting_IntT );
 #ifdef MHD
@@ -96,6 +96,8 @@ static void MHD_CheckDivB( const real *Data1PG_FC, const int GhostSize, const re
 //                            field on the coarse-fine interfaces of the central patch group
 //                        --> It's OK for the MHD solver since it will still guarantee that the updated B field within the patch group
 //                            is divergence free
+//                11. Coarse-fine ghost zones of each variable interpolated at the same level and with the same signature
+//                    are reused for OPT__GHOST_CACHE (see Prepare_PatchData_GhostCache.cpp)
 //
 // Parameter   :  lv             : Target refinement level
 //                PrepTime       : Target physical time to prepare data
@@ -337,10 +339,10 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 // TVarCCIdxList_Flu: list recording the target cell-centered fluid and passive variable indices (e.g., [0 ... NCOMP_TOTAL-1] )
 // TVarCCList_Der   : list recording the target cell-centered derived variable (e.g., _VELX, _PRES)
 // TVarFCIdxList    : list recording the target face-centered variable indices (e.g., [0 ... NCOMP_MAG-1])
-   int NTSib[26], *TSib[26], NVarCC_Flu, NVarCC_Der, NVarCC_Tot, TVarCCIdxList_Flu[NCOMP_TOTAL];
+   int NTSib[26], *TSib[26], TSib_Data[26*17], NVarCC_Flu, NVarCC_Der, NVarCC_Tot, TVarCCIdxList_Flu[NCOMP_TOTAL];
 
 // set up the target sibling indices for InterpolateGhostZone()
-   SetTargetSibling( NTSib, TSib );
+   SetTargetSibling( NTSib, TSib, TSib_Data );
 
 // determine the cell-centered fluid components to be prepared
 // --> assuming that _VAR_NAME = 1L<<VAR_NAME (e.g., _DENS == 1L<<DENS)
@@ -528,7 +530,7 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
       int NearBy_PID_List[NNearByPatchMax];
       int NPar, NNearByPatch;
 
-      ParMass_PID_List = new int [ParMass_NPatchMax];
+      ParMass_PID_List = (int*)Aux_Scratch_Get( SCRATCH_PREP_PARMASS, (long)ParMass_NPatchMax*sizeof(int) );
 
       for (int TID=0; TID<NPG; TID++)
       {
@@ -614,6 +616,16 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 #  endif // #ifdef PARTICLE
 
 
+// look up the cached coarse-fine ghost zones for OPT__GHOST_CACHE
+// --> GhostCacheKey[]: cache key of each cell-centered variable (fluid + derived + potential)
+   int GhostCacheKey[ NCOMP_TOTAL + NDERIVE + 1 ];
+
+   const int GhostCacheSig = Prepare_PatchData_GhostCache_GetSig( lv, PrepTime, GhostSize, TVarCC, NVarCC_Tot,
+                                                                  NVarCC_Flu, TVarCCIdxList_Flu, NVarCC_Der, TVarCCList_Der,
+                                                                  NVarFC_Tot, IntScheme_CC, IntPhase, FluBC, PotBC, MinPres,
+                                                                  DE_Consistency, GhostCacheKey );
+
+
 // start to prepare data
 #  pragma omp parallel
    {
@@ -628,24 +640,32 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 //                   (including the ghost-zone data)
 //    --> for PrepUnit == UNIT_PATCHGROUP, these pointers point to OutputCC/FC directly (which will be set later)
 //        for PrepUnit == UNIT_PATCH, these arrays will be copied to different patches in OutputCC/FC later
-      real *Data1PG_CC     = ( PrepUnit == UNIT_PATCH ) ? new real [ NVarCC_Tot*PGSize3D_CC ] : NULL;
+//    --> all temporary arrays in this parallel region are thread-private scratch buffers allocated by
+//        Aux_Scratch_Init() and reused across calls, so they must not be freed here
+      real *Data1PG_CC     = ( PrepUnit == UNIT_PATCH ) ?
+                             (real*)Aux_Scratch_Get( SCRATCH_PREP_DATA1PG_CC, (long)NVarCC_Tot*PGSize3D_CC*sizeof(real) ) : NULL;
       real *Data1PG_CC_Ptr = NULL;
-      real *Data1PG_FC     = ( PrepUnit == UNIT_PATCH ) ? new real [ NVarFC_Tot*PGSize3D_FC ] : NULL;
+      real *Data1PG_FC     = ( PrepUnit == UNIT_PATCH ) ?
+                             (real*)Aux_Scratch_Get( SCRATCH_PREP_DATA1PG_FC, (long)NVarFC_Tot*PGSize3D_FC*sizeof(real) ) : NULL;
       real *Data1PG_FC_Ptr = NULL;
 
 
 //    IntData_CC/FC: arrays to store the interpolated cell-/face-centered results
-//    --> allocate it only once but with the maximum required size to reduce the number of memory allocations
-      real *IntData_CC = new real [ NVarCC_Tot*PS2*PS2*(GhostSize_Padded  ) ];
-      real *IntData_FC = new real [ NVarFC_Tot*PS2*PS2*(GhostSize_Padded+1) ];
+//    --> use the maximum required size
+      real *IntData_CC = (real*)Aux_Scratch_Get( SCRATCH_PREP_INTDATA_CC,
+                                                 (long)NVarCC_Tot*PS2*PS2*(GhostSize_Padded  )*sizeof(real) );
+      real *IntData_FC = (real*)Aux_Scratch_Get( SCRATCH_PREP_INTDATA_FC,
+                                                 (long)NVarFC_Tot*PS2*PS2*(GhostSize_Padded+1)*sizeof(real) );
 
 
 //    B field on the coarse-fine interfaces for the divergence-preserving interpolation
-//    --> allocate it only once but with the maximum required size to reduce the number of memory allocations
+//    --> use the maximum required size
 #     ifdef MHD
       real *FInterface_Data = NULL;
 
-      if ( NVarFC_Tot > 0 )   FInterface_Data = new real [ SQR(PS2) + 4*PS2*GhostSize_Padded ];
+      if ( NVarFC_Tot > 0 )
+         FInterface_Data = (real*)Aux_Scratch_Get( SCRATCH_PREP_FINTERFACE,
+                                                   (long)( SQR(PS2) + 4*PS2*GhostSize_Padded )*sizeof(real) );
 #     endif
 
 
@@ -1375,11 +1395,21 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
 
 
 //             (b2-3) perform interpolation and store the results in IntData_CC[] and IntData_FC[]
-               InterpolateGhostZone( lv-1, FaSibPID, IntData_CC, IntData_FC, Side, PrepTime, GhostSize,
-                                     IntScheme_CC, IntScheme_FC, NTSib, TSib, TVarCC, NVarCC_Tot, NVarCC_Flu,
-                                     TVarCCIdxList_Flu, NVarCC_Der, TVarCCList_Der, TVarFC, NVarFC_Tot, TVarFCIdxList,
-                                     IntPhase, FluBC, PotBC, BC_Face, MinPres, DE_Consistency,
-                                     (const real **)FInterface_Ptr );
+//             --> reuse the results of a previous preparation with the same signature for OPT__GHOST_CACHE
+               const int FSize3D = FSize[0]*FSize[1]*FSize[2];
+
+               if (  ! Prepare_PatchData_GhostCache_Load( lv, GhostCacheSig, GhostCacheKey, NVarCC_Tot, PID0, Side,
+                                                          IntData_CC, FSize3D )  )
+               {
+                  InterpolateGhostZone( lv-1, FaSibPID, IntData_CC, IntData_FC, Side, PrepTime, GhostSize,
+                                        IntScheme_CC, IntScheme_FC, NTSib, TSib, TVarCC, NVarCC_Tot, NVarCC_Flu,
+                                        TVarCCIdxList_Flu, NVarCC_Der, TVarCCList_Der, TVarFC, NVarFC_Tot, TVarFCIdxList,
+                                        IntPhase, FluBC, PotBC, BC_Face, MinPres, DE_Consistency,
+                                        (const real **)FInterface_Ptr );
+
+                  Prepare_PatchData_GhostCache_Store( lv, GhostCacheSig, GhostCacheKey, NVarCC_Tot, PID0, Side,
+                                                      IntData_CC, FSize3D );
+               }
 
 
 //             (b2-4) copy cell-centered data from IntData_CC[] to Data1PG_CC[]
@@ -1918,29 +1948,8 @@ void Prepare_PatchData( const int lv, const double PrepTime, real *OutputCC, rea
          } // if ( PrepUnit == UNIT_PATCH )
 
       } // for (int TID=0; TID<NPG; TID++)
-
-      if ( PrepUnit == UNIT_PATCH )
-      {
-         delete [] Data1PG_CC;
-         delete [] Data1PG_FC;
-      }
-      delete [] IntData_CC;
-      delete [] IntData_FC;
-
-#     ifdef MHD
-      delete [] FInterface_Data;
-#     endif
-
    } // end of OpenMP parallel region
 
-
-// free memroy
-   for (int s=0; s<26; s++)   delete [] TSib[s];
-
-#  ifdef PARTICLE
-   if ( PrepParOnlyDens || PrepTotalDens )   delete [] ParMass_PID_List;
-#  endif
-
 } // FUNCTION : Prepare_PatchData
 
 
@@ -2376,23 +2385,24 @@ int Table_02( const int lv, const int PID, const int Side )
 // Description :  Set the target sibling directions for preparing the ghost-zone data at the coarse-grid level
 //
 // Note        :  1. Work for Prepare_PatchData()
-//                2. TSib needs to be deallocated manually
+//                2. TSib[] points to TSib_Data[], which must have at least 26*17 elements
 //                3. Sibling directions recorded in TSib must be in ascending numerical order for filling the
 //                   non-periodic ghost-zone data in InterpolateGhostZone()
 //                   --> Therefore, this function CANNOT be applied in LB_RecordExchangeDataPatchID(), in which
 //                       case "SetTargetSibling" and "SetReceiveSibling" must be declared consistently
 //
-// Parameter   :  NTSib : Number of target sibling patches along different sibling directions
-//                TSib  : Target sibling indices along different sibling directions
+// Parameter   :  NTSib     : Number of target sibling patches along different sibling directions
+//                TSib      : Target sibling indices along different sibling directions
+//                TSib_Data : Array to store TSib[]
 //-------------------------------------------------------------------------------------------------------
-void SetTargetSibling( int NTSib[], int *TSib[] )
+void SetTargetSibling( int NTSib[], int *TSib[], int TSib_Data[] )
 {
 
    for (int t= 0; t< 6; t++)  NTSib[t] = 17;
    for (int t= 6; t<18; t++)  NTSib[t] = 11;
    for (int t=18; t<26; t++)  NTSib[t] =  7;
 
-   for (int s=0; s<26; s++)   TSib[s] = new int [ NTSib[s] ];
+   for (int s=0; s<26; s++)   TSib[s] = TSib_Data + s*17;
 
    TSib[ 0][ 0] =  1;
    TSib[ 0][ 1] =  2;
@@ -0,0 +1,411 @@
+#include "GAMER.h"
+
+
+// maximum number of preparation signatures cached at each level
+#define GHOST_CACHE_NSIG   8
+
+// number of variables that can be cached individually: fluid/passive/derived variables and potential
+// --> variable "v" is stored with key "v", where "v" is the bit index of _VAR_NAME (e.g., _DENS == 1L<<DENS)
+// --> fluid/passive variables corrected by the dual-energy consistency check are stored with key "v+GHOST_CACHE_NVAR"
+#define GHOST_CACHE_NVAR   ( NCOMP_TOTAL + NDERIVE + 1 )
+#define GHOST_CACHE_NKEY   ( 2*GHOST_CACHE_NVAR )
+
+int Table_02( const int lv, const int PID, const int Side );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  GhostCacheSig_t
+// Description :  Interpolated coarse-fine ghost zones of all patch groups at one level sharing the same
+//                preparation signature
+//
+// Data Member :  PrepTime ... MinPres : Parameters of Prepare_PatchData() affecting the interpolation results
+//                                       of individual variables
+//                TVarCC_Couple        : Target variables if they are not interpolated independently (ELBDM only)
+//                Data                 : Interpolated ghost zones of each variable (NULL if not allocated yet)
+//                                       --> Data[Key][ Offset + t ], where Offset is given by GhostCache_Offset()
+//                                           and t is the cell index of one sibling direction in InterpolateGhostZone()
+//                Filled               : Whether Data[Key][] has been filled for each patch group and sibling direction
+//                                       --> Filled[Key][ PID0/8*26 + Side ]
+//-------------------------------------------------------------------------------------------------------
+struct GhostCacheSig_t
+{
+   double      PrepTime;
+   long        TVarCC_Couple;
+   int         GhostSize;
+   IntScheme_t IntScheme_CC;
+   bool        IntPhase;
+   OptFluBC_t  FluBC[6];
+   OptPotBC_t  PotBC;
+   real        MinPres;
+   real       *Data  [GHOST_CACHE_NKEY];
+   bool       *Filled[GHOST_CACHE_NKEY];
+};
+
+static bool            GhostCache_Active[NLEVEL];
+static int             GhostCache_NPG   [NLEVEL];
+static int            *GhostCache_Slot  [NLEVEL];
+static long            GhostCache_NSlot [NLEVEL][3];
+static int             GhostCache_NSig  [NLEVEL];
+static GhostCacheSig_t GhostCache_Sig   [NLEVEL][GHOST_CACHE_NSIG];
+
+// number of coarse-fine ghost-zone interpolations found/not found in the cache (recorded in Aux_Record_Timing())
+long GhostCache_NHit [NLEVEL];
+long GhostCache_NMiss[NLEVEL];
+
+static long GhostCache_Offset( const int lv, const int GhostSize, const int PID0, const int Side, int *SideSize );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_GhostCache_Begin
+// Description :  Start caching the coarse-fine ghost zones interpolated by Prepare_PatchData() at level "lv"
+//
+// Note        :  1. Invoked by EvolveLevel() on entry for OPT__GHOST_CACHE
+//                   --> Prepare_PatchData_GhostCache_End() must be invoked on exit
+//                2. The cached ghost zones depend only on the coarse-grid data at lv-1 and the patch lists at
+//                   lv-1 and lv, none of which changes during EvolveLevel(lv)
+//                   --> FluSg/MagSg/PotSg flips, fix-up, and grid refinement at lv-1 all take place outside
+//                       EvolveLevel(lv), so the cache is simply discarded on exit
+//                   --> Grid refinement inside EvolveLevel(lv) only affects lv+1
+//                3. Prepare_PatchData() at lv never uses the cache outside EvolveLevel(lv)
+//                4. Record the coarse-fine sibling directions of all patch groups here so that the cache of each
+//                   variable can be allocated as a single array in Prepare_PatchData_GhostCache_GetSig()
+//                   --> GhostCache_Slot[lv][ PID0/8*26 + Side ] = index of the sibling direction among all
+//                       coarse-fine faces, edges, or corners at lv (-1 if the sibling patch group exists)
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_GhostCache_Begin( const int lv )
+{
+
+// the base level never requires interpolation
+   if ( !OPT__GHOST_CACHE  ||  lv == 0 )  return;
+
+   Prepare_PatchData_GhostCache_End( lv );
+
+   const int NPG = amr->NPatchComma[lv][1] / 8;
+
+   GhostCache_NPG [lv] = NPG;
+   GhostCache_Slot[lv] = new int [ (long)NPG*26 ];
+
+   for (int t=0; t<3; t++)    GhostCache_NSlot[lv][t] = 0;
+
+   for (int PG=0; PG<NPG; PG++)
+   for (int Side=0; Side<26; Side++)
+   {
+      const int SideType = ( Side < 6 ) ? 0 : ( Side < 18 ) ? 1 : 2;
+
+      GhostCache_Slot[lv][ (long)PG*26 + Side ] = ( Table_02( lv, PG*8, Side ) == -1 ) ?
+                                                  GhostCache_NSlot[lv][SideType] ++ : -1;
+   }
+
+   GhostCache_Active[lv] = true;
+
+} // FUNCTION : Prepare_PatchData_GhostCache_Begin
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_GhostCache_End
+// Description :  Stop caching and free all the cached ghost zones at level "lv"
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_GhostCache_End( const int lv )
+{
+
+   for (int s=0; s<GhostCache_NSig[lv]; s++)
+   for (int k=0; k<GHOST_CACHE_NKEY; k++)
+   {
+      delete [] GhostCache_Sig[lv][s].Data  [k];
+      delete [] GhostCache_Sig[lv][s].Filled[k];
+   }
+
+   delete [] GhostCache_Slot[lv];
+
+   GhostCache_Slot  [lv] = NULL;
+   GhostCache_NSig  [lv] = 0;
+   GhostCache_Active[lv] = false;
+
+} // FUNCTION : Prepare_PatchData_GhostCache_End
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_GhostCache_GetSig
+// Description :  Return the index of the cache entry matching the preparation signature of Prepare_PatchData()
+//                and the cache key of each target variable
+//
+// Note        :  1. Invoked by Prepare_PatchData() before preparing any patch group
+//                2. Register a new signature if no match is found
+//                3. Each variable is cached separately since InterpolateGhostZone() interpolates them independently
+//                   --> Preparations of different variable subsets (e.g., _TOTAL and _POTE) share the same entry
+//                   --> Exceptions:
+//                       (a) Fluid variables corrected by the dual-energy consistency check use different keys
+//                       (b) ELBDM interpolates density, real and imaginary parts together for IntPhase and adopts
+//                           the same monotonicity for all fluid variables, so TVarCC is part of the signature
+//                4. Memory of all coarse-fine sibling directions at lv is allocated here once for each new variable
+//                   --> Prepare_PatchData_GhostCache_Store() only copies data to the pre-allocated arrays
+//                5. Face-centered variables and particle mass density are never cached
+//                   --> The former depend on the fine-grid B field on the coarse-fine interfaces, and the latter
+//                       depend on particles, which are collected again for each preparation
+//                6. Thread-safe
+//
+// Parameter   :  Key    : Array to store the cache key of each variable in the order of IntData_CC[] in
+//                         InterpolateGhostZone()
+//                Others : See Prepare_PatchData()
+//
+// Return      :  Index of the cache entry (-1 if the ghost zones cannot be cached), Key[]
+//-------------------------------------------------------------------------------------------------------
+int Prepare_PatchData_GhostCache_GetSig( const int lv, const double PrepTime, const int GhostSize, const long TVarCC,
+                                         const int NVarCC_Tot, const int NVarCC_Flu, const int TVarCCIdxList_Flu[],
+                                         const int NVarCC_Der, const long TVarCCList_Der[], const int NVarFC_Tot,
+                                         const IntScheme_t IntScheme_CC, const bool IntPhase, const OptFluBC_t FluBC[],
+                                         const OptPotBC_t PotBC, const real MinPres, const bool DE_Consistency, int Key[] )
+{
+
+   if ( !GhostCache_Active[lv]  ||  GhostSize == 0  ||  NVarCC_Tot == 0  ||  NVarFC_Tot != 0 )   return -1;
+
+#  ifdef PARTICLE
+   if ( TVarCC & ( _PAR_DENS | _TOTAL_DENS ) )  return -1;
+#  endif
+
+
+// 1. set the cache key of each variable in the order of IntData_CC[]: fluid --> derived --> potential
+// --> must be consistent with the dual-energy consistency check in InterpolateGhostZone()
+#  if ( MODEL == HYDRO  &&  defined DUAL_ENERGY  &&  !defined MHD )
+   const bool DE_Fix = (  DE_Consistency  &&  ( TVarCC & _TOTAL ) == _TOTAL  );
+#  else
+   const bool DE_Fix = false;
+#  endif
+   const int  KeyShift_Flu = ( DE_Fix ) ? GHOST_CACHE_NVAR : 0;
+   int NKey = 0;
+
+   for (int v=0; v<NVarCC_Flu; v++)    Key[ NKey ++ ] = TVarCCIdxList_Flu[v] + KeyShift_Flu;
+
+   for (int v=0; v<NVarCC_Der; v++)
+   for (int b=NCOMP_TOTAL; b<NCOMP_TOTAL+NDERIVE; b++)
+      if ( TVarCCList_Der[v] == (1L<<b) )    Key[ NKey ++ ] = b;
+
+#  ifdef GRAVITY
+   if ( TVarCC & _POTE )   Key[ NKey ++ ] = NCOMP_TOTAL + NDERIVE;
+#  endif
+
+   if ( NKey != NVarCC_Tot )  return -1;
+
+#  if ( MODEL == ELBDM )
+   const long TVarCC_Couple = TVarCC;
+#  else
+   const long TVarCC_Couple = _NONE;
+#  endif
+
+
+// 2. look up or register the signature and allocate the cache of new variables
+   int Sig = -1;
+
+#  pragma omp critical( GhostCache )
+   {
+      for (int s=0; s<GhostCache_NSig[lv]; s++)
+      {
+         const GhostCacheSig_t *Entry = &GhostCache_Sig[lv][s];
+
+         if ( Entry->PrepTime == PrepTime  &&  Entry->TVarCC_Couple == TVarCC_Couple  &&
+              Entry->GhostSize == GhostSize  &&  Entry->IntScheme_CC == IntScheme_CC  &&
+              Entry->IntPhase == IntPhase  &&  Entry->PotBC == PotBC  &&  Entry->MinPres == MinPres  &&
+              memcmp( Entry->FluBC, FluBC, 6*sizeof(OptFluBC_t) ) == 0 )
+         {
+            Sig = s;
+            break;
+         }
+      }
+
+//    register a new signature (give up if the cache is full)
+      if ( Sig == -1  &&  GhostCache_NSig[lv] < GHOST_CACHE_NSIG )
+      {
+         Sig = GhostCache_NSig[lv] ++;
+
+         GhostCacheSig_t *Entry = &GhostCache_Sig[lv][Sig];
+
+         Entry->PrepTime      = PrepTime;
+         Entry->TVarCC_Couple = TVarCC_Couple;
+         Entry->GhostSize     = GhostSize;
+         Entry->IntScheme_CC  = IntScheme_CC;
+         Entry->IntPhase      = IntPhase;
+         Entry->PotBC         = PotBC;
+         Entry->MinPres       = MinPres;
+
+         memcpy( Entry->FluBC, FluBC, 6*sizeof(OptFluBC_t) );
+
+         for (int k=0; k<GHOST_CACHE_NKEY; k++)
+         {
+            Entry->Data  [k] = NULL;
+            Entry->Filled[k] = NULL;
+         }
+      }
+
+//    allocate the cache of all coarse-fine sibling directions for the variables not cached yet
+      if ( Sig != -1 )
+      {
+         GhostCacheSig_t *Entry = &GhostCache_Sig[lv][Sig];
+
+         for (int v=0; v<NKey; v++)
+         {
+            if ( Entry->Data[ Key[v] ] != NULL )   continue;
+
+            const long Size = GhostCache_Offset( lv, GhostSize, -1, -1, NULL );
+
+            Entry->Data  [ Key[v] ] = new real [Size];
+            Entry->Filled[ Key[v] ] = new bool [ (long)GhostCache_NPG[lv]*26 ];
+
+            for (long t=0; t<(long)GhostCache_NPG[lv]*26; t++)    Entry->Filled[ Key[v] ][t] = false;
+         }
+      }
+   } // #pragma omp critical
+
+   return Sig;
+
+} // FUNCTION : Prepare_PatchData_GhostCache_GetSig
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_GhostCache_Load
+// Description :  Copy the cached interpolation results of the target patch group and sibling direction
+//
+// Note        :  1. Invoked by Prepare_PatchData() in place of InterpolateGhostZone()
+//                2. Each (PID0, Side) pair is only accessed by the OpenMP thread preparing PID0
+//                3. Cache hit only if all target variables are found
+//                4. Also record the numbers of cache hits and misses
+//
+// Parameter   :  lv         : Target refinement level
+//                Sig        : Cache entry returned by Prepare_PatchData_GhostCache_GetSig()
+//                Key        : Cache keys returned by Prepare_PatchData_GhostCache_GetSig()
+//                NVar       : Number of variables in IntData_CC[]
+//                PID0       : Target patch index with LocalID==0
+//                Side       : Target sibling direction
+//                IntData_CC : Array to store the interpolated cell-centered data
+//                Size3D     : Number of cells of each variable in IntData_CC[]
+//
+// Return      :  true  --> cache hit and IntData_CC[] is filled
+//                false --> cache miss and IntData_CC[] is untouched
+//-------------------------------------------------------------------------------------------------------
+bool Prepare_PatchData_GhostCache_Load( const int lv, const int Sig, const int Key[], const int NVar, const int PID0,
+                                        const int Side, real IntData_CC[], const int Size3D )
+{
+
+   if ( !GhostCache_Active[lv] )    return false;
+
+   const long SideIdx = (long)(PID0/8)*26 + Side;
+   bool       Hit     = (  Sig >= 0  &&  PID0/8 < GhostCache_NPG[lv]  &&  GhostCache_Slot[lv][SideIdx] != -1  );
+
+   for (int v=0; v<NVar  &&  Hit; v++)
+      if ( ! GhostCache_Sig[lv][Sig].Filled[ Key[v] ][SideIdx] )  Hit = false;
+
+   if ( ! Hit )
+   {
+#     pragma omp atomic
+      GhostCache_NMiss[lv] ++;
+
+      return false;
+   }
+
+   int SideSize;
+   const long Offset = GhostCache_Offset( lv, GhostCache_Sig[lv][Sig].GhostSize, PID0, Side, &SideSize );
+
+#  ifdef GAMER_DEBUG
+   if ( SideSize != Size3D )
+      Aux_Error( ERROR_INFO, "SideSize (%d) != Size3D (%d) (lv %d, PID0 %d, Side %d) !!\n", SideSize, Size3D, lv, PID0, Side );
+#  endif
+
+   for (int v=0; v<NVar; v++)
+      memcpy( IntData_CC + (long)v*Size3D, GhostCache_Sig[lv][Sig].Data[ Key[v] ] + Offset, Size3D*sizeof(real) );
+
+#  pragma omp atomic
+   GhostCache_NHit[lv] ++;
+
+   return true;
+
+} // FUNCTION : Prepare_PatchData_GhostCache_Load
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Prepare_PatchData_GhostCache_Store
+// Description :  Store the interpolation results of the target patch group and sibling direction in the cache
+//
+// Note        :  1. Invoked by Prepare_PatchData() right after InterpolateGhostZone()
+//                2. Each (PID0, Side) pair is only accessed by the OpenMP thread preparing PID0
+//                3. Memory has been allocated by Prepare_PatchData_GhostCache_GetSig()
+//
+// Parameter   :  See Prepare_PatchData_GhostCache_Load()
+//-------------------------------------------------------------------------------------------------------
+void Prepare_PatchData_GhostCache_Store( const int lv, const int Sig, const int Key[], const int NVar, const int PID0,
+                                         const int Side, const real IntData_CC[], const int Size3D )
+{
+
+   if ( !GhostCache_Active[lv]  ||  Sig < 0  ||  PID0/8 >= GhostCache_NPG[lv] )   return;
+
+   const long SideIdx = (long)(PID0/8)*26 + Side;
+
+// sibling directions not recorded in Prepare_PatchData_GhostCache_Begin() are not cached
+   if ( GhostCache_Slot[lv][SideIdx] == -1 )    return;
+
+   int SideSize;
+   const long Offset = GhostCache_Offset( lv, GhostCache_Sig[lv][Sig].GhostSize, PID0, Side, &SideSize );
+
+#  ifdef GAMER_DEBUG
+   if ( SideSize != Size3D )
+      Aux_Error( ERROR_INFO, "SideSize (%d) != Size3D (%d) (lv %d, PID0 %d, Side %d) !!\n", SideSize, Size3D, lv, PID0, Side );
+#  endif
+
+   for (int v=0; v<NVar; v++)
+   {
+      memcpy( GhostCache_Sig[lv][Sig].Data[ Key[v] ] + Offset, IntData_CC + (long)v*Size3D, Size3D*sizeof(real) );
+
+      GhostCache_Sig[lv][Sig].Filled[ Key[v] ][SideIdx] = true;
+   }
+
+} // FUNCTION : Prepare_PatchData_GhostCache_Store
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GhostCache_Offset
+// Description :  Return the offset of the target patch group and sibling direction in the cache array of
+//                one variable
+//
+// Note        :  1. Faces, edges, and corners are stored in order, each of which has the array size returned
+//                   by InterpolateGhostZone() with a padded ghost size (i.e., TABLE_01(...,GhostSize_Padded,PS2,...))
+//                2. Return the total array size if PID0 < 0
+//
+// Parameter   :  lv        : Target refinement level
+//                GhostSize : Number of ghost zones
+//                PID0      : Target patch index with LocalID==0
+//                Side      : Target sibling direction
+//                SideSize  : Number of cells of each variable in the target sibling direction
+//
+// Return      :  Offset, SideSize (if not NULL)
+//-------------------------------------------------------------------------------------------------------
+long GhostCache_Offset( const int lv, const int GhostSize, const int PID0, const int Side, int *SideSize )
+{
+
+   const int  GhostSize_Padded = GhostSize + (GhostSize&1);
+   const int  Size[3]          = { GhostSize_Padded*PS2*PS2, SQR(GhostSize_Padded)*PS2, CUBE(GhostSize_Padded) };
+   long       Base[4];
+
+   Base[0] = 0;
+   for (int t=0; t<3; t++)    Base[t+1] = Base[t] + GhostCache_NSlot[lv][t]*Size[t];
+
+   if ( PID0 < 0 )   return Base[3];
+
+   const int SideType = ( Side < 6 ) ? 0 : ( Side < 18 ) ? 1 : 2;
+   const int Slot     = GhostCache_Slot[lv][ (long)(PID0/8)*26 + Side ];
+
+   if ( SideSize != NULL )    *SideSize = Size[SideType];
+
+   return Base[SideType] + (long)Slot*Size[SideType];
+
+} // FUNCTION : GhostCache_Offset
@@ -0,0 +1,38 @@
+#include "GAMER.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_CopyArray
+// Description :  Copy an array with type conversion
+//
+// Note        :  1. Mainly used for copying data between the patch field arrays (real_fld) and the arrays used
+//                   by the solvers and I/O buffers (real) for MIXED_PRECISION
+//                   --> Reduce to memcpy() when the two types are the same
+//                2. Input and output arrays must not overlap
+//                3. Explicit template instantiation is applied at the end of this file
+//
+// Parameter   :  Out : Output array
+//                In  : Input array
+//                N   : Number of elements to be copied
+//-------------------------------------------------------------------------------------------------------
+template <typename TOut, typename TIn>
+void Mis_CopyArray( TOut *Out, const TIn *In, const long N )
+{
+
+   if ( sizeof(TOut) == sizeof(TIn) )
+      memcpy( Out, In, N*sizeof(TIn) );
+
+   else
+      for (long t=0; t<N; t++)   Out[t] = (TOut)In[t];
+
+} // FUNCTION : Mis_CopyArray
+
+
+
+// explicit template instantiation
+template void Mis_CopyArray <float,  float>  ( float  *Out, const float  *In, const long N );
+template void Mis_CopyArray <double, double> ( double *Out, const double *In, const long N );
+template void Mis_CopyArray <float,  double> ( float  *Out, const double *In, const long N );
+template void Mis_CopyArray <double, float>  ( double *Out, const float  *In, const long N );
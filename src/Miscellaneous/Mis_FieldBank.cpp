@@ -0,0 +1,294 @@
+#include "GAMER.h"
+
+// target field arrays stored in the banks
+enum BankField_t { BANK_FLU=0, BANK_MAG, BANK_POT, BANK_NFIELD };
+
+static void  BindField( const int lv, const BankField_t Field );
+static BlockPool_t *GetPool( const int lv, const BankField_t Field );
+static void *GetField( const patch_t *Patch, const BankField_t Field );
+static void  SetField( patch_t *Patch, const BankField_t Field, void *Ptr );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_FieldBank_Bind
+// Description :  Move the field arrays of all patches at the target level into the field banks so that the
+//                data of all patches are stored contiguously in PID order
+//
+// Note        :  1. Controlled by the option "OPT__FIELD_BANK"
+//                2. Each field (fluid[], magnetic[], pot[]) of each sandglass has its own bank, which is a single
+//                   ARENA_ALIGN-aligned array in amr->Arena[lv]
+//                   --> After binding, the field array of patch[Sg][lv][PID] is the PID-th slot of the Sg-th bank
+//                   --> pot_ext[] is not stored in the banks
+//                3. Patches created since the last binding still allocate their field arrays from the memory
+//                   pool of this level, and the field pointers of existing patches may have been swapped during
+//                   refinement. Both are moved back to their slots here.
+//                   --> Do nothing if there is no patch allocation or deallocation since the last binding
+//                       (i.e., when Arena[lv]->BankDirty is off)
+//                4. Must be invoked by a single thread outside of any OpenMP parallel region, and no other
+//                   pointer to the field arrays of this level may be kept across this function
+//                5. Level-wide kernels should access the banks with Mis_FieldBank_GetFluid(), which returns
+//                   NULL if the level is not bound
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Mis_FieldBank_Bind( const int lv )
+{
+
+   if ( !OPT__FIELD_BANK  ||  !amr->Arena[lv]->BankDirty )   return;
+
+   for (int f=0; f<BANK_NFIELD; f++)   BindField( lv, (BankField_t)f );
+
+   amr->Arena[lv]->BankDirty = false;
+
+} // FUNCTION : Mis_FieldBank_Bind
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_FieldBank_GetFluid
+// Description :  Return the fluid bank of the target level and sandglass
+//
+// Note        :  1. fluid[v][k][j][i] of patch[Sg][lv][PID] is stored at
+//                      Bank[ ( (long)PID*NCOMP_TOTAL + v )*CUBE(PS1) + (k*PS1+j)*PS1 + i ]
+//                   for all PID < amr->num[lv] with allocated fluid[]
+//                2. Return NULL if OPT__FIELD_BANK is off or Mis_FieldBank_Bind() has not been invoked since the
+//                   last patch allocation or deallocation at this level
+//                   --> Callers must fall back to accessing the patches one by one
+//                3. Thread-safe
+//
+// Parameter   :  lv : Target refinement level
+//                Sg : Target sandglass
+//
+// Return      :  Base address of the bank or NULL
+//-------------------------------------------------------------------------------------------------------
+real_fld* Mis_FieldBank_GetFluid( const int lv, const int Sg )
+{
+
+   if ( !OPT__FIELD_BANK  ||  amr->Arena[lv]->BankDirty )   return NULL;
+
+   return (real_fld*)amr->Arena[lv]->Flu.Bank[Sg];
+
+} // FUNCTION : Mis_FieldBank_GetFluid
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  BindField
+// Description :  Move one type of field arrays of all patches at the target level into their bank slots
+//
+// Note        :  1. Invoked by Mis_FieldBank_Bind()
+//                2. Procedure:
+//                   (1) Resize the banks if they are too small or much larger than the number of patches
+//                       --> Field arrays in the slots that no longer exist are moved to the memory pool
+//                   (2) Record the patch owning each bank slot, including the inactive patches
+//                   (3) For each active patch whose field array is not in its slot, either move the data to the
+//                       slot if the slot is free, or swap the data and pointers with the patch owning the slot
+//                3. Only the field arrays that are not in their slots are copied
+//
+// Parameter   :  lv    : Target refinement level
+//                Field : Target field (BANK_FLU/MAG/POT)
+//-------------------------------------------------------------------------------------------------------
+void BindField( const int lv, const BankField_t Field )
+{
+
+   BlockPool_t *Pool = GetPool( lv, Field );
+
+   if ( Pool == NULL )  return;
+
+   const int    NPatch    = amr->num     [lv];
+   const int    PatchCap  = amr->PatchCap[lv];
+   const size_t BlockSize = Pool->BlockSize;
+
+
+// 1. resize the banks
+// --> grow by 25% to avoid resizing after every refinement and shrink only when more than half of the slots are unused
+   if ( NPatch > Pool->BankNSlot  ||  2*(long)NPatch < Pool->BankNSlot )
+   {
+      const long NSlot_Old = Pool->BankNSlot;
+      const long NSlot_New = ( NPatch == 0 ) ? 0 : NPatch + NPatch/4 + 1;
+      char *OldBank[ARENA_NBANK];
+
+      Pool->ResizeBank( NSlot_New, OldBank );
+
+//    redirect all pointers to the old banks
+      for (int Sg=0; Sg<2; Sg++)
+      for (int PID=0; PID<PatchCap; PID++)
+      {
+         patch_t *Patch = amr->patch[Sg][lv][PID];
+
+         if ( Patch == NULL )    continue;
+
+         char *Ptr = (char*)GetField( Patch, Field );
+
+         for (int b=0; b<ARENA_NBANK; b++)
+         {
+            if ( OldBank[b] == NULL  ||  Ptr < OldBank[b]  ||  Ptr >= OldBank[b] + NSlot_Old*BlockSize )   continue;
+
+            const long s = ( Ptr - OldBank[b] )/BlockSize;
+
+            if ( s < NSlot_New )    SetField( Patch, Field, Pool->Bank[b] + s*BlockSize );
+
+//          slots removed by shrinking (only possible for patches not in their slots) --> move to the memory pool
+            else
+            {
+               void *NewPtr = Pool->Alloc();
+               memcpy( NewPtr, Ptr, BlockSize );
+               SetField( Patch, Field, NewPtr );
+            }
+
+            break;
+         }
+      }
+
+      for (int b=0; b<ARENA_NBANK; b++)   free( OldBank[b] );
+   } // if ( NPatch > Pool->BankNSlot  ||  2*(long)NPatch < Pool->BankNSlot )
+
+   const long NSlot = Pool->BankNSlot;
+
+   if ( NSlot == 0 )
+   {
+      Pool->BankNUsed = 0;
+      return;
+   }
+
+
+// 2. record the owner of each slot as Sg*PatchCap+PID (-1 for free slots)
+   long *Owner = new long [ARENA_NBANK*NSlot];
+
+   for (long t=0; t<ARENA_NBANK*NSlot; t++)  Owner[t] = -1;
+
+   for (int Sg=0; Sg<2; Sg++)
+   for (int PID=0; PID<PatchCap; PID++)
+   {
+      const patch_t *Patch = amr->patch[Sg][lv][PID];
+
+      if ( Patch == NULL )    continue;
+
+      const char *Ptr = (const char*)GetField( Patch, Field );
+      const int   b   = Pool->BankOf( Ptr );
+
+      if ( b >= 0 )  Owner[ b*NSlot + (Ptr-Pool->Bank[b])/BlockSize ] = (long)Sg*PatchCap + PID;
+   }
+
+
+// 3. move the field arrays of all active patches to their slots
+   char *Buf = new char [BlockSize];
+
+   for (int Sg=0; Sg<2; Sg++)
+   for (int PID=0; PID<NPatch; PID++)
+   {
+      patch_t *Patch = amr->patch[Sg][lv][PID];
+      char    *Ptr   = (char*)GetField( Patch, Field );
+      char    *Slot  = Pool->Bank[Sg] + (long)PID*BlockSize;
+
+      if ( Ptr == NULL  ||  Ptr == Slot )    continue;
+
+      const long MySlot  = (long)Sg*NSlot + PID;
+      const long MyOwner = (long)Sg*PatchCap + PID;
+      const int  b       = Pool->BankOf( Ptr );
+      const long OldSlot = ( b >= 0 ) ? b*NSlot + (Ptr-Pool->Bank[b])/BlockSize : -1;
+      const long Other   = Owner[MySlot];
+
+//    3-1. target slot is free --> move the data and release the old array
+      if ( Other == -1 )
+      {
+         memcpy( Slot, Ptr, BlockSize );
+
+         if ( OldSlot >= 0 )  Owner[OldSlot] = -1;
+         else                 Pool->Free( Ptr );
+      }
+
+//    3-2. target slot is owned by another patch --> swap the data and pointers
+      else
+      {
+         memcpy( Buf,  Slot, BlockSize );
+         memcpy( Slot, Ptr,  BlockSize );
+         memcpy( Ptr,  Buf,  BlockSize );
+
+         SetField( amr->patch[ Other/PatchCap ][lv][ Other%PatchCap ], Field, Ptr );
+
+         if ( OldSlot >= 0 )  Owner[OldSlot] = Other;
+      }
+
+      SetField( Patch, Field, Slot );
+      Owner[MySlot] = MyOwner;
+   } // for Sg, PID
+
+   delete [] Buf;
+
+
+// 4. record the number of slots in use
+   Pool->BankNUsed = 0;
+   for (long t=0; t<ARENA_NBANK*NSlot; t++)
+      if ( Owner[t] != -1 )   Pool->BankNUsed ++;
+
+   delete [] Owner;
+
+} // FUNCTION : BindField
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetPool
+// Description :  Return the memory pool of the target field at the target level (NULL if not supported)
+//-------------------------------------------------------------------------------------------------------
+BlockPool_t *GetPool( const int lv, const BankField_t Field )
+{
+
+   switch ( Field )
+   {
+      case BANK_FLU :   return &amr->Arena[lv]->Flu;
+#     ifdef MHD
+      case BANK_MAG :   return &amr->Arena[lv]->Mag;
+#     endif
+#     ifdef GRAVITY
+      case BANK_POT :   return &amr->Arena[lv]->Pot;
+#     endif
+      default       :   return NULL;
+   }
+
+} // FUNCTION : GetPool
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetField / SetField
+// Description :  Get/set the pointer of the target field array of a patch
+//-------------------------------------------------------------------------------------------------------
+void *GetField( const patch_t *Patch, const BankField_t Field )
+{
+
+   switch ( Field )
+   {
+      case BANK_FLU :   return Patch->fluid;
+#     ifdef MHD
+      case BANK_MAG :   return Patch->magnetic;
+#     endif
+#     ifdef GRAVITY
+      case BANK_POT :   return Patch->pot;
+#     endif
+      default       :   return NULL;
+   }
+
+} // FUNCTION : GetField
+
+
+
+void SetField( patch_t *Patch, const BankField_t Field, void *Ptr )
+{
+
+   switch ( Field )
+   {
+      case BANK_FLU :   Patch->fluid    = ( real_fld (*)[PS1][PS1][PS1] )Ptr;   break;
+#     ifdef MHD
+      case BANK_MAG :   Patch->magnetic = ( real_fld (*)[ PS1P1*SQR(PS1) ] )Ptr;   break;
+#     endif
+#     ifdef GRAVITY
+      case BANK_POT :   Patch->pot      = ( real_fld (*)[PS1][PS1] )Ptr;   break;
+#     endif
+      default       :   break;
+   }
+
+} // FUNCTION : SetField
@@ -0,0 +1,111 @@
+#include "GAMER.h"
+
+static long GetTargetNPatch( const int lv, const bool Update );
+
+
+// number of patches recorded at each level (ring buffer of size MEMORY_POOL_WINDOW)
+static int NPatch_Record[NLEVEL][MEMPOOL_MAX_WINDOW];
+static int NRecord      [NLEVEL];
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_MemoryPool_Reserve
+// Description :  Pre-grow the memory pool of the target level before creating patches on it
+//
+// Note        :  1. Invoked by EvolveLevel() before Refine() when OPT__MEMORY_POOL is on
+//                2. The arena of the target level is grown to hold GetTargetNPatch() patches, which is the larger
+//                   of the recent high-water mark and the number of patches extrapolated from the last change
+//                   --> Chunks are allocated and first-touched here instead of one by one during refinement
+//                3. Do nothing if there is no patch at the target level since the number of field arrays per
+//                   patch is unknown
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Mis_MemoryPool_Reserve( const int lv )
+{
+
+   const int NPatch = amr->num[lv];
+
+   if ( NPatch == 0 )   return;
+
+   const long Target = GetTargetNPatch( lv, false );
+
+   if ( Target > NPatch )  amr->Arena[lv]->Reserve( (double)Target/NPatch );
+
+} // FUNCTION : Mis_MemoryPool_Reserve
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_MemoryPool_Update
+// Description :  Record the number of patches at the target level and shrink its memory pool if it has become
+//                much larger than necessary
+//
+// Note        :  1. Invoked by EvolveLevel() after Refine() when OPT__MEMORY_POOL is on
+//                2. Memory is released only if the arena is larger than MEMORY_POOL_SHRINK times the memory
+//                   required by the high-water mark of the last MEMORY_POOL_WINDOW records
+//                   --> Hysteresis: a level must stay small for a while before its memory is released, and
+//                       the pool does not oscillate between growing and shrinking
+//                3. Shrinking deallocates all inactive patches (for OPT__REUSE_MEMORY) and then releases all
+//                   empty chunks to the system
+//                   --> Free blocks in partially used chunks (i.e., fragmentation) cannot be released
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Mis_MemoryPool_Update( const int lv )
+{
+
+   const long Target = GetTargetNPatch( lv, true );
+
+
+// estimate the number of bytes per patch from all allocated patches (including the inactive ones)
+   PatchArena_t *Arena     = amr->Arena[lv];
+   const long    NAllocPID = Arena->Patch.NUsed/2;
+   const double  NByte_PID = ( NAllocPID > 0 ) ? (double)Arena->GetNByteUsed()/NAllocPID : 0.0;
+   const double  NByte_Req = NByte_PID*Target;
+
+   if ( Arena->GetNByte() > MEMORY_POOL_SHRINK*NByte_Req )
+   {
+      amr->Lvrelease( lv );
+      Arena->Trim();
+   }
+
+} // FUNCTION : Mis_MemoryPool_Update
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetTargetNPatch
+// Description :  Return the number of patches the memory pool of the target level should be able to hold
+//
+// Note        :  1. Target = max( high-water mark of the last MEMORY_POOL_WINDOW records,
+//                                 current number + increase since the last record )
+//                2. The current number of patches is amr->num[lv] (real + buffer patches)
+//
+// Parameter   :  lv     : Target refinement level
+//                Update : true --> append the current number of patches to the records
+//
+// Return      :  Target number of patches
+//-------------------------------------------------------------------------------------------------------
+long GetTargetNPatch( const int lv, const bool Update )
+{
+
+   const int NPatch = amr->num[lv];
+   const int NWin   = MIN( NRecord[lv], MEMORY_POOL_WINDOW );
+   const int Last   = ( NRecord[lv] > 0 ) ? NPatch_Record[lv][ (NRecord[lv]-1)%MEMORY_POOL_WINDOW ] : NPatch;
+
+   long Target = NPatch + MAX( NPatch-Last, 0 );
+
+   for (int t=0; t<NWin; t++)    Target = MAX( Target, (long)NPatch_Record[lv][t] );
+
+   if ( Update )
+   {
+      NPatch_Record[lv][ NRecord[lv]%MEMORY_POOL_WINDOW ] = NPatch;
+      NRecord[lv] ++;
+   }
+
+   return Target;
+
+} // FUNCTION : GetTargetNPatch
@@ -0,0 +1,104 @@
+#include "GAMER.h"
+
+#if ( MODEL == HYDRO )
+
+real CPU_dtSolver_HydroCFL_MaxSpeed( const real g_Flu[][ CUBE(PS1) ], const real g_Mag[][ PS1P1*SQR(PS1) ],
+                                     const real Gamma, const real MinPres );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_CFLCache_Update
+// Description :  Evaluate and cache the maximum CFL speed of the target patch for OPT__DT_CFL_CACHE
+//
+// Note        :  1. Invoked by Flu_Close(), Flu_Close_Cluster(), and Gra_Close() right after storing the updated
+//                   fluid data so that the patch data are still in cache
+//                   --> Also invoked by dt_CFLCache_GetTimeStep() for patches with invalid cached values
+//                2. Use the same routine as CPU_dtSolver_HydroCFL() to guarantee bitwise identical time-steps
+//                3. MHD is not supported (see Init_ResetParameter())
+//
+// Parameter   :  lv  : Target refinement level
+//                Sg  : Sandglass of the target fluid data
+//                PID : Target patch index
+//-------------------------------------------------------------------------------------------------------
+void dt_CFLCache_Update( const int lv, const int Sg, const int PID )
+{
+
+// promote the stored fluid data to the solver precision for MIXED_PRECISION
+#  ifdef MIXED_PRECISION
+   real Flu[NCOMP_FLUID][ CUBE(PS1) ];
+   Mis_CopyArray( Flu[0], amr->patch[Sg][lv][PID]->fluid[0][0][0], NCOMP_FLUID*CUBE(PS1) );
+#  else
+   const real (*Flu)[ CUBE(PS1) ] = ( const real (*)[ CUBE(PS1) ] )amr->patch[Sg][lv][PID]->fluid[0][0][0];
+#  endif
+
+   amr->patch[Sg][lv][PID]->MaxCFL = CPU_dtSolver_HydroCFL_MaxSpeed( Flu, NULL, GAMMA, MIN_PRES );
+
+} // FUNCTION : dt_CFLCache_Update
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_CFLCache_Invalidate
+// Description :  Invalidate the cached maximum CFL speed of the target patch
+//
+// Note        :  1. Must be invoked whenever the fluid data of a real patch are modified without calling
+//                   dt_CFLCache_Update() afterward (e.g., by Flu_FixUp_Flux() and Flu_FixUp_Restrict())
+//                   --> The cached value will be re-evaluated by the next dt_CFLCache_GetTimeStep()
+//
+// Parameter   :  lv  : Target refinement level
+//                Sg  : Sandglass of the target fluid data
+//                PID : Target patch index
+//-------------------------------------------------------------------------------------------------------
+void dt_CFLCache_Invalidate( const int lv, const int Sg, const int PID )
+{
+
+   amr->patch[Sg][lv][PID]->MaxCFL = (real)-1.0;
+
+} // FUNCTION : dt_CFLCache_Invalidate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  dt_CFLCache_GetTimeStep
+// Description :  Estimate the hydro CFL time-step of all real patches at level "lv" in this rank from the cached
+//                maximum CFL speed
+//
+// Note        :  1. Invoked by dt_InvokeSolver() when OPT__DT_CFL_CACHE is on
+//                   --> Replace dt_Prepare_Flu(), CPU_dtSolver_HydroCFL(), and dt_Close()
+//                2. Only re-evaluate patches whose cached values have been invalidated (e.g., patches modified by
+//                   the fix-up operations and patches newly allocated by refinement or load balancing)
+//                3. Return the same result as dt_Close() since Safety*dh/MaxCFL is monotonic in MaxCFL
+//
+// Parameter   :  lv     : Target refinement level
+//                Safety : dt safety factor
+//
+// Return      :  Minimum dt in this rank
+//-------------------------------------------------------------------------------------------------------
+double dt_CFLCache_GetTimeStep( const int lv, const real Safety )
+{
+
+   const int  FluSg    = amr->FluSg[lv];
+   const real dhSafety = Safety*(real)amr->dh[lv];
+
+
+// 1. re-evaluate the invalid cached values
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      if ( amr->patch[FluSg][lv][PID]->MaxCFL < (real)0.0 )    dt_CFLCache_Update( lv, FluSg, PID );
+
+
+// 2. get the minimum dt
+   double dt_min = HUGE_NUMBER;
+
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      dt_min = fmin( dt_min, (double)( dhSafety/amr->patch[FluSg][lv][PID]->MaxCFL ) );
+
+   return dt_min;
+
+} // FUNCTION : dt_CFLCache_GetTimeStep
+
+
+
+#endif // #if ( MODEL == HYDRO )
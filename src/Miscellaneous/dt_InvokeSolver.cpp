@@ -11,6 +11,9 @@ double dt_min_for_solver;
 //
 // Note        :  1. Invoked by Mis_GetTimeStep()
 //                2. The global variable "dt_min_for_solver" will be set by dt_Close()
+//                3. Bind the field banks of the target level before invoking the solver (for OPT__FIELD_BANK)
+//                4. For OPT__DT_CFL_CACHE, the hydro CFL time-step is obtained from the maximum CFL speed cached
+//                   by the fluid solver instead (see dt_CFLCache_GetTimeStep())
 //
 // Parameter   :  TSolver : Target dt solver
 //                          --> DT_FLU_SOLVER, DT_GRA_SOLVER
@@ -25,8 +28,20 @@ double dt_InvokeSolver( const Solver_t TSolver, const int lv )
    dt_min_for_solver = HUGE_NUMBER;
 
 
-// invoke the target dt solver
-   InvokeSolver( TSolver, lv, Time[lv], NULL_REAL, NULL_REAL, NULL_REAL, NULL_INT, NULL_INT, NULL_INT, false, false );
+// use the cached CFL speed for OPT__DT_CFL_CACHE
+#  if ( MODEL == HYDRO )
+   if ( TSolver == DT_FLU_SOLVER  &&  OPT__DT_CFL_CACHE )
+      dt_min_for_solver = dt_CFLCache_GetTimeStep( lv, (Step==0)?DT__FLUID_INIT:DT__FLUID );
+
+   else
+#  endif
+   {
+//    move the field arrays into the field banks so that dt_Prepare_Flu() can copy patch groups as a whole
+      Mis_FieldBank_Bind( lv );
+
+//    invoke the target dt solver
+      InvokeSolver( TSolver, lv, Time[lv], NULL_REAL, NULL_REAL, NULL_REAL, NULL_INT, NULL_INT, NULL_INT, false, false );
+   }
 
 
 // get the minimum dt among all ranks
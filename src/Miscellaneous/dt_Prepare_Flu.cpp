@@ -12,6 +12,8 @@
 //                2. Prepare NCOMP_FLUID fluid variables and NCOMP_MAG B field components
 //                3. Use patches instead of patch groups as the basic unit
 //                4. No ghost zones
+//                5. Copy all patches in a patch group at once if their fluid data are stored contiguously
+//                   in the field bank (i.e., OPT__FIELD_BANK) and there are no passive scalars
 //
 // Parameter   :  lv            : Target refinement level
 //                h_Flu_Array_T : Host array to store the prepared fluid data
@@ -23,24 +25,32 @@ void dt_Prepare_Flu( const int lv, real h_Flu_Array_T[][NCOMP_FLUID][ CUBE(PS1)
                      real h_Mag_Array_T[][NCOMP_MAG][ PS1P1*SQR(PS1) ], const int NPG, const int *PID0_List )
 {
 
+   const real_fld *FluBank = ( NCOMP_PASSIVE == 0 ) ? Mis_FieldBank_GetFluid( lv, amr->FluSg[lv] ) : NULL;
+
 #  pragma omp parallel for schedule( static )
    for (int TID=0; TID<NPG; TID++)
    {
       const int PID0 = PID0_List[TID];
 
+//    fluid variables of the entire patch group
+      if ( FluBank != NULL )
+         Mis_CopyArray( h_Flu_Array_T[8*TID][0], FluBank + (long)PID0*NCOMP_TOTAL*CUBE(PS1),
+                        8*NCOMP_FLUID*CUBE(PS1) );
+
       for (int LocalID=0; LocalID<8; LocalID++)
       {
          const int PID = PID0 + LocalID;
          const int N   = 8*TID + LocalID;
 
 //       fluid variables (excluding passive scalars)
-         memcpy( h_Flu_Array_T[N][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0],
-                 NCOMP_FLUID*CUBE(PS1)*sizeof(real) );
+         if ( FluBank == NULL )
+         Mis_CopyArray( h_Flu_Array_T[N][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0],
+                        NCOMP_FLUID*CUBE(PS1) );
 
 //       B field
 #        ifdef MHD
-         memcpy( h_Mag_Array_T[N][0], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[0],
-                 NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
+         Mis_CopyArray( h_Mag_Array_T[N][0], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[0],
+                        NCOMP_MAG*PS1P1*SQR(PS1) );
 #        endif
       }
    } // for (int TID=0; TID<NPG; TID++)
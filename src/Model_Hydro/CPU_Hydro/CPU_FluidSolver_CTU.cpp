@@ -19,32 +19,37 @@
 #else // #ifdef __CUDACC__
 
 void Hydro_Rotate3D( real InOut[], const int XYZ, const bool Forward, const int Mag_Offset );
+template <int LR, int RS>
 void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
                                      real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-                                     real g_Slope_PPM[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
+                                     real g_FC_Var   [][NCOMP_LR][ CUBE(N_FC_VAR) ],
+                                     real g_Slope_PPM[][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
                                const bool Con2Pri, const int NIn, const int NGhost, const real Gamma,
                                const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh, const real MinDens, const real MinPres,
                                const bool NormPassive, const int NNorm, const int NormIdx[],
-                               const bool JeansMinPres, const real JeansMinPres_Coeff );
-void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-                              real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                               const bool JeansMinPres, const real JeansMinPres_Coeff, const int kBeg, const int kEnd );
+template <int RS>
+void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_LR][ CUBE(N_FC_VAR) ],
+                              real g_FC_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T, const real Gamma,
                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],
                         const real dt, const real dh, const double Time,
                         const OptGravityType_t GravityType, const double ExtAcc_AuxArray[],
-                        const real MinPres, const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ] );
+                        const real MinPres, const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
+                        const int kBeg, const int kEnd );
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
-                           const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                           const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                            const real dt, const real dh, const real Gamma, const real MinDens, const real MinPres,
-                           const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[] );
+                           const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
+                           const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
+                           const int kBeg, const int kEnd );
 real Hydro_CheckMinPresInEngy( const real Dens, const real MomX, const real MomY, const real MomZ, const real Engy,
                                const real Gamma_m1, const real _Gamma_m1, const real MinPres );
 #ifdef MHD
 void MHD_ComputeElectric(       real g_EC_Ele[][ CUBE(N_EC_ELE) ],
-                          const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                          const real g_FC_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                           const real g_PriVar[][ CUBE(FLU_NXT) ],
                           const int NEle, const int NFlux, const int NPri, const int OffsetPri,
                           const real dt, const real dh,
@@ -58,7 +63,7 @@ void MHD_UpdateMagnetic( real *g_FC_Bx_Out, real *g_FC_By_Out, real *g_FC_Bz_Out
 void MHD_HalfStepPrimitive( const real g_Flu_In[][ CUBE(FLU_NXT) ],
                             const real g_FC_B_Half[][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                   real g_PriVar_Out[][ CUBE(FLU_NXT) ],
-                            const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                            const real g_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                             const real dt, const real dh, const real MinDens );
 #endif // #ifdef MHD
 
@@ -67,14 +72,14 @@ void MHD_HalfStepPrimitive( const real g_Flu_In[][ CUBE(FLU_NXT) ],
 
 // internal functions
 GPU_DEVICE
-void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)  ],
-                                const real g_FC_Flux  [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_LR][ CUBE(N_FC_VAR)  ],
+                                const real g_FC_Flux  [][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                                 const real g_FC_B_In  [][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                 const real g_FC_B_Half[][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                 const real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
                                 const real g_PriVar   [][ CUBE(FLU_NXT) ],
                                 const real dt, const real dh, const real Gamma,
-                                const real MinDens, const real MinPres );
+                                const real MinDens, const real MinPres, const int kBeg, const int kEnd );
 
 
 
@@ -88,6 +93,23 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 //                2. See include/CUFLU.h for the values and description of different symbolic constants
 //                   such as N_FC_VAR, N_FC_FLUX, N_SLOPE_PPM, N_FL_FLUX, N_HF_VAR
 //                3. Arrays with a prefix "g_" are stored in the global memory of GPU
+//                4. Fused CPU solver (FusedSlab > 0, pure hydro only)
+//                   --> Each patch group is evaluated slab by slab along z, where all steps from the data
+//                       reconstruction to the full-step update are applied to one slab of FusedSlab output cells
+//                       before proceeding to the next slab
+//                   --> Each step only evaluates the planes of its output array that are required by the current
+//                       slab but not evaluated by the previous slabs, which are at most a few planes ahead of the
+//                       output slab. The data of each slab are therefore still in cache when the next step
+//                       reads them.
+//                   --> The half-step and full-step fluxes share g_FC_Flux[] (with N_HF_FLUX == N_FL_FLUX for pure
+//                       hydro) and Hydro_TGradientCorrection() updates g_FC_Var[] in place. The planes evaluated
+//                       by each step of one slab are chosen so that no data are overwritten before being used by
+//                       the other steps.
+//                   --> Give bitwise identical results to the unfused solver
+//                5. The CPU solver is a template of the data reconstruction scheme (LR = PLM/PPM) and the Riemann
+//                   solver (RS = EXACT/ROE/HLLE/HLLC/HLLD), which are selected at runtime by CPU_FluidSolver()
+//                   --> See HYDRO_FOR_EACH_SCHEME() in CUFLU.h for the instantiated combinations
+//                   --> The GPU solver always adopts LR_SCHEME and RSOLVER set in the Makefile
 //
 // Parameter   :  g_Flu_Array_In     : Array storing the input fluid variables
 //                g_Flu_Array_Out    : Array to store the output fluid variables
@@ -135,6 +157,8 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 //                                             highlight that this is a constant variable on GPU
 //                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
+//                FusedSlab          : Thickness of the slabs evaluated by the fused CPU solver
+//                                     --> <= 0: disable the fused solver
 //-------------------------------------------------------------------------------------------------------
 #ifdef __CUDACC__
 __global__
@@ -148,10 +172,10 @@ void CUFLU_FluidSolver_CTU(
          real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
-         real   g_PriVar       []   [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT) ],
-         real   g_Slope_PPM    [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-         real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const real dt, const real dh, const real Gamma,
@@ -162,6 +186,7 @@ void CUFLU_FluidSolver_CTU(
    const bool NormPassive, const int NNorm,
    const bool JeansMinPres, const real JeansMinPres_Coeff )
 #else
+template <int LR, int RS>
 void CPU_FluidSolver_CTU(
    const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],
          real   g_Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],
@@ -172,10 +197,10 @@ void CPU_FluidSolver_CTU(
          real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
-         real   g_PriVar       []   [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT) ],
-         real   g_Slope_PPM    [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-         real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const int NPatchGroup, const real dt, const real dh, const real Gamma,
@@ -184,10 +209,14 @@ void CPU_FluidSolver_CTU(
    const double Time, const OptGravityType_t GravityType,
    const double c_ExtAcc_AuxArray[], const real MinDens, const real MinPres,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int c_NormIdx[],
-   const bool JeansMinPres, const real JeansMinPres_Coeff )
+   const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab )
 #endif // #ifdef __CUDACC__ ... else ...
 {
 
+#  ifdef __CUDACC__
+   const int  LR                   = LR_SCHEME;
+   const int  RS                   = RSOLVER;
+#  endif
 #  ifdef UNSPLIT_GRAVITY
    const bool CorrHalfVel          = true;
 #  else
@@ -214,16 +243,21 @@ void CPU_FluidSolver_CTU(
       const int array_idx = blockIdx.x;
 #     else
 #     ifdef OPENMP
-      const int array_idx = omp_get_thread_num();
+//    --> use the thread index in the innermost team with more than one thread since the solver may be invoked
+//        by an OpenMP task with a single-thread team (e.g., for OPT__TASK_GRAPH), where omp_get_thread_num() == 0
+      int TeamLv = omp_get_level();
+      while ( TeamLv > 0  &&  omp_get_team_size(TeamLv) == 1 )    TeamLv --;
+
+      const int array_idx = omp_get_ancestor_thread_num( TeamLv );
 #     else
       const int array_idx = 0;
 #     endif
 #     endif // #ifdef __CUDACC__ ... else ...
 
-      real (*const g_FC_Var_1PG   )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = g_FC_Var   [array_idx];
-      real (*const g_FC_Flux_1PG  )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = g_FC_Flux  [array_idx];
+      real (*const g_FC_Var_1PG   )[NCOMP_LR][ CUBE(N_FC_VAR)    ] = g_FC_Var   [array_idx];
+      real (*const g_FC_Flux_1PG  )[NCOMP_LR][ CUBE(N_FC_FLUX)   ] = g_FC_Flux  [array_idx];
       real (*const g_PriVar_1PG   )                      [ CUBE(FLU_NXT)     ] = g_PriVar   [array_idx];
-      real (*const g_Slope_PPM_1PG)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ] = g_Slope_PPM[array_idx];
+      real (*const g_Slope_PPM_1PG)[NCOMP_LR][ CUBE(N_SLOPE_PPM) ] = g_Slope_PPM[array_idx];
 
 #     ifdef MHD
       real (*const g_FC_Mag_Half_1PG)[ FLU_NXT_P1*SQR(FLU_NXT) ] = g_FC_Mag_Half[array_idx];
@@ -248,17 +282,60 @@ void CPU_FluidSolver_CTU(
       for (int P=0; P<NPatchGroup; P++)
 #     endif
       {
+//       0. fused CPU solver: evaluate steps 1-8 slab by slab along z
+//          --> for a slab of output cells [kBeg_out, kEnd_out), steps 1, 2/4, and 6 evaluate the planes of g_FC_Var[],
+//              half-step fluxes/corrected g_FC_Var[], and full-step fluxes up to kEnd_out+3, kEnd_out+2,
+//              and kEnd_out+1, respectively, which are the planes required by the subsequent steps
+#        if ( !defined __CUDACC__  &&  !defined MHD )
+         if ( FusedSlab > 0 )
+         {
+            for (int kBeg_out=0; kBeg_out<PS2; kBeg_out+=FusedSlab)
+            {
+               const int kEnd_out = MIN( kBeg_out+FusedSlab, PS2 );
+               const int kBeg_1   = ( kBeg_out == 0 ) ? 0 : kBeg_out + 1;
+               const int kBeg_2   = ( kBeg_out == 0 ) ? 0 : kBeg_out + 2;
+               const int kBeg_3   = ( kBeg_out == 0 ) ? 0 : kBeg_out + 3;
+
+               Hydro_DataReconstruction <LR, RS> ( g_Flu_Array_In[P], g_Mag_Array_In[P], g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                                   Con2Pri_Yes, FLU_NXT, LR_GHOST_SIZE, Gamma, LR_Limiter, MinMod_Coeff, dt, dh,
+                                                   MinDens, MinPres, NormPassive, NNorm, c_NormIdx, JeansMinPres, JeansMinPres_Coeff,
+                                                   kBeg_3, kEnd_out+3 );
+
+               Hydro_ComputeFlux <RS> ( g_FC_Var_1PG, g_FC_Flux_1PG, N_HF_FLUX, 0, 0, Gamma,
+                                        CorrHalfVel_No, NULL, NULL,
+                                        NULL_REAL, NULL_REAL, NULL_REAL, GRAVITY_NONE, NULL, MinPres,
+                                        StoreFlux_No, NULL, kBeg_2, kEnd_out+2 );
+
+               Hydro_TGradientCorrection( g_FC_Var_1PG, g_FC_Flux_1PG, g_Mag_Array_In[P], g_FC_Mag_Half_1PG, g_EC_Ele_1PG,
+                                          g_PriVar_1PG, dt, dh, Gamma, MinDens, MinPres, kBeg_2, kEnd_out+2 );
+
+               Hydro_ComputeFlux <RS> ( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, 0, 1, Gamma,
+                                        CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
+                                        dt, dh, Time, GravityType, c_ExtAcc_AuxArray, MinPres,
+                                        StoreFlux, g_Flux_Array[P], kBeg_1, kEnd_out+1 );
+
+               Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
+                                     g_FC_Flux_1PG, dt, dh, Gamma, MinDens, MinPres, DualEnergySwitch,
+                                     NormPassive, NNorm, c_NormIdx, StoreFlux, g_Flux_Array[P], kBeg_out, kEnd_out );
+            } // for (int kBeg_out=0; kBeg_out<PS2; kBeg_out+=FusedSlab)
+
+            continue;
+         } // if ( FusedSlab > 0 )
+#        endif // #if ( !defined __CUDACC__  &&  !defined MHD )
+
+
 //       1. evaluate the face-centered values at the half time-step
-         Hydro_DataReconstruction( g_Flu_Array_In[P], g_Mag_Array_In[P], g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                   Con2Pri_Yes, FLU_NXT, LR_GHOST_SIZE, Gamma, LR_Limiter, MinMod_Coeff, dt, dh,
-                                   MinDens, MinPres, NormPassive, NNorm, c_NormIdx, JeansMinPres, JeansMinPres_Coeff );
+         Hydro_DataReconstruction <LR, RS> ( g_Flu_Array_In[P], g_Mag_Array_In[P], g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                             Con2Pri_Yes, FLU_NXT, LR_GHOST_SIZE, Gamma, LR_Limiter, MinMod_Coeff, dt, dh,
+                                             MinDens, MinPres, NormPassive, NNorm, c_NormIdx, JeansMinPres, JeansMinPres_Coeff,
+                                             0, N_FC_VAR );
 
 
 //       2. evaluate the face-centered half-step fluxes by solving the Riemann problem
-         Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_HF_FLUX, 0, 0, Gamma,
-                            CorrHalfVel_No, NULL, NULL,
-                            NULL_REAL, NULL_REAL, NULL_REAL, GRAVITY_NONE, NULL, MinPres,
-                            StoreFlux_No, NULL );
+         Hydro_ComputeFlux <RS> ( g_FC_Var_1PG, g_FC_Flux_1PG, N_HF_FLUX, 0, 0, Gamma,
+                                  CorrHalfVel_No, NULL, NULL,
+                                  NULL_REAL, NULL_REAL, NULL_REAL, GRAVITY_NONE, NULL, MinPres,
+                                  StoreFlux_No, NULL, 0, N_FC_FLUX );
 
 
 //       3. evaluate electric field and update B field at the half time-step
@@ -274,7 +351,7 @@ void CPU_FluidSolver_CTU(
 
 //       4. correct the face-centered variables by the transverse flux gradients
          Hydro_TGradientCorrection( g_FC_Var_1PG, g_FC_Flux_1PG, g_Mag_Array_In[P], g_FC_Mag_Half_1PG, g_EC_Ele_1PG, g_PriVar_1PG,
-                                    dt, dh, Gamma, MinDens, MinPres );
+                                    dt, dh, Gamma, MinDens, MinPres, 0, N_FC_VAR );
 
 
 //       5. evaluate the cell-centered primitive variables at the half time-step
@@ -292,10 +369,10 @@ void CPU_FluidSolver_CTU(
          const int NSkip_N = 0;
          const int NSkip_T = 1;
 #        endif
-         Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T, Gamma,
-                            CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
-                            dt, dh, Time, GravityType, c_ExtAcc_AuxArray, MinPres,
-                            StoreFlux, g_Flux_Array[P] );
+         Hydro_ComputeFlux <RS> ( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T, Gamma,
+                                  CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
+                                  dt, dh, Time, GravityType, c_ExtAcc_AuxArray, MinPres,
+                                  StoreFlux, g_Flux_Array[P], 0, N_FC_FLUX );
 
 
 //       7. evaluate electric field and update B field at the full time-step
@@ -315,7 +392,7 @@ void CPU_FluidSolver_CTU(
 //       8. full-step evolution of the fluid data
          Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
                                g_FC_Flux_1PG, dt, dh, Gamma, MinDens, MinPres, DualEnergySwitch,
-                               NormPassive, NNorm, c_NormIdx );
+                               NormPassive, NNorm, c_NormIdx, StoreFlux, g_Flux_Array[P], 0, PS2 );
 
       } // loop over all patch groups
    } // OpenMP parallel region
@@ -331,6 +408,7 @@ void CPU_FluidSolver_CTU(
 // Note        :  1. Ref: (a) Stone et al., ApJS, 178, 137 (2008)
 //                        (b) Gardiner & Stone, J. Comput. Phys., 227, 4123 (2008)
 //                2. Assuming "N_FC_VAR == N_HF_FLUX"
+//                3. Only the z planes [kBeg, kEnd) of g_FC_Var[] are corrected
 //
 // Parameter   :  g_FC_Var     : Array to store the input and output face-centered conserved variables
 //                               --> Accessed with the stride N_FC_VAR
@@ -344,16 +422,18 @@ void CPU_FluidSolver_CTU(
 //                dh           : Cell size
 //                Gamma        : Ratio of specific heats
 //                MinDens/Pres : Minimum allowed density and pressure
+//                kBeg/kEnd    : Only correct the z planes [kBeg, kEnd) of g_FC_Var[]
+//                               --> Set to [0, N_FC_VAR) to correct all cells
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE
-void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)  ],
-                                const real g_FC_Flux  [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_LR][ CUBE(N_FC_VAR)  ],
+                                const real g_FC_Flux  [][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                                 const real g_FC_B_In  [][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                 const real g_FC_B_Half[][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                 const real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
                                 const real g_PriVar   [][ CUBE(FLU_NXT) ],
                                 const real dt, const real dh, const real Gamma,
-                                const real MinDens, const real MinPres )
+                                const real MinDens, const real MinPres, const int kBeg, const int kEnd )
 {
 
    const int  didx_flux[3]   = { 1, N_HF_FLUX, SQR(N_HF_FLUX) };
@@ -395,15 +475,16 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 
       const int size_i  = ( N_FC_VAR - 2*nskip[0] );
       const int size_j  = ( N_FC_VAR - 2*nskip[1] );
-      const int size_k  = ( N_FC_VAR - 2*nskip[2] );
       const int size_ij = size_i*size_j;
+      const int kBeg_fc = MAX( kBeg, nskip[2] );
+      const int kEnd_fc = MIN( kEnd, N_FC_VAR-nskip[2] );
 
-      CGPU_LOOP( idx0, size_i*size_j*size_k )
+      CGPU_LOOP( idx0, size_ij*(kEnd_fc-kBeg_fc) )
       {
 //       i/j/k0 start from zero
          const int i0         = idx0 % size_i;
          const int j0         = idx0 % size_ij / size_i;
-         const int k0         = idx0 / size_ij;
+         const int k0         = idx0 / size_ij + kBeg_fc - nskip[2];
 
          const int i_fc_var   = i0 + nskip[0];
          const int j_fc_var   = j0 + nskip[1];
@@ -415,7 +496,7 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
          const int idx_fluxL2 = idx_fluxR - didx_flux[TDir2];
 
 //       0. load g_FC_Var[] to the local variable fc[] to reduce the GPU global memory access
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             fc_var[0][v] = g_FC_Var[faceL][v][idx_fc_var];
             fc_var[1][v] = g_FC_Var[faceR][v][idx_fc_var];
@@ -423,7 +504,7 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 
 
 //       1. calculate the transverse fluid flux gradients and update the corresponding face-centered fluid variables
-         for (int v=0; v<NCOMP_TOTAL; v++)
+         for (int v=0; v<NCOMP_TOTAL_LR; v++)
          {
             real Correct, TGrad1, TGrad2;
 
@@ -557,20 +638,20 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
             fc_var[f][0] = FMAX( fc_var[f][0], MinDens );
             fc_var[f][4] = Hydro_CheckMinPresInEngy( fc_var[f][0], fc_var[f][1], fc_var[f][2], fc_var[f][3], fc_var[f][4],
                                                      Gamma_m1, _Gamma_m1, MinPres, EngyB );
-#           if ( NCOMP_PASSIVE > 0 )
+#           if ( NCOMP_PASSIVE_LR > 0 )
             for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
             fc_var[f][v] = FMAX( fc_var[f][v], TINY_NUMBER );
 #           endif
          }
 
 //       store the results to g_FC_Var[]
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             g_FC_Var[faceL][v][idx_fc_var] = fc_var[0][v];
             g_FC_Var[faceR][v][idx_fc_var] = fc_var[1][v];
          }
 
-      } // CGPU_LOOP( idx0, size_i*size_j*size_k )
+      } // CGPU_LOOP( idx0, size_ij*(kEnd_fc-kBeg_fc) )
    } // for (int d=0; d<3; d++)
 
 
@@ -582,4 +663,38 @@ void Hydro_TGradientCorrection(       real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][
 
 
 
+// explicit template instantiation
+#ifndef __CUDACC__
+#define INSTANTIATE( LR, RS )                                                                                 \
+template void CPU_FluidSolver_CTU <LR, RS> (                                                                  \
+   const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],                                              \
+         real   g_Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],                                                  \
+   const real   g_Mag_Array_In [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],                                      \
+         real   g_Mag_Array_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],                                               \
+         char   g_DE_Array_Out [][ CUBE(PS2) ],                                                               \
+         real   g_Flux_Array   [][9][NCOMP_TOTAL][ SQR(PS2) ],                                                \
+         real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],                                                 \
+   const double g_Corner_Array [][3],                                                                         \
+   const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],                                                         \
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],                                              \
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],                                          \
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],                                             \
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],                                            \
+         real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],                                      \
+         real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],                                               \
+   const int NPatchGroup, const real dt, const real dh, const real Gamma,                                     \
+   const bool StoreFlux, const bool StoreElectric,                                                            \
+   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,                                                    \
+   const double Time, const OptGravityType_t GravityType,                                                     \
+   const double c_ExtAcc_AuxArray[], const real MinDens, const real MinPres,                                  \
+   const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int c_NormIdx[],               \
+   const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab );
+
+HYDRO_FOR_EACH_SCHEME( INSTANTIATE )
+
+#undef INSTANTIATE
+#endif // #ifndef __CUDACC__
+
+
+
 #endif // #if ( MODEL == HYDRO  &&  FLU_SCHEME == CTU )
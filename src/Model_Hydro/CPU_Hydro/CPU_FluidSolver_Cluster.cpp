@@ -0,0 +1,203 @@
+#include "GAMER.h"
+#include "CUFLU.h"
+
+#ifdef FLU_CLUSTER
+
+
+
+// re-instantiate the MHM/MHM_RP/CTU solvers for input/output arrays of a cluster of FLU_CLU_NPG^3 patch groups
+// --> all array sizes in the fluid solvers (e.g., FLU_NXT, N_FC_VAR, and N_FC_FLUX) are derived from PS2 and thus
+//     automatically follow the cluster size after redefining PS1/PS2 below
+// --> rename all non-static functions whose signatures or loops depend on the array sizes to avoid conflicting with
+//     the patch-group solvers; size-independent functions (e.g., Hydro_Con2Pri() and the Riemann solvers) are still
+//     linked to the original implementations
+// --> PS1 is only used for storing the coarse-fine fluxes, which is always disabled for clusters
+#undef  PS1
+#undef  PS2
+#define PS1    ( FLU_CLU_NPG*PATCH_SIZE )
+#define PS2    ( 2*PS1 )
+
+#if ( FLU_NXT != FLU_CLU_NXT  ||  PS2 != FLU_CLU_NOUT )
+#  error : ERROR : inconsistent FLU_NXT/PS2 and FLU_CLU_NXT/FLU_CLU_NOUT !!
+#endif
+
+#define CPU_FluidSolver_MHM         CPU_FluidSolver_MHM_Cluster
+#define CPU_FluidSolver_CTU         CPU_FluidSolver_CTU_Cluster
+#define Hydro_DataReconstruction    Hydro_DataReconstruction_Cluster
+#define Hydro_ComputeFlux           Hydro_ComputeFlux_Cluster
+#define Hydro_FullStepUpdate        Hydro_FullStepUpdate_Cluster
+#define Hydro_TGradientCorrection   Hydro_TGradientCorrection_Cluster
+
+#if   ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+#  include "CPU_FluidSolver_MHM.cpp"
+#elif ( FLU_SCHEME == CTU )
+#  include "CPU_FluidSolver_CTU.cpp"
+#endif
+#include "CPU_Shared_DataReconstruction.cpp"
+#include "CPU_Shared_ComputeFlux.cpp"
+#include "CPU_Shared_FullStepUpdate.cpp"
+
+
+// per-thread scratch arrays of the cluster solver (allocated by CPU_FluidSolver_Cluster_MemAllocate())
+static real (*h_PriVar_C)      [NCOMP_LR][ CUBE(FLU_NXT)     ] = NULL;
+static real (*h_Slope_PPM_C)[3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ] = NULL;
+static real (*h_FC_Var_C)   [6][NCOMP_LR][ CUBE(N_FC_VAR)    ] = NULL;
+static real (*h_FC_Flux_C)  [3][NCOMP_LR][ CUBE(N_FC_FLUX)   ] = NULL;
+
+
+// function pointer to the cluster solver instantiated for the adopted data reconstruction scheme and Riemann solver
+typedef void (*ClusterSolver_t)(
+   const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],
+         real   g_Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],
+   const real   g_Mag_Array_In [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
+         real   g_Mag_Array_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
+         char   g_DE_Array_Out [][ CUBE(PS2) ],
+         real   g_Flux_Array   [][9][NCOMP_TOTAL][ SQR(PS2) ],
+         real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
+   const double g_Corner_Array [][3],
+   const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],
+         real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
+         real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
+   const int NPatchGroup, const real dt, const real dh, const real Gamma,
+   const bool StoreFlux, const bool StoreElectric,
+   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+   const double Time, const OptGravityType_t GravityType,
+   const double c_ExtAcc_AuxArray[], const real MinDens, const real MinPres,
+   const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int c_NormIdx[],
+   const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_FluidSolver_Cluster
+// Description :  Use CPU to advance clusters of FLU_CLU_NPG^3 patch groups by the MHM/MHM_RP/CTU schemes
+//
+// Note        :  1. Each cluster is evaluated as a single uniform block of FLU_CLU_NOUT^3 cells with a single ghost
+//                   shell of FLU_GHOST_SIZE cells, which avoids evaluating the ghost zones shared by adjacent
+//                   patch groups repeatedly
+//                2. Invoked by InvokeSolver() when OPT__FLU_CLUSTER is on
+//                   --> Clusters are prepared by Flu_Prepare_Cluster() and stored by Flu_Close_Cluster()
+//                3. Do not store the coarse-fine fluxes since Flu_FindCluster() only selects clusters without
+//                   any coarse-fine boundary
+//                4. The results are bitwise identical to those of CPU_FluidSolver() since the scheme is
+//                   translation invariant
+//
+// Parameter   :  h_Flu_Array_In     : Host array storing the input fluid variables
+//                h_Flu_Array_Out    : Host array to store the output fluid variables
+//                h_DE_Array_Out     : Host array to store the dual-energy status
+//                NCluster           : Number of clusters to be evaluated
+//                dt                 : Time interval to advance solution
+//                dh                 : Grid size
+//                Gamma              : Ratio of specific heats
+//                LR_Limiter         : Slope limiter for the data reconstruction
+//                MinMod_Coeff       : Coefficient of the generalized MinMod limiter
+//                LR_Scheme          : Data reconstruction scheme (PLM/PPM)
+//                RSolver            : Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD)
+//                MinDens/Pres       : Minimum allowed density and pressure
+//                DualEnergySwitch   : Use the dual-energy formalism if E_int/E_kin < DualEnergySwitch
+//                NormPassive        : true --> normalize passive scalars so that the sum of their mass density
+//                                              is equal to the gas mass density
+//                NNorm              : Number of passive scalars to be normalized
+//                NormIdx            : Target variable indices to be normalized
+//                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
+//                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
+//                FusedSlab          : Thickness of the slabs evaluated by the fused solvers (<= 0: disable)
+//-------------------------------------------------------------------------------------------------------
+void CPU_FluidSolver_Cluster( real h_Flu_Array_In[][FLU_NIN][ CUBE(FLU_CLU_NXT) ],
+                              real h_Flu_Array_Out[][FLU_NOUT][ CUBE(FLU_CLU_NOUT) ],
+                              char h_DE_Array_Out[][ CUBE(FLU_CLU_NOUT) ],
+                              const int NCluster, const real dt, const real dh, const real Gamma,
+                              const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                              const OptLRScheme_t LR_Scheme, const OptRSolver_t RSolver,
+                              const real MinDens, const real MinPres, const real DualEnergySwitch,
+                              const bool NormPassive, const int NNorm, const int NormIdx[],
+                              const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( h_PriVar_C == NULL )  Aux_Error( ERROR_INFO, "scratch arrays of the cluster solver are not allocated !!\n" );
+#  endif
+
+
+   const bool   StoreFlux_No      = false;
+   const bool   StoreElectric_No  = false;
+   const double Time_Useless      = NULL_REAL;
+   const double *ExtAcc_AuxArray  = NULL;
+
+// select the solver instantiated for LR_Scheme and RSolver (see GetHydroSolver() in CPU_FluidSolver.cpp)
+#  if   ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+#  define CLUSTER_SOLVER   CPU_FluidSolver_MHM_Cluster
+#  elif ( FLU_SCHEME == CTU )
+#  define CLUSTER_SOLVER   CPU_FluidSolver_CTU_Cluster
+#  endif
+#  define GET_SOLVER( LR, RS )   if ( LR_Scheme == LR  &&  RSolver == RS )  ClusterSolver = CLUSTER_SOLVER <LR, RS>;
+
+   ClusterSolver_t ClusterSolver = NULL;
+
+   HYDRO_FOR_EACH_SCHEME( GET_SOLVER )
+
+#  undef GET_SOLVER
+#  undef CLUSTER_SOLVER
+
+   if ( ClusterSolver == NULL )
+      Aux_Error( ERROR_INFO, "unsupported OPT__LR_SCHEME (%d) and OPT__RSOLVER (%d) !!\n", LR_Scheme, RSolver );
+
+
+   ClusterSolver( h_Flu_Array_In, h_Flu_Array_Out, NULL, NULL, h_DE_Array_Out, NULL, NULL, NULL, NULL,
+                  h_PriVar_C, h_Slope_PPM_C, h_FC_Var_C, h_FC_Flux_C, NULL, NULL,
+                  NCluster, dt, dh, Gamma, StoreFlux_No, StoreElectric_No, LR_Limiter, MinMod_Coeff,
+                  Time_Useless, GRAVITY_NONE, ExtAcc_AuxArray, MinDens, MinPres, DualEnergySwitch,
+                  NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff, FusedSlab );
+
+} // FUNCTION : CPU_FluidSolver_Cluster
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_FluidSolver_Cluster_MemAllocate
+// Description :  Allocate the per-thread scratch arrays of CPU_FluidSolver_Cluster()
+//
+// Note        :  1. Invoked by Init_MemAllocate_Fluid()
+//                2. The array sizes depend on the cluster size and thus must be allocated in this file
+//
+// Parameter   :  NThread : Number of OpenMP threads
+//-------------------------------------------------------------------------------------------------------
+void CPU_FluidSolver_Cluster_MemAllocate( const int NThread )
+{
+
+   h_FC_Var_C    = new real [NThread][6][NCOMP_LR][ CUBE(N_FC_VAR)    ];
+   h_FC_Flux_C   = new real [NThread][3][NCOMP_LR][ CUBE(N_FC_FLUX)   ];
+   h_PriVar_C    = new real [NThread]   [NCOMP_LR][ CUBE(FLU_NXT)     ];
+#  if ( LR_SCHEME == PPM )
+   h_Slope_PPM_C = new real [NThread][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ];
+#  endif
+
+} // FUNCTION : CPU_FluidSolver_Cluster_MemAllocate
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_FluidSolver_Cluster_MemFree
+// Description :  Free memory previously allocated by CPU_FluidSolver_Cluster_MemAllocate()
+//
+// Note        :  1. Invoked by End_MemFree_Fluid()
+//-------------------------------------------------------------------------------------------------------
+void CPU_FluidSolver_Cluster_MemFree()
+{
+
+   delete [] h_FC_Var_C;      h_FC_Var_C    = NULL;
+   delete [] h_FC_Flux_C;     h_FC_Flux_C   = NULL;
+   delete [] h_PriVar_C;      h_PriVar_C    = NULL;
+   delete [] h_Slope_PPM_C;   h_Slope_PPM_C = NULL;
+
+} // FUNCTION : CPU_FluidSolver_Cluster_MemFree
+
+
+
+#endif // #ifdef FLU_CLUSTER
@@ -16,57 +16,53 @@
 #include "CUFLU_Shared_ConstrainedTransport.cu"
 #endif
 
-#if   ( RSOLVER == EXACT )
+#ifndef MHD
 # include "CUFLU_Shared_RiemannSolver_Exact.cu"
-#elif ( RSOLVER == ROE )
-# include "CUFLU_Shared_RiemannSolver_Roe.cu"
-#elif ( RSOLVER == HLLE )
-# include "CUFLU_Shared_RiemannSolver_HLLE.cu"
-#elif ( RSOLVER == HLLC )
 # include "CUFLU_Shared_RiemannSolver_HLLC.cu"
-#elif ( RSOLVER == HLLD )
+#else
 # include "CUFLU_Shared_RiemannSolver_HLLD.cu"
 #endif
+# include "CUFLU_Shared_RiemannSolver_Roe.cu"
+# include "CUFLU_Shared_RiemannSolver_HLLE.cu"
 
 #else // #ifdef __CUDACC__
 
+template <int LR, int RS>
 void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
                                      real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-                                     real g_Slope_PPM[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
+                                     real g_FC_Var   [][NCOMP_LR][ CUBE(N_FC_VAR) ],
+                                     real g_Slope_PPM[][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
                                const bool Con2Pri, const int NIn, const int NGhost, const real Gamma,
                                const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
                                const real dt, const real dh, const real MinDens, const real MinPres,
                                const bool NormPassive, const int NNorm, const int NormIdx[],
-                               const bool JeansMinPres, const real JeansMinPres_Coeff );
-void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-                              real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                               const bool JeansMinPres, const real JeansMinPres_Coeff, const int kBeg, const int kEnd );
+template <int RS>
+void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_LR][ CUBE(N_FC_VAR) ],
+                              real g_FC_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T, const real Gamma,
                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],
                         const real dt, const real dh, const double Time,
                         const OptGravityType_t GravityType, const double ExtAcc_AuxArray[],
-                        const real MinPres, const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ] );
+                        const real MinPres, const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
+                        const int kBeg, const int kEnd );
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
-                           const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                           const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                            const real dt, const real dh, const real Gamma, const real MinDens, const real MinPres,
-                           const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[] );
-#if   ( RSOLVER == EXACT )
+                           const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
+                           const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
+                           const int kBeg, const int kEnd );
+#if ( FLU_SCHEME == MHM_RP )
 void Hydro_RiemannSolver_Exact( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[], const real Gamma );
-#elif ( RSOLVER == ROE )
 void Hydro_RiemannSolver_Roe( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                               const real Gamma, const real MinPres );
-#elif ( RSOLVER == HLLE )
 void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                const real Gamma, const real MinPres );
-#elif ( RSOLVER == HLLC )
 void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                const real Gamma, const real MinPres );
-#elif ( RSOLVER == HLLD )
 void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                const real Gamma, const real MinPres );
-#endif
-#if ( FLU_SCHEME == MHM_RP )
 void Hydro_Con2Pri( const real In[], real Out[], const real Gamma_m1, const real MinPres,
                     const bool NormPassive, const int NNorm, const int NormIdx[],
                     const bool JeansMinPres, const real JeansMinPres_Coeff );
@@ -74,7 +70,7 @@ real Hydro_CheckMinPresInEngy( const real Dens, const real MomX, const real MomY
                                const real Gamma_m1, const real _Gamma_m1, const real MinPres );
 #ifdef MHD
 void MHD_ComputeElectric(       real g_EC_Ele[][ CUBE(N_EC_ELE) ],
-                          const real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                          const real g_FC_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                           const real g_PriVar[][ CUBE(FLU_NXT) ],
                           const int NEle, const int NFlux, const int NPri, const int OffsetPri,
                           const real dt, const real dh,
@@ -93,16 +89,17 @@ void MHD_UpdateMagnetic( real *g_FC_Bx_Out, real *g_FC_By_Out, real *g_FC_Bz_Out
 
 // internal functions
 #if ( FLU_SCHEME == MHM_RP )
+template <int RS>
 GPU_DEVICE
 static void Hydro_RiemannPredict_Flux( const real g_ConVar[][ CUBE(FLU_NXT) ],
-                                             real g_Flux_Half[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                                             real g_Flux_Half[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                                        const real g_FC_B[][ SQR(FLU_NXT)*FLU_NXT_P1 ],
                                        const real g_CC_B[][ CUBE(FLU_NXT) ],
                                        const real Gamma, const real MinPres );
 GPU_DEVICE
 static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
                                   const real g_FC_B_Half[][ FLU_NXT_P1*SQR(FLU_NXT) ],
-                                  const real g_Flux_Half[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                                  const real g_Flux_Half[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                                         real g_PriVar_Half[][ CUBE(FLU_NXT) ],
                                   const real dt, const real dh, const real Gamma, const real MinDens, const real MinPres,
                                   const bool NormPassive, const int NNorm, const int NormIdx[],
@@ -127,6 +124,15 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                4. See include/CUFLU.h for the values and description of different symbolic constants
 //                   such as N_FC_VAR, N_FC_FLUX, N_SLOPE_PPM, N_FL_FLUX, N_HF_VAR
 //                5. Arrays with a prefix "g_" are stored in the global memory of GPU
+//                6. Fused CPU solver (FusedSlab > 0, MHM and pure hydro only)
+//                   --> Each patch group is evaluated slab by slab along z, where all steps from the data
+//                       reconstruction to the full-step update are applied to one slab of FusedSlab output cells
+//                       before proceeding to the next slab
+//                   --> See CPU_FluidSolver_CTU() for details
+//                7. The CPU solver is a template of the data reconstruction scheme (LR = PLM/PPM) and the Riemann
+//                   solver (RS = EXACT/ROE/HLLE/HLLC/HLLD), which are selected at runtime by CPU_FluidSolver()
+//                   --> See HYDRO_FOR_EACH_SCHEME() in CUFLU.h for the instantiated combinations
+//                   --> The GPU solver always adopts LR_SCHEME and RSOLVER set in the Makefile
 //
 // Parameter   :  g_Flu_Array_In     : Array storing the input fluid variables
 //                g_Flu_Array_Out    : Array to store the output fluid variables
@@ -174,6 +180,8 @@ static void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 //                                             highlight that this is a constant variable on GPU
 //                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
+//                FusedSlab          : Thickness of the slabs evaluated by the fused CPU solver
+//                                     --> <= 0: disable the fused solver
 //-------------------------------------------------------------------------------------------------------
 #ifdef __CUDACC__
 __global__
@@ -187,10 +195,10 @@ void CUFLU_FluidSolver_MHM(
          real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
-         real   g_PriVar       []   [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT) ],
-         real   g_Slope_PPM    [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-         real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const real dt, const real dh, const real Gamma,
@@ -201,6 +209,7 @@ void CUFLU_FluidSolver_MHM(
    const bool NormPassive, const int NNorm,
    const bool JeansMinPres, const real JeansMinPres_Coeff )
 #else
+template <int LR, int RS>
 void CPU_FluidSolver_MHM(
    const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],
          real   g_Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],
@@ -211,10 +220,10 @@ void CPU_FluidSolver_MHM(
          real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],
    const double g_Corner_Array [][3],
    const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],
-         real   g_PriVar       []   [NCOMP_TOTAL_PLUS_MAG][ CUBE(FLU_NXT) ],
-         real   g_Slope_PPM    [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
-         real   g_FC_Var       [][6][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-         real   g_FC_Flux      [][3][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],
          real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
          real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],
    const int NPatchGroup, const real dt, const real dh, const real Gamma,
@@ -223,10 +232,14 @@ void CPU_FluidSolver_MHM(
    const double Time, const OptGravityType_t GravityType,
    const double c_ExtAcc_AuxArray[], const real MinDens, const real MinPres,
    const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int c_NormIdx[],
-   const bool JeansMinPres, const real JeansMinPres_Coeff )
+   const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab )
 #endif // #ifdef __CUDACC__ ... else ...
 {
 
+#  ifdef __CUDACC__
+   const int  LR                   = LR_SCHEME;
+   const int  RS                   = RSOLVER;
+#  endif
 #  ifdef UNSPLIT_GRAVITY
    const bool CorrHalfVel          = true;
 #  else
@@ -256,16 +269,21 @@ void CPU_FluidSolver_MHM(
       const int array_idx = blockIdx.x;
 #     else
 #     ifdef OPENMP
-      const int array_idx = omp_get_thread_num();
+//    --> use the thread index in the innermost team with more than one thread since the solver may be invoked
+//        by an OpenMP task with a single-thread team (e.g., for OPT__TASK_GRAPH), where omp_get_thread_num() == 0
+      int TeamLv = omp_get_level();
+      while ( TeamLv > 0  &&  omp_get_team_size(TeamLv) == 1 )    TeamLv --;
+
+      const int array_idx = omp_get_ancestor_thread_num( TeamLv );
 #     else
       const int array_idx = 0;
 #     endif
 #     endif // #ifdef __CUDACC__ ... else ...
 
-      real (*const g_FC_Var_1PG   )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR)    ] = g_FC_Var   [array_idx];
-      real (*const g_FC_Flux_1PG  )[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX)   ] = g_FC_Flux  [array_idx];
+      real (*const g_FC_Var_1PG   )[NCOMP_LR][ CUBE(N_FC_VAR)    ] = g_FC_Var   [array_idx];
+      real (*const g_FC_Flux_1PG  )[NCOMP_LR][ CUBE(N_FC_FLUX)   ] = g_FC_Flux  [array_idx];
       real (*const g_PriVar_1PG   )                      [ CUBE(FLU_NXT)     ] = g_PriVar   [array_idx];
-      real (*const g_Slope_PPM_1PG)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ] = g_Slope_PPM[array_idx];
+      real (*const g_Slope_PPM_1PG)[NCOMP_LR][ CUBE(N_SLOPE_PPM) ] = g_Slope_PPM[array_idx];
 
 #     ifdef MHD
       real (*const g_FC_Mag_Half_1PG)[ FLU_NXT_P1*SQR(FLU_NXT) ] = g_FC_Mag_Half[array_idx];
@@ -276,7 +294,7 @@ void CPU_FluidSolver_MHM(
 #     endif
 
 #     if ( FLU_SCHEME == MHM_RP )
-      real (*const g_Flux_Half_1PG)[NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ] = g_FC_Flux_1PG;
+      real (*const g_Flux_Half_1PG)[NCOMP_LR][ CUBE(N_FC_FLUX) ] = g_FC_Flux_1PG;
       real (*const g_PriVar_Half_1PG )                   [ CUBE(FLU_NXT)   ] = g_PriVar_1PG;
 #     endif
 
@@ -292,6 +310,39 @@ void CPU_FluidSolver_MHM(
 #     endif
       {
 
+//       0. fused CPU solver: evaluate steps 1-4 slab by slab along z
+//          --> for a slab of output cells [kBeg_out, kEnd_out), steps 1 and 2 evaluate the planes of g_FC_Var[]
+//              and full-step fluxes up to kEnd_out+2 and kEnd_out+1, respectively, which are the planes required by
+//              the subsequent steps
+#        if ( !defined __CUDACC__  &&  FLU_SCHEME == MHM  &&  !defined MHD )
+         if ( FusedSlab > 0 )
+         {
+            for (int kBeg_out=0; kBeg_out<PS2; kBeg_out+=FusedSlab)
+            {
+               const int kEnd_out = MIN( kBeg_out+FusedSlab, PS2 );
+               const int kBeg_1   = ( kBeg_out == 0 ) ? 0 : kBeg_out + 1;
+               const int kBeg_2   = ( kBeg_out == 0 ) ? 0 : kBeg_out + 2;
+
+               Hydro_DataReconstruction <LR, RS> ( g_Flu_Array_In[P], NULL, g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                                   Con2Pri_Yes, FLU_NXT, LR_GHOST_SIZE, Gamma, LR_Limiter, MinMod_Coeff,
+                                                   dt, dh, MinDens, MinPres, NormPassive, NNorm, c_NormIdx,
+                                                   JeansMinPres, JeansMinPres_Coeff, kBeg_2, kEnd_out+2 );
+
+               Hydro_ComputeFlux <RS> ( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, 0, 1, Gamma,
+                                        CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
+                                        dt, dh, Time, GravityType, c_ExtAcc_AuxArray, MinPres,
+                                        StoreFlux, g_Flux_Array[P], kBeg_1, kEnd_out+1 );
+
+               Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
+                                     g_FC_Flux_1PG, dt, dh, Gamma, MinDens, MinPres, DualEnergySwitch,
+                                     NormPassive, NNorm, c_NormIdx, StoreFlux, g_Flux_Array[P], kBeg_out, kEnd_out );
+            } // for (int kBeg_out=0; kBeg_out<PS2; kBeg_out+=FusedSlab)
+
+            continue;
+         } // if ( FusedSlab > 0 )
+#        endif // #if ( !defined __CUDACC__  &&  FLU_SCHEME == MHM  &&  !defined MHD )
+
+
 //       1. half-step prediction
 //       1-a. MHM_RP: use Riemann solver to calculate the half-step fluxes
 #        if ( FLU_SCHEME == MHM_RP )
@@ -331,8 +382,8 @@ void CPU_FluidSolver_MHM(
 
 
 //       1-a-2. evaluate the half-step first-order fluxes by Riemann solver
-         Hydro_RiemannPredict_Flux( g_Flu_Array_In[P], g_Flux_Half_1PG, g_Mag_Array_In[P], g_PriVar_1PG+MAG_OFFSET,
-                                    Gamma, MinPres );
+         Hydro_RiemannPredict_Flux <RS> ( g_Flu_Array_In[P], g_Flux_Half_1PG, g_Mag_Array_In[P], g_PriVar_1PG+MAG_OFFSET,
+                                          Gamma, MinPres );
 
 
 //       1-a-3. evaluate electric field and update B field at the half time-step
@@ -354,18 +405,20 @@ void CPU_FluidSolver_MHM(
 
 //       1-a-5. evaluate the face-centered values by data reconstruction
 //              --> note that g_PriVar_Half_1PG[] returned by Hydro_RiemannPredict() stores the primitive variables
-         Hydro_DataReconstruction( NULL, g_FC_Mag_Half_1PG, g_PriVar_Half_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                   Con2Pri_No, N_HF_VAR, LR_GHOST_SIZE, Gamma, LR_Limiter, MinMod_Coeff, dt, dh,
-                                   MinDens, MinPres, NormPassive, NNorm, c_NormIdx, JeansMinPres, JeansMinPres_Coeff );
+         Hydro_DataReconstruction <LR, RS> ( NULL, g_FC_Mag_Half_1PG, g_PriVar_Half_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                             Con2Pri_No, N_HF_VAR, LR_GHOST_SIZE, Gamma, LR_Limiter, MinMod_Coeff, dt, dh,
+                                             MinDens, MinPres, NormPassive, NNorm, c_NormIdx, JeansMinPres, JeansMinPres_Coeff,
+                                             0, N_FC_VAR );
 
 
 //       1-b. MHM: use interpolated face-centered values to calculate the half-step fluxes
 #        elif ( FLU_SCHEME == MHM )
 
 //       evaluate the face-centered values by data reconstruction
-         Hydro_DataReconstruction( g_Flu_Array_In[P], NULL, g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
-                                   Con2Pri_Yes, FLU_NXT, LR_GHOST_SIZE, Gamma, LR_Limiter, MinMod_Coeff, dt, dh,
-                                   MinDens, MinPres, NormPassive, NNorm, c_NormIdx, JeansMinPres, JeansMinPres_Coeff );
+         Hydro_DataReconstruction <LR, RS> ( g_Flu_Array_In[P], NULL, g_PriVar_1PG, g_FC_Var_1PG, g_Slope_PPM_1PG,
+                                             Con2Pri_Yes, FLU_NXT, LR_GHOST_SIZE, Gamma, LR_Limiter, MinMod_Coeff, dt, dh,
+                                             MinDens, MinPres, NormPassive, NNorm, c_NormIdx, JeansMinPres, JeansMinPres_Coeff,
+                                             0, N_FC_VAR );
 
 #        endif // #if ( FLU_SCHEME == MHM_RP ) ... else ...
 
@@ -378,10 +431,10 @@ void CPU_FluidSolver_MHM(
          const int NSkip_N = 0;
          const int NSkip_T = 1;
 #        endif
-         Hydro_ComputeFlux( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T, Gamma,
-                            CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
-                            dt, dh, Time, GravityType, c_ExtAcc_AuxArray, MinPres,
-                            StoreFlux, g_Flux_Array[P] );
+         Hydro_ComputeFlux <RS> ( g_FC_Var_1PG, g_FC_Flux_1PG, N_FL_FLUX, NSkip_N, NSkip_T, Gamma,
+                                  CorrHalfVel, g_Pot_Array_USG[P], g_Corner_Array[P],
+                                  dt, dh, Time, GravityType, c_ExtAcc_AuxArray, MinPres,
+                                  StoreFlux, g_Flux_Array[P], 0, N_FC_FLUX );
 
 
 //       3. evaluate electric field and update B field at the full time-step
@@ -401,7 +454,7 @@ void CPU_FluidSolver_MHM(
 //       4. full-step evolution
          Hydro_FullStepUpdate( g_Flu_Array_In[P], g_Flu_Array_Out[P], g_DE_Array_Out[P], g_Mag_Array_Out[P],
                                g_FC_Flux_1PG, dt, dh, Gamma, MinDens, MinPres, DualEnergySwitch,
-                               NormPassive, NNorm, c_NormIdx );
+                               NormPassive, NNorm, c_NormIdx, StoreFlux, g_Flux_Array[P], 0, PS2 );
 
       } // loop over all patch groups
    } // OpenMP parallel region
@@ -416,7 +469,8 @@ void CPU_FluidSolver_MHM(
 // Description :  Evaluate the half-step face-centered fluxes by Riemann solver
 //
 // Note        :  1. Work for the MHM_RP scheme
-//                2. Currently support the exact, Roe, HLLE, and HLLC solvers
+//                2. Currently support the exact, Roe, HLLE, HLLC, and HLLD solvers
+//                   --> Set by the template parameter RS
 //                3. g_Flux_Half[] is accessed with a stride N_HF_FLUX
 //                   --> Fluxes on the **left** face of the (i+1,j+1,k+1) element in g_ConVar[] will
 //                       be stored in the (i,j,k) element of g_Flux_Half[]
@@ -431,9 +485,10 @@ void CPU_FluidSolver_MHM(
 //                Gamma       : Ratio of specific heats
 //                MinPres     : Minimum allowed pressure
 //-------------------------------------------------------------------------------------------------------
+template <int RS>
 GPU_DEVICE
 void Hydro_RiemannPredict_Flux( const real g_ConVar[][ CUBE(FLU_NXT) ],
-                                      real g_Flux_Half[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                                      real g_Flux_Half[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                                 const real g_FC_B[][ SQR(FLU_NXT)*FLU_NXT_P1 ],
                                 const real g_CC_B[][ CUBE(FLU_NXT) ],
                                 const real Gamma, const real MinPres )
@@ -442,9 +497,17 @@ void Hydro_RiemannPredict_Flux( const real g_ConVar[][ CUBE(FLU_NXT) ],
    const int didx_cvar[3] = { 1, FLU_NXT, SQR(FLU_NXT) };
    real ConVar_L[NCOMP_TOTAL_PLUS_MAG], ConVar_R[NCOMP_TOTAL_PLUS_MAG], Flux_1Face[NCOMP_TOTAL_PLUS_MAG];
 
-#  if ( RSOLVER == EXACT )
    const real Gamma_m1 = Gamma - (real)1.0;
    real PriVar_L[NCOMP_TOTAL], PriVar_R[NCOMP_TOTAL];
+
+// passive scalars are not stored in g_Flux_Half[] for SPLIT_PASSIVE
+// --> set them to zero once since the Riemann solvers still copy them
+#  ifdef SPLIT_PASSIVE
+   for (int v=NCOMP_TOTAL_LR; v<NCOMP_TOTAL; v++)
+   {
+      ConVar_L[v] = (real)0.0;
+      ConVar_R[v] = (real)0.0;
+   }
 #  endif
 
 
@@ -506,7 +569,7 @@ void Hydro_RiemannPredict_Flux( const real g_ConVar[][ CUBE(FLU_NXT) ],
          const int idx_cvar = IDX321( i_cvar, j_cvar, k_cvar, FLU_NXT, FLU_NXT );
 
 //       get the left and right fluid variables
-         for (int v=0; v<NCOMP_TOTAL; v++)
+         for (int v=0; v<NCOMP_TOTAL_LR; v++)
          {
             ConVar_L[v] = g_ConVar[v][ idx_cvar                ];
             ConVar_R[v] = g_ConVar[v][ idx_cvar + didx_cvar[d] ];
@@ -531,28 +594,41 @@ void Hydro_RiemannPredict_Flux( const real g_ConVar[][ CUBE(FLU_NXT) ],
 #        endif
 
 //       invoke the Riemann solver
-#        if   ( RSOLVER == EXACT  &&  !defined MHD )
-         const bool NormPassive_No  = false;  // do NOT convert any passive variable to mass fraction for the Riemann solvers
-         const bool JeansMinPres_No = false;
-
-         Hydro_Con2Pri( ConVar_L, PriVar_L, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
-         Hydro_Con2Pri( ConVar_R, PriVar_R, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
-
-         Hydro_RiemannSolver_Exact( d, Flux_1Face, PriVar_L, PriVar_R, Gamma );
-#        elif ( RSOLVER == ROE )
-         Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
-#        elif ( RSOLVER == HLLE )
-         Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
-#        elif ( RSOLVER == HLLC  &&  !defined MHD )
-         Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
-#        elif ( RSOLVER == HLLD  &&  defined MHD )
-         Hydro_RiemannSolver_HLLD ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
-#        else
-#        error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD) !!
-#        endif
+         switch ( RS )
+         {
+#           ifndef MHD
+            case EXACT :
+            {
+               const bool NormPassive_No  = false;  // do NOT convert any passive variable to mass fraction for the Riemann solvers
+               const bool JeansMinPres_No = false;
+
+               Hydro_Con2Pri( ConVar_L, PriVar_L, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
+               Hydro_Con2Pri( ConVar_R, PriVar_R, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
+
+               Hydro_RiemannSolver_Exact( d, Flux_1Face, PriVar_L, PriVar_R, Gamma );
+            }
+            break;
+
+            case HLLC :
+               Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
+            break;
+#           else
+            case HLLD :
+               Hydro_RiemannSolver_HLLD ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
+            break;
+#           endif // #ifndef MHD ... else ...
+
+            case ROE :
+               Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
+            break;
+
+            case HLLE :
+               Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
+            break;
+         } // switch ( RS )
 
 //       store the results in g_Flux_Half[]
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_Flux_Half[d][v][idx_flux] = Flux_1Face[v];
+         for (int v=0; v<NCOMP_LR; v++)   g_Flux_Half[d][v][idx_flux] = Flux_1Face[v];
       } // CGPU_LOOP( idx, N_HF_FLUX*SQR(N_HF_FLUX-1) )
    } // for (int d=0; d<3; d++)
 
@@ -597,7 +673,7 @@ void Hydro_RiemannPredict_Flux( const real g_ConVar[][ CUBE(FLU_NXT) ],
 GPU_DEVICE
 void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
                            const real g_FC_B_Half[][ FLU_NXT_P1*SQR(FLU_NXT) ],
-                           const real g_Flux_Half[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                           const real g_Flux_Half[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                                  real g_PriVar_Half[][ CUBE(FLU_NXT) ],
                            const real dt, const real dh, const real Gamma, const real MinDens, const real MinPres,
                            const bool NormPassive, const int NNorm, const int NormIdx[],
@@ -633,11 +709,11 @@ void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
       const int k_in     = k_out + 1;
       const int idx_in   = IDX321( i_in, j_in, k_in, FLU_NXT, FLU_NXT );
 
-      real out_con[NCOMP_TOTAL_PLUS_MAG], out_pri[NCOMP_TOTAL_PLUS_MAG], dflux[3][NCOMP_TOTAL];
+      real out_con[NCOMP_TOTAL_PLUS_MAG], out_pri[NCOMP_TOTAL_PLUS_MAG], dflux[3][NCOMP_TOTAL_LR];
 
 //    calculate the flux differences of the fluid variables
       for (int d=0; d<3; d++)
-      for (int v=0; v<NCOMP_TOTAL; v++)
+      for (int v=0; v<NCOMP_TOTAL_LR; v++)
       {
 #        ifdef MHD
          dflux[d][v] = g_Flux_Half[d][v][idx_flux] - g_Flux_Half[d][v][ idx_flux - didx_flux[d] ];
@@ -647,9 +723,15 @@ void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
       }
 
 //    update the input cell-centered conserved variables with the flux differences
-      for (int v=0; v<NCOMP_TOTAL; v++)
+      for (int v=0; v<NCOMP_TOTAL_LR; v++)
          out_con[v] = g_ConVar_In[v][idx_in] - dt_dh2*( dflux[0][v] + dflux[1][v] + dflux[2][v] );
 
+//    passive scalars are excluded from the half-step prediction for SPLIT_PASSIVE
+#     ifdef SPLIT_PASSIVE
+      for (int v=NCOMP_TOTAL_LR; v<NCOMP_TOTAL; v++)
+         out_con[v] = (real)0.0;
+#     endif
+
 //    compute the cell-centered half-step B field
 #     ifdef MHD
       MHD_GetCellCenteredBField( out_con+MAG_OFFSET, g_FC_B_Half[0], g_FC_B_Half[1], g_FC_B_Half[2],
@@ -664,7 +746,7 @@ void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 #     endif
       out_con[0] = FMAX( out_con[0], MinDens );
       out_con[4] = Hydro_CheckMinPresInEngy( out_con[0], out_con[1], out_con[2], out_con[3], out_con[4], Gamma_m1, _Gamma_m1, MinPres, EngyB );
-#     if ( NCOMP_PASSIVE > 0 )
+#     if ( NCOMP_PASSIVE_LR > 0 )
       for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
       out_con[v] = FMAX( out_con[v], TINY_NUMBER );
 #     endif
@@ -673,7 +755,7 @@ void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
       Hydro_Con2Pri( out_con, out_pri, Gamma_m1, MinPres, NormPassive, NNorm, NormIdx, JeansMinPres, JeansMinPres_Coeff );
 
 //    store the results in g_PriVar_Half[]
-      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_PriVar_Half[v][idx_out] = out_pri[v];
+      for (int v=0; v<NCOMP_LR; v++)   g_PriVar_Half[v][idx_out] = out_pri[v];
    } // i,j,k
 
 
@@ -686,4 +768,38 @@ void Hydro_RiemannPredict( const real g_ConVar_In[][ CUBE(FLU_NXT) ],
 
 
 
+// explicit template instantiation
+#ifndef __CUDACC__
+#define INSTANTIATE( LR, RS )                                                                                 \
+template void CPU_FluidSolver_MHM <LR, RS> (                                                                  \
+   const real   g_Flu_Array_In [][NCOMP_TOTAL][ CUBE(FLU_NXT) ],                                              \
+         real   g_Flu_Array_Out[][NCOMP_TOTAL][ CUBE(PS2) ],                                                  \
+   const real   g_Mag_Array_In [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],                                      \
+         real   g_Mag_Array_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],                                               \
+         char   g_DE_Array_Out [][ CUBE(PS2) ],                                                               \
+         real   g_Flux_Array   [][9][NCOMP_TOTAL][ SQR(PS2) ],                                                \
+         real   g_Ele_Array    [][9][NCOMP_ELE][ PS2P1*PS2 ],                                                 \
+   const double g_Corner_Array [][3],                                                                         \
+   const real   g_Pot_Array_USG[][ CUBE(USG_NXT_F) ],                                                         \
+         real   g_PriVar       []   [NCOMP_LR][ CUBE(FLU_NXT) ],                                              \
+         real   g_Slope_PPM    [][3][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],                                          \
+         real   g_FC_Var       [][6][NCOMP_LR][ CUBE(N_FC_VAR) ],                                             \
+         real   g_FC_Flux      [][3][NCOMP_LR][ CUBE(N_FC_FLUX) ],                                            \
+         real   g_FC_Mag_Half  [][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],                                      \
+         real   g_EC_Ele       [][NCOMP_MAG][ CUBE(N_EC_ELE) ],                                               \
+   const int NPatchGroup, const real dt, const real dh, const real Gamma,                                     \
+   const bool StoreFlux, const bool StoreElectric,                                                            \
+   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,                                                    \
+   const double Time, const OptGravityType_t GravityType,                                                     \
+   const double c_ExtAcc_AuxArray[], const real MinDens, const real MinPres,                                  \
+   const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int c_NormIdx[],               \
+   const bool JeansMinPres, const real JeansMinPres_Coeff, const int FusedSlab );
+
+HYDRO_FOR_EACH_SCHEME( INSTANTIATE )
+
+#undef INSTANTIATE
+#endif // #ifndef __CUDACC__
+
+
+
 #endif // #if (  MODEL == HYDRO  &&  ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP )  )
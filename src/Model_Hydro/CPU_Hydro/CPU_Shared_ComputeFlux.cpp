@@ -10,19 +10,17 @@
 
 
 // external functions
+// --> all Riemann solvers are included since the adopted one is a template parameter of Hydro_ComputeFlux()
 #ifdef __CUDACC__
 
-#if   ( RSOLVER == EXACT )
+#ifndef MHD
 # include "CUFLU_Shared_RiemannSolver_Exact.cu"
-#elif ( RSOLVER == ROE )
-# include "CUFLU_Shared_RiemannSolver_Roe.cu"
-#elif ( RSOLVER == HLLE )
-# include "CUFLU_Shared_RiemannSolver_HLLE.cu"
-#elif ( RSOLVER == HLLC )
 # include "CUFLU_Shared_RiemannSolver_HLLC.cu"
-#elif ( RSOLVER == HLLD )
+#else
 # include "CUFLU_Shared_RiemannSolver_HLLD.cu"
 #endif
+# include "CUFLU_Shared_RiemannSolver_Roe.cu"
+# include "CUFLU_Shared_RiemannSolver_HLLE.cu"
 
 #ifdef UNSPLIT_GRAVITY
 # include "../../SelfGravity/GPU_Gravity/CUPOT_ExternalAcc.cu"
@@ -30,24 +28,29 @@
 
 #else // #ifdef __CUDACC__
 
-#if   ( RSOLVER == EXACT )
 void Hydro_Con2Pri( const real In[], real Out[], const real Gamma_m1, const real MinPres,
                     const bool NormPassive, const int NNorm, const int NormIdx[],
                     const bool JeansMinPres, const real JeansMinPres_Coeff );
 void Hydro_RiemannSolver_Exact( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[], const real Gamma );
-#elif ( RSOLVER == ROE )
 void Hydro_RiemannSolver_Roe( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                               const real Gamma, const real MinPres );
-#elif ( RSOLVER == HLLE )
 void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                const real Gamma, const real MinPres );
-#elif ( RSOLVER == HLLC )
 void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                const real Gamma, const real MinPres );
-#elif ( RSOLVER == HLLD )
 void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real L_In[], const real R_In[],
                                const real Gamma, const real MinPres );
-#endif
+#ifdef RSOLVER_BATCH
+void Hydro_RiemannSolver_Roe_Batch ( const int XYZ, const int NFace, real Flux_Out[][RSOLVER_BATCH],
+                                     const real L_In[][RSOLVER_BATCH], const real R_In[][RSOLVER_BATCH],
+                                     const real Gamma, const real MinPres );
+void Hydro_RiemannSolver_HLLE_Batch( const int XYZ, const int NFace, real Flux_Out[][RSOLVER_BATCH],
+                                     const real L_In[][RSOLVER_BATCH], const real R_In[][RSOLVER_BATCH],
+                                     const real Gamma, const real MinPres );
+void Hydro_RiemannSolver_HLLC_Batch( const int XYZ, const int NFace, real Flux_Out[][RSOLVER_BATCH],
+                                     const real L_In[][RSOLVER_BATCH], const real R_In[][RSOLVER_BATCH],
+                                     const real Gamma, const real MinPres );
+#endif // #ifdef RSOLVER_BATCH
 #ifdef UNSPLIT_GRAVITY
 void ExternalAcc( real Acc[], const double x, const double y, const double z, const double Time, const double UserArray[] );
 #endif
@@ -55,6 +58,13 @@ void ExternalAcc( real Acc[], const double x, const double y, const double z, co
 #endif // #ifdef __CUDACC__ ... else ...
 
 
+// internal functions
+GPU_DEVICE static
+void StoreFlux( const int d, const real Flux_1Face[], const int idx_flux, const int i_flux, const int j_flux, const int k_flux,
+                real g_FC_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
+                const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ] );
+
+
 
 
 //-------------------------------------------------------------------------------------------------------
@@ -62,6 +72,9 @@ void ExternalAcc( real Acc[], const double x, const double y, const double z, co
 // Description :  Compute the face-centered fluxes by Riemann solver
 //
 // Note        :  1. Currently support the exact, HLLC, HLLE, HLLD, and Roe solvers
+//                   --> The adopted solver is set by the template parameter RS (EXACT/ROE/HLLE/HLLC/HLLD), which
+//                       is resolved at compile time so that it does not introduce any per-interface overhead
+//                   --> See HYDRO_FOR_EACH_RSOLVER() in CUFLU.h for the instantiated solvers
 //                2. g_FC_Var[] has the size of N_FC_VAR^3
 //                   --> (N_FC_VAR-1-2*NSkip_N)*(N_FC_VAR-2*NSkip_T)^2 fluxes will be computed
 //                   --> See below for the definitions of NSkip_N and NSkip_T
@@ -77,6 +90,12 @@ void ExternalAcc( real Acc[], const double x, const double y, const double z, co
 //                   --> Option "DumpIntFlux"
 //                6. For the unsplitting scheme in gravity (i.e., UNSPLIT_GRAVITY), this function also corrects the half-step
 //                   velocity by gravity when CorrHalfVel==true
+//                7. When RSOLVER_BATCH is defined (see CUFLU.h) and RS is ROE/HLLE/HLLC, the input states of RSOLVER_BATCH
+//                   consecutive interfaces are gathered into structure-of-arrays buffers and passed to the batched
+//                   Riemann solvers at once
+//                8. Only the fluxes with k in [kBeg, kEnd) are computed, which allows the fused CPU solvers to evaluate
+//                   a patch group slab by slab (see CPU_FluidSolver_MHM/CTU())
+//                   --> kEnd is truncated to the number of fluxes along z for each direction
 //
 // Parameter   :  g_FC_Var        : Array storing the input face-centered conserved variables
 //                g_FC_Flux       : Array to store the output face-centered fluxes
@@ -97,15 +116,19 @@ void ExternalAcc( real Acc[], const double x, const double y, const double z, co
 //                MinPres         : Minimum allowed pressure
 //                DumpIntFlux     : true --> store the inter-patch fluxes in g_IntFlux[]
 //                g_IntFlux       : Array for DumpIntFlux
+//                kBeg/kEnd       : Only compute the fluxes with k in [kBeg, kEnd)
+//                                  --> Set to [0, N_FC_FLUX) to compute all fluxes
 //-------------------------------------------------------------------------------------------------------
+template <int RS>
 GPU_DEVICE
-void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-                              real g_FC_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_LR][ CUBE(N_FC_VAR) ],
+                              real g_FC_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                         const int NFlux, const int NSkip_N, const int NSkip_T, const real Gamma,
                         const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],
                         const real dt, const real dh, const double Time,
                         const OptGravityType_t GravityType, const double ExtAcc_AuxArray[],
-                        const real MinPres, const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ] )
+                        const real MinPres, const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
+                        const int kBeg, const int kEnd )
 {
 
 // check
@@ -133,9 +156,24 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
    real ConVar_L[NCOMP_TOTAL_PLUS_MAG], ConVar_R[NCOMP_TOTAL_PLUS_MAG], Flux_1Face[NCOMP_TOTAL_PLUS_MAG];
 
-#  if ( RSOLVER == EXACT )
    const real Gamma_m1 = Gamma - (real)1.0;
    real PriVar_L[NCOMP_TOTAL], PriVar_R[NCOMP_TOTAL];
+
+// passive scalars are not stored in g_FC_Var[] for SPLIT_PASSIVE
+// --> set them to zero once since the Riemann solvers still copy them
+#  ifdef SPLIT_PASSIVE
+   for (int v=NCOMP_TOTAL_LR; v<NCOMP_TOTAL; v++)
+   {
+      ConVar_L[v] = (real)0.0;
+      ConVar_R[v] = (real)0.0;
+   }
+#  endif
+
+#  ifdef RSOLVER_BATCH
+   const bool Batch = ( RS == ROE  ||  RS == HLLE  ||  RS == HLLC );
+   real Batch_L[NCOMP_TOTAL_LR][RSOLVER_BATCH], Batch_R[NCOMP_TOTAL_LR][RSOLVER_BATCH], Batch_Flux[NCOMP_TOTAL_LR][RSOLVER_BATCH];
+   int  Batch_Idx[RSOLVER_BATCH][4];   // idx_flux, i_flux, j_flux, k_flux of each interface in the batch
+   int  NBatch = 0;
 #  endif
 
 #  ifdef UNSPLIT_GRAVITY
@@ -203,9 +241,12 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
                   break;
       }
 
-      const int size_ij = idx_flux_e[0]*idx_flux_e[1];
-      CGPU_LOOP( idx, idx_flux_e[0]*idx_flux_e[1]*idx_flux_e[2] )
+      const int kEnd_flux = MIN( kEnd, idx_flux_e[2] );
+      const int size_ij   = idx_flux_e[0]*idx_flux_e[1];
+      const int NFace     = size_ij*( kEnd_flux - kBeg );
+      CGPU_LOOP( idx0, NFace )
       {
+         const int idx      = idx0 + kBeg*size_ij;
          const int i_flux   = idx % idx_flux_e[0];
          const int j_flux   = idx % size_ij / idx_flux_e[0];
          const int k_flux   = idx / size_ij;
@@ -216,7 +257,7 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
          const int k_fc     = k_flux + idx_fc_s[2];
          const int idx_fc   = IDX321( i_fc, j_fc, k_fc, N_FC_VAR, N_FC_VAR );
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             ConVar_L[v] = g_FC_Var[faceR][v][ idx_fc            ];
             ConVar_R[v] = g_FC_Var[faceL][v][ idx_fc+didx_fc[d] ];
@@ -279,89 +320,84 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
 
 //       2. invoke Riemann solver
-#        if   ( RSOLVER == EXACT  &&  !defined MHD )
-         const bool NormPassive_No  = false; // do NOT convert any passive variable to mass fraction for the Riemann solvers
-         const bool JeansMinPres_No = false;
-
-         Hydro_Con2Pri( ConVar_L, PriVar_L, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
-         Hydro_Con2Pri( ConVar_R, PriVar_R, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
-
-         Hydro_RiemannSolver_Exact( d, Flux_1Face, PriVar_L, PriVar_R, Gamma );
-#        elif ( RSOLVER == ROE )
-         Hydro_RiemannSolver_Roe  ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
-#        elif ( RSOLVER == HLLE )
-         Hydro_RiemannSolver_HLLE ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
-#        elif ( RSOLVER == HLLC  &&  !defined MHD )
-         Hydro_RiemannSolver_HLLC ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
-#        elif ( RSOLVER == HLLD  &&  defined MHD )
-         Hydro_RiemannSolver_HLLD ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
-#        else
-#        error : ERROR : unsupported Riemann solver (EXACT/ROE/HLLE/HLLC/HLLD) !!
-#        endif
-
-
-//       3. store the fluxes of all cells in g_FC_Flux[]
-//       --> including the magnetic components since they are required for CT
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_FC_Flux[d][v][idx_flux] = Flux_1Face[v];
-
-
-//       4. store the inter-patch fluxes in g_IntFlux[]
-//       --> no need to store the magnetic components since this array is only for the flux fix-up operation
-         if ( DumpIntFlux )
+#        ifdef RSOLVER_BATCH
+         if ( Batch )
          {
-            int int_face, int_idx;
-
-//          we have assumed N_FC_VAR=PS2+2 for pure hydro
-//          --> for MHD, one additional flux is evaluated along each transverse direction for computing the CT electric field
-//          --> must exclude it when storing the inter-patch fluxes
-            if (  d == 0  &&  ( i_flux == 0 || i_flux == PS1 || i_flux == PS2 )  )
+//          2-1. push the interface into the batch
+            for (int v=0; v<NCOMP_TOTAL_LR; v++)
             {
-#              ifdef MHD
-               if ( j_flux > 0  &&  j_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
-#              endif
-               {
-                  int_face = i_flux/PS1;
-#                 ifdef MHD
-                  int_idx  = (k_flux-1)*PS2 + j_flux-1;
-#                 else
-                  int_idx  = (k_flux  )*PS2 + j_flux;
-#                 endif
-                  for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
-               }
+               Batch_L[v][NBatch] = ConVar_L[v];
+               Batch_R[v][NBatch] = ConVar_R[v];
             }
 
-            else if (  d == 1  &&  ( j_flux == 0 || j_flux == PS1 || j_flux == PS2 )  )
+            Batch_Idx[NBatch][0] = idx_flux;
+            Batch_Idx[NBatch][1] = i_flux;
+            Batch_Idx[NBatch][2] = j_flux;
+            Batch_Idx[NBatch][3] = k_flux;
+            NBatch ++;
+
+//          2-2. solve all interfaces in the batch when it is full or at the last interface along this direction
+            if ( NBatch == RSOLVER_BATCH  ||  idx0 == NFace-1 )
             {
-#              ifdef MHD
-               if ( i_flux > 0  &&  i_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
-#              endif
+               if      ( RS == ROE  )   Hydro_RiemannSolver_Roe_Batch ( d, NBatch, Batch_Flux, Batch_L, Batch_R, Gamma, MinPres );
+               else if ( RS == HLLE )   Hydro_RiemannSolver_HLLE_Batch( d, NBatch, Batch_Flux, Batch_L, Batch_R, Gamma, MinPres );
+               else if ( RS == HLLC )   Hydro_RiemannSolver_HLLC_Batch( d, NBatch, Batch_Flux, Batch_L, Batch_R, Gamma, MinPres );
+
+//             3. store the fluxes
+               for (int f=0; f<NBatch; f++)
                {
-                  int_face = j_flux/PS1 + 3;
-#                 ifdef MHD
-                  int_idx  = (k_flux-1)*PS2 + i_flux-1;
-#                 else
-                  int_idx  = (k_flux  )*PS2 + i_flux;
-#                 endif
-                  for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+                  for (int v=0; v<NCOMP_TOTAL_LR; v++)   Flux_1Face[v] = Batch_Flux[v][f];
+
+                  StoreFlux( d, Flux_1Face, Batch_Idx[f][0], Batch_Idx[f][1], Batch_Idx[f][2], Batch_Idx[f][3],
+                             g_FC_Flux, DumpIntFlux, g_IntFlux );
                }
-            }
 
-            else if (  d == 2  &&  ( k_flux == 0 || k_flux == PS1 || k_flux == PS2 )  )
+               NBatch = 0;
+            } // if ( NBatch == RSOLVER_BATCH  ||  idx0 == NFace-1 )
+
+         } // if ( Batch )
+
+         else
+#        endif // #ifdef RSOLVER_BATCH
+         {
+//          2-3. solve one interface at a time
+            switch ( RS )
             {
-#              ifdef MHD
-               if ( i_flux > 0  &&  i_flux < PS2+1  &&  j_flux > 0  &&  j_flux < PS2+1 )
-#              endif
+#              ifndef MHD
+               case EXACT :
                {
-                  int_face = k_flux/PS1 + 6;
-#                 ifdef MHD
-                  int_idx  = (j_flux-1)*PS2 + i_flux-1;
-#                 else
-                  int_idx  = (j_flux  )*PS2 + i_flux;
-#                 endif
-                  for (int v=0; v<NCOMP_TOTAL; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+                  const bool NormPassive_No  = false; // do NOT convert any passive variable to mass fraction for the Riemann solvers
+                  const bool JeansMinPres_No = false;
+
+                  Hydro_Con2Pri( ConVar_L, PriVar_L, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
+                  Hydro_Con2Pri( ConVar_R, PriVar_R, Gamma_m1, MinPres, NormPassive_No, NULL_INT, NULL, JeansMinPres_No, NULL_REAL );
+
+                  Hydro_RiemannSolver_Exact( d, Flux_1Face, PriVar_L, PriVar_R, Gamma );
                }
-            }
-         } // if ( DumpIntFlux )
+               break;
+
+               case HLLC :
+                  Hydro_RiemannSolver_HLLC( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
+               break;
+#              else
+               case HLLD :
+                  Hydro_RiemannSolver_HLLD( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
+               break;
+#              endif // #ifndef MHD ... else ...
+
+               case ROE :
+                  Hydro_RiemannSolver_Roe ( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
+               break;
+
+               case HLLE :
+                  Hydro_RiemannSolver_HLLE( d, Flux_1Face, ConVar_L, ConVar_R, Gamma, MinPres );
+               break;
+            } // switch ( RS )
+
+
+//          3. store the fluxes
+            StoreFlux( d, Flux_1Face, idx_flux, i_flux, j_flux, k_flux, g_FC_Flux, DumpIntFlux, g_IntFlux );
+         } // if ( Batch ) ... else ...
       } // i,j,k
    } // for (int d=0; d<3; d++)
 
@@ -374,6 +410,113 @@ void Hydro_ComputeFlux( const real g_FC_Var [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  StoreFlux
+// Description :  Store the flux of one interface in g_FC_Flux[] and, optionally, in g_IntFlux[]
+//
+// Note        :  1. Invoked by Hydro_ComputeFlux()
+//                2. For SPLIT_PASSIVE, the inter-patch fluxes of passive scalars are stored by Hydro_FullStepUpdate()
+//
+// Parameter   :  d           : Spatial direction of the interface
+//                Flux_1Face  : Flux of the target interface
+//                idx_flux    : Index of the target interface in g_FC_Flux[]
+//                i/j/k_flux  : Spatial indices of the target interface in g_FC_Flux[]
+//                g_FC_Flux   : Array to store the output face-centered fluxes
+//                DumpIntFlux : true --> store the inter-patch fluxes in g_IntFlux[]
+//                g_IntFlux   : Array for DumpIntFlux
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+void StoreFlux( const int d, const real Flux_1Face[], const int idx_flux, const int i_flux, const int j_flux, const int k_flux,
+                real g_FC_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
+                const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ] )
+{
+
+// 1. store the fluxes of all cells in g_FC_Flux[]
+// --> including the magnetic components since they are required for CT
+   for (int v=0; v<NCOMP_LR; v++)   g_FC_Flux[d][v][idx_flux] = Flux_1Face[v];
+
+
+// 2. store the inter-patch fluxes in g_IntFlux[]
+// --> no need to store the magnetic components since this array is only for the flux fix-up operation
+   if ( DumpIntFlux )
+   {
+      int int_face, int_idx;
+
+//    we have assumed N_FC_VAR=PS2+2 for pure hydro
+//    --> for MHD, one additional flux is evaluated along each transverse direction for computing the CT electric field
+//    --> must exclude it when storing the inter-patch fluxes
+      if (  d == 0  &&  ( i_flux == 0 || i_flux == PS1 || i_flux == PS2 )  )
+      {
+#        ifdef MHD
+         if ( j_flux > 0  &&  j_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
+#        endif
+         {
+            int_face = i_flux/PS1;
+#           ifdef MHD
+            int_idx  = (k_flux-1)*PS2 + j_flux-1;
+#           else
+            int_idx  = (k_flux  )*PS2 + j_flux;
+#           endif
+            for (int v=0; v<NCOMP_TOTAL_LR; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+         }
+      }
+
+      else if (  d == 1  &&  ( j_flux == 0 || j_flux == PS1 || j_flux == PS2 )  )
+      {
+#        ifdef MHD
+         if ( i_flux > 0  &&  i_flux < PS2+1  &&  k_flux > 0  &&  k_flux < PS2+1 )
+#        endif
+         {
+            int_face = j_flux/PS1 + 3;
+#           ifdef MHD
+            int_idx  = (k_flux-1)*PS2 + i_flux-1;
+#           else
+            int_idx  = (k_flux  )*PS2 + i_flux;
+#           endif
+            for (int v=0; v<NCOMP_TOTAL_LR; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+         }
+      }
+
+      else if (  d == 2  &&  ( k_flux == 0 || k_flux == PS1 || k_flux == PS2 )  )
+      {
+#        ifdef MHD
+         if ( i_flux > 0  &&  i_flux < PS2+1  &&  j_flux > 0  &&  j_flux < PS2+1 )
+#        endif
+         {
+            int_face = k_flux/PS1 + 6;
+#           ifdef MHD
+            int_idx  = (j_flux-1)*PS2 + i_flux-1;
+#           else
+            int_idx  = (j_flux  )*PS2 + i_flux;
+#           endif
+            for (int v=0; v<NCOMP_TOTAL_LR; v++)   g_IntFlux[int_face][v][int_idx] = Flux_1Face[v];
+         }
+      }
+   } // if ( DumpIntFlux )
+
+} // FUNCTION : StoreFlux
+
+
+
+// explicit template instantiation
+#ifndef __CUDACC__
+#define INSTANTIATE( LR, RS )                                                                                       \
+template void Hydro_ComputeFlux <RS> ( const real g_FC_Var [][NCOMP_LR][ CUBE(N_FC_VAR) ],                         \
+                                             real g_FC_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],                        \
+                                       const int NFlux, const int NSkip_N, const int NSkip_T, const real Gamma,     \
+                                       const bool CorrHalfVel, const real g_Pot_USG[], const double g_Corner[],     \
+                                       const real dt, const real dh, const double Time,                             \
+                                       const OptGravityType_t GravityType, const double ExtAcc_AuxArray[],          \
+                                       const real MinPres, const bool DumpIntFlux,                                  \
+                                       real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ], const int kBeg, const int kEnd );
+
+HYDRO_FOR_EACH_RSOLVER( INSTANTIATE, NONE )
+
+#undef INSTANTIATE
+#endif // #ifndef __CUDACC__
+
+
+
 #endif // #if ( MODEL == HYDRO  &&  (FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU) )
 
 
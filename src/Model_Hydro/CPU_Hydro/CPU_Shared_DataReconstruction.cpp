@@ -31,11 +31,23 @@ void Hydro_Con2Flux( const int XYZ, real Flux[], const real In[], const real Gam
 
 
 // internal functions (GPU_DEVICE is defined in CUFLU.h)
+#ifdef LR_PENCIL
+static void Hydro_LimitSlope_Pencil( const real g_PriVar[][ CUBE(FLU_NXT) ], const int idx_cc, const int didx_cc,
+                                     const int NCell, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                                     const real Gamma, const int XYZ, real Slope_Limiter[][FLU_NXT] );
+#ifdef CHAR_RECONSTRUCTION
+static void Hydro_Pri2Char_Pencil( real InOut[][FLU_NXT], const int NCell, const real Gamma, const real Rho[],
+                                   const real Pres[], const real LEigenVec[][NWAVE][FLU_NXT], const int XYZ );
+static void Hydro_Char2Pri_Pencil( real InOut[][FLU_NXT], const int NCell, const real Gamma, const real Rho[],
+                                   const real Pres[], const real REigenVec[][NWAVE][FLU_NXT], const int XYZ );
+#endif
+#else
 GPU_DEVICE
 static void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_Limiter_t LR_Limiter,
                               const real MinMod_Coeff, const real Gamma, const int XYZ,
                               const real LEigenVec[][NWAVE], const real REigenVec[][NWAVE],
                               real Slope_Limiter[] );
+#endif // #ifdef LR_PENCIL ... else ...
 #if (  FLU_SCHEME == CTU  ||  ( defined MHD && defined CHAR_RECONSTRUCTION )  )
 #ifdef MHD
 GPU_DEVICE
@@ -56,7 +68,7 @@ static void Hydro_HancockPredict( real fc[][NCOMP_TOTAL], const real dt, const r
                                   const real g_cc_array[][ CUBE(FLU_NXT) ], const int cc_idx,
                                   const real MinDens, const real MinPres );
 #endif
-#ifdef CHAR_RECONSTRUCTION
+#if ( defined CHAR_RECONSTRUCTION  &&  !defined LR_PENCIL )
 GPU_DEVICE
 static void Hydro_Pri2Char( real InOut[], const real Gamma, const real Rho, const real Pres,
                             const real LEigenVec[][NWAVE], const int XYZ );
@@ -74,9 +86,8 @@ static void Hydro_Char2Pri( real InOut[], const real Gamma, const real Rho, cons
 
 
 
-#if ( LR_SCHEME == PLM )
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Hydro_DataReconstruction
+// Function    :  Hydro_DataReconstruction_PLM
 // Description :  Reconstruct the face-centered variables by the piecewise-linear method (PLM)
 //
 // Note        :  1. Use the parameter "LR_Limiter" to choose different slope limiters
@@ -92,27 +103,36 @@ static void Hydro_Char2Pri( real InOut[], const real Gamma, const real Rho, cons
 //                       --> Adopted by MHM_RP, where Hydro_RiemannPredict() already returns primitive variables
 //                3. Output data are always conserved variables
 //                   --> Because Hydro_HancockPredict() only works with conserved variables
-//                4. PLM and PPM data reconstruction functions share the same function name
+//                4. Invoked by Hydro_DataReconstruction() when LR == PLM
+//                   --> Always compiled since PLM works with the ghost zones of both LR_SCHEME == PLM and PPM
+//                   --> The template parameter RS is the adopted Riemann solver, which affects the CTU half-step
+//                       prediction when HLL_NO_REF_STATE is on
 //                5. Face-centered variables will be advanced by half time-step for the MHM and CTU schemes
 //                6. Data reconstruction can be applied to characteristic variables by
 //                   defining "CHAR_RECONSTRUCTION" in the header CUFLU.h
 //                7. This function is shared by MHM, MHM_RP, and CTU schemes
 //                8. g_FC_B[] has the size of SQR(FLU_NXT)*FLU_NXT_P1 but is accessed with the strides
 //                   NIn/NIn+1 along the transverse/longitudinal directions
+//                9. Only the z planes [kBeg, kEnd) of g_FC_Var[] are evaluated, which allows the fused CPU solvers
+//                   to evaluate a patch group slab by slab (see CPU_FluidSolver_MHM/CTU())
+//                   --> Consecutive invocations must cover the planes in ascending order without any gap
+//                   --> g_PriVar[] and g_Slope_PPM[] are evaluated only on the planes not evaluated by the
+//                       previous invocations
+//                   --> kEnd is truncated to N_FC_VAR
 //
 // Parameter   :  g_ConVar           : Array storing the input cell-centered conserved variables
 //                                     --> Should contain NCOMP_TOTAL variables
 //                g_FC_B             : Array storing the input face-centered magnetic field (for MHD only)
 //                                     --> Should contain NCOMP_MAG variables
 //                g_PriVar           : Array storing/to store the cell-centered primitive variables
-//                                     --> Should contain NCOMP_TOTAL_PLUS_MAG variables
+//                                     --> Should contain NCOMP_LR variables
 //                                         --> For MHD, this array currently stores the normal B field as well
 //                                     --> For MHM, g_ConVar[] and g_PriVar[] must point to different arrays since
 //                                         Hydro_HancockPredict() requires the original g_ConVar[]
 //                g_FC_Var           : Array to store the output face-centered primitive variables
-//                                     --> Should contain NCOMP_TOTAL_PLUS_MAG variables
+//                                     --> Should contain NCOMP_LR variables
 //                g_Slope_PPM        : Array to store the x/y/z slopes for the PPM reconstruction
-//                                     --> Should contain NCOMP_TOTAL_PLUS_MAG variables
+//                                     --> Should contain NCOMP_LR variables
 //                Con2Pri            : Convert conserved variables in g_ConVar[] to primitive variables and
 //                                     store the results in g_PriVar[]
 //                NIn                : Size of g_PriVar[] along each direction
@@ -136,18 +156,21 @@ static void Hydro_Char2Pri( real InOut[], const real Gamma, const real Rho, cons
 //                                     --> Should be set to the global variable "PassiveNorm_VarIdx"
 //                JeansMinPres       : Apply minimum pressure estimated from the Jeans length
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
+//                kBeg/kEnd          : Only evaluate the z planes [kBeg, kEnd) of g_FC_Var[]
+//                                     --> Set to [0, N_FC_VAR) to evaluate all cells
 //------------------------------------------------------------------------------------------------------
-GPU_DEVICE
-void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
-                               const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
-                                     real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-                                     real g_Slope_PPM[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
-                               const bool Con2Pri, const int NIn, const int NGhost, const real Gamma,
-                               const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-                               const real dt, const real dh, const real MinDens, const real MinPres,
-                               const bool NormPassive, const int NNorm, const int NormIdx[],
-                               const bool JeansMinPres, const real JeansMinPres_Coeff )
+template <int RS>
+GPU_DEVICE static
+void Hydro_DataReconstruction_PLM( const real g_ConVar   [][ CUBE(FLU_NXT) ],
+                                   const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
+                                         real g_PriVar   [][ CUBE(FLU_NXT) ],
+                                         real g_FC_Var   [][NCOMP_LR][ CUBE(N_FC_VAR) ],
+                                         real g_Slope_PPM[][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+                                   const bool Con2Pri, const int NIn, const int NGhost, const real Gamma,
+                                   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                                   const real dt, const real dh, const real MinDens, const real MinPres,
+                                   const bool NormPassive, const int NNorm, const int NormIdx[],
+                                   const bool JeansMinPres, const real JeansMinPres_Coeff, const int kBeg, const int kEnd )
 {
 
 // check
@@ -155,10 +178,14 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    if ( NIn - 2*NGhost != N_FC_VAR )
       printf( "ERROR : NIn - 2*NGhost != N_FC_VAR (NIn %d, NGhost %d, N_FC_VAR %d) !!\n",
               NIn, NGhost, N_FC_VAR );
+
+   if ( kBeg < 0 )
+      printf( "ERROR : kBeg (%d) < 0 !!\n", kBeg );
 #  endif
 
 
    const int  didx_cc[3] = { 1, NIn, SQR(NIn) };
+   const int  kEnd_fc    = MIN( kEnd, N_FC_VAR );
    const real  Gamma_m1  = Gamma - (real)1.0;
    const real _Gamma_m1  = (real)1.0 / Gamma_m1;
 
@@ -207,7 +234,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                     { 1.0, NULL_REAL, 0.0, 0.0, NULL_REAL } };
 #  endif // #ifdef MHD ... else ...
 
-#  elif ( defined MHD  &&  defined CHAR_RECONSTRUCTION ) // #if ( FLU_SCHEME == CTU )
+#  elif ( defined MHD  &&  defined CHAR_RECONSTRUCTION  &&  !defined LR_PENCIL ) // #if ( FLU_SCHEME == CTU )
    real EigenVal[3][NWAVE];
    real REigenVec[NWAVE][NWAVE] = { { NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL },
                                     {       0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
@@ -224,24 +251,36 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                     { 0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
                                     { 0.0, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL } };
 
-#  else // #if ( FLU_SCHEME == CTU ) ... elif ...
+#  elif ( !defined LR_PENCIL ) // #if ( FLU_SCHEME == CTU ) ... elif ...
    real (*const REigenVec)[NWAVE] = NULL;
    real (*const LEigenVec)[NWAVE] = NULL;
-#  endif // #if ( FLU_SCHEME ==  CTU ) ... elif ... else ...
+#  endif // #if ( FLU_SCHEME ==  CTU ) ... elif ... elif ...
 
 
 // 0. conserved --> primitive variables
+// --> only on the planes required by g_FC_Var[kBeg ... kEnd-1] but not evaluated by the previous invocations
    if ( Con2Pri )
    {
+      const int size_ij = SQR( NIn );
+      const int kBeg_cc = ( kBeg    == 0        ) ? 0   : kBeg    + NGhost + LR_GHOST_SIZE;
+      const int kEnd_cc = ( kEnd_fc == N_FC_VAR ) ? NIn : kEnd_fc + NGhost + LR_GHOST_SIZE;
+
       real ConVar_1Cell[NCOMP_TOTAL_PLUS_MAG], PriVar_1Cell[NCOMP_TOTAL_PLUS_MAG];
 
-      CGPU_LOOP( idx, CUBE(NIn) )
+//    passive scalars are excluded from the data reconstruction for SPLIT_PASSIVE
+//    --> set them to zero once since Hydro_Con2Pri() still copies them
+#     ifdef SPLIT_PASSIVE
+      for (int v=NCOMP_TOTAL_LR; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = (real)0.0;
+#     endif
+
+      CGPU_LOOP( idx0, (kEnd_cc-kBeg_cc)*size_ij )
       {
-         for (int v=0; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
+         const int idx = idx0 + kBeg_cc*size_ij;
+
+         for (int v=0; v<NCOMP_TOTAL_LR; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
 
 #        ifdef MHD
 //       assuming that g_FC_B[] is accessed with the strides NIn/NIn+1 along the transverse/longitudinal directions
-         const int size_ij = SQR( NIn );
          const int i       = idx % NIn;
          const int j       = idx % size_ij / NIn;
          const int k       = idx / size_ij;
@@ -252,7 +291,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          Hydro_Con2Pri( ConVar_1Cell, PriVar_1Cell, Gamma_m1, MinPres, NormPassive, NNorm, NormIdx,
                         JeansMinPres, JeansMinPres_Coeff );
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_PriVar[v][idx] = PriVar_1Cell[v];
+         for (int v=0; v<NCOMP_LR; v++)   g_PriVar[v][idx] = PriVar_1Cell[v];
       }
 
 #     ifdef __CUDACC__
@@ -268,8 +307,66 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    int idx_B[NCOMP_MAG];
 #  endif
 
-   CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+// 2-3. evaluate the monotonic slopes and face-centered primitive variables of all cells pencil by pencil
+// --> pencils are along x and the results are stored in g_FC_Var[] temporarily, which will be loaded and
+//     overwritten in the loop over cells below
+#  ifdef LR_PENCIL
+   for (int d=0; d<3; d++)
+   {
+      const int faceL = 2*d;      // left and right face indices
+      const int faceR = faceL+1;
+
+      for (int jk=kBeg*N_FC_VAR; jk<kEnd_fc*N_FC_VAR; jk++)
+      {
+         const int  j_cc   = NGhost + jk%N_FC_VAR;
+         const int  k_cc   = NGhost + jk/N_FC_VAR;
+         const int  idx_cc = IDX321( NGhost, j_cc, k_cc, NIn, NIn );
+         const int  idx_fc = jk*N_FC_VAR;
+         real Slope_Limiter[NCOMP_LR][FLU_NXT];
+
+         Hydro_LimitSlope_Pencil( g_PriVar, idx_cc, didx_cc[d], N_FC_VAR, LR_Limiter, MinMod_Coeff, Gamma, d,
+                                  Slope_Limiter );
+
+         for (int v=0; v<NCOMP_LR; v++)
+         {
+            const real *cc_C  = g_PriVar[v] + idx_cc;
+            const real *cc_L  = cc_C - didx_cc[d];
+            const real *cc_R  = cc_C + didx_cc[d];
+            const real *Slope = Slope_Limiter[v];
+                  real *fc_L  = g_FC_Var[faceL][v] + idx_fc;
+                  real *fc_R  = g_FC_Var[faceR][v] + idx_fc;
+
+#           pragma omp simd
+            for (int i=0; i<N_FC_VAR; i++)
+            {
+               real L, R, Min, Max;
+
+               L = cc_C[i] - (real)0.5*Slope[i];
+
+//             ensure the face-centered variables lie between neighboring cell-centered values
+               Min = ( cc_C[i] < cc_L[i] ) ? cc_C[i] : cc_L[i];
+               Max = ( cc_C[i] > cc_L[i] ) ? cc_C[i] : cc_L[i];
+               L   = ( L > Min ) ? L : Min;
+               L   = ( L < Max ) ? L : Max;
+               R   = (real)2.0*cc_C[i] - L;
+
+               Min = ( cc_C[i] < cc_R[i] ) ? cc_C[i] : cc_R[i];
+               Max = ( cc_C[i] > cc_R[i] ) ? cc_C[i] : cc_R[i];
+               R   = ( R > Min ) ? R : Min;
+               R   = ( R < Max ) ? R : Max;
+               L   = (real)2.0*cc_C[i] - R;
+
+               fc_L[i] = L;
+               fc_R[i] = R;
+            }
+         } // for (int v=0; v<NCOMP_LR; v++)
+      } // for (int jk=kBeg*N_FC_VAR; jk<kEnd_fc*N_FC_VAR; jk++)
+   } // for (int d=0; d<3; d++)
+#  endif // #ifdef LR_PENCIL
+
+   CGPU_LOOP( idx0, (kEnd_fc-kBeg)*N_FC_VAR2 )
    {
+      const int idx_fc = idx0 + kBeg*N_FC_VAR2;
       const int i_cc   = NGhost + idx_fc%N_FC_VAR;
       const int j_cc   = NGhost + idx_fc%N_FC_VAR2/N_FC_VAR;
       const int k_cc   = NGhost + idx_fc/N_FC_VAR2;
@@ -284,10 +381,12 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 //    cc_C/L/R: cell-centered variables of the Central/Left/Right cells
 //    fc: face-centered variables of the central cell
-      real cc_C[NCOMP_TOTAL_PLUS_MAG], cc_L[NCOMP_TOTAL_PLUS_MAG], cc_R[NCOMP_TOTAL_PLUS_MAG];
-      real fc[6][NCOMP_TOTAL_PLUS_MAG], Slope_Limiter[NCOMP_TOTAL_PLUS_MAG];
+      real cc_C[NCOMP_TOTAL_PLUS_MAG], fc[6][NCOMP_TOTAL_PLUS_MAG];
+#     ifndef LR_PENCIL
+      real cc_L[NCOMP_TOTAL_PLUS_MAG], cc_R[NCOMP_TOTAL_PLUS_MAG], Slope_Limiter[NCOMP_TOTAL_PLUS_MAG];
+#     endif
 
-      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   cc_C[v] = g_PriVar[v][idx_cc];
+      for (int v=0; v<NCOMP_LR; v++)   cc_C[v] = g_PriVar[v][idx_cc];
 
 
 //    1-a. evaluate the eigenvalues and eigenvectors along all three directions for the pure-hydro CTU integrator
@@ -300,18 +399,28 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       for (int d=0; d<3; d++)
       {
 //       1-b. evaluate the eigenvalues and eigenvectors along the target direction for the MHD CTU integrator
-#        if (  defined MHD  &&  ( FLU_SCHEME == CTU || defined CHAR_RECONSTRUCTION )  )
+#        if (  defined MHD  &&  ( FLU_SCHEME == CTU || ( defined CHAR_RECONSTRUCTION && !defined LR_PENCIL ) )  )
          MHD_GetEigenSystem( cc_C, EigenVal[d], LEigenVec, REigenVec, Gamma, d );
 #        endif
 
 
-//       2. evaluate the monotonic slope
          const int faceL   = 2*d;      // left and right face indices
          const int faceR   = faceL+1;
+
+//       2-3. load the face-centered primitive variables evaluated pencil by pencil
+#        ifdef LR_PENCIL
+         for (int v=0; v<NCOMP_LR; v++)
+         {
+            fc[faceL][v] = g_FC_Var[faceL][v][idx_fc];
+            fc[faceR][v] = g_FC_Var[faceR][v][idx_fc];
+         }
+
+#        else
+//       2. evaluate the monotonic slope
          const int idx_ccL = idx_cc - didx_cc[d];
          const int idx_ccR = idx_cc + didx_cc[d];
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             cc_L[v] = g_PriVar[v][idx_ccL];
             cc_R[v] = g_PriVar[v][idx_ccR];
@@ -322,14 +431,14 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 
 //       3. get the face-centered primitive variables
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             fc[faceL][v] = cc_C[v] - (real)0.5*Slope_Limiter[v];
             fc[faceR][v] = cc_C[v] + (real)0.5*Slope_Limiter[v];
          }
 
 //       ensure the face-centered variables lie between neighboring cell-centered values
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             real Min, Max;
 
@@ -345,6 +454,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
             fc[faceR][v] = ( fc[faceR][v] < Max ) ? fc[faceR][v] : Max;
             fc[faceL][v] = (real)2.0*cc_C[v] - fc[faceR][v];
          }
+#        endif // #ifdef LR_PENCIL ... else ...
 
 
 //       4. advance the face-centered variables by half time-step for the CTU integrator
@@ -353,7 +463,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          real Correct_L[NCOMP_TOTAL_PLUS_MAG], Correct_R[NCOMP_TOTAL_PLUS_MAG], dfc[NCOMP_TOTAL_PLUS_MAG];
 
 //       4-1. evaluate the slope (for passive scalars as well)
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   dfc[v] = fc[faceR][v] - fc[faceL][v];
+         for (int v=0; v<NCOMP_LR; v++)   dfc[v] = fc[faceR][v] - fc[faceL][v];
 
 
 //       4-2. re-order variables for the y/z directions
@@ -363,107 +473,109 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 //       =====================================================================================
 //       a. for the HLL solvers (HLLE/HLLC/HLLD)
 //       =====================================================================================
-#        if (  ( RSOLVER == HLLE || RSOLVER == HLLC || RSOLVER == HLLD )  &&  defined HLL_NO_REF_STATE  )
-
-//       4-2-a1. evaluate the corrections to the left and right face-centered variables
-
-         for (int v=0; v<NWAVE; v++)
+#        ifdef HLL_NO_REF_STATE
+         if ( RS == HLLE  ||  RS == HLLC  ||  RS == HLLD )
          {
-            Correct_L[ idx_wave[v] ] = (real)0.0;
-            Correct_R[ idx_wave[v] ] = (real)0.0;
-         }
+//          4-2-a1. evaluate the corrections to the left and right face-centered variables
 
-#        ifdef HLL_INCLUDE_ALL_WAVES
+            for (int v=0; v<NWAVE; v++)
+            {
+               Correct_L[ idx_wave[v] ] = (real)0.0;
+               Correct_R[ idx_wave[v] ] = (real)0.0;
+            }
 
-         for (int Mode=0; Mode<NWAVE; Mode++)
-         {
-            Coeff_L = (real)0.0;
+#           ifdef HLL_INCLUDE_ALL_WAVES
 
-            for (int v=0; v<NWAVE; v++)   Coeff_L += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
+            for (int Mode=0; Mode<NWAVE; Mode++)
+            {
+               Coeff_L = (real)0.0;
 
-            Coeff_L *= -dt_dh2*EigenVal[d][Mode];
+               for (int v=0; v<NWAVE; v++)   Coeff_L += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
 
-            for (int v=0; v<NWAVE; v++)   Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
-         } // for (int Mode=0; Mode<NWAVE; Mode++)
+               Coeff_L *= -dt_dh2*EigenVal[d][Mode];
 
-         for (int v=0; v<NWAVE; v++)   Correct_R[ idx_wave[v] ] = Correct_L[ idx_wave[v] ];
+               for (int v=0; v<NWAVE; v++)   Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
+            } // for (int Mode=0; Mode<NWAVE; Mode++)
 
-#        else // #ifdef HLL_INCLUDE_ALL_WAVES
+            for (int v=0; v<NWAVE; v++)   Correct_R[ idx_wave[v] ] = Correct_L[ idx_wave[v] ];
 
-         for (int Mode=0; Mode<NWAVE; Mode++)
-         {
-            Coeff_L = (real)0.0;
-            Coeff_R = (real)0.0;
+#           else // #ifdef HLL_INCLUDE_ALL_WAVES
 
-            if ( EigenVal[d][Mode] <= (real)0.0 )
+            for (int Mode=0; Mode<NWAVE; Mode++)
             {
-               for (int v=0; v<NWAVE; v++)   Coeff_L += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
+               Coeff_L = (real)0.0;
+               Coeff_R = (real)0.0;
 
-               Coeff_L *= -dt_dh2*EigenVal[d][Mode];
+               if ( EigenVal[d][Mode] <= (real)0.0 )
+               {
+                  for (int v=0; v<NWAVE; v++)   Coeff_L += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
 
-               for (int v=0; v<NWAVE; v++)   Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
-            }
+                  Coeff_L *= -dt_dh2*EigenVal[d][Mode];
 
-            if ( EigenVal[d][Mode] >= (real)0.0 )
-            {
-               for (int v=0; v<NWAVE; v++)   Coeff_R += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
+                  for (int v=0; v<NWAVE; v++)   Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
+               }
 
-               Coeff_R *= -dt_dh2*EigenVal[d][Mode];
+               if ( EigenVal[d][Mode] >= (real)0.0 )
+               {
+                  for (int v=0; v<NWAVE; v++)   Coeff_R += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
 
-               for (int v=0; v<NWAVE; v++)   Correct_R[ idx_wave[v] ] += Coeff_R*REigenVec[Mode][v];
-            }
-         } // for (int Mode=0; Mode<NWAVE; Mode++)
+                  Coeff_R *= -dt_dh2*EigenVal[d][Mode];
+
+                  for (int v=0; v<NWAVE; v++)   Correct_R[ idx_wave[v] ] += Coeff_R*REigenVec[Mode][v];
+               }
+            } // for (int Mode=0; Mode<NWAVE; Mode++)
 
-#        endif // #ifdef HLL_INCLUDE_ALL_WAVES ... else ...
+#           endif // #ifdef HLL_INCLUDE_ALL_WAVES ... else ...
+         } // if ( RS == HLLE  ||  RS == HLLC  ||  RS == HLLD )
 
 
 //       =====================================================================================
 //       b. for the Roe's and exact solvers
 //       =====================================================================================
-#        else // ( RSOLVER == ROE/EXACT || ifndef HLL_NO_REF_STATE )
-
-//       4-2-b1. evaluate the reference states
-         Coeff_L = -dt_dh2*FMIN( EigenVal[d][       0 ], (real)0.0 );
-         Coeff_R = -dt_dh2*FMAX( EigenVal[d][ NWAVE-1 ], (real)0.0 );
-
-         for (int v=0; v<NWAVE; v++)
+         else
+#        endif // #ifdef HLL_NO_REF_STATE
          {
-            Correct_L[ idx_wave[v] ] = Coeff_L*dfc[ idx_wave[v] ];
-            Correct_R[ idx_wave[v] ] = Coeff_R*dfc[ idx_wave[v] ];
-         }
+//          4-2-b1. evaluate the reference states
+            Coeff_L = -dt_dh2*FMIN( EigenVal[d][       0 ], (real)0.0 );
+            Coeff_R = -dt_dh2*FMAX( EigenVal[d][ NWAVE-1 ], (real)0.0 );
 
+            for (int v=0; v<NWAVE; v++)
+            {
+               Correct_L[ idx_wave[v] ] = Coeff_L*dfc[ idx_wave[v] ];
+               Correct_R[ idx_wave[v] ] = Coeff_R*dfc[ idx_wave[v] ];
+            }
 
-//       4-2-b2. evaluate the corrections to the left and right face-centered variables
-         for (int Mode=0; Mode<NWAVE; Mode++)
-         {
-            Coeff_L = (real)0.0;
-            Coeff_R = (real)0.0;
 
-            if ( EigenVal[d][Mode] <= (real)0.0 )
+//          4-2-b2. evaluate the corrections to the left and right face-centered variables
+            for (int Mode=0; Mode<NWAVE; Mode++)
             {
-               for (int v=0; v<NWAVE; v++)   Coeff_L += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
+               Coeff_L = (real)0.0;
+               Coeff_R = (real)0.0;
 
-               Coeff_L *= dt_dh2*( EigenVal[d][0] - EigenVal[d][Mode] );
+               if ( EigenVal[d][Mode] <= (real)0.0 )
+               {
+                  for (int v=0; v<NWAVE; v++)   Coeff_L += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
 
-               for (int v=0; v<NWAVE; v++)   Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
-            }
+                  Coeff_L *= dt_dh2*( EigenVal[d][0] - EigenVal[d][Mode] );
 
-            if ( EigenVal[d][Mode] >= (real)0.0 )
-            {
-               for (int v=0; v<NWAVE; v++)   Coeff_R += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
+                  for (int v=0; v<NWAVE; v++)   Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
+               }
 
-               Coeff_R *= dt_dh2*( EigenVal[d][ NWAVE-1 ] - EigenVal[d][Mode] );
+               if ( EigenVal[d][Mode] >= (real)0.0 )
+               {
+                  for (int v=0; v<NWAVE; v++)   Coeff_R += LEigenVec[Mode][v]*dfc[ idx_wave[v] ];
 
-               for (int v=0; v<NWAVE; v++)   Correct_R[ idx_wave[v] ] += Coeff_R*REigenVec[Mode][v];
-            }
-         } // for (int Mode=0; Mode<NWAVE; Mode++)
+                  Coeff_R *= dt_dh2*( EigenVal[d][ NWAVE-1 ] - EigenVal[d][Mode] );
 
-#        endif // if (  ( RSOLVER == HLLE || RSOLVER == HLLC || RSOLVER == HLLD )  &&  defined HLL_NO_REF_STATE  ) ... else ...
+                  for (int v=0; v<NWAVE; v++)   Correct_R[ idx_wave[v] ] += Coeff_R*REigenVec[Mode][v];
+               }
+            } // for (int Mode=0; Mode<NWAVE; Mode++)
+         } // if ( RS == HLLE  ||  RS == HLLC  ||  RS == HLLD ) ... else ...
 
 
 //       4-3. evaluate the corrections to the left and right face-centered passive scalars
 //            --> passive scalars travel with fluid velocity (i.e., entropy mode)
-#        if ( NCOMP_PASSIVE > 0 )
+#        if ( NCOMP_PASSIVE_LR > 0 )
          Coeff_L = -dt_dh2*FMIN( EigenVal[d][1], (real)0.0 );
          Coeff_R = -dt_dh2*FMAX( EigenVal[d][1], (real)0.0 );
 
@@ -510,7 +622,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          Hydro_Rotate3D( Correct_L, d, false, MAG_OFFSET );
          Hydro_Rotate3D( Correct_R, d, false, MAG_OFFSET );
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             fc[faceL][v] += Correct_L[v];
             fc[faceR][v] += Correct_R[v];
@@ -524,7 +636,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          fc[faceL][4] = Hydro_CheckMinPres( fc[faceL][4], MinPres );
          fc[faceR][4] = Hydro_CheckMinPres( fc[faceR][4], MinPres );
 
-#        if ( NCOMP_PASSIVE > 0 )
+#        if ( NCOMP_PASSIVE_LR > 0 )
          for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++) {
          fc[faceL][v] = FMAX( fc[faceL][v], TINY_NUMBER );
          fc[faceR][v] = FMAX( fc[faceR][v], TINY_NUMBER ); }
@@ -548,11 +660,14 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 //       6. primitive variables --> conserved variables
          real tmp[NCOMP_TOTAL_PLUS_MAG];  // input and output arrays must not overlap for Pri2Con()
+#        ifdef SPLIT_PASSIVE
+         for (int v=NCOMP_TOTAL_LR; v<NCOMP_TOTAL; v++)   tmp[v] = (real)0.0;
+#        endif
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   tmp[v] = fc[faceL][v];
+         for (int v=0; v<NCOMP_LR; v++)   tmp[v] = fc[faceL][v];
          Hydro_Pri2Con( tmp, fc[faceL], _Gamma_m1, NormPassive, NNorm, NormIdx );
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   tmp[v] = fc[faceR][v];
+         for (int v=0; v<NCOMP_LR; v++)   tmp[v] = fc[faceR][v];
          Hydro_Pri2Con( tmp, fc[faceR], _Gamma_m1, NormPassive, NNorm, NormIdx );
 
       } // for (int d=0; d<3; d++)
@@ -566,41 +681,42 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 //    8. store the face-centered values to the output array
       for (int f=0; f<6; f++)
-      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+      for (int v=0; v<NCOMP_LR; v++)
          g_FC_Var[f][v][idx_fc] = fc[f][v];
 
-   } // CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   } // CGPU_LOOP( idx0, (kEnd_fc-kBeg)*N_FC_VAR2 )
 
 
 #  ifdef __CUDACC__
    __syncthreads();
 #  endif
 
-} // FUNCTION : Hydro_DataReconstruction (PLM)
-#endif // #if ( LR_SCHEME == PLM )
+} // FUNCTION : Hydro_DataReconstruction_PLM
 
 
 
 #if ( LR_SCHEME == PPM )
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Hydro_DataReconstruction
+// Function    :  Hydro_DataReconstruction_PPM
 // Description :  Reconstruct the face-centered variables by the piecewise-parabolic method (PPM)
 //
-// Note        :  See the PLM routine
+// Note        :  1. See the PLM routine
+//                2. Only compiled when LR_SCHEME == PPM since it requires the larger ghost zones and g_Slope_PPM[]
 //
 // Parameter   :  See the PLM routine
 //------------------------------------------------------------------------------------------------------
-GPU_DEVICE
-void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
-                               const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
-                                     real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-                                     real g_Slope_PPM[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_SLOPE_PPM) ],
-                               const bool Con2Pri, const int NIn, const int NGhost, const real Gamma,
-                               const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-                               const real dt, const real dh, const real MinDens, const real MinPres,
-                               const bool NormPassive, const int NNorm, const int NormIdx[],
-                               const bool JeansMinPres, const real JeansMinPres_Coeff )
+template <int RS>
+GPU_DEVICE static
+void Hydro_DataReconstruction_PPM( const real g_ConVar   [][ CUBE(FLU_NXT) ],
+                                   const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
+                                         real g_PriVar   [][ CUBE(FLU_NXT) ],
+                                         real g_FC_Var   [][NCOMP_LR][ CUBE(N_FC_VAR) ],
+                                         real g_Slope_PPM[][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+                                   const bool Con2Pri, const int NIn, const int NGhost, const real Gamma,
+                                   const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                                   const real dt, const real dh, const real MinDens, const real MinPres,
+                                   const bool NormPassive, const int NNorm, const int NormIdx[],
+                                   const bool JeansMinPres, const real JeansMinPres_Coeff, const int kBeg, const int kEnd )
 {
 
 // check
@@ -609,6 +725,9 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       printf( "ERROR : NIn - 2*NGhost != N_FC_VAR (NIn %d, NGhost %d, N_FC_VAR %d) !!\n",
               NIn, NGhost, N_FC_VAR );
 
+   if ( kBeg < 0 )
+      printf( "ERROR : kBeg (%d) < 0 !!\n", kBeg );
+
 #  if ( N_SLOPE_PPM != N_FC_VAR + 2 )
 #     error : ERROR : N_SLOPE_PPM != N_FC_VAR + 2 !!
 #  endif
@@ -617,6 +736,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
    const int  didx_cc   [3] = { 1, NIn, SQR(NIn) };
    const int  didx_slope[3] = { 1, N_SLOPE_PPM, SQR(N_SLOPE_PPM) };
+   const int  kEnd_fc       = MIN( kEnd, N_FC_VAR );
    const real  Gamma_m1  = Gamma - (real)1.0;
    const real _Gamma_m1  = (real)1.0 / Gamma_m1;
 
@@ -631,13 +751,13 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 #  endif
 
 // include waves both from left and right directions during the data reconstruction, as suggested in ATHENA
-#  if (  ( RSOLVER == HLLE || RSOLVER == HLLC || RSOLVER == HLLD )  &&  defined HLL_NO_REF_STATE  )
+#  ifdef HLL_NO_REF_STATE
 #  ifdef HLL_INCLUDE_ALL_WAVES
    const bool HLL_Include_All_Waves = true;
 #  else
    const bool HLL_Include_All_Waves = false;
 #  endif
-#  endif // if (  ( RSOLVER == HLLE || RSOLVER == HLLC || RSOLVER == HLLD )  &&  defined HLL_NO_REF_STATE  )
+#  endif // #ifdef HLL_NO_REF_STATE
 #  endif // #if ( FLU_SCHEME == CTU )
 
 // eigenvalues and eigenvectors
@@ -674,7 +794,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                     { 1.0, NULL_REAL, 0.0, 0.0, NULL_REAL } };
 #  endif // #ifdef MHD ... else ...
 
-#  elif ( defined MHD  &&  defined CHAR_RECONSTRUCTION ) // #if ( FLU_SCHEME == CTU )
+#  elif ( defined MHD  &&  defined CHAR_RECONSTRUCTION  &&  !defined LR_PENCIL ) // #if ( FLU_SCHEME == CTU )
    real EigenVal[3][NWAVE];
    real REigenVec[NWAVE][NWAVE] = { { NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL },
                                     {       0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
@@ -691,24 +811,36 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                                     { 0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
                                     { 0.0, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL } };
 
-#  else // #if ( FLU_SCHEME == CTU ) ... elif ...
+#  elif ( !defined LR_PENCIL ) // #if ( FLU_SCHEME == CTU ) ... elif ...
    real (*const REigenVec)[NWAVE] = NULL;
    real (*const LEigenVec)[NWAVE] = NULL;
-#  endif // #if ( FLU_SCHEME ==  CTU ) ... elif ... else ...
+#  endif // #if ( FLU_SCHEME ==  CTU ) ... elif ... elif ...
 
 
 // 0. conserved --> primitive variables
+// --> only on the planes required by g_FC_Var[kBeg ... kEnd-1] but not evaluated by the previous invocations
    if ( Con2Pri )
    {
+      const int size_ij = SQR( NIn );
+      const int kBeg_cc = ( kBeg    == 0        ) ? 0   : kBeg    + NGhost + LR_GHOST_SIZE;
+      const int kEnd_cc = ( kEnd_fc == N_FC_VAR ) ? NIn : kEnd_fc + NGhost + LR_GHOST_SIZE;
+
       real ConVar_1Cell[NCOMP_TOTAL_PLUS_MAG], PriVar_1Cell[NCOMP_TOTAL_PLUS_MAG];
 
-      CGPU_LOOP( idx, CUBE(NIn) )
+//    passive scalars are excluded from the data reconstruction for SPLIT_PASSIVE
+//    --> set them to zero once since Hydro_Con2Pri() still copies them
+#     ifdef SPLIT_PASSIVE
+      for (int v=NCOMP_TOTAL_LR; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = (real)0.0;
+#     endif
+
+      CGPU_LOOP( idx0, (kEnd_cc-kBeg_cc)*size_ij )
       {
-         for (int v=0; v<NCOMP_TOTAL; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
+         const int idx = idx0 + kBeg_cc*size_ij;
+
+         for (int v=0; v<NCOMP_TOTAL_LR; v++)   ConVar_1Cell[v] = g_ConVar[v][idx];
 
 #        ifdef MHD
 //       assuming that g_FC_B[] is accessed with the strides NIn/NIn+1 along the transverse/longitudinal directions
-         const int size_ij = SQR( NIn );
          const int i       = idx % NIn;
          const int j       = idx % size_ij / NIn;
          const int k       = idx / size_ij;
@@ -719,7 +851,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          Hydro_Con2Pri( ConVar_1Cell, PriVar_1Cell, Gamma_m1, MinPres, NormPassive, NNorm, NormIdx,
                         JeansMinPres, JeansMinPres_Coeff );
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_PriVar[v][idx] = PriVar_1Cell[v];
+         for (int v=0; v<NCOMP_LR; v++)   g_PriVar[v][idx] = PriVar_1Cell[v];
       }
 
 #     ifdef __CUDACC__
@@ -729,9 +861,37 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 
 // 1. evaluate the monotonic slope of all cells
+// --> only on the planes required by g_FC_Var[kBeg ... kEnd-1] but not evaluated by the previous invocations
+// --> plane k in g_FC_Var[] requires planes k ... k+2 in g_Slope_PPM[] since N_SLOPE_PPM = N_FC_VAR + 2
    const int N_SLOPE_PPM2 = SQR( N_SLOPE_PPM );
-   CGPU_LOOP( idx_slope, CUBE(N_SLOPE_PPM) )
+   const int kBeg_slope   = ( kBeg == 0 ) ? 0 : kBeg + 2;
+   const int kEnd_slope   = kEnd_fc + 2;
+
+// 1-a. pencil by pencil along x
+#  ifdef LR_PENCIL
+   for (int d=0; d<3; d++)
+   for (int jk=kBeg_slope*N_SLOPE_PPM; jk<kEnd_slope*N_SLOPE_PPM; jk++)
+   {
+      const int  j_cc      = NGhost - 1 + jk%N_SLOPE_PPM;
+      const int  k_cc      = NGhost - 1 + jk/N_SLOPE_PPM;
+      const int  idx_cc    = IDX321( NGhost-1, j_cc, k_cc, NIn, NIn );
+      const int  idx_slope = jk*N_SLOPE_PPM;
+      real Slope_Limiter[NCOMP_LR][FLU_NXT];
+
+      Hydro_LimitSlope_Pencil( g_PriVar, idx_cc, didx_cc[d], N_SLOPE_PPM, LR_Limiter, MinMod_Coeff, Gamma, d,
+                               Slope_Limiter );
+
+//    store the results to g_Slope_PPM[]
+      for (int v=0; v<NCOMP_LR; v++)
+      for (int i=0; i<N_SLOPE_PPM; i++)
+         g_Slope_PPM[d][v][ idx_slope + i ] = Slope_Limiter[v][i];
+   }
+
+// 1-b. cell by cell
+#  else
+   CGPU_LOOP( idx0, (kEnd_slope-kBeg_slope)*N_SLOPE_PPM2 )
    {
+      const int idx_slope = idx0 + kBeg_slope*N_SLOPE_PPM2;
       const int i_cc   = NGhost - 1 + idx_slope%N_SLOPE_PPM;
       const int j_cc   = NGhost - 1 + idx_slope%N_SLOPE_PPM2/N_SLOPE_PPM;
       const int k_cc   = NGhost - 1 + idx_slope/N_SLOPE_PPM2;
@@ -741,7 +901,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       real cc_C[NCOMP_TOTAL_PLUS_MAG], cc_L[NCOMP_TOTAL_PLUS_MAG], cc_R[NCOMP_TOTAL_PLUS_MAG];
       real Slope_Limiter[NCOMP_TOTAL_PLUS_MAG];
 
-      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   cc_C[v] = g_PriVar[v][idx_cc];
+      for (int v=0; v<NCOMP_LR; v++)   cc_C[v] = g_PriVar[v][idx_cc];
 
 //    loop over different spatial directions
       for (int d=0; d<3; d++)
@@ -753,7 +913,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          MHD_GetEigenSystem( cc_C, EigenVal[d], LEigenVec, REigenVec, Gamma, d );
 #        endif
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             cc_L[v] = g_PriVar[v][idx_ccL];
             cc_R[v] = g_PriVar[v][idx_ccR];
@@ -763,10 +923,11 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                            LEigenVec, REigenVec, Slope_Limiter );
 
 //       store the results to g_Slope_PPM[]
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   g_Slope_PPM[d][v][idx_slope] = Slope_Limiter[v];
+         for (int v=0; v<NCOMP_LR; v++)   g_Slope_PPM[d][v][idx_slope] = Slope_Limiter[v];
 
       } // for (int d=0; d<3; d++)
-   } // CGPU_LOOP( idx_slope, CUBE(N_SLOPE_PPM) )
+   } // CGPU_LOOP( idx0, (kEnd_slope-kBeg_slope)*N_SLOPE_PPM2 )
+#  endif // #ifdef LR_PENCIL ... else ...
 
 #  ifdef __CUDACC__
    __syncthreads();
@@ -780,8 +941,80 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
    int idx_B[NCOMP_MAG];
 #  endif
 
-   CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+// 3. get the face-centered primitive variables of all cells pencil by pencil
+// --> pencils are along x and the results are stored in g_FC_Var[] temporarily, which will be loaded and
+//     overwritten in the loop over cells below
+// --> the if-else branches of the monotonicity constraint are replaced by conditional expressions
+//     so that the loop over cells can be vectorized
+#  ifdef LR_PENCIL
+   for (int d=0; d<3; d++)
+   {
+      const int faceL = 2*d;      // left and right face indices
+      const int faceR = faceL+1;
+
+      for (int jk=kBeg*N_FC_VAR; jk<kEnd_fc*N_FC_VAR; jk++)
+      {
+         const int j_fc      = jk%N_FC_VAR;
+         const int k_fc      = jk/N_FC_VAR;
+         const int idx_cc    = IDX321( NGhost, j_fc+NGhost, k_fc+NGhost, NIn, NIn );
+         const int idx_slope = IDX321( 1, j_fc+1, k_fc+1, N_SLOPE_PPM, N_SLOPE_PPM );
+         const int idx_fc    = jk*N_FC_VAR;
+
+         for (int v=0; v<NCOMP_LR; v++)
+         {
+            const real *cc_C  = g_PriVar[v] + idx_cc;
+            const real *cc_L  = cc_C - didx_cc[d];
+            const real *cc_R  = cc_C + didx_cc[d];
+            const real *dcc_C = g_Slope_PPM[d][v] + idx_slope;
+            const real *dcc_L = dcc_C - didx_slope[d];
+            const real *dcc_R = dcc_C + didx_slope[d];
+                  real *fc_L  = g_FC_Var[faceL][v] + idx_fc;
+                  real *fc_R  = g_FC_Var[faceR][v] + idx_fc;
+
+#           pragma omp simd
+            for (int i=0; i<N_FC_VAR; i++)
+            {
+               real L, R, dfc, dfc6, Max, Min;
+
+//             3-1. parabolic interpolation
+               L    = (real)0.5*( cc_C[i] + cc_L[i] ) - (real)1.0/(real)6.0*( dcc_C[i] - dcc_L[i] );
+               R    = (real)0.5*( cc_C[i] + cc_R[i] ) - (real)1.0/(real)6.0*( dcc_R[i] - dcc_C[i] );
+
+//             3-2. monotonicity constraint
+               dfc  = R - L;
+               dfc6 = (real)6.0*(  cc_C[i] - (real)0.5*( L + R )  );
+
+               const bool Flat  = ( R - cc_C[i] )*( cc_C[i] - L ) <= (real)0.0;
+               const bool SetL  = !Flat  &&  dfc*dfc6 > +dfc*dfc;
+               const bool SetR  = !Flat  &&  !SetL  &&  dfc*dfc6 < -dfc*dfc;
+               const real L_New = ( Flat ) ? cc_C[i] : ( SetL ) ? (real)3.0*cc_C[i] - (real)2.0*R : L;
+               const real R_New = ( Flat ) ? cc_C[i] : ( SetR ) ? (real)3.0*cc_C[i] - (real)2.0*L : R;
+
+               L = L_New;
+               R = R_New;
+
+//             3-3. ensure the face-centered variables lie between neighboring cell-centered values
+               Min = ( cc_C[i] < cc_L[i] ) ? cc_C[i] : cc_L[i];
+               Max = ( cc_C[i] > cc_L[i] ) ? cc_C[i] : cc_L[i];
+               L   = ( L > Min ) ? L : Min;
+               L   = ( L < Max ) ? L : Max;
+
+               Min = ( cc_C[i] < cc_R[i] ) ? cc_C[i] : cc_R[i];
+               Max = ( cc_C[i] > cc_R[i] ) ? cc_C[i] : cc_R[i];
+               R   = ( R > Min ) ? R : Min;
+               R   = ( R < Max ) ? R : Max;
+
+               fc_L[i] = L;
+               fc_R[i] = R;
+            }
+         } // for (int v=0; v<NCOMP_LR; v++)
+      } // for (int jk=kBeg*N_FC_VAR; jk<kEnd_fc*N_FC_VAR; jk++)
+   } // for (int d=0; d<3; d++)
+#  endif // #ifdef LR_PENCIL
+
+   CGPU_LOOP( idx0, (kEnd_fc-kBeg)*N_FC_VAR2 )
    {
+      const int idx_fc    = idx0 + kBeg*N_FC_VAR2;
       const int i_fc      = idx_fc%N_FC_VAR;
       const int j_fc      = idx_fc%N_FC_VAR2/N_FC_VAR;
       const int k_fc      = idx_fc/N_FC_VAR2;
@@ -791,10 +1024,12 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       const int k_cc      = k_fc + NGhost;
       const int idx_cc    = IDX321( i_cc, j_cc, k_cc, NIn, NIn );
 
+#     ifndef LR_PENCIL
       const int i_slope   = i_fc + 1;   // because N_SLOPE_PPM = N_FC_VAR + 2
       const int j_slope   = j_fc + 1;
       const int k_slope   = k_fc + 1;
       const int idx_slope = IDX321( i_slope, j_slope, k_slope, N_SLOPE_PPM, N_SLOPE_PPM );
+#     endif
 
 #     ifdef MHD
 //    assuming that g_FC_B[] is accessed with the strides NIn/NIn+1 along the transverse/longitudinal directions
@@ -807,7 +1042,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       real cc_C_ncomp[NCOMP_TOTAL_PLUS_MAG], fc[6][NCOMP_TOTAL_PLUS_MAG];
       real dfc[NCOMP_TOTAL_PLUS_MAG], dfc6[NCOMP_TOTAL_PLUS_MAG];
 
-      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   cc_C_ncomp[v] = g_PriVar[v][idx_cc];
+      for (int v=0; v<NCOMP_LR; v++)   cc_C_ncomp[v] = g_PriVar[v][idx_cc];
 
 
 //    2-a. evaluate the eigenvalues and eigenvectors along all three directions for the pure-hydro CTU integrator
@@ -820,20 +1055,30 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
       for (int d=0; d<3; d++)
       {
 //       2-b. evaluate the eigenvalues and eigenvectors along the target direction for the MHD CTU integrator
-#        if (  defined MHD  &&  ( FLU_SCHEME == CTU || defined CHAR_RECONSTRUCTION )  )
+#        if (  defined MHD  &&  ( FLU_SCHEME == CTU || ( defined CHAR_RECONSTRUCTION && !defined LR_PENCIL ) )  )
          MHD_GetEigenSystem( cc_C_ncomp, EigenVal[d], LEigenVec, REigenVec, Gamma, d );
 #        endif
 
 
-//       3. get the face-centered primitive variables
          const int faceL      = 2*d;      // left and right face indices
          const int faceR      = faceL+1;
+
+//       3. load the face-centered primitive variables evaluated pencil by pencil
+#        ifdef LR_PENCIL
+         for (int v=0; v<NCOMP_LR; v++)
+         {
+            fc[faceL][v] = g_FC_Var[faceL][v][idx_fc];
+            fc[faceR][v] = g_FC_Var[faceR][v][idx_fc];
+         }
+
+#        else
+//       3. get the face-centered primitive variables
          const int idx_ccL    = idx_cc - didx_cc[d];
          const int idx_ccR    = idx_cc + didx_cc[d];
          const int idx_slopeL = idx_slope - didx_slope[d];
          const int idx_slopeR = idx_slope + didx_slope[d];
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
 //          cc/fc: cell/face-centered variables; _C/L/R: Central/Left/Right cells
             real cc_C, cc_L, cc_R, dcc_L, dcc_R, dcc_C, fc_L, fc_R, Max, Min;
@@ -880,7 +1125,8 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
             fc[faceL][v] = fc_L;
             fc[faceR][v] = fc_R;
 
-         } // for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         } // for (int v=0; v<NCOMP_LR; v++)
+#        endif // #ifdef LR_PENCIL ... else ...
 
 
 //       4. advance the face-centered variables by half time-step for the CTU integrator
@@ -889,7 +1135,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          real Correct_L[NCOMP_TOTAL_PLUS_MAG], Correct_R[NCOMP_TOTAL_PLUS_MAG];
 
 //       4-1. compute the PPM coefficient (for the passive scalars as well)
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             dfc [v] = fc[faceR][v] - fc[faceL][v];
             dfc6[v] = (real)6.0*(  cc_C_ncomp[v] - (real)0.5*( fc[faceL][v] + fc[faceR][v] )  );
@@ -903,109 +1149,111 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 //       =====================================================================================
 //       a. for the HLL solvers (HLLE/HLLC/HLLD)
 //       =====================================================================================
-#        if (  ( RSOLVER == HLLE || RSOLVER == HLLC || RSOLVER == HLLD )  &&  defined HLL_NO_REF_STATE  )
-
-//       4-2-a1. evaluate the corrections to the left and right face-centered variables
-         for (int v=0; v<NWAVE; v++)
+#        ifdef HLL_NO_REF_STATE
+         if ( RS == HLLE  ||  RS == HLLC  ||  RS == HLLD )
          {
-            Correct_L[ idx_wave[v] ] = (real)0.0;
-            Correct_R[ idx_wave[v] ] = (real)0.0;
-         }
-
-         for (int Mode=0; Mode<NWAVE; Mode++)
-         {
-            Coeff_L = (real)0.0;
-            Coeff_R = (real)0.0;
-
-            if ( HLL_Include_All_Waves  ||  EigenVal[d][Mode] <= (real)0.0 )
+//          4-2-a1. evaluate the corrections to the left and right face-centered variables
+            for (int v=0; v<NWAVE; v++)
             {
-               const real Coeff_C = -dt_dh2*EigenVal[d][Mode];
-               const real Coeff_D = real(-4.0/3.0)*SQR(Coeff_C);
-
-               for (int v=0; v<NWAVE; v++)
-                  Coeff_L += LEigenVec[Mode][v]*(  Coeff_C*( dfc[ idx_wave[v] ] + dfc6[ idx_wave[v] ] ) +
-                                                   Coeff_D*( dfc6[ idx_wave[v] ]                      )  );
-
-               for (int v=0; v<NWAVE; v++)
-                  Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
+               Correct_L[ idx_wave[v] ] = (real)0.0;
+               Correct_R[ idx_wave[v] ] = (real)0.0;
             }
 
-            if ( HLL_Include_All_Waves  ||  EigenVal[d][Mode] >= (real)0.0 )
+            for (int Mode=0; Mode<NWAVE; Mode++)
             {
-               const real Coeff_A = -dt_dh2*EigenVal[d][Mode];
-               const real Coeff_B = real(-4.0/3.0)*SQR(Coeff_A);
+               Coeff_L = (real)0.0;
+               Coeff_R = (real)0.0;
 
-               for (int v=0; v<NWAVE; v++)
-                  Coeff_R += LEigenVec[Mode][v]*(  Coeff_A*( dfc[ idx_wave[v] ] - dfc6[ idx_wave[v] ] ) +
-                                                   Coeff_B*( dfc6[ idx_wave[v] ]                      )  );
+               if ( HLL_Include_All_Waves  ||  EigenVal[d][Mode] <= (real)0.0 )
+               {
+                  const real Coeff_C = -dt_dh2*EigenVal[d][Mode];
+                  const real Coeff_D = real(-4.0/3.0)*SQR(Coeff_C);
 
-               for (int v=0; v<NWAVE; v++)
-                  Correct_R[ idx_wave[v] ] += Coeff_R*REigenVec[Mode][v];
-            }
-         } // for (int Mode=0; Mode<NWAVE; Mode++)
+                  for (int v=0; v<NWAVE; v++)
+                     Coeff_L += LEigenVec[Mode][v]*(  Coeff_C*( dfc[ idx_wave[v] ] + dfc6[ idx_wave[v] ] ) +
+                                                      Coeff_D*( dfc6[ idx_wave[v] ]                      )  );
 
+                  for (int v=0; v<NWAVE; v++)
+                     Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
+               }
 
-//       =====================================================================================
-//       b. for the Roe's and exact solvers
-//       =====================================================================================
-#        else // ( RSOLVER == ROE/EXACT || ifndef HLL_NO_REF_STATE )
+               if ( HLL_Include_All_Waves  ||  EigenVal[d][Mode] >= (real)0.0 )
+               {
+                  const real Coeff_A = -dt_dh2*EigenVal[d][Mode];
+                  const real Coeff_B = real(-4.0/3.0)*SQR(Coeff_A);
 
-//       4-2-b1. evaluate the reference states
-         Coeff_L = -dt_dh2*FMIN( EigenVal[d][       0 ], (real)0.0 );
-         Coeff_R = -dt_dh2*FMAX( EigenVal[d][ NWAVE-1 ], (real)0.0 );
+                  for (int v=0; v<NWAVE; v++)
+                     Coeff_R += LEigenVec[Mode][v]*(  Coeff_A*( dfc[ idx_wave[v] ] - dfc6[ idx_wave[v] ] ) +
+                                                      Coeff_B*( dfc6[ idx_wave[v] ]                      )  );
 
-         for (int v=0; v<NWAVE; v++)
-         {
-            Correct_L[ idx_wave[v] ] = Coeff_L*(  dfc[ idx_wave[v] ] + ( (real)1.0 - real(4.0/3.0)*Coeff_L )*dfc6[ idx_wave[v] ]  );
-            Correct_R[ idx_wave[v] ] = Coeff_R*(  dfc[ idx_wave[v] ] - ( (real)1.0 + real(4.0/3.0)*Coeff_R )*dfc6[ idx_wave[v] ]  );
-         }
+                  for (int v=0; v<NWAVE; v++)
+                     Correct_R[ idx_wave[v] ] += Coeff_R*REigenVec[Mode][v];
+               }
+            } // for (int Mode=0; Mode<NWAVE; Mode++)
+         } // if ( RS == HLLE  ||  RS == HLLC  ||  RS == HLLD )
 
 
-//       4-2-b2. evaluate the corrections to the left and right face-centered variables
-         for (int Mode=0; Mode<NWAVE; Mode++)
+//       =====================================================================================
+//       b. for the Roe's and exact solvers
+//       =====================================================================================
+         else
+#        endif // #ifdef HLL_NO_REF_STATE
          {
-            Coeff_L = (real)0.0;
-            Coeff_R = (real)0.0;
+//          4-2-b1. evaluate the reference states
+            Coeff_L = -dt_dh2*FMIN( EigenVal[d][       0 ], (real)0.0 );
+            Coeff_R = -dt_dh2*FMAX( EigenVal[d][ NWAVE-1 ], (real)0.0 );
 
-            if ( EigenVal[d][Mode] <= (real)0.0 )
+            for (int v=0; v<NWAVE; v++)
             {
-               const real Coeff_C = dt_dh2*( EigenVal[d][0] - EigenVal[d][Mode] );
-//             write as (a-b)*(a+b) instead of a^2-b^2 to ensure that Coeff_D=0 when Coeff_C=0
-//             Coeff_D = real(4.0/3.0)*dt_dh2*dt_dh2* ( EigenVal[d][   0]*EigenVal[d][   0] -
-//                                                      EigenVal[d][Mode]*EigenVal[d][Mode]   );
-               const real Coeff_D = real(4.0/3.0)*dt_dh2*Coeff_C*( EigenVal[d][0] + EigenVal[d][Mode] );
-
-               for (int v=0; v<NWAVE; v++)
-                  Coeff_L += LEigenVec[Mode][v]*(  Coeff_C*( dfc[ idx_wave[v] ] + dfc6[ idx_wave[v] ] ) +
-                                                   Coeff_D*( dfc6[ idx_wave[v] ]                      )  );
-
-               for (int v=0; v<NWAVE; v++)
-                  Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
+               Correct_L[ idx_wave[v] ] = Coeff_L*(  dfc[ idx_wave[v] ] + ( (real)1.0 - real(4.0/3.0)*Coeff_L )*dfc6[ idx_wave[v] ]  );
+               Correct_R[ idx_wave[v] ] = Coeff_R*(  dfc[ idx_wave[v] ] - ( (real)1.0 + real(4.0/3.0)*Coeff_R )*dfc6[ idx_wave[v] ]  );
             }
 
-            if ( EigenVal[d][Mode] >= (real)0.0 )
-            {
-               const real Coeff_A = dt_dh2*( EigenVal[d][ NWAVE-1 ] - EigenVal[d][Mode] );
-//             write as (a-b)*(a+b) instead of a^2-b^2 to ensure that Coeff_B=0 when Coeff_A=0
-//             Coeff_B = real(4.0/3.0)*dt_dh2*dt_dh2* ( EigenVal[d][NWAVE-1]*EigenVal[d][NWAVE-1] -
-//                                                      EigenVal[d][Mode   ]*EigenVal[d][Mode   ]   );
-               const real Coeff_B = real(4.0/3.0)*dt_dh2*Coeff_A*( EigenVal[d][ NWAVE-1 ] + EigenVal[d][Mode] );
-
-               for (int v=0; v<NWAVE; v++)
-                  Coeff_R += LEigenVec[Mode][v]*(  Coeff_A*( dfc[ idx_wave[v] ] - dfc6[ idx_wave[v] ] ) +
-                                                   Coeff_B*( dfc6[ idx_wave[v] ]                      )  );
-
-               for (int v=0; v<NWAVE; v++)
-                  Correct_R[ idx_wave[v] ] += Coeff_R*REigenVec[Mode][v];
-            }
-         } // for (int Mode=0; Mode<NWAVE; Mode++)
 
-#        endif // if (  ( RSOLVER == HLLE || RSOLVER == HLLC || RSOLVER == HLLD )  &&  defined HLL_NO_REF_STATE  ) ... else ...
+//          4-2-b2. evaluate the corrections to the left and right face-centered variables
+            for (int Mode=0; Mode<NWAVE; Mode++)
+            {
+               Coeff_L = (real)0.0;
+               Coeff_R = (real)0.0;
+
+               if ( EigenVal[d][Mode] <= (real)0.0 )
+               {
+                  const real Coeff_C = dt_dh2*( EigenVal[d][0] - EigenVal[d][Mode] );
+//                write as (a-b)*(a+b) instead of a^2-b^2 to ensure that Coeff_D=0 when Coeff_C=0
+//                Coeff_D = real(4.0/3.0)*dt_dh2*dt_dh2* ( EigenVal[d][   0]*EigenVal[d][   0] -
+//                                                         EigenVal[d][Mode]*EigenVal[d][Mode]   );
+                  const real Coeff_D = real(4.0/3.0)*dt_dh2*Coeff_C*( EigenVal[d][0] + EigenVal[d][Mode] );
+
+                  for (int v=0; v<NWAVE; v++)
+                     Coeff_L += LEigenVec[Mode][v]*(  Coeff_C*( dfc[ idx_wave[v] ] + dfc6[ idx_wave[v] ] ) +
+                                                      Coeff_D*( dfc6[ idx_wave[v] ]                      )  );
+
+                  for (int v=0; v<NWAVE; v++)
+                     Correct_L[ idx_wave[v] ] += Coeff_L*REigenVec[Mode][v];
+               }
+
+               if ( EigenVal[d][Mode] >= (real)0.0 )
+               {
+                  const real Coeff_A = dt_dh2*( EigenVal[d][ NWAVE-1 ] - EigenVal[d][Mode] );
+//                write as (a-b)*(a+b) instead of a^2-b^2 to ensure that Coeff_B=0 when Coeff_A=0
+//                Coeff_B = real(4.0/3.0)*dt_dh2*dt_dh2* ( EigenVal[d][NWAVE-1]*EigenVal[d][NWAVE-1] -
+//                                                         EigenVal[d][Mode   ]*EigenVal[d][Mode   ]   );
+                  const real Coeff_B = real(4.0/3.0)*dt_dh2*Coeff_A*( EigenVal[d][ NWAVE-1 ] + EigenVal[d][Mode] );
+
+                  for (int v=0; v<NWAVE; v++)
+                     Coeff_R += LEigenVec[Mode][v]*(  Coeff_A*( dfc[ idx_wave[v] ] - dfc6[ idx_wave[v] ] ) +
+                                                      Coeff_B*( dfc6[ idx_wave[v] ]                      )  );
+
+                  for (int v=0; v<NWAVE; v++)
+                     Correct_R[ idx_wave[v] ] += Coeff_R*REigenVec[Mode][v];
+               }
+            } // for (int Mode=0; Mode<NWAVE; Mode++)
+         } // if ( RS == HLLE  ||  RS == HLLC  ||  RS == HLLD ) ... else ...
 
 
 //       4-3. evaluate the corrections to the left and right face-centered passive scalars
 //            --> passive scalars travel with fluid velocity (i.e., entropy mode)
-#        if ( NCOMP_PASSIVE > 0 )
+#        if ( NCOMP_PASSIVE_LR > 0 )
          Coeff_L = -dt_dh2*FMIN( EigenVal[d][1], (real)0.0 );
          Coeff_R = -dt_dh2*FMAX( EigenVal[d][1], (real)0.0 );
 
@@ -1052,7 +1300,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          Hydro_Rotate3D( Correct_L, d, false, MAG_OFFSET );
          Hydro_Rotate3D( Correct_R, d, false, MAG_OFFSET );
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+         for (int v=0; v<NCOMP_LR; v++)
          {
             fc[faceL][v] += Correct_L[v];
             fc[faceR][v] += Correct_R[v];
@@ -1066,7 +1314,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
          fc[faceL][4] = Hydro_CheckMinPres( fc[faceL][4], MinPres );
          fc[faceR][4] = Hydro_CheckMinPres( fc[faceR][4], MinPres );
 
-#        if ( NCOMP_PASSIVE > 0 )
+#        if ( NCOMP_PASSIVE_LR > 0 )
          for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++) {
          fc[faceL][v] = FMAX( fc[faceL][v], TINY_NUMBER );
          fc[faceR][v] = FMAX( fc[faceR][v], TINY_NUMBER ); }
@@ -1090,11 +1338,14 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 //       6. primitive variables --> conserved variables
          real tmp[NCOMP_TOTAL_PLUS_MAG];  // input and output arrays must not overlap for Pri2Con()
+#        ifdef SPLIT_PASSIVE
+         for (int v=NCOMP_TOTAL_LR; v<NCOMP_TOTAL; v++)   tmp[v] = (real)0.0;
+#        endif
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   tmp[v] = fc[faceL][v];
+         for (int v=0; v<NCOMP_LR; v++)   tmp[v] = fc[faceL][v];
          Hydro_Pri2Con( tmp, fc[faceL], _Gamma_m1, NormPassive, NNorm, NormIdx );
 
-         for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)   tmp[v] = fc[faceR][v];
+         for (int v=0; v<NCOMP_LR; v++)   tmp[v] = fc[faceR][v];
          Hydro_Pri2Con( tmp, fc[faceR], _Gamma_m1, NormPassive, NNorm, NormIdx );
 
       } // for (int d=0; d<3; d++)
@@ -1108,22 +1359,63 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 //    8. store the face-centered values to the output array
       for (int f=0; f<6; f++)
-      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+      for (int v=0; v<NCOMP_LR; v++)
          g_FC_Var[f][v][idx_fc] = fc[f][v];
 
-   } // CGPU_LOOP( idx_fc, CUBE(N_FC_VAR) )
+   } // CGPU_LOOP( idx0, (kEnd_fc-kBeg)*N_FC_VAR2 )
 
 
 #  ifdef __CUDACC__
    __syncthreads();
 #  endif
 
-} // FUNCTION : Hydro_DataReconstruction (PPM)
+} // FUNCTION : Hydro_DataReconstruction_PPM
 #endif // #if ( LR_SCHEME == PPM )
 
 
 
-#ifdef CHAR_RECONSTRUCTION
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_DataReconstruction
+// Description :  Reconstruct the face-centered variables by either PLM or PPM
+//
+// Note        :  1. The data reconstruction scheme and the Riemann solver are set by the template parameters
+//                   LR (PLM/PPM) and RS (EXACT/ROE/HLLE/HLLC/HLLD), respectively
+//                   --> Resolved at compile time and thus do not introduce any per-cell overhead
+//                   --> See HYDRO_FOR_EACH_SCHEME() in CUFLU.h for the instantiated combinations
+//                2. LR == PPM is only supported when LR_SCHEME == PPM
+//
+// Parameter   :  See Hydro_DataReconstruction_PLM()
+//------------------------------------------------------------------------------------------------------
+template <int LR, int RS>
+GPU_DEVICE
+void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
+                               const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
+                                     real g_PriVar   [][ CUBE(FLU_NXT) ],
+                                     real g_FC_Var   [][NCOMP_LR][ CUBE(N_FC_VAR) ],
+                                     real g_Slope_PPM[][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],
+                               const bool Con2Pri, const int NIn, const int NGhost, const real Gamma,
+                               const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                               const real dt, const real dh, const real MinDens, const real MinPres,
+                               const bool NormPassive, const int NNorm, const int NormIdx[],
+                               const bool JeansMinPres, const real JeansMinPres_Coeff, const int kBeg, const int kEnd )
+{
+
+#  if ( LR_SCHEME == PPM )
+   if ( LR == PPM )
+      Hydro_DataReconstruction_PPM <RS> ( g_ConVar, g_FC_B, g_PriVar, g_FC_Var, g_Slope_PPM, Con2Pri, NIn, NGhost, Gamma,
+                                          LR_Limiter, MinMod_Coeff, dt, dh, MinDens, MinPres, NormPassive, NNorm, NormIdx,
+                                          JeansMinPres, JeansMinPres_Coeff, kBeg, kEnd );
+   else
+#  endif
+      Hydro_DataReconstruction_PLM <RS> ( g_ConVar, g_FC_B, g_PriVar, g_FC_Var, g_Slope_PPM, Con2Pri, NIn, NGhost, Gamma,
+                                          LR_Limiter, MinMod_Coeff, dt, dh, MinDens, MinPres, NormPassive, NNorm, NormIdx,
+                                          JeansMinPres, JeansMinPres_Coeff, kBeg, kEnd );
+
+} // FUNCTION : Hydro_DataReconstruction
+
+
+
+#if ( defined CHAR_RECONSTRUCTION  &&  !defined LR_PENCIL )
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Hydro_Pri2Char
 // Description :  Primitive variables --> characteristic variables
@@ -1350,7 +1642,7 @@ void Hydro_GetEigenSystem( const real CC_Var[], real EigenVal[][NWAVE],
    real Cf2, Cs2, Cf, Cs;
    real PriVar[NCOMP_TOTAL_PLUS_MAG];
 
-   for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)  PriVar[v] = CC_Var[v];
+   for (int v=0; v<NCOMP_LR; v++)  PriVar[v] = CC_Var[v];
 
    Hydro_Rotate3D( PriVar, XYZ, true, MAG_OFFSET );
 
@@ -1606,6 +1898,7 @@ void Hydro_GetEigenSystem( const real CC_Var[], real EigenVal[][NWAVE],
 
 
 
+#ifndef LR_PENCIL
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Hydro_LimitSlope
 // Description :  Evaluate the monotonic slope by slope limiters
@@ -1646,7 +1939,7 @@ void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_
    real Slope_A[NCOMP_TOTAL_PLUS_MAG], Slope_LR;
 
 // evaluate different slopes
-   for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+   for (int v=0; v<NCOMP_LR; v++)
    {
       Slope_L[v] = C[v] - L[v];
       Slope_R[v] = R[v] - C[v];
@@ -1655,7 +1948,7 @@ void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_
 
    if ( LR_Limiter == VL_GMINMOD )
    {
-      for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+      for (int v=0; v<NCOMP_LR; v++)
       {
          if ( Slope_L[v]*Slope_R[v] > (real)0.0 )
             Slope_A[v] = (real)2.0*Slope_L[v]*Slope_R[v]/( Slope_L[v] + Slope_R[v] );
@@ -1680,7 +1973,7 @@ void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_
 
 
 // apply the slope limiter
-   for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+   for (int v=0; v<NCOMP_LR; v++)
    {
       Slope_LR = Slope_L[v]*Slope_R[v];
 
@@ -1726,7 +2019,7 @@ void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_
       {
          Slope_Limiter[v] = (real)0.0;
       } // if ( Slope_LR > (real)0.0 ) ... else ...
-   } // for (int v=0; v<NCOMP_TOTAL_PLUS_MAG; v++)
+   } // for (int v=0; v<NCOMP_LR; v++)
 
 
 // characteristic variables --> primitive variables
@@ -1738,6 +2031,348 @@ void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_
 
 
 
+#else // #ifndef LR_PENCIL
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_LimitSlope_Pencil
+// Description :  Evaluate the monotonic slopes of a pencil of cells by slope limiters
+//
+// Note        :  1. Pencil version of Hydro_LimitSlope() for CPU
+//                   --> Work on NCell consecutive cells along x at once with structure-of-arrays buffers so that
+//                       the slopes, characteristic projection, and slope limiters are vectorized along the pencil
+//                   --> Give the same results as Hydro_LimitSlope()
+//                2. Eigenvectors for MHD + CHAR_RECONSTRUCTION are still evaluated cell by cell by MHD_GetEigenSystem()
+//                3. Input data must be primitive variables
+//
+// Parameter   :  g_PriVar      : Array storing the input cell-centered primitive variables
+//                idx_cc        : Index of the first cell of the pencil in g_PriVar[]
+//                didx_cc       : Index difference between neighboring cells along the target direction
+//                NCell         : Number of cells in the pencil (must be <= FLU_NXT)
+//                LR_Limiter    : Slope limiter for the data reconstruction in the MHM/MHM_RP/CTU schemes
+//                                (0/1/2/3) = (vanLeer/generalized MinMod/vanAlbada/vanLeer+generalized MinMod) limiter
+//                MinMod_Coeff  : Coefficient of the generalized MinMod limiter
+//                Gamma         : Ratio of specific heats
+//                XYZ           : Target spatial direction : (0/1/2) --> (x/y/z)
+//                Slope_Limiter : Array to store the output monotonic slopes
+//-------------------------------------------------------------------------------------------------------
+void Hydro_LimitSlope_Pencil( const real g_PriVar[][ CUBE(FLU_NXT) ], const int idx_cc, const int didx_cc, const int NCell,
+                              const LR_Limiter_t LR_Limiter, const real MinMod_Coeff, const real Gamma, const int XYZ,
+                              real Slope_Limiter[][FLU_NXT] )
+{
+
+   real Slope_L[NCOMP_LR][FLU_NXT], Slope_R[NCOMP_LR][FLU_NXT], Slope_C[NCOMP_LR][FLU_NXT];
+   real Slope_A[NCOMP_LR][FLU_NXT];
+
+
+// 1. evaluate different slopes
+   for (int v=0; v<NCOMP_LR; v++)
+   {
+      const real *C = g_PriVar[v] + idx_cc;
+      const real *L = C - didx_cc;
+      const real *R = C + didx_cc;
+
+#     pragma omp simd
+      for (int i=0; i<NCell; i++)
+      {
+         Slope_L[v][i] = C[i] - L[i];
+         Slope_R[v][i] = R[i] - C[i];
+         Slope_C[v][i] = (real)0.5*( Slope_L[v][i] + Slope_R[v][i] );
+      }
+
+      if ( LR_Limiter == VL_GMINMOD )
+      {
+#        pragma omp simd
+         for (int i=0; i<NCell; i++)
+            Slope_A[v][i] = ( Slope_L[v][i]*Slope_R[v][i] > (real)0.0 ) ?
+                            (real)2.0*Slope_L[v][i]*Slope_R[v][i]/( Slope_L[v][i] + Slope_R[v][i] ) : (real)0.0;
+      }
+   }
+
+
+// 2. primitive variables --> characteristic variables
+#  ifdef CHAR_RECONSTRUCTION
+   const real *Rho  = g_PriVar[0] + idx_cc;
+   const real *Pres = g_PriVar[4] + idx_cc;
+
+#  ifdef MHD
+// evaluate the eigenvectors of all cells in the pencil
+// --> constant components of the left and right eigenvector matrices must be initialized
+   real LEigenVec[NWAVE][NWAVE][FLU_NXT], REigenVec[NWAVE][NWAVE][FLU_NXT];
+   real LEigenVec_1Cell[NWAVE][NWAVE] = { { 0.0, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL },
+                                          { 0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
+                                          { 0.0, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL },
+                                          { 1.0,       0.0,       0.0,       0.0, NULL_REAL,       0.0,       0.0 },
+                                          { 0.0, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL },
+                                          { 0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
+                                          { 0.0, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL } };
+   real REigenVec_1Cell[NWAVE][NWAVE] = { { NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL },
+                                          {       0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
+                                          { NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL },
+                                          {       1.0,       0.0,       0.0,       0.0,       0.0,       0.0,       0.0 },
+                                          { NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL },
+                                          {       0.0,       0.0, NULL_REAL, NULL_REAL,       0.0, NULL_REAL, NULL_REAL },
+                                          { NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL, NULL_REAL } };
+   real EigenVal_1Cell[NWAVE], cc_C[NCOMP_TOTAL_PLUS_MAG];
+
+   for (int i=0; i<NCell; i++)
+   {
+      for (int v=0; v<NCOMP_LR; v++)   cc_C[v] = g_PriVar[v][ idx_cc + i ];
+
+      MHD_GetEigenSystem( cc_C, EigenVal_1Cell, LEigenVec_1Cell, REigenVec_1Cell, Gamma, XYZ );
+
+      for (int m=0; m<NWAVE; m++)
+      for (int n=0; n<NWAVE; n++)
+      {
+         LEigenVec[m][n][i] = LEigenVec_1Cell[m][n];
+         REigenVec[m][n][i] = REigenVec_1Cell[m][n];
+      }
+   }
+#  else
+   const real (*LEigenVec)[NWAVE][FLU_NXT] = NULL;
+   const real (*REigenVec)[NWAVE][FLU_NXT] = NULL;
+#  endif // #ifdef MHD ... else ...
+
+   Hydro_Pri2Char_Pencil( Slope_L, NCell, Gamma, Rho, Pres, LEigenVec, XYZ );
+   Hydro_Pri2Char_Pencil( Slope_R, NCell, Gamma, Rho, Pres, LEigenVec, XYZ );
+   Hydro_Pri2Char_Pencil( Slope_C, NCell, Gamma, Rho, Pres, LEigenVec, XYZ );
+
+   if ( LR_Limiter == VL_GMINMOD )
+      Hydro_Pri2Char_Pencil( Slope_A, NCell, Gamma, Rho, Pres, LEigenVec, XYZ );
+#  endif // #ifdef CHAR_RECONSTRUCTION
+
+
+// 3. apply the slope limiter
+// --> the limiter is selected outside the loops over cells, and min/max operations are written as
+//     conditional expressions so that the loops can be vectorized
+   for (int v=0; v<NCOMP_LR; v++)
+   {
+      const real *SL = Slope_L[v];
+      const real *SR = Slope_R[v];
+      const real *SC = Slope_C[v];
+      const real *SA = Slope_A[v];
+            real *Lim = Slope_Limiter[v];
+
+      switch ( LR_Limiter )
+      {
+         case VANLEER:     // van-Leer
+#           pragma omp simd
+            for (int i=0; i<NCell; i++)
+            {
+               const real Slope_LR = SL[i]*SR[i];
+
+               Lim[i] = ( Slope_LR > (real)0.0 ) ? (real)2.0*Slope_LR/( SL[i] + SR[i] ) : (real)0.0;
+            }
+            break;
+
+         case GMINMOD:     // generalized MinMod
+#           pragma omp simd
+            for (int i=0; i<NCell; i++)
+            {
+               const real Slope_LR = SL[i]*SR[i];
+               const real AbsL     = FABS( SL[i]*MinMod_Coeff );
+               const real AbsR     = FABS( SR[i]*MinMod_Coeff );
+               const real AbsC     = FABS( SC[i] );
+               real Slope;
+
+               Slope  = ( AbsL  < AbsR  ) ? AbsL : AbsR;
+               Slope  = ( AbsC  < Slope ) ? AbsC : Slope;
+               Slope *= SIGN( SC[i] );
+
+               Lim[i] = ( Slope_LR > (real)0.0 ) ? Slope : (real)0.0;
+            }
+            break;
+
+         case ALBADA:      // van-Albada
+#           pragma omp simd
+            for (int i=0; i<NCell; i++)
+            {
+               const real Slope_LR = SL[i]*SR[i];
+
+               Lim[i] = ( Slope_LR > (real)0.0 ) ?
+                        Slope_LR*( SL[i] + SR[i] ) / ( SL[i]*SL[i] + SR[i]*SR[i] ) : (real)0.0;
+            }
+            break;
+
+         case VL_GMINMOD:  // van-Leer + generalized MinMod
+#           pragma omp simd
+            for (int i=0; i<NCell; i++)
+            {
+               const real Slope_LR = SL[i]*SR[i];
+               const real AbsL     = FABS( SL[i]*MinMod_Coeff );
+               const real AbsR     = FABS( SR[i]*MinMod_Coeff );
+               const real AbsC     = FABS( SC[i] );
+               const real AbsA     = FABS( SA[i] );
+               real Slope;
+
+               Slope  = ( AbsL  < AbsR  ) ? AbsL : AbsR;
+               Slope  = ( AbsC  < Slope ) ? AbsC : Slope;
+               Slope  = ( AbsA  < Slope ) ? AbsA : Slope;
+               Slope *= SIGN( SC[i] );
+
+               Lim[i] = ( Slope_LR > (real)0.0 ) ? Slope : (real)0.0;
+            }
+            break;
+
+         default :
+#           ifdef GAMER_DEBUG
+            printf( "ERROR : incorrect parameter %s = %d !!\n", "LR_Limiter", LR_Limiter );
+#           endif
+            return;
+      } // switch ( LR_Limiter )
+   } // for (int v=0; v<NCOMP_LR; v++)
+
+
+// 4. characteristic variables --> primitive variables
+#  ifdef CHAR_RECONSTRUCTION
+   Hydro_Char2Pri_Pencil( Slope_Limiter, NCell, Gamma, Rho, Pres, REigenVec, XYZ );
+#  endif
+
+} // FUNCTION : Hydro_LimitSlope_Pencil
+
+
+
+#ifdef CHAR_RECONSTRUCTION
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_Pri2Char_Pencil / Hydro_Char2Pri_Pencil
+// Description :  Pencil versions of Hydro_Pri2Char() and Hydro_Char2Pri()
+//
+// Note        :  1. Invoked by Hydro_LimitSlope_Pencil()
+//                2. Coordinate rotation is replaced by the index mapping of the vector components
+//                3. Input and output share the same array InOut[v][i], where i is the cell index in the pencil
+//                4. L/REigenVec[m][n][i] store the eigenvectors of each cell (for MHD only)
+//-------------------------------------------------------------------------------------------------------
+void Hydro_Pri2Char_Pencil( real InOut[][FLU_NXT], const int NCell, const real Gamma, const real Rho[], const real Pres[],
+                            const real LEigenVec[][NWAVE][FLU_NXT], const int XYZ )
+{
+
+   const int MomN  = 1 + XYZ;
+   const int MomT1 = 1 + (XYZ+1)%3;
+   const int MomT2 = 1 + (XYZ+2)%3;
+#  ifdef MHD
+   const int MagT1 = MAG_OFFSET + (XYZ+1)%3;
+   const int MagT2 = MAG_OFFSET + (XYZ+2)%3;
+#  endif
+
+#  pragma omp simd
+   for (int i=0; i<NCell; i++)
+   {
+//    rotated input (the normal B field is removed to be consistent with the eigenvector matrix)
+      const real T0 = InOut[0    ][i];
+      const real T1 = InOut[MomN ][i];
+      const real T2 = InOut[MomT1][i];
+      const real T3 = InOut[MomT2][i];
+      const real T4 = InOut[4    ][i];
+
+// a. MHD
+#     ifdef MHD
+      const real T5 = InOut[MagT1][i];
+      const real T6 = InOut[MagT2][i];
+
+      const real tmp_f1 = LEigenVec[0][1][i]*T1 + LEigenVec[0][2][i]*T2 + LEigenVec[0][3][i]*T3;
+      const real tmp_b1 = LEigenVec[0][4][i]*T4 + LEigenVec[0][5][i]*T5 + LEigenVec[0][6][i]*T6;
+      const real tmp_f2 = LEigenVec[2][1][i]*T1 + LEigenVec[2][2][i]*T2 + LEigenVec[2][3][i]*T3;
+      const real tmp_b2 = LEigenVec[2][4][i]*T4 + LEigenVec[2][5][i]*T5 + LEigenVec[2][6][i]*T6;
+
+      InOut[MAG_OFFSET+0][i] = (real)0.0;
+      InOut[           3][i] = T0 + LEigenVec[3][4][i]*T4;
+      InOut[           1][i] = LEigenVec[1][2][i]*T2 + LEigenVec[1][3][i]*T3 + LEigenVec[1][5][i]*T5 + LEigenVec[1][6][i]*T6;
+      InOut[MAG_OFFSET+1][i] = LEigenVec[5][2][i]*T2 + LEigenVec[5][3][i]*T3 + LEigenVec[5][5][i]*T5 + LEigenVec[5][6][i]*T6;
+      InOut[           0][i] =  tmp_f1 + tmp_b1;
+      InOut[           2][i] =  tmp_f2 + tmp_b2;
+      InOut[           4][i] = -tmp_f2 + tmp_b2;
+      InOut[MAG_OFFSET+2][i] = -tmp_f1 + tmp_b1;
+
+// b. pure hydro
+#     else
+      const real _a2 = (real)1.0 / ( Gamma*Pres[i]/Rho[i] );
+      const real _a  = SQRT( _a2 );
+
+      InOut[0][i] = -(real)0.5*Rho[i]*_a*T1 + (real)0.5*_a2*T4;
+      InOut[1][i] = T0 - _a2*T4;
+      InOut[2][i] = T2;
+      InOut[3][i] = T3;
+      InOut[4][i] = +(real)0.5*Rho[i]*_a*T1 + (real)0.5*_a2*T4;
+#     endif // #ifdef MHD ... else ...
+   } // for (int i=0; i<NCell; i++)
+
+} // FUNCTION : Hydro_Pri2Char_Pencil
+
+
+
+void Hydro_Char2Pri_Pencil( real InOut[][FLU_NXT], const int NCell, const real Gamma, const real Rho[], const real Pres[],
+                            const real REigenVec[][NWAVE][FLU_NXT], const int XYZ )
+{
+
+   const int MomN  = 1 + XYZ;
+   const int MomT1 = 1 + (XYZ+1)%3;
+   const int MomT2 = 1 + (XYZ+2)%3;
+#  ifdef MHD
+   const int MagN  = MAG_OFFSET + XYZ;
+   const int MagT1 = MAG_OFFSET + (XYZ+1)%3;
+   const int MagT2 = MAG_OFFSET + (XYZ+2)%3;
+#  endif
+
+#  pragma omp simd
+   for (int i=0; i<NCell; i++)
+   {
+      const real T0   = InOut[0][i];
+      const real T1   = InOut[1][i];
+      const real T2   = InOut[2][i];
+      const real T3   = InOut[3][i];
+      const real T4   = InOut[4][i];
+      const real _Rho = (real)1.0 / Rho[i];
+      const real a2   = Gamma*Pres[i]*_Rho;
+      real Out0, Out1, Out2, Out3, Out4;
+
+// a. MHD
+#     ifdef MHD
+      const real T5 = InOut[MAG_OFFSET+1][i];
+      const real T6 = InOut[MAG_OFFSET+2][i];
+      real OutB0, OutB1, OutB2;
+
+      Out0  = REigenVec[0][0][i]*T0 + REigenVec[2][0][i]*T2 + T3 +
+              REigenVec[4][0][i]*T4 + REigenVec[6][0][i]*T6;
+      Out1  = REigenVec[0][1][i]*T0 + REigenVec[2][1][i]*T2 + REigenVec[4][1][i]*T4 +
+              REigenVec[6][1][i]*T6;
+      Out2  = REigenVec[0][2][i]*T0 + REigenVec[1][2][i]*T1 + REigenVec[2][2][i]*T2 +
+              REigenVec[4][2][i]*T4 + REigenVec[5][2][i]*T5 + REigenVec[6][2][i]*T6;
+      Out3  = REigenVec[0][3][i]*T0 + REigenVec[1][3][i]*T1 + REigenVec[2][3][i]*T2 +
+              REigenVec[4][3][i]*T4 + REigenVec[5][3][i]*T5 + REigenVec[6][3][i]*T6;
+      Out4  = ( Out0 - T3 )*a2;
+      OutB0 = (real)0.0;
+      OutB1 = REigenVec[0][5][i]*T0 + REigenVec[1][5][i]*T1 + REigenVec[2][5][i]*T2 +
+              REigenVec[4][5][i]*T4 + REigenVec[5][5][i]*T5 + REigenVec[6][5][i]*T6;
+      OutB2 = REigenVec[0][6][i]*T0 + REigenVec[1][6][i]*T1 + REigenVec[2][6][i]*T2 +
+              REigenVec[4][6][i]*T4 + REigenVec[5][6][i]*T5 + REigenVec[6][6][i]*T6;
+
+      InOut[MagN ][i] = OutB0;
+      InOut[MagT1][i] = OutB1;
+      InOut[MagT2][i] = OutB2;
+
+// b. pure hydro
+#     else
+      const real a = SQRT( a2 );
+
+      Out0 = T0 + T1 + T4;
+      Out1 = a*_Rho*( -T0 + T4 );
+      Out2 = T2;
+      Out3 = T3;
+      Out4 = a2*( T0 + T4 );
+#     endif // #ifdef MHD ... else ...
+
+//    restore the original order
+      InOut[0    ][i] = Out0;
+      InOut[MomN ][i] = Out1;
+      InOut[MomT1][i] = Out2;
+      InOut[MomT2][i] = Out3;
+      InOut[4    ][i] = Out4;
+   } // for (int i=0; i<NCell; i++)
+
+} // FUNCTION : Hydro_Char2Pri_Pencil
+#endif // #ifdef CHAR_RECONSTRUCTION
+#endif // #ifndef LR_PENCIL ... else ...
+
+
+
 #if ( FLU_SCHEME == MHM )
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Hydro_HancockPredict
@@ -1747,6 +2382,7 @@ void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_
 // Note        :  1. Work for the MHM scheme
 //                2. Do NOT require data in the neighboring cells
 //                3. Input variables must be conserved variables
+//                4. Passive scalars are skipped for SPLIT_PASSIVE
 //
 // Parameter   :  fc           : Face-centered conserved variables to be updated
 //                dt           : Time interval to advance solution
@@ -1775,7 +2411,7 @@ void Hydro_HancockPredict( real fc[][NCOMP_TOTAL], const real dt, const real dh,
    for (int f=0; f<6; f++)    Hydro_Con2Flux( f/2, Flux[f], fc[f], Gamma_m1, MinPres );
 
 // update the face-centered variables
-   for (int v=0; v<NCOMP_TOTAL; v++)
+   for (int v=0; v<NCOMP_TOTAL_LR; v++)
    {
       dFlux = dt_dh2*( Flux[1][v] - Flux[0][v] + Flux[3][v] - Flux[2][v] + Flux[5][v] - Flux[4][v] );
 
@@ -1789,7 +2425,7 @@ void Hydro_HancockPredict( real fc[][NCOMP_TOTAL], const real dt, const real dh,
       {
 //       set to the cell-centered values before update
          for (int f=0; f<6; f++)
-         for (int v=0; v<NCOMP_TOTAL; v++)
+         for (int v=0; v<NCOMP_TOTAL_LR; v++)
             fc[f][v] = g_cc_array[v][cc_idx];
 
          break;
@@ -1808,7 +2444,7 @@ void Hydro_HancockPredict( real fc[][NCOMP_TOTAL], const real dt, const real dh,
       fc[f][0] = FMAX( fc[f][0], MinDens );
       fc[f][4] = Hydro_CheckMinPresInEngy( fc[f][0], fc[f][1], fc[f][2], fc[f][3], fc[f][4],
                                            Gamma_m1, _Gamma_m1, MinPres, EngyB );
-#     if ( NCOMP_PASSIVE > 0 )
+#     if ( NCOMP_PASSIVE_LR > 0 )
       for (int v=NCOMP_FLUID; v<NCOMP_TOTAL; v++)
       fc[f][v] = FMAX( fc[f][v], TINY_NUMBER );
 #     endif
@@ -1820,6 +2456,28 @@ void Hydro_HancockPredict( real fc[][NCOMP_TOTAL], const real dt, const real dh,
 
 
 // MINMOD macro is only used in this function
+// explicit template instantiation
+#ifndef __CUDACC__
+#define INSTANTIATE( LR, RS )                                                                                        \
+template void Hydro_DataReconstruction <LR, RS> ( const real g_ConVar   [][ CUBE(FLU_NXT) ],                          \
+                                                  const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],                \
+                                                        real g_PriVar   [][ CUBE(FLU_NXT) ],                          \
+                                                        real g_FC_Var   [][NCOMP_LR][ CUBE(N_FC_VAR) ],               \
+                                                        real g_Slope_PPM[][NCOMP_LR][ CUBE(N_SLOPE_PPM) ],            \
+                                                  const bool Con2Pri, const int NIn, const int NGhost, const real Gamma,\
+                                                  const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,             \
+                                                  const real dt, const real dh, const real MinDens, const real MinPres,\
+                                                  const bool NormPassive, const int NNorm, const int NormIdx[],       \
+                                                  const bool JeansMinPres, const real JeansMinPres_Coeff,             \
+                                                  const int kBeg, const int kEnd );
+
+HYDRO_FOR_EACH_SCHEME( INSTANTIATE )
+
+#undef INSTANTIATE
+#endif // #ifndef __CUDACC__
+
+
+
 #ifdef MINMOD
 #  undef MINMOD
 #endif
@@ -25,12 +25,70 @@
 
 
 
+#if ( defined SPLIT_PASSIVE  &&  NCOMP_PASSIVE > 0 )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_PassiveFlux
+// Description :  Evaluate the fluxes of all passive scalars across one cell face from the density flux
+//
+// Note        :  1. Invoked by Hydro_FullStepUpdate() for SPLIT_PASSIVE
+//                2. Passive scalars are advected as mass fractions carried by the density flux
+//                   --> Mass fraction of the upwind cell is reconstructed by a van Leer-limited linear profile
+//                       and averaged over the volume swept through the face during dt
+//                   --> Reduce to the first-order upwind scheme when the face Courant number approaches one
+//                   --> The face value is bounded by the mass fractions of the neighboring cells, so the flux
+//                       never reverses the sign of the density flux
+//                3. Require two ghost zones on each side of the face in g_Input[]
+//
+// Parameter   :  g_Input  : Array storing the input fluid data
+//                idx_L    : Index of the cell on the left side of the target face in g_Input[]
+//                didx     : Index difference between neighboring cells along the face normal in g_Input[]
+//                FluxDens : Density flux across the target face
+//                dt_dh    : dt/dh
+//                Flux     : Array to store the output passive-scalar fluxes
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE static
+void Hydro_PassiveFlux( const real g_Input[][ CUBE(FLU_NXT) ], const int idx_L, const int didx,
+                        const real FluxDens, const real dt_dh, real Flux[] )
+{
+
+   const bool Upwind_L = ( FluxDens >= (real)0.0 );
+   const int  idx_C    = ( Upwind_L ) ? idx_L : idx_L + didx;
+   const real _Dens_L  = (real)1.0 / g_Input[DENS][ idx_C - didx ];
+   const real _Dens_C  = (real)1.0 / g_Input[DENS][ idx_C        ];
+   const real _Dens_R  = (real)1.0 / g_Input[DENS][ idx_C + didx ];
+
+// fraction of the upwind cell not swept through the face during dt
+   const real Courant  = FMIN( FABS(FluxDens)*dt_dh*_Dens_C, (real)1.0 );
+   const real Coeff    = ( Upwind_L ? (real)0.5 : (real)-0.5 )*( (real)1.0 - Courant );
+
+   for (int v=0; v<NCOMP_PASSIVE; v++)
+   {
+      const real *Passive = g_Input[ NCOMP_FLUID + v ];
+      const real  X_C     = Passive[idx_C]*_Dens_C;
+      const real  dX_L    = X_C - Passive[ idx_C - didx ]*_Dens_L;
+      const real  dX_R    = Passive[ idx_C + didx ]*_Dens_R - X_C;
+      const real  dX_LR   = dX_L*dX_R;
+      const real  Slope   = ( dX_LR > (real)0.0 ) ? (real)2.0*dX_LR/( dX_L + dX_R ) : (real)0.0;
+
+      Flux[v] = FluxDens*( X_C + Coeff*Slope );
+   }
+
+} // FUNCTION : Hydro_PassiveFlux
+#endif // #if ( defined SPLIT_PASSIVE  &&  NCOMP_PASSIVE > 0 )
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Hydro_FullStepUpdate
 // Description :  Evaluate the full-step solution
 //
 // Note        :  1. This function is shared by MHM, MHM_RP, and CTU schemes
 //                2. Invoke dual-energy check if DualEnergySwitch is on
+//                3. Only the output cells with k in [kBeg, kEnd) are updated
+//                   --> Used by the fused CPU solvers to update a patch group slab by slab
+//                4. For SPLIT_PASSIVE, g_Flux[] does not store the fluxes of passive scalars, which are evaluated
+//                   here by Hydro_PassiveFlux() from the density flux instead
+//                   --> Their inter-patch fluxes are also stored in g_IntFlux[] here
 //
 // Parameter   :  g_Input          : Array storing the input fluid data
 //                g_Output         : Array to store the updated fluid data
@@ -52,16 +110,26 @@
 //                                   --> Should be set to the global variable "PassiveNorm_NVar"
 //                NormIdx          : Target variable indices to be normalized
 //                                   --> Should be set to the global variable "PassiveNorm_VarIdx"
+//                DumpIntFlux      : true --> store the inter-patch fluxes of passive scalars in g_IntFlux[]
+//                                   --> For SPLIT_PASSIVE only
+//                g_IntFlux        : Array for DumpIntFlux
+//                kBeg/kEnd        : Only update the output cells with k in [kBeg, kEnd)
+//                                   --> Set to [0, PS2) to update all cells
 //-------------------------------------------------------------------------------------------------------
 GPU_DEVICE
 void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[][ CUBE(PS2) ], char g_DE_Status[],
-                           const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_FLUX) ],
+                           const real g_FC_B[][ PS2P1*SQR(PS2) ], const real g_Flux[][NCOMP_LR][ CUBE(N_FC_FLUX) ],
                            const real dt, const real dh, const real Gamma, const real MinDens, const real MinPres,
-                           const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[] )
+                           const real DualEnergySwitch, const bool NormPassive, const int NNorm, const int NormIdx[],
+                           const bool DumpIntFlux, real g_IntFlux[][NCOMP_TOTAL][ SQR(PS2) ],
+                           const int kBeg, const int kEnd )
 {
 
    const int  didx_flux[3] = { 1, N_FL_FLUX, SQR(N_FL_FLUX) };
    const real dt_dh        = dt/dh;
+#  if ( defined SPLIT_PASSIVE  &&  NCOMP_PASSIVE > 0 )
+   const int  didx_in  [3] = { 1, FLU_NXT, SQR(FLU_NXT) };
+#  endif
 #  ifdef DUAL_ENERGY
    const real  Gamma_m1    = Gamma - (real)1.0;
    const real _Gamma_m1    = (real)1.0 / Gamma_m1;
@@ -70,9 +138,11 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
    real dFlux[3][NCOMP_TOTAL], Output_1Cell[NCOMP_TOTAL];
 
 
-   const int size_ij = SQR(PS2);
-   CGPU_LOOP( idx_out, CUBE(PS2) )
+   const int size_ij  = SQR(PS2);
+   const int kEnd_out = MIN( kEnd, PS2 );
+   CGPU_LOOP( idx0, (kEnd_out-kBeg)*size_ij )
    {
+      const int idx_out  = idx0 + kBeg*size_ij;
       const int i_out    = idx_out % PS2;
       const int j_out    = idx_out % size_ij / PS2;
       const int k_out    = idx_out / size_ij;
@@ -97,7 +167,7 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 
 //    1. calculate flux difference to update the fluid data
       for (int d=0; d<3; d++)
-      for (int v=0; v<NCOMP_TOTAL; v++)
+      for (int v=0; v<NCOMP_TOTAL_LR; v++)
       {
 #        ifdef MHD
          dFlux[d][v] = g_Flux[d][v][idx_flux] - g_Flux[d][v][ idx_flux - didx_flux[d] ];
@@ -106,6 +176,41 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
 #        endif
       }
 
+//    advect passive scalars with the density flux for SPLIT_PASSIVE
+//    --> MHD is not supported, so the left face of the output cell has the same index as the cell
+#     if ( defined SPLIT_PASSIVE  &&  NCOMP_PASSIVE > 0 )
+      const int ijk_out[3] = { i_out, j_out, k_out };
+
+      for (int d=0; d<3; d++)
+      {
+         real Flux_L[NCOMP_PASSIVE], Flux_R[NCOMP_PASSIVE];
+
+         Hydro_PassiveFlux( g_Input, idx_in-didx_in[d], didx_in[d], g_Flux[d][DENS][idx_flux],
+                            dt_dh, Flux_L );
+         Hydro_PassiveFlux( g_Input, idx_in,            didx_in[d], g_Flux[d][DENS][ idx_flux + didx_flux[d] ],
+                            dt_dh, Flux_R );
+
+         for (int v=0; v<NCOMP_PASSIVE; v++)
+            dFlux[d][ NCOMP_FLUID + v ] = Flux_R[v] - Flux_L[v];
+
+//       store the inter-patch fluxes on the left faces of the cells 0 and PS1 and on the right face of the cell PS2-1
+         if ( DumpIntFlux )
+         {
+            const int TL      = ( d == 0 ) ? 1 : 0;   // transverse directions with the lower/higher array strides
+            const int TH      = ( d == 2 ) ? 1 : 2;
+            const int int_idx = ijk_out[TH]*PS2 + ijk_out[TL];
+
+            if ( ijk_out[d] == 0  ||  ijk_out[d] == PS1 )
+               for (int v=0; v<NCOMP_PASSIVE; v++)
+                  g_IntFlux[ 3*d + ijk_out[d]/PS1 ][ NCOMP_FLUID + v ][int_idx] = Flux_L[v];
+
+            if ( ijk_out[d] == PS2-1 )
+               for (int v=0; v<NCOMP_PASSIVE; v++)
+                  g_IntFlux[ 3*d + 2 ][ NCOMP_FLUID + v ][int_idx] = Flux_R[v];
+         }
+      } // for (int d=0; d<3; d++)
+#     endif // #if ( defined SPLIT_PASSIVE  &&  NCOMP_PASSIVE > 0 )
+
       for (int v=0; v<NCOMP_TOTAL; v++)
          Output_1Cell[v] = g_Input[v][idx_in] - dt_dh*( dFlux[0][v] + dFlux[1][v] + dFlux[2][v] );
 
@@ -176,7 +281,7 @@ void Hydro_FullStepUpdate( const real g_Input[][ CUBE(FLU_NXT) ], real g_Output[
                  Output_1Cell[ENGY], __FILE__, __LINE__, __FUNCTION__ );
 #     endif
 
-   } // CGPU_LOOP( idx_out, CUBE(PS2) )
+   } // CGPU_LOOP( idx0, (kEnd_out-kBeg)*size_ij )
 
 } // FUNCTION : Hydro_FullStepUpdate
 
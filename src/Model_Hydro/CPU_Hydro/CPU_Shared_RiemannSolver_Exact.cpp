@@ -5,8 +5,7 @@
 
 #include "CUFLU.h"
 
-#if (  MODEL == HYDRO  &&  \
-       ( RSOLVER == EXACT || CHECK_INTERMEDIATE == EXACT )  &&  \
+#if (  MODEL == HYDRO  &&  !defined MHD  &&  \
        ( FLU_SCHEME == MHM || FLU_SCHEME == MHM_RP || FLU_SCHEME == CTU )  )
 
 
@@ -429,7 +428,7 @@ void Set_Flux( real flux[], const real val[], const real Gamma )
 
 
 
-#endif // #if ( MODEL == HYDRO  &&  ( RSOLVER == EXACT || CHECK_INTE == EXACT ) && ( SCHEME == MHM/MHM_RP/CTU ) )
+#endif // #if ( MODEL == HYDRO  &&  !defined MHD  &&  ( SCHEME == MHM/MHM_RP/CTU ) )
 
 
 
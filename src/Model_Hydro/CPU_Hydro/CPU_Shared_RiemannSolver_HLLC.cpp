@@ -218,6 +218,173 @@ void Hydro_RiemannSolver_HLLC( const int XYZ, real Flux_Out[], const real L_In[]
 
 
 
+#ifdef RSOLVER_BATCH
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLC_Batch
+// Description :  Batched version of Hydro_RiemannSolver_HLLC() for pure hydro
+//
+// Note        :  1. Input and output arrays are structure-of-arrays with the layout [variable][interface]
+//                   --> Only the first NCOMP_TOTAL_LR variables are accessed (i.e., no passive scalars for SPLIT_PASSIVE)
+//                2. The loop over interfaces contains no branches so that it can be vectorized
+//                   --> Coordinate rotation is replaced by the index mapping of the momentum components
+//                   --> The upwind side is selected by conditional expressions compiled into masked blends
+//                3. Results agree with Hydro_RiemannSolver_HLLC() up to round-off errors
+//
+// Parameter   :  XYZ      : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NFace    : Number of interfaces (<= RSOLVER_BATCH)
+//                Flux_Out : Array to store the output fluxes
+//                L_In     : Input left  states (conserved variables)
+//                R_In     : Input right states (conserved variables)
+//                Gamma    : Ratio of specific heats
+//                MinPres  : Minimum allowed pressure
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLC_Batch( const int XYZ, const int NFace, real Flux_Out[][RSOLVER_BATCH],
+                                     const real L_In[][RSOLVER_BATCH], const real R_In[][RSOLVER_BATCH],
+                                     const real Gamma, const real MinPres )
+{
+
+   const real ZERO     = (real)0.0;
+   const real ONE      = (real)1.0;
+   const real _TWO     = (real)0.5;
+   const real Gamma_m1 = Gamma - ONE;
+
+// momentum components normal and transverse to the interfaces
+   const int MomN  = 1 + XYZ;
+   const int MomT1 = 1 + (XYZ+1)%3;
+   const int MomT2 = 1 + (XYZ+2)%3;
+
+
+#  pragma omp simd
+   for (int f=0; f<NFace; f++)
+   {
+//    1. load the rotated states
+      const real L0 = L_In[0][f], L1 = L_In[MomN][f], L2 = L_In[MomT1][f], L3 = L_In[MomT2][f], L4 = L_In[4][f];
+      const real R0 = R_In[0][f], R1 = R_In[MomN][f], R2 = R_In[MomT1][f], R3 = R_In[MomT2][f], R4 = R_In[4][f];
+
+
+//    2. evaluate the Roe's average values
+      const real  TempRho = (real)0.5*( L0 + R0 );
+      const real _TempRho = (real)1.0/TempRho;
+      const real _RhoL    = (real)1.0 / L0;
+      const real _RhoR    = (real)1.0 / R0;
+      real P_L, P_R;
+
+      P_L = Gamma_m1*(  L4 - (real)0.5*( L1*L1 + L2*L2 + L3*L3 )*_RhoL  );
+      P_R = Gamma_m1*(  R4 - (real)0.5*( R1*R1 + R2*R2 + R3*R3 )*_RhoR  );
+      P_L = ( P_L > MinPres ) ? P_L : MinPres;
+      P_R = ( P_R > MinPres ) ? P_R : MinPres;
+
+      const real H_L             = ( L4 + P_L )*_RhoL;
+      const real H_R             = ( R4 + P_R )*_RhoR;
+      const real RhoL_sqrt       = SQRT( L0 );
+      const real RhoR_sqrt       = SQRT( R0 );
+      const real _RhoL_sqrt      = (real)1.0 / RhoL_sqrt;
+      const real _RhoR_sqrt      = (real)1.0 / RhoR_sqrt;
+      const real _RhoLR_sqrt_sum = (real)1.0 / (RhoL_sqrt + RhoR_sqrt);
+
+      const real u  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L1 + _RhoR_sqrt*R1 );
+      const real v  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L2 + _RhoR_sqrt*R2 );
+      const real w  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L3 + _RhoR_sqrt*R3 );
+      const real V2 = u*u + v*v + w*w;
+      const real H  = _RhoLR_sqrt_sum*(  RhoL_sqrt*H_L  +  RhoR_sqrt*H_R  );
+
+      real GammaP_Rho, TempPres;
+      GammaP_Rho = Gamma_m1*( H - (real)0.5*V2 );
+      TempPres   = GammaP_Rho*TempRho/Gamma;
+      TempPres   = ( TempPres > MinPres ) ? TempPres : MinPres;
+      GammaP_Rho = Gamma*TempPres*_TempRho;
+
+      const real Cs = SQRT( GammaP_Rho );
+
+
+//    3. estimate the maximum wave speeds
+      const real EVal0  = u - Cs;
+      const real EVal4  = u + Cs;
+      const real u_L    = _RhoL*L1;
+      const real u_R    = _RhoR*R1;
+      const real Cs_L   = SQRT( Gamma*P_L*_RhoL );
+      const real Cs_R   = SQRT( Gamma*P_R*_RhoR );
+      const real W_L    = ( EVal0 < u_L-Cs_L ) ? EVal0 : u_L-Cs_L;
+      const real W_R    = ( EVal4 > u_R+Cs_R ) ? EVal4 : u_R+Cs_R;
+      const real MaxV_L = ( W_L < ZERO ) ? W_L : ZERO;
+      const real MaxV_R = ( W_R > ZERO ) ? W_R : ZERO;
+
+
+//    4. evaluate the star-region velocity (V_S) and pressure (P_S)
+      const real temp1_L = L0*(  (EVal0<u_L-Cs_L) ? (u_L-EVal0) : (+Cs_L)  );
+      const real temp1_R = R0*(  (EVal4>u_R+Cs_R) ? (u_R-EVal4) : (-Cs_R)  );
+      const real temp2_L = P_L + temp1_L*u_L;
+      const real temp2_R = P_R + temp1_R*u_R;
+      const real temp3   = real(1.0) / ( temp1_L - temp1_R );
+      const real V_S     = temp3*( P_L - P_R + temp1_L*u_L - temp1_R*u_R );
+      real P_S;
+
+      P_S = temp3*( temp1_L*temp2_R - temp1_R*temp2_L );
+      P_S = ( P_S > MinPres ) ? P_S : MinPres;
+
+
+//    5. evaluate the weightings of the upwind fluxes and contact wave
+      const bool UseL  = ( V_S >= (real)0.0 );
+      const real S0    = UseL ? L0     : R0;
+      const real S1    = UseL ? L1     : R1;
+      const real S2    = UseL ? L2     : R2;
+      const real S3    = UseL ? L3     : R3;
+      const real S4    = UseL ? L4     : R4;
+      const real _RhoS = UseL ? _RhoL  : _RhoR;
+      const real MaxV  = UseL ? MaxV_L : MaxV_R;
+
+//    upwind fluxes along the maximum wave speed (see Hydro_Con2Flux())
+      real P_F;
+      P_F  = S4 - (real)0.5*_RhoS*( SQR(S1) + SQR(S2) + SQR(S3) );
+      P_F *= Gamma_m1;
+      P_F  = ( P_F > MinPres ) ? P_F : MinPres;
+
+      const real Vx   = _RhoS*S1;
+      const real FS0  = S1               - MaxV*S0;
+      const real FS1  = Vx*S1 + P_F      - MaxV*S1;
+      const real FS2  = Vx*S2            - MaxV*S2;
+      const real FS3  = Vx*S3            - MaxV*S3;
+      const real FS4  = Vx*( S4 + P_F )  - MaxV*S4;
+
+      const real temp4    = (real)1.0 / ( V_S - MaxV );
+      const real Coeff_LR = temp4*V_S;
+      const real Coeff_S  = -temp4*MaxV*P_S;
+
+
+//    6. evaluate the HLLC fluxes
+      real F0, F1, F2, F3, F4;
+
+      F0  = Coeff_LR*FS0;
+      F1  = Coeff_LR*FS1;
+      F2  = Coeff_LR*FS2;
+      F3  = Coeff_LR*FS3;
+      F4  = Coeff_LR*FS4;
+      F1 += Coeff_S;
+      F4 += Coeff_S*V_S;
+
+
+//    7. evaluate the fluxes for passive scalars
+#     if ( NCOMP_PASSIVE_LR > 0 )
+      const real vx = F0*( ( F0 >= ZERO ) ? _RhoL : _RhoR );
+
+      for (int t=NCOMP_FLUID; t<NCOMP_TOTAL_LR; t++)
+         Flux_Out[t][f] = ( ( F0 >= ZERO ) ? L_In[t][f] : R_In[t][f] )*vx;
+#     endif
+
+
+//    8. store the fluxes in the original order
+      Flux_Out[0    ][f] = F0;
+      Flux_Out[MomN ][f] = F1;
+      Flux_Out[MomT1][f] = F2;
+      Flux_Out[MomT2][f] = F3;
+      Flux_Out[4    ][f] = F4;
+   } // for (int f=0; f<NFace; f++)
+
+} // FUNCTION : Hydro_RiemannSolver_HLLC_Batch
+#endif // #ifdef RSOLVER_BATCH
+
+
+
 #endif // #if ( MODEL == HYDRO )
 
 
@@ -342,6 +342,149 @@ void Hydro_RiemannSolver_HLLE( const int XYZ, real Flux_Out[], const real L_In[]
 
 
 
+#ifdef RSOLVER_BATCH
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_HLLE_Batch
+// Description :  Batched version of Hydro_RiemannSolver_HLLE() for pure hydro
+//
+// Note        :  1. Input and output arrays are structure-of-arrays with the layout [variable][interface]
+//                   --> Only the first NCOMP_TOTAL_LR variables are accessed (i.e., no passive scalars for SPLIT_PASSIVE)
+//                2. The loop over interfaces contains no branches so that it can be vectorized
+//                   --> Coordinate rotation is replaced by the index mapping of the momentum components
+//                   --> Minimum/maximum operations are conditional expressions compiled into masked blends
+//                3. Results agree with Hydro_RiemannSolver_HLLE() up to round-off errors
+//
+// Parameter   :  XYZ      : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NFace    : Number of interfaces (<= RSOLVER_BATCH)
+//                Flux_Out : Array to store the output fluxes
+//                L_In     : Input left  states (conserved variables)
+//                R_In     : Input right states (conserved variables)
+//                Gamma    : Ratio of specific heats
+//                MinPres  : Minimum allowed pressure
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_HLLE_Batch( const int XYZ, const int NFace, real Flux_Out[][RSOLVER_BATCH],
+                                     const real L_In[][RSOLVER_BATCH], const real R_In[][RSOLVER_BATCH],
+                                     const real Gamma, const real MinPres )
+{
+
+   const real ZERO     = (real)0.0;
+   const real ONE      = (real)1.0;
+   const real _TWO     = (real)0.5;
+   const real Gamma_m1 = Gamma - ONE;
+
+// momentum components normal and transverse to the interfaces
+   const int MomN  = 1 + XYZ;
+   const int MomT1 = 1 + (XYZ+1)%3;
+   const int MomT2 = 1 + (XYZ+2)%3;
+
+
+#  pragma omp simd
+   for (int f=0; f<NFace; f++)
+   {
+//    1. load the rotated states
+      const real L0 = L_In[0][f], L1 = L_In[MomN][f], L2 = L_In[MomT1][f], L3 = L_In[MomT2][f], L4 = L_In[4][f];
+      const real R0 = R_In[0][f], R1 = R_In[MomN][f], R2 = R_In[MomT1][f], R3 = R_In[MomT2][f], R4 = R_In[4][f];
+
+
+//    2. evaluate the Roe's average values
+      const real _RhoL = ONE / L0;
+      const real _RhoR = ONE / R0;
+      real P_L, P_R;
+
+      P_L = Gamma_m1*(  L4 - _TWO*( SQR(L1) + SQR(L2) + SQR(L3) )*_RhoL  );
+      P_R = Gamma_m1*(  R4 - _TWO*( SQR(R1) + SQR(R2) + SQR(R3) )*_RhoR  );
+      P_L = ( P_L > MinPres ) ? P_L : MinPres;
+      P_R = ( P_R > MinPres ) ? P_R : MinPres;
+
+      const real H_L             = ( L4 + P_L )*_RhoL;
+      const real H_R             = ( R4 + P_R )*_RhoR;
+      const real RhoL_sqrt       = SQRT( L0 );
+      const real RhoR_sqrt       = SQRT( R0 );
+      const real Rho             = RhoL_sqrt*RhoR_sqrt;
+      const real _Rho            = ONE/Rho;
+      const real _RhoL_sqrt      = ONE/RhoL_sqrt;
+      const real _RhoR_sqrt      = ONE/RhoR_sqrt;
+      const real _RhoLR_sqrt_sum = ONE/(RhoL_sqrt + RhoR_sqrt);
+
+      const real u  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L1 + _RhoR_sqrt*R1 );
+      const real v  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L2 + _RhoR_sqrt*R2 );
+      const real w  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L3 + _RhoR_sqrt*R3 );
+      const real V2 = u*u + v*v + w*w;
+      const real H  = _RhoLR_sqrt_sum*(  RhoL_sqrt*H_L  +  RhoR_sqrt*H_R  );
+
+      real GammaP_Rho, TempPres;
+      GammaP_Rho = Gamma_m1*( H - _TWO*V2 );
+      TempPres   = GammaP_Rho*Rho/Gamma;
+      TempPres   = ( TempPres > MinPres ) ? TempPres : MinPres;
+      GammaP_Rho = Gamma*_Rho*TempPres;
+
+      const real Cf = SQRT( GammaP_Rho );
+
+
+//    3. estimate the maximum wave speeds
+      const real EVal_min = u - Cf;
+      const real EVal_max = u + Cf;
+      const real u_L      = _RhoL*L1;
+      const real u_R      = _RhoR*R1;
+      const real Cf_L     = SQRT( Gamma*P_L*_RhoL );
+      const real Cf_R     = SQRT( Gamma*P_R*_RhoR );
+      real MaxV_L, MaxV_R;
+
+      MaxV_L = ( EVal_min < u_L-Cf_L ) ? EVal_min : u_L-Cf_L;
+      MaxV_R = ( EVal_max > u_R+Cf_R ) ? EVal_max : u_R+Cf_R;
+      MaxV_L = ( MaxV_L < ZERO ) ? MaxV_L : ZERO;
+      MaxV_R = ( MaxV_R > ZERO ) ? MaxV_R : ZERO;
+
+
+//    4. evaluate the left and right fluxes along the maximum wave speeds (see Hydro_Con2Flux())
+      real PL_F, PR_F;
+      PL_F  = L4 - (real)0.5*_RhoL*( SQR(L1) + SQR(L2) + SQR(L3) );
+      PR_F  = R4 - (real)0.5*_RhoR*( SQR(R1) + SQR(R2) + SQR(R3) );
+      PL_F *= Gamma_m1;
+      PR_F *= Gamma_m1;
+      PL_F  = ( PL_F > MinPres ) ? PL_F : MinPres;
+      PR_F  = ( PR_F > MinPres ) ? PR_F : MinPres;
+
+      const real VxL = _RhoL*L1;
+      const real VxR = _RhoR*R1;
+      const real FL0 = L1                - MaxV_L*L0,   FR0 = R1                - MaxV_R*R0;
+      const real FL1 = VxL*L1 + PL_F     - MaxV_L*L1,   FR1 = VxR*R1 + PR_F     - MaxV_R*R1;
+      const real FL2 = VxL*L2            - MaxV_L*L2,   FR2 = VxR*R2            - MaxV_R*R2;
+      const real FL3 = VxL*L3            - MaxV_L*L3,   FR3 = VxR*R3            - MaxV_R*R3;
+      const real FL4 = VxL*( L4 + PL_F ) - MaxV_L*L4,   FR4 = VxR*( R4 + PR_F ) - MaxV_R*R4;
+
+
+//    5. evaluate the HLLE fluxes
+      const real _MaxV_R_minus_L = ONE / ( MaxV_R - MaxV_L );
+      const real F0 = _MaxV_R_minus_L*( MaxV_R*FL0 - MaxV_L*FR0 );
+      const real F1 = _MaxV_R_minus_L*( MaxV_R*FL1 - MaxV_L*FR1 );
+      const real F2 = _MaxV_R_minus_L*( MaxV_R*FL2 - MaxV_L*FR2 );
+      const real F3 = _MaxV_R_minus_L*( MaxV_R*FL3 - MaxV_L*FR3 );
+      const real F4 = _MaxV_R_minus_L*( MaxV_R*FL4 - MaxV_L*FR4 );
+
+
+//    6. evaluate the fluxes for passive scalars
+#     if ( NCOMP_PASSIVE_LR > 0 )
+      const real vx = F0*( ( F0 >= ZERO ) ? _RhoL : _RhoR );
+
+      for (int t=NCOMP_FLUID; t<NCOMP_TOTAL_LR; t++)
+         Flux_Out[t][f] = ( ( F0 >= ZERO ) ? L_In[t][f] : R_In[t][f] )*vx;
+#     endif
+
+
+//    7. store the fluxes in the original order
+      Flux_Out[0    ][f] = F0;
+      Flux_Out[MomN ][f] = F1;
+      Flux_Out[MomT1][f] = F2;
+      Flux_Out[MomT2][f] = F3;
+      Flux_Out[4    ][f] = F4;
+   } // for (int f=0; f<NFace; f++)
+
+} // FUNCTION : Hydro_RiemannSolver_HLLE_Batch
+#endif // #ifdef RSOLVER_BATCH
+
+
+
 #endif // #if ( MODEL == HYDRO )
 
 
@@ -692,6 +692,235 @@ void Hydro_RiemannSolver_Roe( const int XYZ, real Flux_Out[], const real L_In[],
 
 
 
+#ifdef RSOLVER_BATCH
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_RiemannSolver_Roe_Batch
+// Description :  Batched version of Hydro_RiemannSolver_Roe() for pure hydro
+//
+// Note        :  1. Input and output arrays are structure-of-arrays with the layout [variable][interface]
+//                   --> Only the first NCOMP_TOTAL_LR variables are accessed (i.e., no passive scalars for SPLIT_PASSIVE)
+//                2. The loop over interfaces contains no branches so that it can be vectorized
+//                   --> Coordinate rotation is replaced by the index mapping of the momentum components
+//                   --> Upwind selections are conditional expressions compiled into masked blends
+//                3. Interfaces failing the intermediate-state check (CHECK_INTERMEDIATE) are recomputed
+//                   by Hydro_RiemannSolver_Roe() one by one afterwards
+//                4. Results agree with Hydro_RiemannSolver_Roe() up to round-off errors
+//
+// Parameter   :  XYZ      : Target spatial direction : (0/1/2) --> (x/y/z)
+//                NFace    : Number of interfaces (<= RSOLVER_BATCH)
+//                Flux_Out : Array to store the output fluxes
+//                L_In     : Input left  states (conserved variables)
+//                R_In     : Input right states (conserved variables)
+//                Gamma    : Ratio of specific heats
+//                MinPres  : Minimum allowed pressure
+//-------------------------------------------------------------------------------------------------------
+void Hydro_RiemannSolver_Roe_Batch( const int XYZ, const int NFace, real Flux_Out[][RSOLVER_BATCH],
+                                    const real L_In[][RSOLVER_BATCH], const real R_In[][RSOLVER_BATCH],
+                                    const real Gamma, const real MinPres )
+{
+
+   const real ZERO     = (real)0.0;
+   const real ONE      = (real)1.0;
+   const real _TWO     = (real)0.5;
+   const real Gamma_m1 = Gamma - ONE;
+
+// momentum components normal and transverse to the interfaces
+   const int MomN  = 1 + XYZ;
+   const int MomT1 = 1 + (XYZ+1)%3;
+   const int MomT2 = 1 + (XYZ+2)%3;
+
+#  ifdef CHECK_INTERMEDIATE
+   int Redo[RSOLVER_BATCH];
+#  endif
+
+
+#  pragma omp simd
+   for (int f=0; f<NFace; f++)
+   {
+//    1. load the rotated states
+      const real L0 = L_In[0][f], L1 = L_In[MomN][f], L2 = L_In[MomT1][f], L3 = L_In[MomT2][f], L4 = L_In[4][f];
+      const real R0 = R_In[0][f], R1 = R_In[MomN][f], R2 = R_In[MomT1][f], R3 = R_In[MomT2][f], R4 = R_In[4][f];
+
+
+//    2. evaluate the average values
+      const real _RhoL           = ONE/L0;
+      const real _RhoR           = ONE/R0;
+      const real HL              = (  L4 + Gamma_m1*( L4 - _TWO*( SQR(L1) + SQR(L2) + SQR(L3) )*_RhoL )  )*_RhoL;
+      const real HR              = (  R4 + Gamma_m1*( R4 - _TWO*( SQR(R1) + SQR(R2) + SQR(R3) )*_RhoR )  )*_RhoR;
+      const real RhoL_sqrt       = SQRT( L0 );
+      const real RhoR_sqrt       = SQRT( R0 );
+      const real Rho             = RhoL_sqrt*RhoR_sqrt;
+      const real _Rho            = ONE/Rho;
+      const real _RhoL_sqrt      = ONE/RhoL_sqrt;
+      const real _RhoR_sqrt      = ONE/RhoR_sqrt;
+      const real _RhoLR_sqrt_sum = ONE/(RhoL_sqrt + RhoR_sqrt);
+
+      const real u  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L1 + _RhoR_sqrt*R1 );
+      const real v  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L2 + _RhoR_sqrt*R2 );
+      const real w  = _RhoLR_sqrt_sum*( _RhoL_sqrt*L3 + _RhoR_sqrt*R3 );
+      const real V2 = u*u + v*v + w*w;
+      const real H  = _RhoLR_sqrt_sum*(  RhoL_sqrt*HL   +  RhoR_sqrt*HR   );
+
+      real GammaP_Rho, TempPres;
+      GammaP_Rho = Gamma_m1*( H - _TWO*V2 );
+      TempPres   = GammaP_Rho*Rho/Gamma;
+      TempPres   = ( TempPres > MinPres ) ? TempPres : MinPres;
+      GammaP_Rho = Gamma*_Rho*TempPres;
+
+      const real a2 = GammaP_Rho;
+      const real a  = SQRT( a2 );
+
+
+//    3. evaluate the eigenvalues
+      const real EVal0 = u - a;
+      const real EVal4 = u + a;
+
+
+//    4. evaluate the left and right fluxes (see Hydro_Con2Flux())
+      real PL, PR;
+      PL  = L4 - (real)0.5*_RhoL*( SQR(L1) + SQR(L2) + SQR(L3) );
+      PR  = R4 - (real)0.5*_RhoR*( SQR(R1) + SQR(R2) + SQR(R3) );
+      PL *= Gamma_m1;
+      PR *= Gamma_m1;
+      PL  = ( PL > MinPres ) ? PL : MinPres;
+      PR  = ( PR > MinPres ) ? PR : MinPres;
+
+      const real VxL = _RhoL*L1;
+      const real VxR = _RhoR*R1;
+      const real FL0 = L1,                  FR0 = R1;
+      const real FL1 = VxL*L1 + PL,         FR1 = VxR*R1 + PR;
+      const real FL2 = VxL*L2,              FR2 = VxR*R2;
+      const real FL3 = VxL*L3,              FR3 = VxR*R3;
+      const real FL4 = VxL*( L4 + PL ),     FR4 = VxR*( R4 + PR );
+
+
+//    5. evaluate the amplitudes along different characteristics
+      const real J0 = R0 - L0, J1 = R1 - L1, J2 = R2 - L2, J3 = R3 - L3, J4 = R4 - L4;
+      real A0, A1, A2, A3, A4;
+
+      A2 = J2 - v*J0;
+      A3 = J3 - w*J0;
+      A1 = Gamma_m1/a2*( J0*(H-SQR(u)) + u*J1 - J4 + v*A2 + w*A3 );
+      A0 = _TWO/a*( J0*(u+a) - J1 - a*A1 );
+      A4 = J0 - A0 - A1;
+
+
+//    6. verify that the density and pressure in the intermediate states are positive
+//       --> only the states between waves with different eigenvalues are checked, i.e., after the first and
+//           the fourth waves
+#     ifdef CHECK_INTERMEDIATE
+      real I0, I1, I2, I3, I4, I_Pres;
+      bool Fail;
+
+      I0 = L0 + A0*ONE;
+      I1 = L1 + A0*(u-a);
+      I2 = L2 + A0*v;
+      I3 = L3 + A0*w;
+      I4 = L4 + A0*(H-u*a);
+      I_Pres = Gamma_m1*( I4 - (real)0.5*(ONE/I0)*( SQR(I1) + SQR(I2) + SQR(I3) ) );
+      Fail   = ( EVal0 < u ) & (  ( I0 <= ZERO ) | ( I_Pres <= ZERO )  );
+
+      I0 += A1*ONE;     I1 += A1*u;       I2 += A1*v;       I3 += A1*w;       I4 += A1*(_TWO*V2);
+      I0 += A2*ZERO;    I1 += A2*ZERO;    I2 += A2*ONE;     I3 += A2*ZERO;    I4 += A2*v;
+      I0 += A3*ZERO;    I1 += A3*ZERO;    I2 += A3*ZERO;    I3 += A3*ONE;     I4 += A3*w;
+      I_Pres = Gamma_m1*( I4 - (real)0.5*(ONE/I0)*( SQR(I1) + SQR(I2) + SQR(I3) ) );
+      Fail  |= ( EVal4 > u ) & (  ( I0 <= ZERO ) | ( I_Pres <= ZERO )  );
+
+//    supersonic interfaces skip the check
+      Redo[f] = Fail & ( EVal0 < ZERO ) & ( EVal4 > ZERO );
+#     endif
+
+
+//    7. evaluate the Roe fluxes
+      A0 *= FABS( EVal0 );
+      A1 *= FABS( u     );
+      A2 *= FABS( u     );
+      A3 *= FABS( u     );
+      A4 *= FABS( EVal4 );
+
+      real F0, F1, F2, F3, F4;
+
+      F0 = FL0 + FR0;   F0 -= A0*ONE;       F0 -= A1*ONE;         F0 -= A2*ZERO;   F0 -= A3*ZERO;   F0 -= A4*ONE;
+      F1 = FL1 + FR1;   F1 -= A0*(u-a);     F1 -= A1*u;           F1 -= A2*ZERO;   F1 -= A3*ZERO;   F1 -= A4*(u+a);
+      F2 = FL2 + FR2;   F2 -= A0*v;         F2 -= A1*v;           F2 -= A2*ONE;    F2 -= A3*ZERO;   F2 -= A4*v;
+      F3 = FL3 + FR3;   F3 -= A0*w;         F3 -= A1*w;           F3 -= A2*ZERO;   F3 -= A3*ONE;    F3 -= A4*w;
+      F4 = FL4 + FR4;   F4 -= A0*(H-u*a);   F4 -= A1*(_TWO*V2);   F4 -= A2*v;      F4 -= A3*w;      F4 -= A4*(H+u*a);
+
+      F0 *= _TWO;
+      F1 *= _TWO;
+      F2 *= _TWO;
+      F3 *= _TWO;
+      F4 *= _TWO;
+
+
+//    8. return the upwind fluxes if flow is supersonic
+      const bool SuperL = ( EVal0 >= ZERO );
+      const bool SuperR = ( EVal4 <= ZERO );
+
+      F0 = SuperL ? FL0 : SuperR ? FR0 : F0;
+      F1 = SuperL ? FL1 : SuperR ? FR1 : F1;
+      F2 = SuperL ? FL2 : SuperR ? FR2 : F2;
+      F3 = SuperL ? FL3 : SuperR ? FR3 : F3;
+      F4 = SuperL ? FL4 : SuperR ? FR4 : F4;
+
+
+//    9. evaluate the fluxes for passive scalars
+#     if ( NCOMP_PASSIVE_LR > 0 )
+      const real vx = F0*( ( F0 >= ZERO ) ? _RhoL : _RhoR );
+
+      for (int t=NCOMP_FLUID; t<NCOMP_TOTAL_LR; t++)
+      {
+         const real FluxL_t = L_In[t][f]*VxL;
+         const real FluxR_t = R_In[t][f]*VxR;
+         const real FluxS_t = ( ( F0 >= ZERO ) ? L_In[t][f] : R_In[t][f] )*vx;
+
+         Flux_Out[t][f] = SuperL ? FluxL_t : SuperR ? FluxR_t : FluxS_t;
+      }
+#     endif
+
+
+//    10. store the fluxes in the original order
+      Flux_Out[0    ][f] = F0;
+      Flux_Out[MomN ][f] = F1;
+      Flux_Out[MomT1][f] = F2;
+      Flux_Out[MomT2][f] = F3;
+      Flux_Out[4    ][f] = F4;
+   } // for (int f=0; f<NFace; f++)
+
+
+// 11. recompute the interfaces failing the intermediate-state check
+#  ifdef CHECK_INTERMEDIATE
+   for (int f=0; f<NFace; f++)
+   {
+      if ( !Redo[f] )   continue;
+
+      real L[NCOMP_TOTAL], R[NCOMP_TOTAL], Flux[NCOMP_TOTAL];
+
+      for (int v=0; v<NCOMP_TOTAL_LR; v++)
+      {
+         L[v] = L_In[v][f];
+         R[v] = R_In[v][f];
+      }
+
+#     ifdef SPLIT_PASSIVE
+      for (int v=NCOMP_TOTAL_LR; v<NCOMP_TOTAL; v++)
+      {
+         L[v] = (real)0.0;
+         R[v] = (real)0.0;
+      }
+#     endif
+
+      Hydro_RiemannSolver_Roe( XYZ, Flux, L, R, Gamma, MinPres );
+
+      for (int v=0; v<NCOMP_TOTAL_LR; v++)   Flux_Out[v][f] = Flux[v];
+   }
+#  endif
+
+} // FUNCTION : Hydro_RiemannSolver_Roe_Batch
+#endif // #ifdef RSOLVER_BATCH
+
+
+
 #endif // #if ( MODEL == HYDRO )
 
 
@@ -23,12 +23,22 @@
 
 real Hydro_GetPressure( const real Dens, const real MomX, const real MomY, const real MomZ, const real Engy,
                         const real Gamma_m1, const bool CheckMinPres, const real MinPres, const real EngyB );
+real CPU_dtSolver_HydroCFL_MaxSpeed( const real g_Flu[][ CUBE(PS1) ], const real g_Mag[][ PS1P1*SQR(PS1) ],
+                                     const real Gamma, const real MinPres );
 
 #endif // #ifdef __CUDACC__ ... else ...
 
 
 
 
+// internal functions
+GPU_DEVICE
+static real Hydro_GetCFLSpeed( const real g_Flu[][ CUBE(PS1) ], const real g_Mag[][ PS1P1*SQR(PS1) ], const int t,
+                               const real Gamma, const real Gamma_m1, const real MinPres );
+
+
+
+
 //-----------------------------------------------------------------------------------------
 // Function    :  CPU/CUFLU_dtSolver_HydroCFL
 // Description :  Estimate the evolution time-step (dt) from the CFL condition of the hydro/MHD solver
@@ -59,111 +69,193 @@ __global__
 void CUFLU_dtSolver_HydroCFL( real g_dt_Array[], const real g_Flu_Array[][NCOMP_FLUID][ CUBE(PS1) ],
                               const real g_Mag_Array[][NCOMP_MAG][ PS1P1*SQR(PS1) ],
                               const real dh, const real Safety, const real Gamma, const real MinPres )
-#else
-void CPU_dtSolver_HydroCFL  ( real g_dt_Array[], const real g_Flu_Array[][NCOMP_FLUID][ CUBE(PS1) ],
-                              const real g_Mag_Array[][NCOMP_MAG][ PS1P1*SQR(PS1) ], const int NPG,
-                              const real dh, const real Safety, const real Gamma, const real MinPres )
-#endif
 {
 
-   const bool CheckMinPres_Yes = true;
-   const real Gamma_m1         = Gamma - (real)1.0;
-   const real dhSafety         = Safety*dh;
+   const real Gamma_m1 = Gamma - (real)1.0;
+   const real dhSafety = Safety*dh;
 
 // loop over all patches
-// --> CPU/GPU solver: use different (OpenMP threads) / (CUDA thread blocks)
-//                     to work on different patches
-#  ifdef __CUDACC__
+// --> use different CUDA thread blocks to work on different patches
    const int p = blockIdx.x;
+
+#  ifdef MHD
+   const real (*Mag)[ PS1P1*SQR(PS1) ] = g_Mag_Array[p];
 #  else
+   const real (*Mag)[ PS1P1*SQR(PS1) ] = NULL;
+#  endif
+
+   real MaxCFL=(real)0.0;
+
+   CGPU_LOOP( t, CUBE(PS1) )
+      MaxCFL = FMAX( Hydro_GetCFLSpeed(g_Flu_Array[p],Mag,t,Gamma,Gamma_m1,MinPres), MaxCFL );
+
+// perform parallel reduction to get the maximum CFL speed in each thread block
+// --> store in the thread 0
+#  ifdef DT_FLU_USE_SHUFFLE
+   MaxCFL = BlockReduction_Shuffle ( MaxCFL );
+#  else
+   MaxCFL = BlockReduction_WarpSync( MaxCFL );
+#  endif
+
+   if ( threadIdx.x == 0 )    g_dt_Array[p] = dhSafety/MaxCFL;
+
+} // FUNCTION : CUFLU_dtSolver_HydroCFL
+
+
+
+#else // #ifdef __CUDACC__
+
+
+
+void CPU_dtSolver_HydroCFL( real g_dt_Array[], const real g_Flu_Array[][NCOMP_FLUID][ CUBE(PS1) ],
+                            const real g_Mag_Array[][NCOMP_MAG][ PS1P1*SQR(PS1) ], const int NPG,
+                            const real dh, const real Safety, const real Gamma, const real MinPres )
+{
+
+   const real dhSafety = Safety*dh;
+
+// loop over all patches
+// --> use different OpenMP threads to work on different patches
 #  pragma omp parallel for schedule( runtime )
    for (int p=0; p<8*NPG; p++)
-#  endif
    {
-      real MaxCFL=(real)0.0;
-
-      CGPU_LOOP( t, CUBE(PS1) )
-      {
-         real fluid[NCOMP_FLUID], _Rho, Vx, Vy, Vz, Pres, EngyB, a2, CFLx, CFLy, CFLz;
-#        ifdef MHD
-         int  i, j, k;
-         real B[3], Bx2, By2, Bz2, B2, Ca2_plus_a2, Ca2_min_a2, Ca2_min_a2_sqr, four_a2_over_Rho;
-#        endif
-
-         for (int v=0; v<NCOMP_FLUID; v++)   fluid[v] = g_Flu_Array[p][v][t];
-
-#        ifdef MHD
-         i     = t % PS1;
-         j     = t % SQR(PS1) / PS1;
-         k     = t / SQR(PS1);
-
-         MHD_GetCellCenteredBField( B, g_Mag_Array[p][MAGX], g_Mag_Array[p][MAGY], g_Mag_Array[p][MAGZ], PS1, PS1, PS1, i, j, k );
-
-         Bx2   = SQR( B[MAGX] );
-         By2   = SQR( B[MAGY] );
-         Bz2   = SQR( B[MAGZ] );
-         B2    = Bx2 + By2 + Bz2;
-         EngyB = (real)0.5*B2;
-#        else
-         EngyB = NULL_REAL;
-#        endif
-
-        _Rho   = (real)1.0 / fluid[DENS];
-         Vx    = FABS( fluid[MOMX] )*_Rho;
-         Vy    = FABS( fluid[MOMY] )*_Rho;
-         Vz    = FABS( fluid[MOMZ] )*_Rho;
-         Pres  = Hydro_GetPressure( fluid[DENS], fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY],
-                                    Gamma_m1, CheckMinPres_Yes, MinPres, EngyB );
-         a2    = Gamma*Pres*_Rho; // sound speed squared
-
-//       compute the maximum information propagating speed
-//       --> hydro: bulk velocity + sound wave
-//           MHD  : bulk velocity +  fast wave
-#        ifdef MHD
-         Ca2_plus_a2      = B2*_Rho + a2;
-         Ca2_min_a2       = B2*_Rho - a2;
-         Ca2_min_a2_sqr   = SQR( Ca2_min_a2 );
-         four_a2_over_Rho = (real)4.0*a2*_Rho;
-         CFLx             = (real)0.5*(  Ca2_plus_a2 + SQRT( Ca2_min_a2_sqr + four_a2_over_Rho*(By2+Bz2) )  );
-         CFLy             = (real)0.5*(  Ca2_plus_a2 + SQRT( Ca2_min_a2_sqr + four_a2_over_Rho*(Bx2+Bz2) )  );
-         CFLz             = (real)0.5*(  Ca2_plus_a2 + SQRT( Ca2_min_a2_sqr + four_a2_over_Rho*(Bx2+By2) )  );
-         CFLx             = SQRT( CFLx );
-         CFLy             = SQRT( CFLy );
-         CFLz             = SQRT( CFLz );
-#        else
-         CFLx             = SQRT( a2 );
-         CFLy             = CFLx;
-         CFLz             = CFLx;
-#        endif // #ifdef MHD ... else ...
-
-         CFLx += Vx;
-         CFLy += Vy;
-         CFLz += Vz;
-
-#        if   ( FLU_SCHEME == RTVD  ||  FLU_SCHEME == CTU )
-         MaxCFL = FMAX( CFLx, MaxCFL );
-         MaxCFL = FMAX( CFLy, MaxCFL );
-         MaxCFL = FMAX( CFLz, MaxCFL );
-#        elif ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
-         MaxCFL = FMAX( CFLx+CFLy+CFLz, MaxCFL );
-#        endif
-      } // CGPU_LOOP( t, CUBE(PS1) )
-
-//    perform parallel reduction to get the maximum CFL speed in each thread block
-//    --> store in the thread 0
-#     ifdef __CUDACC__
-#     ifdef DT_FLU_USE_SHUFFLE
-      MaxCFL = BlockReduction_Shuffle ( MaxCFL );
+#     ifdef MHD
+      const real (*Mag)[ PS1P1*SQR(PS1) ] = g_Mag_Array[p];
 #     else
-      MaxCFL = BlockReduction_WarpSync( MaxCFL );
+      const real (*Mag)[ PS1P1*SQR(PS1) ] = NULL;
 #     endif
-      if ( threadIdx.x == 0 )
-#     endif // #ifdef __CUDACC__
-      g_dt_Array[p] = dhSafety/MaxCFL;
 
-   } // for (int p=0; p<8*NPG; p++)
+      g_dt_Array[p] = dhSafety/CPU_dtSolver_HydroCFL_MaxSpeed( g_Flu_Array[p], Mag, Gamma, MinPres );
+   }
+
+} // FUNCTION : CPU_dtSolver_HydroCFL
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  CPU_dtSolver_HydroCFL_MaxSpeed
+// Description :  Return the maximum CFL speed in a single patch
+//
+// Note        :  1. Invoked by CPU_dtSolver_HydroCFL() and dt_CFLCache_Update()
+//                   --> Both share this function to ensure that the cached CFL speed used by OPT__DT_CFL_CACHE is
+//                       bitwise identical to that evaluated by the dt solver
+//                2. The corresponding time-step is Safety*dh/MaxCFL
+//
+// Parameter   :  g_Flu   : Array storing the fluid   data of the target patch
+//                g_Mag   : Array storing the B field data of the target patch (for MHD only)
+//                Gamma   : Ratio of specific heats
+//                MinPres : Minimum allowed pressure
+//
+// Return      :  MaxCFL
+//-----------------------------------------------------------------------------------------
+real CPU_dtSolver_HydroCFL_MaxSpeed( const real g_Flu[][ CUBE(PS1) ], const real g_Mag[][ PS1P1*SQR(PS1) ],
+                                     const real Gamma, const real MinPres )
+{
+
+   const real Gamma_m1 = Gamma - (real)1.0;
+
+   real MaxCFL=(real)0.0;
+
+   for (int t=0; t<CUBE(PS1); t++)
+      MaxCFL = FMAX( Hydro_GetCFLSpeed(g_Flu,g_Mag,t,Gamma,Gamma_m1,MinPres), MaxCFL );
+
+   return MaxCFL;
+
+} // FUNCTION : CPU_dtSolver_HydroCFL_MaxSpeed
+
+
+
+#endif // #ifdef __CUDACC__ ... else ...
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  Hydro_GetCFLSpeed
+// Description :  Return the maximum information propagating speed of a single cell used by the CFL condition
+//
+// Note        :  1. hydro: bulk velocity + sound wave
+//                   MHD  : bulk velocity +  fast wave
+//                2. Return the maximum speed among all three directions for RTVD/CTU and their sum for MHM/MHM_RP
+//
+// Parameter   :  g_Flu    : Array storing the fluid   data of the target patch
+//                g_Mag    : Array storing the B field data of the target patch (for MHD only)
+//                t        : Target cell index
+//                Gamma    : Ratio of specific heats
+//                Gamma_m1 : Gamma - 1
+//                MinPres  : Minimum allowed pressure
+//
+// Return      :  CFL speed
+//-----------------------------------------------------------------------------------------
+GPU_DEVICE
+real Hydro_GetCFLSpeed( const real g_Flu[][ CUBE(PS1) ], const real g_Mag[][ PS1P1*SQR(PS1) ], const int t,
+                        const real Gamma, const real Gamma_m1, const real MinPres )
+{
+
+   const bool CheckMinPres_Yes = true;
+
+   real fluid[NCOMP_FLUID], _Rho, Vx, Vy, Vz, Pres, EngyB, a2, CFLx, CFLy, CFLz;
+#  ifdef MHD
+   int  i, j, k;
+   real B[3], Bx2, By2, Bz2, B2, Ca2_plus_a2, Ca2_min_a2, Ca2_min_a2_sqr, four_a2_over_Rho;
+#  endif
+
+   for (int v=0; v<NCOMP_FLUID; v++)   fluid[v] = g_Flu[v][t];
+
+#  ifdef MHD
+   i     = t % PS1;
+   j     = t % SQR(PS1) / PS1;
+   k     = t / SQR(PS1);
+
+   MHD_GetCellCenteredBField( B, g_Mag[MAGX], g_Mag[MAGY], g_Mag[MAGZ], PS1, PS1, PS1, i, j, k );
+
+   Bx2   = SQR( B[MAGX] );
+   By2   = SQR( B[MAGY] );
+   Bz2   = SQR( B[MAGZ] );
+   B2    = Bx2 + By2 + Bz2;
+   EngyB = (real)0.5*B2;
+#  else
+   EngyB = NULL_REAL;
+#  endif
+
+  _Rho   = (real)1.0 / fluid[DENS];
+   Vx    = FABS( fluid[MOMX] )*_Rho;
+   Vy    = FABS( fluid[MOMY] )*_Rho;
+   Vz    = FABS( fluid[MOMZ] )*_Rho;
+   Pres  = Hydro_GetPressure( fluid[DENS], fluid[MOMX], fluid[MOMY], fluid[MOMZ], fluid[ENGY],
+                              Gamma_m1, CheckMinPres_Yes, MinPres, EngyB );
+   a2    = Gamma*Pres*_Rho; // sound speed squared
+
+// compute the maximum information propagating speed
+// --> hydro: bulk velocity + sound wave
+//     MHD  : bulk velocity +  fast wave
+#  ifdef MHD
+   Ca2_plus_a2      = B2*_Rho + a2;
+   Ca2_min_a2       = B2*_Rho - a2;
+   Ca2_min_a2_sqr   = SQR( Ca2_min_a2 );
+   four_a2_over_Rho = (real)4.0*a2*_Rho;
+   CFLx             = (real)0.5*(  Ca2_plus_a2 + SQRT( Ca2_min_a2_sqr + four_a2_over_Rho*(By2+Bz2) )  );
+   CFLy             = (real)0.5*(  Ca2_plus_a2 + SQRT( Ca2_min_a2_sqr + four_a2_over_Rho*(Bx2+Bz2) )  );
+   CFLz             = (real)0.5*(  Ca2_plus_a2 + SQRT( Ca2_min_a2_sqr + four_a2_over_Rho*(Bx2+By2) )  );
+   CFLx             = SQRT( CFLx );
+   CFLy             = SQRT( CFLy );
+   CFLz             = SQRT( CFLz );
+#  else
+   CFLx             = SQRT( a2 );
+   CFLy             = CFLx;
+   CFLz             = CFLx;
+#  endif // #ifdef MHD ... else ...
+
+   CFLx += Vx;
+   CFLy += Vy;
+   CFLz += Vz;
+
+#  if   ( FLU_SCHEME == RTVD  ||  FLU_SCHEME == CTU )
+   return FMAX(  FMAX( CFLx, CFLy ), CFLz  );
+#  elif ( FLU_SCHEME == MHM  ||  FLU_SCHEME == MHM_RP )
+   return CFLx + CFLy + CFLz;
+#  endif
 
-} // FUNCTION : CPU/CUFLU_dtSolver_HydroCFL
+} // FUNCTION : Hydro_GetCFLSpeed
 
 
 
@@ -68,13 +68,13 @@ void MHD_CopyPatchInterfaceBField( const int lv, const int PID, const int SibID,
       Aux_Error( ERROR_INFO, "amr->patch[%d][%d][%d]->magnetic[%d] == NULL !!\n", MagSg, lv, SibPID, Bdir );
 #  endif
 
-   const real    *MagPtr0 = amr->patch[MagSg][lv][   PID]->magnetic[Bdir] + Bidx_offset[           SibID  ];
-         real *SibMagPtr0 = amr->patch[MagSg][lv][SibPID]->magnetic[Bdir] + Bidx_offset[ MirrorSib[SibID] ];
+   const real_fld    *MagPtr0 = amr->patch[MagSg][lv][   PID]->magnetic[Bdir] + Bidx_offset[           SibID  ];
+         real_fld *SibMagPtr0 = amr->patch[MagSg][lv][SibPID]->magnetic[Bdir] + Bidx_offset[ MirrorSib[SibID] ];
 
    for (int m=0; m<PS1; m++)
    {
-      const real    *MagPtr =    MagPtr0 + m*Bdidx_m;
-            real *SibMagPtr = SibMagPtr0 + m*Bdidx_m;
+      const real_fld    *MagPtr =    MagPtr0 + m*Bdidx_m;
+            real_fld *SibMagPtr = SibMagPtr0 + m*Bdidx_m;
 
       for (int n=0; n<PS1; n++)  SibMagPtr[ n*Bdidx_n ] = MagPtr[ n*Bdidx_n ];
    }
@@ -4,6 +4,41 @@
 
 
 
+#ifdef MIXED_PRECISION
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetCellFaceB
+// Description :  Convert the six face-centered B field values of a given cell to "real" and store them as
+//                the face-centered arrays of a single cell (i.e., Nx=Ny=Nz=1 and i=j=k=0)
+//
+// Note        :  1. Only used by MIXED_PRECISION, for which the patch magnetic[] array is stored in real_fld
+//                   while MHD_GetCellCenteredBField/Energy() expect "real" input
+//
+// Parameter   :  Bx/y/z : Face-centered B field of the target cell to be returned (2 values each)
+//                Others : see MHD_GetCellCenteredBFieldInPatch()
+//
+// Return      :  Bx, By, Bz
+//-------------------------------------------------------------------------------------------------------
+static void GetCellFaceB( real Bx[], real By[], real Bz[], const int lv, const int PID, const int i, const int j,
+                          const int k, const int MagSg )
+{
+
+   const real_fld (*B)[ PS1P1*SQR(PS1) ] = amr->patch[MagSg][lv][PID]->magnetic;
+
+   const int idx_Bx = IDX321_BX( i, j, k, PS1, PS1 );
+   const int idx_By = IDX321_BY( i, j, k, PS1, PS1 );
+   const int idx_Bz = IDX321_BZ( i, j, k, PS1, PS1 );
+
+   Bx[0] = B[MAGX][ idx_Bx            ];
+   Bx[1] = B[MAGX][ idx_Bx + 1        ];
+   By[0] = B[MAGY][ idx_By            ];
+   By[1] = B[MAGY][ idx_By + PS1      ];
+   Bz[0] = B[MAGZ][ idx_Bz            ];
+   Bz[1] = B[MAGZ][ idx_Bz + SQR(PS1) ];
+
+} // FUNCTION : GetCellFaceB
+#endif // #ifdef MIXED_PRECISION
+
+
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  MHD_GetCellCenteredBFieldInPatch
@@ -44,11 +79,20 @@ void MHD_GetCellCenteredBFieldInPatch( real B_CC[], const int lv, const int PID,
 
 
 // FC = face-centered
+#  ifdef MIXED_PRECISION
+   real Bx_FC[2], By_FC[2], Bz_FC[2];
+
+   GetCellFaceB( Bx_FC, By_FC, Bz_FC, lv, PID, i, j, k, MagSg );
+
+   MHD_GetCellCenteredBField( B_CC, Bx_FC, By_FC, Bz_FC, 1, 1, 1, 0, 0, 0 );
+
+#  else
    const real *Bx_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGX];
    const real *By_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGY];
    const real *Bz_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGZ];
 
    MHD_GetCellCenteredBField( B_CC, Bx_FC, By_FC, Bz_FC, PS1, PS1, PS1, i, j, k );
+#  endif
 
 } // FUNCTION : MHD_GetCellCenteredBFieldInPatch
 
@@ -91,11 +135,20 @@ real MHD_GetCellCenteredBEnergyInPatch( const int lv, const int PID, const int i
 
 
 // FC = face-centered
+#  ifdef MIXED_PRECISION
+   real Bx_FC[2], By_FC[2], Bz_FC[2];
+
+   GetCellFaceB( Bx_FC, By_FC, Bz_FC, lv, PID, i, j, k, MagSg );
+
+   return MHD_GetCellCenteredBEnergy( Bx_FC, By_FC, Bz_FC, 1, 1, 1, 0, 0, 0 );
+
+#  else
    const real *Bx_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGX];
    const real *By_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGY];
    const real *Bz_FC = amr->patch[MagSg][lv][PID]->magnetic[MAGZ];
 
    return MHD_GetCellCenteredBEnergy( Bx_FC, By_FC, Bz_FC, PS1, PS1, PS1, i, j, k );
+#  endif
 
 } // FUNCTION : MHD_GetCellCenteredBEnergyInPatch
 
@@ -6,6 +6,7 @@
 //#define DIMENSIONLESS_FORM
 
 
+#if   ( SUPPORT_FFTW == FFTW2 )
 static void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *PS_total );
 
 #ifdef SERIAL
@@ -14,6 +15,12 @@ extern rfftwnd_plan     FFTW_Plan_PS;
 extern rfftwnd_mpi_plan FFTW_Plan_PS;
 #endif
 
+#elif ( SUPPORT_FFTW == FFTW3 )
+static void GetBasePowerSpectrum( FFTPencil_t *Pencil, double *PS_total );
+
+extern FFTPencil_t     *FFTW_Pencil_PS;
+#endif
+
 
 
 
@@ -33,6 +40,7 @@ void Output_BasePowerSpectrum( const char *FileName )
    const int Nx_Padded   = NX0_TOT[0]/2+1;
    const int FFT_Size[3] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
 
+#  if   ( SUPPORT_FFTW == FFTW2 )
 // get the array indices using by FFTW
    int local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose, total_local_size;
 
@@ -61,15 +69,34 @@ void Output_BasePowerSpectrum( const char *FileName )
                  MPI_NRank, List_z_start[MPI_NRank], FFT_Size[2] );
 
 
-// 2. allocate memory
-   const int NRecvSlice = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
+// the slab decomposition is a special case of Patch2Slab() with only one block along y
+   const int  NSplit_y        = 1;
+   const int  List_y_start[2] = { 0, FFT_Size[1] };
+   const int  SSize_x         = 2*Nx_Padded;
+   const int  NRecvSlice      = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
+   const long NRecvCell       = (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice;
 
-   double *PS_total     = NULL;
    real   *RhoK         = new real [ total_local_size ];                         // array storing both density and potential
-   real   *SendBuf      = new real [ amr->NPatchComma[0][1]*CUBE(PS1) ];         // MPI send buffer for density and potential
-   real   *RecvBuf      = new real [ NX0_TOT[0]*NX0_TOT[1]*NRecvSlice ];         // MPI recv buffer for density and potentia
-   long   *SendBuf_SIdx = new long [ amr->NPatchComma[0][1]*PS1 ];               // MPI send buffer for 1D coordinate in slab
-   long   *RecvBuf_SIdx = new long [ NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/SQR(PS1) ];// MPI recv buffer for 1D coordinate in slab
+
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   FFTPencil_t *Pencil = FFTW_Pencil_PS;
+
+   const int  NSplit_y        = Pencil->NSplit[0];
+   const int *List_y_start    = Pencil->Split_y;
+   const int *List_z_start    = Pencil->Split_z;
+   const int  SSize_x         = FFT_Size[0];
+   const long NRecvCell       = (long)FFT_Size[0]*Pencil->ny*Pencil->nz;
+
+   real   *RhoK         = Pencil->Real;                                          // array storing both density and potential
+#  endif // SUPPORT_FFTW
+
+
+// 2. allocate memory
+   double *PS_total     = NULL;
+   real   *SendBuf      = new real [ (long)amr->NPatchComma[0][1]*CUBE(PS1) ];   // MPI send buffer for density and potential
+   real   *RecvBuf      = new real [ NRecvCell ];                                // MPI recv buffer for density and potential
+   long   *SendBuf_SIdx = new long [ (long)amr->NPatchComma[0][1]*PS1 ];         // MPI send buffer for 1D coordinate in slab
+   long   *RecvBuf_SIdx = new long [ NRecvCell/SQR(PS1) ];                       // MPI recv buffer for 1D coordinate in slab
 
    int  *List_PID    [MPI_NRank];   // PID of each patch slice sent to each rank
    int  *List_k      [MPI_NRank];   // local z coordinate of each patch slice sent to each rank
@@ -101,12 +128,16 @@ void Output_BasePowerSpectrum( const char *FileName )
 
 
 // 4. rearrange data from patch to slab
-   Patch2Slab( RhoK, SendBuf, RecvBuf, SendBuf_SIdx, RecvBuf_SIdx, List_PID, List_k, List_NSend, List_NRecv, List_z_start,
-               local_nz, FFT_Size, NRecvSlice, Time[0] );
+   Patch2Slab( RhoK, SendBuf, RecvBuf, SendBuf_SIdx, RecvBuf_SIdx, List_PID, List_k, List_NSend, List_NRecv,
+               NSplit_y, List_y_start, List_z_start, SSize_x, NRecvCell, Time[0] );
 
 
 // 5. evaluate the base-level power spectrum by FFT
+#  if   ( SUPPORT_FFTW == FFTW2 )
    GetBasePowerSpectrum( RhoK, local_y_start_after_transpose, local_ny_after_transpose, PS_total );
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   GetBasePowerSpectrum( Pencil, PS_total );
+#  endif
 
 
 // 6. output the power spectrum
@@ -130,13 +161,22 @@ void Output_BasePowerSpectrum( const char *FileName )
 
 
 // 7. free memory
+#  if ( SUPPORT_FFTW == FFTW2 )
    delete [] RhoK;
+#  endif
    delete [] SendBuf;
    delete [] RecvBuf;
    delete [] SendBuf_SIdx;
    delete [] RecvBuf_SIdx;
    if ( MPI_Rank == 0 )    delete [] PS_total;
 
+// lists allocated by Patch2Slab() are freed by Slab2Patch() in the Poisson solver but not used here
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      free( List_PID[r] );
+      free( List_k  [r] );
+   }
+
 // free memory for collecting particles from other ranks and levels, and free density arrays with ghost zones (rho_ext)
 #  ifdef PARTICLE
    Par_CollectParticle2OneLevel_FreeMemory( 0, SibBufPatch, FaSibBufPatch );
@@ -160,11 +200,16 @@ void Output_BasePowerSpectrum( const char *FileName )
 // Parameter   :  RhoK        : Array storing the input density and output potential
 //                j_start     : Starting j index
 //                dj          : Size of array in the j (y) direction after the forward FFT
+//                Pencil      : FFTPencil_t object storing the input density (for SUPPORT_FFTW == FFTW3)
 //                PS_total    : Power spectrum summed over all MPI ranks
 //
 // Return      :  PS_total
 //-------------------------------------------------------------------------------------------------------
+#if   ( SUPPORT_FFTW == FFTW2 )
 void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *PS_total )
+#elif ( SUPPORT_FFTW == FFTW3 )
+void GetBasePowerSpectrum( FFTPencil_t *Pencil, double *PS_total )
+#endif
 {
 
 // check
@@ -176,23 +221,34 @@ void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *
    const int Nz        = NX0_TOT[2];
    const int Nx_Padded = Nx/2 + 1;
 
+#  if   ( SUPPORT_FFTW == FFTW2 )
    fftw_complex *cdata=NULL;
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   REAL_FFTW(complex) *cdata=NULL;
+#  endif
    double PS_local[Nx_Padded];
    long   Count_local[Nx_Padded], Count_total[Nx_Padded];
    int    bin, bin_i[Nx_Padded], bin_j[Ny], bin_k[Nz];
 
 
 // forward FFT
+#  if   ( SUPPORT_FFTW == FFTW2 )
 #  ifdef SERIAL
    rfftwnd_one_real_to_complex( FFTW_Plan_PS, RhoK, NULL );
 #  else
    rfftwnd_mpi( FFTW_Plan_PS, 1, RhoK, NULL, FFTW_TRANSPOSED_ORDER );
 #  endif
 
-
 // the data are now complex, so typecast a pointer
    cdata = (fftw_complex*) RhoK;
 
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   FFT_Pencil_Forward( Pencil );
+
+// the data are now stored in the z-pencil layout
+   cdata = Pencil->Cplx;
+#  endif
+
 
 // set up the dimensionless wave number coefficients according to the FFTW data format
    for (int i=0; i<Nx_Padded; i++)     bin_i[i] = i;
@@ -209,7 +265,24 @@ void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *
       Count_local[b] = 0;
    }
 
-#  ifdef SERIAL // serial mode
+#  if ( SUPPORT_FFTW == FFTW3 ) // pencil decomposition
+   const int i_start = Pencil->Split_kx[ Pencil->RankY ];
+   const int j_start = Pencil->Split_ky[ Pencil->RankZ ];
+   const int di      = Pencil->nkx;
+   const int dj      = Pencil->nky;
+   int i, j;
+
+   for (int jj=0; jj<dj; jj++)
+   {
+      j = j_start + jj;
+
+      for (int ii=0; ii<di; ii++)
+      for (int k=0; k<Nz; k++)
+      {
+         i   = i_start + ii;
+         Idx = ((long)jj*di + ii)*Nz + k;
+
+#  elif ( defined SERIAL ) // serial mode
 
    for (int k=0; k<Nz; k++)
    {
@@ -230,7 +303,7 @@ void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *
       {
          Idx = ((long)jj*Nz + k)*Nx_Padded + i;
 
-#  endif // #ifdef SERIAL ... else ...
+#  endif // #if ( SUPPORT_FFTW == FFTW3 ) ... elif SERIAL ... else ...
 
 //       round to nearest bin
 //       bin =     int(   SQRT(   real( SQR(bin_i[i]) + SQR(bin_j[j]) + SQR(bin_k[k]) )  )   );
@@ -242,7 +315,11 @@ void GetBasePowerSpectrum( real *RhoK, const int j_start, const int dj, double *
 
          if ( bin < Nx_Padded )
          {
+#           if   ( SUPPORT_FFTW == FFTW2 )
             PS_local   [bin] += double(  SQR( cdata[Idx].re ) + SQR( cdata[Idx].im )  );
+#           elif ( SUPPORT_FFTW == FFTW3 )
+            PS_local   [bin] += double(  SQR( cdata[Idx][0] ) + SQR( cdata[Idx][1] )  );
+#           endif
             Count_local[bin] ++;
          }
       } // i,j,k
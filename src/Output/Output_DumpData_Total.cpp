@@ -375,7 +375,7 @@ void Output_DumpData_Total( const char *FileName )
 #     endif
 
       const int nlevel               = NLEVEL;
-      const int max_patch            = MAX_PATCH;
+      const int max_patch            = NULL_INT;    // no maximum number of patches --> kept for backward compatibility
 
       fwrite( &model,                     sizeof(int),                     1,             File );
       fwrite( &gravity,                   sizeof(bool),                    1,             File );
@@ -775,6 +775,11 @@ void Output_DumpData_Total( const char *FileName )
    real (*CCMag)[ CUBE(PS1) ] = ( OPT__OUTPUT_CC_MAG ) ? new real [NCOMP_MAG][ CUBE(PS1) ] : NULL;
 #  endif
 
+// the field data are always stored as "real" in the output file
+#  ifdef MIXED_PRECISION
+   real *FieldBuf = new real [ MAX( CUBE(PS1)*NCOMP_TOTAL, PS1P1*SQR(PS1)*NCOMP_MAG ) ];
+#  endif
+
 
    for (int lv=0; lv<NLEVEL; lv++)
    {
@@ -865,12 +870,24 @@ void Output_DumpData_Total( const char *FileName )
                if ( amr->patch[0][lv][PID]->son == -1 )
                {
 //                f4-1. output fluid variables
+#                 ifdef MIXED_PRECISION
+                  Mis_CopyArray( FieldBuf, amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0], CUBE(PS1)*NCOMP_TOTAL );
+                  fwrite( FieldBuf,                                        sizeof(real), CUBE(PS1)*NCOMP_TOTAL,    File );
+#                 else
                   fwrite( amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid,    sizeof(real), CUBE(PS1)*NCOMP_TOTAL,    File );
+#                 endif
 
 //                f4-2. output gravitational potential
 #                 ifdef GRAVITY
                   if ( OPT__OUTPUT_POT )
-                  fwrite( amr->patch[ amr->PotSg[lv] ][lv][PID]->pot,      sizeof(real), CUBE(PS1),                File );
+                  {
+#                    ifdef MIXED_PRECISION
+                     Mis_CopyArray( FieldBuf, amr->patch[ amr->PotSg[lv] ][lv][PID]->pot[0][0], CUBE(PS1) );
+                     fwrite( FieldBuf,                                   sizeof(real), CUBE(PS1),                File );
+#                    else
+                     fwrite( amr->patch[ amr->PotSg[lv] ][lv][PID]->pot, sizeof(real), CUBE(PS1),                File );
+#                    endif
+                  }
 #                 endif
 
 //                f4-3. output particle density depostied onto grids
@@ -886,7 +903,12 @@ void Output_DumpData_Total( const char *FileName )
                   fwrite( CCMag,                                           sizeof(real), CUBE(PS1)*NCOMP_MAG,      File );
 
 //                face-centered
+#                 ifdef MIXED_PRECISION
+                  Mis_CopyArray( FieldBuf, amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[0], PS1P1*SQR(PS1)*NCOMP_MAG );
+                  fwrite( FieldBuf,                                        sizeof(real), PS1P1*SQR(PS1)*NCOMP_MAG, File );
+#                 else
                   fwrite( amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic, sizeof(real), PS1P1*SQR(PS1)*NCOMP_MAG, File );
+#                 endif
 #                 endif
                } // if ( amr->patch[0][lv][PID]->son == -1 )
             } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
@@ -919,6 +941,10 @@ void Output_DumpData_Total( const char *FileName )
    delete [] CCMag;
 #  endif
 
+#  ifdef MIXED_PRECISION
+   delete [] FieldBuf;
+#  endif
+
 
 // g. output particles
 // =================================================================================================
@@ -712,13 +712,11 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 
 // 5. output the simulation grid data (density, momentum, ... etc)
-   const int FieldSizeOnePatch = sizeof(real)*CUBE(PS1);
    int  NFieldOut;
    char (*FieldName)[MAX_STRING]     = NULL;
    real (*FieldData)[PS1][PS1][PS1]  = NULL;
 
 #  ifdef MHD
-   const int FCMagSizeOnePatch = sizeof(real)*PS1P1*SQR(PS1);
    char FCMagName[NCOMP_MAG][MAX_STRING];
    real (*FCMagData)[PS1P1*SQR(PS1)] = NULL;
 #  endif
@@ -918,7 +916,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
                if ( v == PotDumpIdx )
                {
                   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                     memcpy( FieldData[PID], amr->patch[ amr->PotSg[lv] ][lv][PID]->pot, FieldSizeOnePatch );
+                     Mis_CopyArray( FieldData[PID][0][0], amr->patch[ amr->PotSg[lv] ][lv][PID]->pot[0][0], CUBE(PS1) );
                }
                else
 #              endif
@@ -966,7 +964,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 //             d. fluid variables
                {
                   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                     memcpy( FieldData[PID], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v], FieldSizeOnePatch );
+                     Mis_CopyArray( FieldData[PID][0][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][0][0], CUBE(PS1) );
                }
 
 
@@ -1029,7 +1027,7 @@ void Output_DumpData_Total_HDF5( const char *FileName )
 
 //             5-3-2-3. collect the target B component from all patches at the current target level
                for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
-                  memcpy( FCMagData[PID], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[v], FCMagSizeOnePatch );
+                  Mis_CopyArray( FCMagData[PID], amr->patch[ amr->MagSg[lv] ][lv][PID]->magnetic[v], PS1P1*SQR(PS1) );
 
 
 //             5-3-2-4. write data to disk
@@ -1560,7 +1558,7 @@ void FillIn_Makefile( Makefile_t &Makefile )
    Makefile.RandomNumber           = RANDOM_NUMBER;
 
    Makefile.NLevel                 = NLEVEL;
-   Makefile.MaxPatch               = MAX_PATCH;
+   Makefile.MaxPatch               = NULL_INT;    // no maximum number of patches --> kept for backward compatibility
 
 
 // model-dependent options
@@ -1996,6 +1994,8 @@ void FillIn_InputPara( InputPara_t &InputPara )
    InputPara.MolecularWeight         = MOLECULAR_WEIGHT;
    InputPara.MinMod_Coeff            = MINMOD_COEFF;
    InputPara.Opt__LR_Limiter         = OPT__LR_LIMITER;
+   InputPara.Opt__LR_Scheme          = OPT__LR_SCHEME;
+   InputPara.Opt__RSolver            = OPT__RSOLVER;
    InputPara.Opt__1stFluxCorr        = OPT__1ST_FLUX_CORR;
    InputPara.Opt__1stFluxCorrScheme  = OPT__1ST_FLUX_CORR_SCHEME;
 #  endif
@@ -2715,6 +2715,8 @@ void GetCompound_InputPara( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "MolecularWeight",         HOFFSET(InputPara_t,MolecularWeight        ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "MinMod_Coeff",            HOFFSET(InputPara_t,MinMod_Coeff           ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "Opt__LR_Limiter",         HOFFSET(InputPara_t,Opt__LR_Limiter        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__LR_Scheme",          HOFFSET(InputPara_t,Opt__LR_Scheme         ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__RSolver",            HOFFSET(InputPara_t,Opt__RSolver           ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__1stFluxCorr",        HOFFSET(InputPara_t,Opt__1stFluxCorr       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__1stFluxCorrScheme",  HOFFSET(InputPara_t,Opt__1stFluxCorrScheme ), H5T_NATIVE_INT     );
 #  endif
@@ -19,8 +19,8 @@ void Output_Flux( const int lv, const int PID, const int Sib, const char *commen
    if ( lv < 0  ||  lv >= NLEVEL )
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
 
-   if ( PID < 0  ||  PID >= MAX_PATCH )
-      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d (MAX_PATCH = %d) !!\n", "PID", PID, MAX_PATCH );
+   if ( PID < 0  ||  PID >= amr->PatchCap[lv] )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d (amr->PatchCap[%d] = %d) !!\n", "PID", PID, lv, amr->PatchCap[lv] );
 
    if ( !amr->WithFlux )
       Aux_Message( stderr, "WARNING : invoking %s is useless since no flux is required !!\n", __FUNCTION__ );
@@ -27,8 +27,8 @@ void Output_Patch( const int lv, const int PID, const int FluSg, const int MagSg
    if ( lv < 0  ||  lv >= NLEVEL )
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "lv", lv );
 
-   if ( PID < 0  ||  PID >= MAX_PATCH )
-      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d (MAX_PATCH = %d) !!\n", "PID", PID, MAX_PATCH );
+   if ( PID < 0  ||  PID >= amr->PatchCap[lv] )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d (amr->PatchCap[%d] = %d) !!\n", "PID", PID, lv, amr->PatchCap[lv] );
 
    if ( FluSg < 0  ||  FluSg >= 2 )
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "FluSg", FluSg );
@@ -51,12 +51,12 @@ void Output_Patch( const int lv, const int PID, const int FluSg, const int MagSg
 
 
    patch_t *Relation                  = amr->patch[    0][lv][PID];
-   real    (*fluid)[PS1][PS1][PS1]    = amr->patch[FluSg][lv][PID]->fluid;
+   real_fld(*fluid)[PS1][PS1][PS1]    = amr->patch[FluSg][lv][PID]->fluid;
 #  ifdef MHD
-   real    (*magnetic)[PS1P1*PS1*PS1] = amr->patch[MagSg][lv][PID]->magnetic;
+   real_fld(*magnetic)[PS1P1*PS1*PS1] = amr->patch[MagSg][lv][PID]->magnetic;
 #  endif
 #  ifdef GRAVITY
-   real    (*pot)[PS1][PS1]           = amr->patch[PotSg][lv][PID]->pot;
+   real_fld(*pot)[PS1][PS1]           = amr->patch[PotSg][lv][PID]->pot;
 #  endif
 
    char FileName[100];
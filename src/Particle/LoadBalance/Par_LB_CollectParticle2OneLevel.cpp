@@ -235,8 +235,8 @@ void Par_LB_CollectParticle2OneLevel( const int FaLv, const bool PredictPos, con
       NSendParTotal   += NParForEachRank  [r];
    }
 
-   SendBuf_NParEachPatch  = new int  [NSendPatchTotal];
-   SendBuf_LBIdxEachPatch = new long [NSendPatchTotal];
+   SendBuf_NParEachPatch  = (int *)LB_MPIBuffer_Get( MPIBUF_SEND_NPAR,  (long)NSendPatchTotal*sizeof(int ) );
+   SendBuf_LBIdxEachPatch = (long*)LB_MPIBuffer_Get( MPIBUF_SEND_LBIDX, (long)NSendPatchTotal*sizeof(long) );
 
 // reuse the MPI send buffer declared in LB_GetBufferData for better MPI performance
    if ( !JustCountNPar )   SendBuf_ParDataEachPatch = LB_GetBufferData_MemAllocate_Send( NSendParTotal*NParAtt );
@@ -354,8 +354,8 @@ void Par_LB_CollectParticle2OneLevel( const int FaLv, const bool PredictPos, con
 
 
 // 2. send data to all ranks
-// these arrays will be allocated by Par_LB_SendParticleData (using call by reference) and must be free'd later
-// --> except for RecvBuf_ParDataEachPatch, which is just a pointer to the MPI recv buffer declared in LB_GetBufferData
+// these arrays will be set by Par_LB_SendParticleData (using call by reference) to the persistent MPI buffers
+// managed by LB_MPIBuffer_Get() --> don't have to be free'd here
    int  *RecvBuf_NPatchEachRank   = NULL;
    int  *RecvBuf_NParEachPatch    = NULL;
    long *RecvBuf_LBIdxEachPatch   = NULL;
@@ -379,8 +379,6 @@ void Par_LB_CollectParticle2OneLevel( const int FaLv, const bool PredictPos, con
 
 // 2-2. free memory
    delete [] SendBuf_NPatchEachRank;
-   delete [] SendBuf_NParEachPatch;
-   delete [] SendBuf_LBIdxEachPatch;
 
 
 
@@ -519,9 +517,6 @@ void Par_LB_CollectParticle2OneLevel( const int FaLv, const bool PredictPos, con
 
 
 // 3-5. free memory
-   delete [] RecvBuf_NPatchEachRank;
-   delete [] RecvBuf_NParEachPatch;
-   delete [] RecvBuf_LBIdxEachPatch;
    delete [] RecvBuf_LBIdxEachPatch_IdxTable;
    delete [] Match_LBIdxEachPatch;
    delete [] FaPIDList;
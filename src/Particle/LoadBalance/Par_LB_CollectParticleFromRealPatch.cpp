@@ -145,7 +145,7 @@ void Par_LB_CollectParticleFromRealPatch( const int lv,
 // 1. get the number of particles to be sent
    const int NParAtt = 4;  // mass + position*3
 
-   int  *SendBuf_NParEachPatch = new int  [Real_NPatchTotal];
+   int  *SendBuf_NParEachPatch = (int*)LB_MPIBuffer_Get( MPIBUF_SEND_NPAR, (long)Real_NPatchTotal*sizeof(int) );
    long *SendBuf_Offset        = new long [Real_NPatchTotal];
 
    int PID, NParThisPatch, NSendParTotal = 0;
@@ -259,9 +259,8 @@ void Par_LB_CollectParticleFromRealPatch( const int lv,
 
    int  *SendBuf_NPatchEachRank   = Real_NPatchEachRank;
    int  *RecvBuf_NPatchEachRank   = Buff_NPatchEachRank;
-   int  *RecvBuf_NParEachPatch    = NULL;   // will be allocated by Par_LB_SendParticleData and must be free'd later
-   real *RecvBuf_ParDataEachPatch = NULL;   // a pointer to the MPI recv buffer declared in LB_GetBufferData
-                                            // --> don't have to be free'd here
+   int  *RecvBuf_NParEachPatch    = NULL;   // pointers to the persistent MPI buffers set by Par_LB_SendParticleData
+   real *RecvBuf_ParDataEachPatch = NULL;   // --> don't have to be free'd here
 
    long *SendBuf_LBIdxEachRank    = NULL;   // useless and does not need to be allocated
    long *RecvBuf_LBIdxEachRank    = NULL;   // useless and will not be allocated by Par_LB_SendParticleData
@@ -283,7 +282,6 @@ void Par_LB_CollectParticleFromRealPatch( const int lv,
 #  endif
 
 // free the send buffer in advance to save memory
-   delete [] SendBuf_NParEachPatch;
    delete [] SendBuf_Offset;
 
 
@@ -351,7 +349,6 @@ void Par_LB_CollectParticleFromRealPatch( const int lv,
 
 
 // 5. free memory
-   delete [] RecvBuf_NParEachPatch;
    delete [] RecvBuf_Offset;
 
 } // FUNCTION : Par_LB_CollectParticleFromRealPatch
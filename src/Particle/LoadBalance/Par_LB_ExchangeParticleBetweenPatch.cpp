@@ -114,7 +114,7 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
 
 
 // 1. get the number of particles to be sent
-   int *SendBuf_NParEachPatch = new int [Send_NPatchTotal];
+   int *SendBuf_NParEachPatch = (int*)LB_MPIBuffer_Get( MPIBUF_SEND_NPAR, (long)Send_NPatchTotal*sizeof(int) );
 
    int PID, NParThisPatch, NSendParTotal = 0;
 
@@ -184,9 +184,8 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
 
    int  *SendBuf_NPatchEachRank   = Send_NPatchEachRank;
    int  *RecvBuf_NPatchEachRank   = Recv_NPatchEachRank;
-   int  *RecvBuf_NParEachPatch    = NULL;    // will be allocated by Par_LB_SendParticleData and must be free'd later
-   real *RecvBuf_ParDataEachPatch = NULL;    // a pointer to the MPI recv buffer declared in LB_GetBufferData
-                                             // --> don't have to be free'd here
+   int  *RecvBuf_NParEachPatch    = NULL;    // pointers to the persistent MPI buffers set by Par_LB_SendParticleData
+   real *RecvBuf_ParDataEachPatch = NULL;    // --> don't have to be free'd here
 
    long *SendBuf_LBIdxEachRank    = NULL;    // useless and does not need to be allocated
    long *RecvBuf_LBIdxEachRank    = NULL;    // useless and will not be allocated by Par_LB_SendParticleData
@@ -207,9 +206,6 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
                  NRecvPatchTotal, Recv_NPatchTotal );
 #  endif
 
-// free the send buffer in advance to save memory
-   delete [] SendBuf_NParEachPatch;
-
 
 // 4. store the received particle data to the particle repository and link to each recv patch
    const real *RecvPtr = RecvBuf_ParDataEachPatch;
@@ -264,7 +260,6 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
 
 
 // 5. free memory
-   delete [] RecvBuf_NParEachPatch;
    delete [] NewParIDList;
 
 } // FUNCTION : Par_LB_ExchangeParticleBetweenPatch
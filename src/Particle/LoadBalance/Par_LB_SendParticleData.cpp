@@ -10,10 +10,10 @@
 // Description :  Exchange particles between different MPI ranks
 //
 // Note        :  1. SendBuf_XXX must be preallocated and will NOT be deallocated in this function
-//                2. RecvBuf_XXX will be allocated in this function (using call by reference) and must be
-//                   deallocated manually after calling this function
-//                   --> Except for RecvBuf_ParDataEachPatch, which is just a pointer to the MPI recv buffer
-//                       declared in LB_GetBufferData
+//                2. RecvBuf_XXX will be set in this function (using call by reference) to the persistent MPI
+//                   buffers managed by LB_MPIBuffer_Get()
+//                   --> They must NOT be deallocated manually and are only valid until the next call
+//                   --> RecvBuf_ParDataEachPatch is the MPI recv buffer shared with LB_GetBufferData
 //                3. SendBuf_ParDataEachPatch format: [ParID][ParAttribute] instead of [ParAttribute][ParID]
 //                4. Called by Par_LB_CollectParticleFromRealPatch(), Par_LB_CollectParticle2OneLevel(), and
 //                   Par_LB_ExchangeParticleBetweenPatch()
@@ -97,7 +97,7 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
 // 1. get the number of patches received from each rank
    if ( Exchange_NPatchEachRank )
    {
-      RecvBuf_NPatchEachRank = new int [MPI_NRank];
+      RecvBuf_NPatchEachRank = (int*)LB_MPIBuffer_Get( MPIBUF_RECV_NPATCH, (long)MPI_NRank*sizeof(int) );
 
       MPI_Alltoall( SendBuf_NPatchEachRank, 1, MPI_INT, RecvBuf_NPatchEachRank, 1, MPI_INT, MPI_COMM_WORLD );
    }
@@ -107,12 +107,17 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
 
 
 // 2. get the number of particles received from each rank
-   int *SendCount_NParEachPatch = new int [MPI_NRank];
-   int *RecvCount_NParEachPatch = new int [MPI_NRank];
-   int *SendDisp_NParEachPatch  = new int [MPI_NRank];
-   int *RecvDisp_NParEachPatch  = new int [MPI_NRank];
-
-   RecvBuf_NParEachPatch = new int [NRecvPatchTotal];
+// --> all MPI count and displacement arrays are stored in the same persistent MPI buffer
+   int *SendCount_NParEachPatch    = (int*)LB_MPIBuffer_Get( MPIBUF_TABLE, 8L*MPI_NRank*sizeof(int) );
+   int *RecvCount_NParEachPatch    = SendCount_NParEachPatch    + MPI_NRank;
+   int *SendDisp_NParEachPatch     = RecvCount_NParEachPatch    + MPI_NRank;
+   int *RecvDisp_NParEachPatch     = SendDisp_NParEachPatch     + MPI_NRank;
+   int *SendCount_ParDataEachPatch = RecvDisp_NParEachPatch     + MPI_NRank;
+   int *RecvCount_ParDataEachPatch = SendCount_ParDataEachPatch + MPI_NRank;
+   int *SendDisp_ParDataEachPatch  = RecvCount_ParDataEachPatch + MPI_NRank;
+   int *RecvDisp_ParDataEachPatch  = SendDisp_ParDataEachPatch  + MPI_NRank;
+
+   RecvBuf_NParEachPatch = (int*)LB_MPIBuffer_Get( MPIBUF_RECV_NPAR, (long)NRecvPatchTotal*sizeof(int) );
 
 // send/recv count
    for (int r=0; r<MPI_NRank; r++)
@@ -138,7 +143,7 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
 // 3. collect LBIdx from all ranks
    if ( Exchange_LBIdxEachRank )
    {
-      RecvBuf_LBIdxEachPatch = new long [NRecvPatchTotal];
+      RecvBuf_LBIdxEachPatch = (long*)LB_MPIBuffer_Get( MPIBUF_RECV_LBIDX, (long)NRecvPatchTotal*sizeof(long) );
 
       MPI_Alltoallv( SendBuf_LBIdxEachPatch, SendCount_NParEachPatch, SendDisp_NParEachPatch, MPI_LONG,
                      RecvBuf_LBIdxEachPatch, RecvCount_NParEachPatch, RecvDisp_NParEachPatch, MPI_LONG, MPI_COMM_WORLD );
@@ -148,11 +153,6 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
 // 4. collect particle attributes from all ranks
    if ( Exchange_ParDataEachRank )
    {
-      int *SendCount_ParDataEachPatch = new int [MPI_NRank];
-      int *RecvCount_ParDataEachPatch = new int [MPI_NRank];
-      int *SendDisp_ParDataEachPatch  = new int [MPI_NRank];
-      int *RecvDisp_ParDataEachPatch  = new int [MPI_NRank];
-
 //    send/recv count
       const int *SendPtr = NULL, *RecvPtr = NULL;
       NRecvParTotal = 0;
@@ -194,22 +194,9 @@ void Par_LB_SendParticleData( const int NParAtt, int *SendBuf_NPatchEachRank, in
       MPI_Alltoallv( SendBuf_ParDataEachPatch, SendCount_ParDataEachPatch, SendDisp_ParDataEachPatch, MPI_FLOAT,
                      RecvBuf_ParDataEachPatch, RecvCount_ParDataEachPatch, RecvDisp_ParDataEachPatch, MPI_FLOAT,  MPI_COMM_WORLD );
 #     endif
-
-//    free memory
-      delete [] SendCount_ParDataEachPatch;
-      delete [] SendDisp_ParDataEachPatch;
-      delete [] RecvCount_ParDataEachPatch;
-      delete [] RecvDisp_ParDataEachPatch;
    } // if ( Exchange_ParDataEachRank )
 
 
-// 5. free memory
-   delete [] SendCount_NParEachPatch;
-   delete [] SendDisp_NParEachPatch;
-   delete [] RecvCount_NParEachPatch;
-   delete [] RecvDisp_NParEachPatch;
-
-
 // stop timing
 #  ifdef TIMING
    if ( Timer != NULL )
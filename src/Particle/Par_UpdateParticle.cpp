@@ -222,6 +222,10 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
 //    nothing to do if there are no target particles in the target patch group
       if ( !GotYou )    continue;
 
+#     ifdef LOAD_BALANCE
+      const double Cost_t0 = ( amr->LB->MeasuredCost ) ? MPI_Wtime() : 0.0;
+#     endif
+
 
 //    2. prepare the potential data for the patch group with particles (need NSIDE_26 for ParGhost>0 )
 //    2.1 potential from self-gravity
@@ -246,7 +250,7 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
                }
 
                else
-                  memcpy( Pot3D[P], amr->patch[PotSg][lv][PID]->pot_ext, CUBE(PotSize)*sizeof(real) );
+                  Mis_CopyArray( Pot3D[P][0][0], amr->patch[PotSg][lv][PID]->pot_ext[0][0], CUBE(PotSize) );
             }
          }
 
@@ -611,9 +615,14 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
             } // amr->Par->Integ
          } // for (int p=0; p<amr->patch[0][lv][PID]->NPar; p++)`
       } // for (int PID=PID0, P=0; PID<PID0+8; PID++, P++)
+
+//    6. record the measured cost of this patch group for load balancing
+#     ifdef LOAD_BALANCE
+      if ( amr->LB->MeasuredCost )  LB_AccumulateCost( lv, 1, &PID0, MPI_Wtime()-Cost_t0 );
+#     endif
    } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
 
-// 6. free memory
+// 7. free memory
    delete [] Pot;
    delete [] Acc;
 
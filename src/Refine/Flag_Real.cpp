@@ -130,6 +130,12 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
       real (*Lohner_Slope)               = NULL;   // array storing the slopes of Lohner_Var for Lohner
       real (*ParCount)[PS1][PS1]         = NULL;   // declare as **real** to be consistent with Par_MassAssignment()
       real (*ParDens )[PS1][PS1]         = NULL;
+#     ifdef MIXED_PRECISION
+      real (*FluBuf)[PS1][PS1][PS1]      = new real [NCOMP_TOTAL][PS1][PS1][PS1];   // patch data converted to "real"
+#     ifdef GRAVITY
+      real (*PotBuf)[PS1][PS1]           = new real [PS1][PS1][PS1];
+#     endif
+#     endif
 
       int  i_start, i_end, j_start, j_end, k_start, k_end, SibID, SibPID, PID;
       bool ProperNesting, NextPatch;
@@ -209,10 +215,19 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
             if ( ProperNesting )
             {
                NextPatch = false;
+#              ifdef MIXED_PRECISION
+               Mis_CopyArray( FluBuf[0][0][0], amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[0][0][0], NCOMP_TOTAL*CUBE(PS1) );
+               Fluid     = FluBuf;
+#              ifdef GRAVITY
+               Mis_CopyArray( PotBuf[0][0], amr->patch[ amr->PotSg[lv] ][lv][PID]->pot[0][0], CUBE(PS1) );
+               Pot       = PotBuf;
+#              endif
+#              else
                Fluid     = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid;
 #              ifdef GRAVITY
                Pot       = amr->patch[ amr->PotSg[lv] ][lv][PID]->pot;
 #              endif
+#              endif // #ifdef MIXED_PRECISION ... else ...
 
 
 #              if ( MODEL == HYDRO )
@@ -489,6 +504,12 @@ void Flag_Real( const int lv, const UseLBFunc_t UseLBFunc )
       delete [] Pres;
       delete [] ParCount;
       delete [] ParDens;
+#     ifdef MIXED_PRECISION
+      delete [] FluBuf;
+#     ifdef GRAVITY
+      delete [] PotBuf;
+#     endif
+#     endif
 
       if ( Lohner_NVar > 0 )
       {
@@ -0,0 +1,539 @@
+#include "GAMER.h"
+
+#if ( defined GRAVITY  &&  SUPPORT_FFTW == FFTW3 )
+
+
+
+static void FFT_Pencil_Split( const int NUnit, const int Unit, const int NSplit, int *Split );
+static void FFT_Pencil_TransposeXY( FFTPencil_t *Pencil, REAL_FFTW(complex) *In, REAL_FFTW(complex) *Out, const bool Forward );
+static void FFT_Pencil_TransposeYZ( FFTPencil_t *Pencil, REAL_FFTW(complex) *In, REAL_FFTW(complex) *Out, const bool Forward );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_Create
+// Description :  Create the data structure, arrays, and FFTW plans of a 3D real-to-complex FFT with the 2D
+//                pencil decomposition
+//
+// Note        :  1. See FFTPencil.h for the data layouts
+//                2. Invoked by Init_FFTW()
+//                3. The rank grid is set by MPI_Dims_create() with more ranks along y than along z
+//                   --> Ranks with an empty range along any direction still take part in the transposes
+//                4. Plans are created with FFTW_MEASURE since they are reused by all root-level Poisson solver calls
+//                   --> FFTW_MEASURE overwrites the arrays, which must therefore be created before the plans
+//                5. REAL_FFTW(init_threads)() must be called in advance when OPENMP is on
+//
+// Parameter   :  N : Size of the FFT
+//
+// Return      :  Pointer to the new FFTPencil_t object
+//-------------------------------------------------------------------------------------------------------
+FFTPencil_t* FFT_Pencil_Create( const int N[] )
+{
+
+// check
+   for (int d=0; d<3; d++)
+      if ( N[d] <= 0 )  Aux_Error( ERROR_INFO, "N[%d] = %d <= 0 !!\n", d, N[d] );
+
+   if ( N[1]%PS1 != 0  ||  N[2]%PS1 != 0 )
+      Aux_Error( ERROR_INFO, "N[1] (%d) and N[2] (%d) must be multiples of PS1 (%d) !!\n", N[1], N[2], PS1 );
+
+
+   FFTPencil_t *Pencil = new FFTPencil_t;
+
+   for (int d=0; d<3; d++)    Pencil->N[d] = N[d];
+
+   Pencil->NX_Cplx = N[0]/2 + 1;
+
+
+// 1. set the rank grid
+#  ifdef SERIAL
+   Pencil->NSplit[0] = 1;
+   Pencil->NSplit[1] = 1;
+#  else
+   int Dims[2] = { 0, 0 };
+
+   MPI_Dims_create( MPI_NRank, 2, Dims );
+
+   Pencil->NSplit[0] = Dims[0];
+   Pencil->NSplit[1] = Dims[1];
+#  endif
+
+   Pencil->RankY = MPI_Rank % Pencil->NSplit[0];
+   Pencil->RankZ = MPI_Rank / Pencil->NSplit[0];
+
+#  ifndef SERIAL
+   MPI_Comm_split( MPI_COMM_WORLD, Pencil->RankZ, Pencil->RankY, &Pencil->Comm_Y );
+   MPI_Comm_split( MPI_COMM_WORLD, Pencil->RankY, Pencil->RankZ, &Pencil->Comm_Z );
+#  endif
+
+
+// 2. split y and z in the x-pencil layout (in units of PS1) and kx and ky in the y- and z-pencil layouts
+   Pencil->Split_y  = new int [ Pencil->NSplit[0] + 1 ];
+   Pencil->Split_z  = new int [ Pencil->NSplit[1] + 1 ];
+   Pencil->Split_kx = new int [ Pencil->NSplit[0] + 1 ];
+   Pencil->Split_ky = new int [ Pencil->NSplit[1] + 1 ];
+
+   FFT_Pencil_Split( N[1]/PS1,         PS1, Pencil->NSplit[0], Pencil->Split_y  );
+   FFT_Pencil_Split( N[2]/PS1,         PS1, Pencil->NSplit[1], Pencil->Split_z  );
+   FFT_Pencil_Split( Pencil->NX_Cplx,  1,   Pencil->NSplit[0], Pencil->Split_kx );
+   FFT_Pencil_Split( N[1],             1,   Pencil->NSplit[1], Pencil->Split_ky );
+
+   Pencil->ny  = Pencil->Split_y [ Pencil->RankY + 1 ] - Pencil->Split_y [ Pencil->RankY ];
+   Pencil->nz  = Pencil->Split_z [ Pencil->RankZ + 1 ] - Pencil->Split_z [ Pencil->RankZ ];
+   Pencil->nkx = Pencil->Split_kx[ Pencil->RankY + 1 ] - Pencil->Split_kx[ Pencil->RankY ];
+   Pencil->nky = Pencil->Split_ky[ Pencil->RankZ + 1 ] - Pencil->Split_ky[ Pencil->RankZ ];
+
+
+// 3. allocate arrays
+   const long NReal  = (long)N[0]*Pencil->ny*Pencil->nz;
+   const long NCplxX = (long)Pencil->NX_Cplx*Pencil->ny *Pencil->nz;
+   const long NCplxY = (long)Pencil->nkx    *N[1]       *Pencil->nz;
+   const long NCplxZ = (long)Pencil->nkx    *Pencil->nky*N[2];
+
+   Pencil->NCplx = MAX( NCplxX, MAX( NCplxY, NCplxZ ) );
+   Pencil->Real  = (real*)REAL_FFTW(malloc)( MAX( NReal, 1L )*sizeof(real) );
+   Pencil->Cplx  = REAL_FFTW(alloc_complex)( MAX( Pencil->NCplx, 1L ) );
+   Pencil->Work  = REAL_FFTW(alloc_complex)( MAX( Pencil->NCplx, 1L ) );
+
+   if ( Pencil->Real == NULL  ||  Pencil->Cplx == NULL  ||  Pencil->Work == NULL )
+      Aux_Error( ERROR_INFO, "failed to allocate the FFT arrays (NReal %ld, NCplx %ld) !!\n", NReal, Pencil->NCplx );
+
+
+// 4. create the FFTW plans of the 1D transforms along x, y, and z
+//    --> plans are set to NULL for the directions with no data on this rank
+#  ifdef OPENMP
+   REAL_FFTW(plan_with_nthreads)( OMP_NTHREAD );
+#  endif
+
+   int Nx = N[0], Ny = N[1], Nz = N[2];
+
+   const int NRow_X = Pencil->ny *Pencil->nz;
+   const int NRow_Y = Pencil->nkx*Pencil->nz;
+   const int NRow_Z = Pencil->nkx*Pencil->nky;
+
+   Pencil->Plan_X_Fw = NULL;
+   Pencil->Plan_X_Bw = NULL;
+   Pencil->Plan_Y_Fw = NULL;
+   Pencil->Plan_Y_Bw = NULL;
+   Pencil->Plan_Z_Fw = NULL;
+   Pencil->Plan_Z_Bw = NULL;
+
+   if ( NRow_X > 0 )
+   {
+      Pencil->Plan_X_Fw = REAL_FFTW(plan_many_dft_r2c)( 1, &Nx, NRow_X, Pencil->Real, NULL, 1, Nx,
+                                                    Pencil->Cplx, NULL, 1, Pencil->NX_Cplx, FFTW_MEASURE );
+      Pencil->Plan_X_Bw = REAL_FFTW(plan_many_dft_c2r)( 1, &Nx, NRow_X, Pencil->Cplx, NULL, 1, Pencil->NX_Cplx,
+                                                    Pencil->Real, NULL, 1, Nx, FFTW_MEASURE );
+   }
+
+   if ( NRow_Y > 0 )
+   {
+      Pencil->Plan_Y_Fw = REAL_FFTW(plan_many_dft)( 1, &Ny, NRow_Y, Pencil->Work, NULL, 1, Ny,
+                                                Pencil->Work, NULL, 1, Ny, FFTW_FORWARD,  FFTW_MEASURE );
+      Pencil->Plan_Y_Bw = REAL_FFTW(plan_many_dft)( 1, &Ny, NRow_Y, Pencil->Work, NULL, 1, Ny,
+                                                Pencil->Work, NULL, 1, Ny, FFTW_BACKWARD, FFTW_MEASURE );
+   }
+
+   if ( NRow_Z > 0 )
+   {
+      Pencil->Plan_Z_Fw = REAL_FFTW(plan_many_dft)( 1, &Nz, NRow_Z, Pencil->Cplx, NULL, 1, Nz,
+                                                Pencil->Cplx, NULL, 1, Nz, FFTW_FORWARD,  FFTW_MEASURE );
+      Pencil->Plan_Z_Bw = REAL_FFTW(plan_many_dft)( 1, &Nz, NRow_Z, Pencil->Cplx, NULL, 1, Nz,
+                                                Pencil->Cplx, NULL, 1, Nz, FFTW_BACKWARD, FFTW_MEASURE );
+   }
+
+   if (  ( NRow_X > 0  &&  ( Pencil->Plan_X_Fw == NULL || Pencil->Plan_X_Bw == NULL ) )  ||
+         ( NRow_Y > 0  &&  ( Pencil->Plan_Y_Fw == NULL || Pencil->Plan_Y_Bw == NULL ) )  ||
+         ( NRow_Z > 0  &&  ( Pencil->Plan_Z_Fw == NULL || Pencil->Plan_Z_Bw == NULL ) )     )
+      Aux_Error( ERROR_INFO, "failed to create the FFTW plans (N = %d x %d x %d) !!\n", N[0], N[1], N[2] );
+
+   return Pencil;
+
+} // FUNCTION : FFT_Pencil_Create
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_Destroy
+// Description :  Delete the FFTPencil_t object created by FFT_Pencil_Create()
+//
+// Parameter   :  Pencil : Target FFTPencil_t object
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_Destroy( FFTPencil_t *Pencil )
+{
+
+   if ( Pencil == NULL )   return;
+
+   REAL_FFTW(plan) *Plan[6] = { &Pencil->Plan_X_Fw, &Pencil->Plan_X_Bw, &Pencil->Plan_Y_Fw,
+                            &Pencil->Plan_Y_Bw, &Pencil->Plan_Z_Fw, &Pencil->Plan_Z_Bw };
+
+   for (int t=0; t<6; t++)
+      if ( *Plan[t] != NULL )    REAL_FFTW(destroy_plan)( *Plan[t] );
+
+   REAL_FFTW(free)( Pencil->Real );
+   REAL_FFTW(free)( Pencil->Cplx );
+   REAL_FFTW(free)( Pencil->Work );
+
+   delete [] Pencil->Split_y;
+   delete [] Pencil->Split_z;
+   delete [] Pencil->Split_kx;
+   delete [] Pencil->Split_ky;
+
+#  ifndef SERIAL
+   MPI_Comm_free( &Pencil->Comm_Y );
+   MPI_Comm_free( &Pencil->Comm_Z );
+#  endif
+
+   delete Pencil;
+
+} // FUNCTION : FFT_Pencil_Destroy
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_Forward
+// Description :  Forward transform Pencil->Real[] in the x-pencil layout to Pencil->Cplx[] in the z-pencil layout
+//
+// Note        :  1. Pencil->Real[] is preserved
+//                2. Must be called by all ranks
+//
+// Parameter   :  Pencil : Target FFTPencil_t object
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_Forward( FFTPencil_t *Pencil )
+{
+
+   if ( Pencil->Plan_X_Fw != NULL )    REAL_FFTW(execute)( Pencil->Plan_X_Fw );
+
+   FFT_Pencil_TransposeXY( Pencil, Pencil->Cplx, Pencil->Work, true );
+
+   if ( Pencil->Plan_Y_Fw != NULL )    REAL_FFTW(execute)( Pencil->Plan_Y_Fw );
+
+   FFT_Pencil_TransposeYZ( Pencil, Pencil->Work, Pencil->Cplx, true );
+
+   if ( Pencil->Plan_Z_Fw != NULL )    REAL_FFTW(execute)( Pencil->Plan_Z_Fw );
+
+} // FUNCTION : FFT_Pencil_Forward
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_Backward
+// Description :  Backward transform Pencil->Cplx[] in the z-pencil layout to Pencil->Real[] in the x-pencil layout
+//
+// Note        :  1. Not normalized --> results are multiplied by N[0]*N[1]*N[2]
+//                2. Pencil->Cplx[] is destroyed
+//                3. Must be called by all ranks
+//
+// Parameter   :  Pencil : Target FFTPencil_t object
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_Backward( FFTPencil_t *Pencil )
+{
+
+   if ( Pencil->Plan_Z_Bw != NULL )    REAL_FFTW(execute)( Pencil->Plan_Z_Bw );
+
+   FFT_Pencil_TransposeYZ( Pencil, Pencil->Cplx, Pencil->Work, false );
+
+   if ( Pencil->Plan_Y_Bw != NULL )    REAL_FFTW(execute)( Pencil->Plan_Y_Bw );
+
+   FFT_Pencil_TransposeXY( Pencil, Pencil->Work, Pencil->Cplx, false );
+
+   if ( Pencil->Plan_X_Bw != NULL )    REAL_FFTW(execute)( Pencil->Plan_X_Bw );
+
+} // FUNCTION : FFT_Pencil_Backward
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_Split
+// Description :  Divide "NUnit" units of size "Unit" among "NSplit" ranks as evenly as possible
+//
+// Parameter   :  NUnit  : Number of units
+//                Unit   : Size of each unit
+//                NSplit : Number of ranks
+//                Split  : Starting index of each rank with Split[NSplit] = NUnit*Unit
+//
+// Return      :  Split[]
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_Split( const int NUnit, const int Unit, const int NSplit, int *Split )
+{
+
+   for (int r=0; r<=NSplit; r++)    Split[r] = Unit*(int)( (long)NUnit*r/NSplit );
+
+} // FUNCTION : FFT_Pencil_Split
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_TransposeXY
+// Description :  Transpose between the x-pencil (complex) and y-pencil layouts among the ranks with the same RankZ
+//
+// Note        :  1. The block exchanged between the x-pencil on rank "A" and the y-pencil on rank "B" has the
+//                   dimension [nz][ny of A][nkx of B] with kx varying fastest
+//                2. "In" is packed to "Out", exchanged back to "In", and unpacked to "Out"
+//                   --> Results are stored in "Out" and "In" is destroyed
+//                3. Packing and unpacking are OpenMP-parallelized
+//
+// Parameter   :  Pencil  : Target FFTPencil_t object
+//                In      : Input array
+//                Out     : Output array
+//                Forward : true/false --> x-pencil to y-pencil/y-pencil to x-pencil
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_TransposeXY( FFTPencil_t *Pencil, REAL_FFTW(complex) *In, REAL_FFTW(complex) *Out, const bool Forward )
+{
+
+   const int  NQ     = Pencil->NSplit[0];
+   const int  Me     = Pencil->RankY;
+   const int  Ny     = Pencil->N[1];
+   const int  NXc    = Pencil->NX_Cplx;
+   const int  nz     = Pencil->nz;
+   const int *Sy     = Pencil->Split_y;
+   const int *Skx    = Pencil->Split_kx;
+
+   int NSend[NQ], NRecv[NQ], SendDisp[NQ], RecvDisp[NQ];    // in units of real numbers
+
+   for (int q=0; q<NQ; q++)
+   {
+      const long NBlock_MeX = (long)nz*( Sy[Me+1] - Sy[Me] )*( Skx[q +1] - Skx[q ] );   // x-pencil on this rank
+      const long NBlock_MeY = (long)nz*( Sy[q +1] - Sy[q ] )*( Skx[Me+1] - Skx[Me] );   // y-pencil on this rank
+
+      NSend[q] = 2*(int)( (Forward) ? NBlock_MeX : NBlock_MeY );
+      NRecv[q] = 2*(int)( (Forward) ? NBlock_MeY : NBlock_MeX );
+   }
+
+   SendDisp[0] = 0;
+   RecvDisp[0] = 0;
+   for (int q=1; q<NQ; q++)
+   {
+      SendDisp[q] = SendDisp[q-1] + NSend[q-1];
+      RecvDisp[q] = RecvDisp[q-1] + NRecv[q-1];
+   }
+
+
+// 1. pack
+#  pragma omp parallel
+   for (int q=0; q<NQ; q++)
+   {
+      REAL_FFTW(complex) *Block = Out + SendDisp[q]/2;
+
+      if ( Forward )
+      {
+//       x-pencil on this rank --> y-pencil on rank q
+         const int ny_A = Sy [Me+1] - Sy [Me];
+         const int nkxB = Skx[q +1] - Skx[q ];
+
+#        pragma omp for collapse( 2 ) schedule( static ) nowait
+         for (int k=0; k<nz;   k++)
+         for (int j=0; j<ny_A; j++)
+            memcpy( Block + ( (long)k*ny_A + j )*nkxB, In + ( (long)k*ny_A + j )*NXc + Skx[q],
+                    nkxB*sizeof(REAL_FFTW(complex)) );
+      }
+
+      else
+      {
+//       y-pencil on this rank --> x-pencil on rank q
+         const int ny_A = Sy [q +1] - Sy [q ];
+         const int nkxB = Skx[Me+1] - Skx[Me];
+
+#        pragma omp for collapse( 2 ) schedule( static ) nowait
+         for (int k=0; k<nz;   k++)
+         for (int j=0; j<ny_A; j++)
+         for (int i=0; i<nkxB; i++)
+         {
+            const long t = ( (long)k*ny_A + j )*nkxB + i;
+            const long s = ( (long)k*nkxB + i )*Ny + Sy[q] + j;
+
+            Block[t][0] = In[s][0];
+            Block[t][1] = In[s][1];
+         }
+      }
+   } // for (int q=0; q<NQ; q++)
+
+
+// 2. exchange
+#  ifdef FLOAT8
+   MPI_Alltoallv( (real*)Out, NSend, SendDisp, MPI_DOUBLE, (real*)In, NRecv, RecvDisp, MPI_DOUBLE, Pencil->Comm_Y );
+#  else
+   MPI_Alltoallv( (real*)Out, NSend, SendDisp, MPI_FLOAT,  (real*)In, NRecv, RecvDisp, MPI_FLOAT,  Pencil->Comm_Y );
+#  endif
+
+
+// 3. unpack
+#  pragma omp parallel
+   for (int q=0; q<NQ; q++)
+   {
+      const REAL_FFTW(complex) *Block = In + RecvDisp[q]/2;
+
+      if ( Forward )
+      {
+//       x-pencil on rank q --> y-pencil on this rank
+         const int ny_A = Sy [q +1] - Sy [q ];
+         const int nkxB = Skx[Me+1] - Skx[Me];
+
+#        pragma omp for collapse( 2 ) schedule( static ) nowait
+         for (int k=0; k<nz;   k++)
+         for (int j=0; j<ny_A; j++)
+         for (int i=0; i<nkxB; i++)
+         {
+            const long t = ( (long)k*ny_A + j )*nkxB + i;
+            const long s = ( (long)k*nkxB + i )*Ny + Sy[q] + j;
+
+            Out[s][0] = Block[t][0];
+            Out[s][1] = Block[t][1];
+         }
+      }
+
+      else
+      {
+//       y-pencil on rank q --> x-pencil on this rank
+         const int ny_A = Sy [Me+1] - Sy [Me];
+         const int nkxB = Skx[q +1] - Skx[q ];
+
+#        pragma omp for collapse( 2 ) schedule( static ) nowait
+         for (int k=0; k<nz;   k++)
+         for (int j=0; j<ny_A; j++)
+            memcpy( Out + ( (long)k*ny_A + j )*NXc + Skx[q], Block + ( (long)k*ny_A + j )*nkxB,
+                    nkxB*sizeof(REAL_FFTW(complex)) );
+      }
+   } // for (int q=0; q<NQ; q++)
+
+} // FUNCTION : FFT_Pencil_TransposeXY
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Pencil_TransposeYZ
+// Description :  Transpose between the y-pencil and z-pencil layouts among the ranks with the same RankY
+//
+// Note        :  1. The block exchanged between the y-pencil on rank "A" and the z-pencil on rank "B" has the
+//                   dimension [nz of A][nkx][nky of B] with ky varying fastest
+//                2. See FFT_Pencil_TransposeXY() for the use of "In" and "Out"
+//
+// Parameter   :  Pencil  : Target FFTPencil_t object
+//                In      : Input array
+//                Out     : Output array
+//                Forward : true/false --> y-pencil to z-pencil/z-pencil to y-pencil
+//-------------------------------------------------------------------------------------------------------
+void FFT_Pencil_TransposeYZ( FFTPencil_t *Pencil, REAL_FFTW(complex) *In, REAL_FFTW(complex) *Out, const bool Forward )
+{
+
+   const int  NQ     = Pencil->NSplit[1];
+   const int  Me     = Pencil->RankZ;
+   const int  Ny     = Pencil->N[1];
+   const int  Nz     = Pencil->N[2];
+   const int  nkx    = Pencil->nkx;
+   const int *Sz     = Pencil->Split_z;
+   const int *Sky    = Pencil->Split_ky;
+
+   int NSend[NQ], NRecv[NQ], SendDisp[NQ], RecvDisp[NQ];    // in units of real numbers
+
+   for (int q=0; q<NQ; q++)
+   {
+      const long NBlock_MeY = (long)( Sz[Me+1] - Sz[Me] )*nkx*( Sky[q +1] - Sky[q ] );  // y-pencil on this rank
+      const long NBlock_MeZ = (long)( Sz[q +1] - Sz[q ] )*nkx*( Sky[Me+1] - Sky[Me] );  // z-pencil on this rank
+
+      NSend[q] = 2*(int)( (Forward) ? NBlock_MeY : NBlock_MeZ );
+      NRecv[q] = 2*(int)( (Forward) ? NBlock_MeZ : NBlock_MeY );
+   }
+
+   SendDisp[0] = 0;
+   RecvDisp[0] = 0;
+   for (int q=1; q<NQ; q++)
+   {
+      SendDisp[q] = SendDisp[q-1] + NSend[q-1];
+      RecvDisp[q] = RecvDisp[q-1] + NRecv[q-1];
+   }
+
+
+// 1. pack
+#  pragma omp parallel
+   for (int q=0; q<NQ; q++)
+   {
+      REAL_FFTW(complex) *Block = Out + SendDisp[q]/2;
+
+      if ( Forward )
+      {
+//       y-pencil on this rank --> z-pencil on rank q
+         const int nz_A = Sz [Me+1] - Sz [Me];
+         const int nkyB = Sky[q +1] - Sky[q ];
+
+#        pragma omp for collapse( 2 ) schedule( static ) nowait
+         for (int k=0; k<nz_A; k++)
+         for (int i=0; i<nkx;  i++)
+            memcpy( Block + ( (long)k*nkx + i )*nkyB, In + ( (long)k*nkx + i )*Ny + Sky[q],
+                    nkyB*sizeof(REAL_FFTW(complex)) );
+      }
+
+      else
+      {
+//       z-pencil on this rank --> y-pencil on rank q
+         const int nz_A = Sz [q +1] - Sz [q ];
+         const int nkyB = Sky[Me+1] - Sky[Me];
+
+#        pragma omp for collapse( 2 ) schedule( static ) nowait
+         for (int j=0; j<nkyB; j++)
+         for (int i=0; i<nkx;  i++)
+         for (int k=0; k<nz_A; k++)
+         {
+            const long t = ( (long)k*nkx + i )*nkyB + j;
+            const long s = ( (long)j*nkx + i )*Nz + Sz[q] + k;
+
+            Block[t][0] = In[s][0];
+            Block[t][1] = In[s][1];
+         }
+      }
+   } // for (int q=0; q<NQ; q++)
+
+
+// 2. exchange
+#  ifdef FLOAT8
+   MPI_Alltoallv( (real*)Out, NSend, SendDisp, MPI_DOUBLE, (real*)In, NRecv, RecvDisp, MPI_DOUBLE, Pencil->Comm_Z );
+#  else
+   MPI_Alltoallv( (real*)Out, NSend, SendDisp, MPI_FLOAT,  (real*)In, NRecv, RecvDisp, MPI_FLOAT,  Pencil->Comm_Z );
+#  endif
+
+
+// 3. unpack
+#  pragma omp parallel
+   for (int q=0; q<NQ; q++)
+   {
+      const REAL_FFTW(complex) *Block = In + RecvDisp[q]/2;
+
+      if ( Forward )
+      {
+//       y-pencil on rank q --> z-pencil on this rank
+         const int nz_A = Sz [q +1] - Sz [q ];
+         const int nkyB = Sky[Me+1] - Sky[Me];
+
+#        pragma omp for collapse( 2 ) schedule( static ) nowait
+         for (int j=0; j<nkyB; j++)
+         for (int i=0; i<nkx;  i++)
+         for (int k=0; k<nz_A; k++)
+         {
+            const long t = ( (long)k*nkx + i )*nkyB + j;
+            const long s = ( (long)j*nkx + i )*Nz + Sz[q] + k;
+
+            Out[s][0] = Block[t][0];
+            Out[s][1] = Block[t][1];
+         }
+      }
+
+      else
+      {
+//       z-pencil on rank q --> y-pencil on this rank
+         const int nz_A = Sz [Me+1] - Sz [Me];
+         const int nkyB = Sky[q +1] - Sky[q ];
+
+#        pragma omp for collapse( 2 ) schedule( static ) nowait
+         for (int k=0; k<nz_A; k++)
+         for (int i=0; i<nkx;  i++)
+            memcpy( Out + ( (long)k*nkx + i )*Ny + Sky[q], Block + ( (long)k*nkx + i )*nkyB,
+                    nkyB*sizeof(REAL_FFTW(complex)) );
+      }
+   } // for (int q=0; q<NQ; q++)
+
+} // FUNCTION : FFT_Pencil_TransposeYZ
+
+
+
+#endif // #if ( defined GRAVITY  &&  SUPPORT_FFTW == FFTW3 )
@@ -4,15 +4,24 @@
 
 
 
+#if   ( SUPPORT_FFTW == FFTW2 )
 static void FFT_Periodic( real *RhoK, const real Poi_Coeff, const int j_start, const int dj, const int RhoK_Size );
 static void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const int RhoK_Size );
-static int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Guess );
+#elif ( SUPPORT_FFTW == FFTW3 )
+static void FFT_Periodic( FFTPencil_t *Pencil, const real Poi_Coeff );
+static void FFT_Isolated( FFTPencil_t *Pencil, const real *gFuncK, const real Poi_Coeff );
+#endif
+static int Index2Rank( const int Index, const int *List_start, const int NList, const int TRank_Guess );
 
+#if   ( SUPPORT_FFTW == FFTW2 )
 #ifdef SERIAL
 extern rfftwnd_plan     FFTW_Plan, FFTW_Plan_Inv;
 #else
 extern rfftwnd_mpi_plan FFTW_Plan, FFTW_Plan_Inv;
 #endif
+#elif ( SUPPORT_FFTW == FFTW3 )
+extern FFTPencil_t     *FFTW_Pencil;
+#endif
 
 extern real (*Poi_AddExtraMassForGravity_Ptr)( const double x, const double y, const double z, const double Time,
                                                const int lv, double AuxArray[] );
@@ -20,9 +29,23 @@ extern real (*Poi_AddExtraMassForGravity_Ptr)( const double x, const double y, c
 
 
 
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Patch2Slab
-// Description :  Patch-based data --> slab domain decomposition (for density)
+// Description :  Patch-based data --> slab/pencil domain decomposition (for density)
+//
+// Note        :  1. The FFT domain is divided into NSplit_y x (MPI_NRank/NSplit_y) blocks along y and z, where
+//                   the block [List_y_start[ry] ... List_y_start[ry+1]-1] x [List_z_start[rz] ... List_z_start[rz+1]-1]
+//                   belongs to rank "rz*NSplit_y + ry"
+//                   --> Slab decomposition of FFTW 2 : NSplit_y = 1 and List_y_start[] = { 0, FFT_Size[1] }
+//                       Pencil decomposition         : see FFTPencil_t
+//                   --> Each block stores all x cells with a row size of "SSize_x"
+//                   --> Each patch slice of PS1*PS1 cells must belong to a single rank
+//                2. Density is prepared in batches of POT_GPU_NPGROUP patch groups by Prepare_PatchData() and
+//                   copied to the send buffer by OpenMP threads
+//                   --> The send buffer position of each patch slice is determined in advance
+//                3. List_PID[] and List_k[] are allocated here and freed by Slab2Patch()
 //
 // Parameter   :  RhoK           : In-place FFT array
 //                SendBuf_Rho    : Sending MPI buffer of density
@@ -33,59 +56,104 @@ extern real (*Poi_AddExtraMassForGravity_Ptr)( const double x, const double y, c
 //                List_k         : Local z coordinate of each patch slice sent to each rank
 //                List_NSend_Rho : Size of density data sent to each rank
 //                List_NRecv_Rho : Size of density data received from each rank
-//                List_z_start   : Starting z coordinate of each rank in the FFTW slab decomposition
-//                local_nz       : Slab thickness of this MPI rank
-//                FFT_Size       : Size of the FFT operation including the zero-padding regions
-//                NRecvSlice     : Total number of z slices received from other ranks (could be zero in the isolated BC)
+//                NSplit_y       : Number of blocks along y
+//                List_y_start   : Starting y coordinate of the blocks along y
+//                List_z_start   : Starting z coordinate of the blocks along z
+//                SSize_x        : Row size of RhoK along x (including the padding cells)
+//                NRecvCell      : Total number of cells received from all ranks (could be zero in the isolated BC)
 //                PrepTime       : Physical time for preparing the density field
 //-------------------------------------------------------------------------------------------------------
 void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf_SIdx, long *RecvBuf_SIdx,
                  int **List_PID, int **List_k, int *List_NSend_Rho, int *List_NRecv_Rho,
-                 const int *List_z_start, const int local_nz, const int FFT_Size[], const int NRecvSlice,
-                 const double PrepTime )
+                 const int NSplit_y, const int *List_y_start, const int *List_z_start, const int SSize_x,
+                 const long NRecvCell, const double PrepTime )
 {
 
 // check
 #  ifdef GAMER_DEBUG
-   if ( List_z_start[MPI_Rank+1] - List_z_start[MPI_Rank] != local_nz )
-      Aux_Error( ERROR_INFO, "local_nz (%d) != expectation (%d) !!\n",
-                 local_nz, List_z_start[MPI_Rank+1] - List_z_start[MPI_Rank] );
-#  endif // GAMER_DEBUG
-
-
-   const int SSize[2]   = { 2*(FFT_Size[0]/2+1), FFT_Size[1] };   // padded slab size in the x and y directions
-   const int PSSize     = PS1*PS1;                                // patch slice size
-// const int MemUnit    = amr->NPatchComma[0][1]*PS1/MPI_NRank;   // set arbitrarily
-   const int MemUnit    = amr->NPatchComma[0][1]*PS1;             // set arbitrarily
-   const int AveNz      = FFT_Size[2]/MPI_NRank + ( (FFT_Size[2]%MPI_NRank == 0 ) ? 0 : 1 );    // average slab thickness
-   const int Scale0     = amr->scale[0];
-
-   int   Cr[3];                        // corner coordinates of each patch normalized to the base-level grid size
-   int   BPos_z;                       // z coordinate of each patch slice in the simulation box
-   int   SPos_z;                       // z coordinate of each patch slice in the slab
-   long  SIdx;                         // 1D coordinate of each patch slice in the slab
+   if ( MPI_NRank % NSplit_y != 0 )
+      Aux_Error( ERROR_INFO, "MPI_NRank (%d) %% NSplit_y (%d) != 0 !!\n", MPI_NRank, NSplit_y );
+#  endif
+
+
+   const int  NSplit_z   = MPI_NRank / NSplit_y;
+   const int  PSSize     = PS1*PS1;                                // patch slice size
+   const int  NPatch     = amr->NPatchComma[0][1];
+   const long NSlice     = (long)NPatch*PS1;                       // number of patch slices on this rank
+   const int  Scale0     = amr->scale[0];
+
    int   List_NSend_SIdx[MPI_NRank];   // number of patch slices sent to each rank
    int   List_NRecv_SIdx[MPI_NRank];   // number of patch slices received from each rank
-   long *TempBuf_SIdx   [MPI_NRank];   // 1D slab coordinate of each patch slice sent to each rank
-   real *TempBuf_Rho    [MPI_NRank];   // density of each patch slice sent to each rank
-   real *TempBuf_Rho_Ptr = NULL;
+   int   Send_Disp_SIdx [MPI_NRank];
+   int   Recv_Disp_SIdx [MPI_NRank];
+   int   Send_Disp_Rho  [MPI_NRank];
+   int   Recv_Disp_Rho  [MPI_NRank];
+   int  *Slice_Rank = new int  [NSlice];  // target rank of each patch slice
+   long *Slice_SIdx = new long [NSlice];  // 1D coordinate of each patch slice in the slab of the target rank
+   long *Slice_Pos  = new long [NSlice];  // position of each patch slice in the send buffer
+
+
+// 1. get the target rank and slab coordinate of each patch slice
+   const int AveNy = MAX( List_y_start[NSplit_y]/NSplit_y, 1 );    // average block size
+   const int AveNz = MAX( List_z_start[NSplit_z]/NSplit_z, 1 );
+
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<NPatch; PID++)
+   {
+      int Cr[3];                       // corner coordinates of each patch normalized to the base-level grid size
+
+      for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][0][PID]->corner[d] / Scale0;
+
+      const int Rank_y = Index2Rank( Cr[1], List_y_start, NSplit_y, MIN(Cr[1]/AveNy, NSplit_y-1) );
+      const int SPos_y = Cr[1] - List_y_start[Rank_y];
+      const int SNy    = List_y_start[Rank_y+1] - List_y_start[Rank_y];
+
+#     ifdef GAMER_DEBUG
+      if ( SPos_y + PS1 > SNy )
+         Aux_Error( ERROR_INFO, "patch slice across the slab boundary (PID %d, y %d, SNy %d) !!\n", PID, Cr[1], SNy );
+#     endif
+
+      for (int k=0; k<PS1; k++)
+      {
+         const int  BPos_z = Cr[2] + k;   // z coordinate of each patch slice in the simulation box
+         const int  Rank_z = Index2Rank( BPos_z, List_z_start, NSplit_z, MIN(BPos_z/AveNz, NSplit_z-1) );
+         const int  SPos_z = BPos_z - List_z_start[Rank_z];
+         const long t      = (long)PID*PS1 + k;
+
+         Slice_Rank[t] = Rank_z*NSplit_y + Rank_y;
+         Slice_SIdx[t] = ( (long)SPos_z*SNy + SPos_y )*SSize_x + Cr[0];
+      }
+   }
+
 
-   int TRank, TRank_Guess, MemSize[MPI_NRank], idx;
+// 2. set the send lists and the send buffer of SIdx
+   for (int r=0; r<MPI_NRank; r++)  List_NSend_SIdx[r] = 0;
 
+   for (long t=0; t<NSlice; t++)    List_NSend_SIdx[ Slice_Rank[t] ] ++;
+
+   Send_Disp_SIdx[0] = 0;
+   for (int r=1; r<MPI_NRank; r++)  Send_Disp_SIdx[r] = Send_Disp_SIdx[r-1] + List_NSend_SIdx[r-1];
 
-// 1. set memory allocation unit
    for (int r=0; r<MPI_NRank; r++)
    {
-      MemSize        [r] = MemUnit;
-      List_PID       [r] = (int* )malloc( MemSize[r]*sizeof(int)         );
-      List_k         [r] = (int* )malloc( MemSize[r]*sizeof(int)         );
-      TempBuf_SIdx   [r] = (long*)malloc( MemSize[r]*sizeof(long)        );
-      TempBuf_Rho    [r] = (real*)malloc( MemSize[r]*sizeof(real)*PSSize );
+      List_PID       [r] = (int*)malloc( MAX( List_NSend_SIdx[r], 1 )*sizeof(int) );
+      List_k         [r] = (int*)malloc( MAX( List_NSend_SIdx[r], 1 )*sizeof(int) );
       List_NSend_SIdx[r] = 0;
    }
 
+   for (long t=0; t<NSlice; t++)
+   {
+      const int TRank = Slice_Rank[t];
+      const int Slot  = List_NSend_SIdx[TRank] ++;
+
+      List_PID[TRank][Slot] = t / PS1;
+      List_k  [TRank][Slot] = t % PS1;
+      Slice_Pos   [t]       = Send_Disp_SIdx[TRank] + Slot;
+      SendBuf_SIdx[ Slice_Pos[t] ] = Slice_SIdx[t];
+   }
+
 
-// 2. prepare the temporary send buffer and record lists
+// 3. prepare the send buffer of density
    const OptPotBC_t  PotBC_None        = BC_POT_NONE;
    const IntScheme_t IntScheme         = INT_NONE;
    const NSide_t     NSide_None        = NSIDE_00;
@@ -94,30 +162,38 @@ void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf
    const real        MinDens_No        = -1.0;
    const real        MinPres_No        = -1.0;
    const int         GhostSize         = 0;
-   const int         NPG               = 1;
+   const int         NPG_Max           = POT_GPU_NPGROUP;
 
-   real (*Dens)[PS1][PS1][PS1] = new real [8*NPG][PS1][PS1][PS1];
+   real (*Dens)[PS1][PS1][PS1] = new real [8*NPG_Max][PS1][PS1][PS1];
+   int   *PID0_List            = new int  [NPG_Max];
 
-   for (int PID0=0; PID0<amr->NPatchComma[0][1]; PID0+=8)
+   for (int PID0_Start=0; PID0_Start<NPatch; PID0_Start+=8*NPG_Max)
    {
+      const int NPG = MIN( NPG_Max, (NPatch-PID0_Start)/8 );
+
+      for (int t=0; t<NPG; t++)  PID0_List[t] = PID0_Start + 8*t;
+
 //    even with NSIDE_00 and GhostSize=0, we still need OPT__BC_FLU to determine whether periodic BC is adopted
 //    for depositing particle mass onto grids.
 //    also note that we do not check minimum density here since no ghost zones are required
-      Prepare_PatchData( 0, PrepTime, Dens[0][0][0], NULL, GhostSize, NPG, &PID0, _TOTAL_DENS, _NONE,
+      Prepare_PatchData( 0, PrepTime, Dens[0][0][0], NULL, GhostSize, NPG, PID0_List, _TOTAL_DENS, _NONE,
                          IntScheme, INT_NONE, UNIT_PATCH, NSide_None, IntPhase_No, OPT__BC_FLU, PotBC_None,
                          MinDens_No, MinPres_No, DE_Consistency_No );
 
 
 //    add extra mass source for gravity if required
+//    --> invoke Poi_AddExtraMassForGravity_Ptr() serially since user-specified functions are not required to be
+//        thread-safe (see Poi_AddExtraMassForGravity())
       if ( OPT__GRAVITY_EXTRA_MASS )
       {
          const double dh = amr->dh[0];
 
-         for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
+         for (int LocalID=0; LocalID<8*NPG; LocalID++)
          {
-            const double x0 = amr->patch[0][0][PID]->EdgeL[0] + 0.5*dh;
-            const double y0 = amr->patch[0][0][PID]->EdgeL[1] + 0.5*dh;
-            const double z0 = amr->patch[0][0][PID]->EdgeL[2] + 0.5*dh;
+            const int    PID = PID0_Start + LocalID;
+            const double x0  = amr->patch[0][0][PID]->EdgeL[0] + 0.5*dh;
+            const double y0  = amr->patch[0][0][PID]->EdgeL[1] + 0.5*dh;
+            const double z0  = amr->patch[0][0][PID]->EdgeL[2] + 0.5*dh;
 
             double x, y, z;
 
@@ -130,70 +206,38 @@ void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf
       }
 
 
-//    copy data to the send buffer
-      for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
+#     pragma omp parallel for schedule( static )
+      for (int LocalID=0; LocalID<8*NPG; LocalID++)
       {
-         for (int d=0; d<3; d++)    Cr[d] = amr->patch[0][0][PID]->corner[d] / Scale0;
+         const int PID = PID0_Start + LocalID;
 
+//       copy data to the send buffer
          for (int k=0; k<PS1; k++)
          {
-            BPos_z      = Cr[2] + k;
-            TRank_Guess = BPos_z / AveNz;
-            TRank       = ZIndex2Rank( BPos_z, List_z_start, TRank_Guess );
-            SPos_z      = BPos_z - List_z_start[TRank];
-            SIdx        = ( (long)SPos_z*SSize[1] + Cr[1] )*SSize[0] + Cr[0];
-
-#           ifdef GAMER_DEBUG
-            if ( SPos_z < 0  ||  SPos_z >= List_z_start[TRank+1] - List_z_start[TRank] )
-               Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "SPos_z", SPos_z );
-#           endif
-
-//          allocate enough memory
-            if ( List_NSend_SIdx[TRank] >= MemSize[TRank] )
-            {
-               MemSize     [TRank] += MemUnit;
-               List_PID    [TRank]  = (int* )realloc( List_PID    [TRank], MemSize[TRank]*sizeof(int)         );
-               List_k      [TRank]  = (int* )realloc( List_k      [TRank], MemSize[TRank]*sizeof(int)         );
-               TempBuf_SIdx[TRank]  = (long*)realloc( TempBuf_SIdx[TRank], MemSize[TRank]*sizeof(long)        );
-               TempBuf_Rho [TRank]  = (real*)realloc( TempBuf_Rho [TRank], MemSize[TRank]*sizeof(real)*PSSize );
-            }
+            real *SendPtr_Rho = SendBuf_Rho + Slice_Pos[ (long)PID*PS1 + k ]*PSSize;
 
-//          record list
-            List_PID    [TRank][ List_NSend_SIdx[TRank] ] = PID;
-            List_k      [TRank][ List_NSend_SIdx[TRank] ] = k;
-            TempBuf_SIdx[TRank][ List_NSend_SIdx[TRank] ] = SIdx;
-
-//          store density
-            TempBuf_Rho_Ptr = TempBuf_Rho[TRank] + List_NSend_SIdx[TRank]*PSSize;
-
-            idx = 0;
-            for (int j=0; j<PS1; j++)
-            for (int i=0; i<PS1; i++)
-               TempBuf_Rho_Ptr[ idx ++ ] = Dens[LocalID][k][j][i];
+            memcpy( SendPtr_Rho, Dens[LocalID][k][0], PSSize*sizeof(real) );
 
 //          subtract the background density (which is assumed to be UNITY) for the isolated BC in the comoving frame
 //          --> to be consistent with the comoving-frame Poisson eq.
 #           ifdef COMOVING
             if ( OPT__BC_POT == BC_POT_ISOLATED )
             {
-               for (int t=0; t<PSSize; t++)  TempBuf_Rho_Ptr[t] -= (real)1.0;
+               for (int t=0; t<PSSize; t++)  SendPtr_Rho[t] -= (real)1.0;
             }
 #           endif
-
-            List_NSend_SIdx[TRank] ++;
-         } // for (int k=0; k<PS1; k++)
-      } // for (int PID=PID0, LocalID=0; PID<PID0+8; PID++, LocalID++)
-   } // for (int PID0=0; PID0<amr->NPatchComma[0][1]; PID0+=8)
+         }
+      } // for (int LocalID=0; LocalID<8*NPG; LocalID++)
+   } // for (int PID0_Start=0; PID0_Start<NPatch; PID0_Start+=8*NPG_Max)
 
    delete [] Dens;
+   delete [] PID0_List;
+   delete [] Slice_Rank;
+   delete [] Slice_SIdx;
+   delete [] Slice_Pos;
 
 
-// 3. prepare the send buffer
-   int   Send_Disp_Rho[MPI_NRank], Recv_Disp_Rho[MPI_NRank], Send_Disp_SIdx[MPI_NRank], Recv_Disp_SIdx[MPI_NRank];
-   long *SendPtr_SIdx = NULL;
-   real *SendPtr_Rho  = NULL;
-
-// 3.1 broadcast the number of elements sending to different ranks
+// 4. broadcast the number of elements sending to different ranks and calculate the displacement
    MPI_Alltoall( List_NSend_SIdx, 1, MPI_INT, List_NRecv_SIdx, 1, MPI_INT, MPI_COMM_WORLD );
 
    for (int r=0; r<MPI_NRank; r++)
@@ -202,14 +246,11 @@ void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf
       List_NRecv_Rho[r] = List_NRecv_SIdx[r]*PSSize;
    }
 
-// 3.2 calculate the displacement
-   Send_Disp_SIdx[0] = 0;
    Recv_Disp_SIdx[0] = 0;
    Send_Disp_Rho [0] = 0;
    Recv_Disp_Rho [0] = 0;
    for (int r=1; r<MPI_NRank; r++)
    {
-      Send_Disp_SIdx[r] = Send_Disp_SIdx[r-1] + List_NSend_SIdx[r-1];
       Recv_Disp_SIdx[r] = Recv_Disp_SIdx[r-1] + List_NRecv_SIdx[r-1];
       Send_Disp_Rho [r] = Send_Disp_Rho [r-1] + List_NSend_Rho [r-1];
       Recv_Disp_Rho [r] = Recv_Disp_Rho [r-1] + List_NRecv_Rho [r-1];
@@ -217,36 +258,20 @@ void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf
 
 // check
 #  ifdef GAMER_DEBUG
-   const int NSend_Total  = Send_Disp_Rho[MPI_NRank-1] + List_NSend_Rho[MPI_NRank-1];
-   const int NRecv_Total  = Recv_Disp_Rho[MPI_NRank-1] + List_NRecv_Rho[MPI_NRank-1];
-   const int NSend_Expect = amr->NPatchComma[0][1]*CUBE(PS1);
-   const int NRecv_Expect = NX0_TOT[0]*NX0_TOT[1]*NRecvSlice;
+   const long NSend_Total  = (long)Send_Disp_Rho[MPI_NRank-1] + List_NSend_Rho[MPI_NRank-1];
+   const long NRecv_Total  = (long)Recv_Disp_Rho[MPI_NRank-1] + List_NRecv_Rho[MPI_NRank-1];
+   const long NSend_Expect = (long)amr->NPatchComma[0][1]*CUBE(PS1);
+   const long NRecv_Expect = NRecvCell;
 
-   if ( NSend_Total != NSend_Expect )  Aux_Error( ERROR_INFO, "NSend_Total = %d != expected value = %d !!\n",
+   if ( NSend_Total != NSend_Expect )  Aux_Error( ERROR_INFO, "NSend_Total = %ld != expected value = %ld !!\n",
                                                   NSend_Total, NSend_Expect );
 
-   if ( NRecv_Total != NRecv_Expect )  Aux_Error( ERROR_INFO, "NRecv_Total = %d != expected value = %d !!\n",
+   if ( NRecv_Total != NRecv_Expect )  Aux_Error( ERROR_INFO, "NRecv_Total = %ld != expected value = %ld !!\n",
                                                   NRecv_Total, NRecv_Expect );
 #  endif
 
-// 3.3 prepare the send buffer of SIdx
-   SendPtr_SIdx = SendBuf_SIdx;
-   for (int r=0; r<MPI_NRank; r++)
-   {
-      memcpy( SendPtr_SIdx, TempBuf_SIdx[r], List_NSend_SIdx[r]*sizeof(long) );
-      SendPtr_SIdx += List_NSend_SIdx[r];
-   }
 
-// 3.4 prepare the send buffer of density
-   SendPtr_Rho = SendBuf_Rho;
-   for (int r=0; r<MPI_NRank; r++)
-   {
-      memcpy( SendPtr_Rho, TempBuf_Rho[r], List_NSend_Rho[r]*sizeof(real) );
-      SendPtr_Rho += List_NSend_Rho[r];
-   }
-
-
-// 4. exchange data by MPI
+// 5. exchange data by MPI
    MPI_Alltoallv( SendBuf_SIdx, List_NSend_SIdx, Send_Disp_SIdx, MPI_LONG,
                   RecvBuf_SIdx, List_NRecv_SIdx, Recv_Disp_SIdx, MPI_LONG,   MPI_COMM_WORLD );
 
@@ -259,30 +284,17 @@ void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf
 #  endif
 
 
-// 5. store the received density to the padded array "RhoK" for FFTW
-   const long NPSlice = (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/PSSize;  // total number of received patch slices
-   long  dSIdx, Counter = 0;
-   real *RhoK_Ptr = NULL;
+// 6. store the received density to the padded array "RhoK" for FFTW
+   const long NPSlice = NRecvCell/PSSize;    // total number of received patch slices
 
+#  pragma omp parallel for schedule( static )
    for (long t=0; t<NPSlice; t++)
    {
-      SIdx     = RecvBuf_SIdx[t];
-      RhoK_Ptr = RhoK + SIdx;
+      const real *RecvPtr  = RecvBuf_Rho + t*PSSize;
+            real *RhoK_Ptr = RhoK + RecvBuf_SIdx[t];
 
       for (int j=0; j<PS1; j++)
-      for (int i=0; i<PS1; i++)
-      {
-         dSIdx           = j*SSize[0] + i;
-         RhoK_Ptr[dSIdx] = RecvBuf_Rho[ Counter ++ ];
-      }
-   }
-
-
-// free memory
-   for (int r=0; r<MPI_NRank; r++)
-   {
-      free( TempBuf_SIdx[r] );
-      free( TempBuf_Rho [r] );
+         memcpy( RhoK_Ptr + j*SSize_x, RecvPtr + j*PS1, PS1*sizeof(real) );
    }
 
 } // FUNCTION : Patch2Slab
@@ -290,32 +302,27 @@ void Patch2Slab( real *RhoK, real *SendBuf_Rho, real *RecvBuf_Rho, long *SendBuf
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  ZIndex2Rank
-// Description :  Return the MPI rank which the input z coordinates belongs to in the FFTW slab decomposition
+// Function    :  Index2Rank
+// Description :  Return the index of the slab/pencil block which the input coordinate belongs to
 //
-// Note        :  1. "List_z_start[r] <= IndexZ < List_z_start[r+1]" belongs to rank r
-//                2. List_z_start[MPI_NRank] can be set to any value >= FFT_Size[2]
+// Note        :  1. "List_start[r] <= Index < List_start[r+1]" belongs to block r
 //
-// Parameter   :  IndexZ       : Input z coordinate
-//                List_z_start : Starting z coordinate of each rank in the FFTW slab decomposition
-//                TRank_Guess  : First guess of the targeting MPI rank
+// Parameter   :  Index       : Input coordinate
+//                List_start  : Starting coordinate of each block
+//                NList       : Number of blocks
+//                TRank_Guess : First guess of the target block
 //
-// Return      :  MPI rank
+// Return      :  Block index
 //-------------------------------------------------------------------------------------------------------
-int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Guess )
+int Index2Rank( const int Index, const int *List_start, const int NList, const int TRank_Guess )
 {
 
 // check
 #  ifdef GAMER_DEBUG
-   const int FFT_SizeZ = ( OPT__BC_POT == BC_POT_ISOLATED ) ? 2*NX0_TOT[2] : NX0_TOT[2];
-
-   if ( IndexZ < 0  ||  IndexZ >= NX0_TOT[2] )
-      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "IndexZ", IndexZ );
-
-   if ( List_z_start[MPI_NRank] < FFT_SizeZ )
-      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "List_z_start[MPI_NRank]", List_z_start[MPI_NRank] );
+   if ( Index < List_start[0]  ||  Index >= List_start[NList] )
+      Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "Index", Index );
 
-   if ( TRank_Guess < 0  ||  TRank_Guess >= MPI_NRank )
+   if ( TRank_Guess < 0  ||  TRank_Guess >= NList )
       Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TRank_Guess", TRank_Guess );
 #  endif
 
@@ -325,24 +332,27 @@ int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Gues
    while ( true )
    {
 #     ifdef GAMER_DEBUG
-      if ( TRank < 0  ||  TRank >= MPI_NRank )  Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TRank", TRank );
+      if ( TRank < 0  ||  TRank >= NList )   Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TRank", TRank );
 #     endif
 
-      if ( IndexZ < List_z_start[TRank] )    TRank --;
+      if ( Index < List_start[TRank] )    TRank --;
       else
       {
-         if ( IndexZ < List_z_start[TRank+1] )  return TRank;
-         else                                   TRank ++;
+         if ( Index < List_start[TRank+1] )  return TRank;
+         else                                TRank ++;
       }
    }
 
-} // FUNCTION : ZIndex2Rank
+} // FUNCTION : Index2Rank
 
 
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Slab2Patch
-// Description :  Slab domain decomposition --> patch-based data (for potential)
+// Description :  Slab/pencil domain decomposition --> patch-based data (for potential)
+//
+// Note        :  1. Send and receive lists are set by Patch2Slab()
+//                2. Packing and storing data are OpenMP-parallelized
 //
 // Parameter   :  RhoK       : In-place FFT array
 //                SendBuf    : Sending MPI buffer of potential
@@ -353,38 +363,15 @@ int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Gues
 //                List_k     : Local z coordinate of each patch slice sent to each rank
 //                List_NSend : Size of potential data sent to each rank
 //                List_NRecv : Size of potential data received from each rank
-//                local_nz   : Slab thickness of this MPI rank
-//                FFT_Size   : Size of the FFT operation including the zero-padding regions
-//                NSendSlice : Total number of z slices need to be sent to other ranks (could be zero in the isolated BC)
+//                SSize_x    : Row size of RhoK along x (including the padding cells)
 //-------------------------------------------------------------------------------------------------------
 void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveSg, const long *List_SIdx,
-                 int **List_PID, int **List_k, int *List_NSend, int *List_NRecv, const int local_nz, const int FFT_Size[],
-                 const int NSendSlice )
+                 int **List_PID, int **List_k, int *List_NSend, int *List_NRecv, const int SSize_x )
 {
 
-// 1. store the evaluated potential to the send buffer
-   const int   SSize[2]   = { 2*(FFT_Size[0]/2+1), FFT_Size[1] };             // padded slab size in the x and y directions
-   const int   PSSize     = PS1*PS1;                                          // patch slice size
-   const long  NPSlice    = (long)NX0_TOT[0]*NX0_TOT[1]*NSendSlice/PSSize;    // total number of patch slices to be sent
-   const real *RhoK_Ptr   = NULL;
-
-   long SIdx, dSIdx, Counter = 0;
-
-   for (long t=0; t<NPSlice; t++)
-   {
-      SIdx     = List_SIdx[t];
-      RhoK_Ptr = RhoK + SIdx;
-
-      for (int j=0; j<PS1; j++)
-      for (int i=0; i<PS1; i++)
-      {
-         dSIdx                 = j*SSize[0] + i;
-         SendBuf[ Counter ++ ] = RhoK_Ptr[dSIdx];
-      }
-   }
-
+// 1. calculate the displacement
+   const int PSSize = PS1*PS1;   // patch slice size
 
-// 2. calculate the displacement and exchange data by MPI
    int Send_Disp[MPI_NRank], Recv_Disp[MPI_NRank];
 
    Send_Disp[0] = 0;
@@ -395,6 +382,22 @@ void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveS
       Recv_Disp[r] = Recv_Disp[r-1] + List_NRecv[r-1];
    }
 
+
+// 2. store the evaluated potential to the send buffer
+   const long NPSlice = ( (long)Send_Disp[MPI_NRank-1] + List_NSend[MPI_NRank-1] )/PSSize;  // total number of patch slices to be sent
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<NPSlice; t++)
+   {
+      const real *RhoK_Ptr = RhoK + List_SIdx[t];
+            real *SendPtr  = SendBuf + t*PSSize;
+
+      for (int j=0; j<PS1; j++)
+         memcpy( SendPtr + j*PS1, RhoK_Ptr + j*SSize_x, PS1*sizeof(real) );
+   }
+
+
+// 3. exchange data by MPI
 #  ifdef FLOAT8
    MPI_Alltoallv( SendBuf, List_NSend, Send_Disp, MPI_DOUBLE,
                   RecvBuf, List_NRecv, Recv_Disp, MPI_DOUBLE, MPI_COMM_WORLD );
@@ -404,22 +407,20 @@ void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveS
 #  endif
 
 
-// 3. store the received potential data to different patch objects
-   int   PID, k, NRecvSlice;
-   real *RecvPtr = RecvBuf;
-
+// 4. store the received potential data to different patch objects
+#  pragma omp parallel
    for (int r=0; r<MPI_NRank; r++)
    {
-      NRecvSlice = List_NRecv[r]/PSSize;
+      const int   NRecvSlice = List_NRecv[r]/PSSize;
+      const real *RecvPtr    = RecvBuf + Recv_Disp[r];
 
+#     pragma omp for schedule( static ) nowait
       for (int t=0; t<NRecvSlice; t++)
       {
-         PID = List_PID[r][t];
-         k   = List_k  [r][t];
+         const int PID = List_PID[r][t];
+         const int k   = List_k  [r][t];
 
-         memcpy( amr->patch[SaveSg][0][PID]->pot[k], RecvPtr, PSSize*sizeof(real) );
-
-         RecvPtr += PSSize;
+         Mis_CopyArray( amr->patch[SaveSg][0][PID]->pot[k][0], RecvPtr + (long)t*PSSize, PSSize );
       }
    }
 
@@ -435,6 +436,7 @@ void Slab2Patch( const real *RhoK, real *SendBuf, real *RecvBuf, const int SaveS
 
 
 
+#if   ( SUPPORT_FFTW == FFTW2 )
 //-------------------------------------------------------------------------------------------------------
 // Function    :  FFT_Periodic
 // Description :  Evaluate the gravitational potential by FFT for the periodic BC
@@ -608,11 +610,167 @@ void FFT_Isolated( real *RhoK, const real *gFuncK, const real Poi_Coeff, const i
 
 
 
+#elif ( SUPPORT_FFTW == FFTW3 )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Periodic
+// Description :  Evaluate the gravitational potential by FFT for the periodic BC (FFTW 3 pencil version)
+//
+// Note        :  1. Effect from the homogenerous background density (DC) will be ignored by setting the k=0 mode
+//                   equal to zero
+//                2. Input density and output potential are stored in Pencil->Real in the x-pencil layout,
+//                   and the k-space data are in Pencil->Cplx in the z-pencil layout (see FFTPencil.h)
+//
+// Parameter   :  Pencil    : FFTPencil_t object storing the input density and output potential
+//                Poi_Coeff : Coefficient in front of density in the Poisson equation (4*Pi*Newton_G*a)
+//-------------------------------------------------------------------------------------------------------
+void FFT_Periodic( FFTPencil_t *Pencil, const real Poi_Coeff )
+{
+
+   const int  Nx       = Pencil->N[0];
+   const int  Ny       = Pencil->N[1];
+   const int  Nz       = Pencil->N[2];
+   const int  nkx      = Pencil->nkx;
+   const int  nky      = Pencil->nky;
+   const int  i_start  = Pencil->Split_kx[ Pencil->RankY ];
+   const int  j_start  = Pencil->Split_ky[ Pencil->RankZ ];
+   const real dh       = amr->dh[0];
+   REAL_FFTW(complex) *cdata = Pencil->Cplx;
+
+
+// forward FFT
+   FFT_Pencil_Forward( Pencil );
+
+
+// set up the dimensionless wave number and the corresponding sin(k)^2 function
+   real *sinkx2 = new real [nkx];
+   real *sinky2 = new real [nky];
+   real *sinkz2 = new real [Nz ];
+   real  kx, ky, kz;
+
+   for (int ii=0; ii<nkx; ii++) {   const int i = i_start + ii;
+                                    kx          = 2.0*M_PI/Nx*i;
+                                    sinkx2[ii]  = SQR(  SIN( (real)0.5*kx )  );    }
+   for (int jj=0; jj<nky; jj++) {   const int j = j_start + jj;
+                                    ky          = ( j <= Ny/2 ) ? 2.0*M_PI/Ny*j : 2.0*M_PI/Ny*(j-Ny);
+                                    sinky2[jj]  = SQR(  SIN( (real)0.5*ky )  );    }
+   for (int k=0; k<Nz; k++)     {   kz          = ( k <= Nz/2 ) ? 2.0*M_PI/Nz*k : 2.0*M_PI/Nz*(k-Nz);
+                                    sinkz2[k]   = SQR(  SIN( (real)0.5*kz )  );    }
+
+
+// divide the Rho_K by -k^2
+#  pragma omp parallel for collapse( 2 ) schedule( static )
+   for (int jj=0; jj<nky; jj++)
+   for (int ii=0; ii<nkx; ii++)
+   {
+      const long ID0 = ( (long)jj*nkx + ii )*Nz;
+
+      for (int k=0; k<Nz; k++)
+      {
+         const long ID = ID0 + k;
+
+//       this form is more consistent with the "second-order discrete" Laplacian operator
+         const real Deno = -4.0 * ( sinkx2[ii] + sinky2[jj] + sinkz2[k] );
+
+//       remove the DC mode
+         if ( Deno == 0.0 )
+         {
+            cdata[ID][0] = 0.0;
+            cdata[ID][1] = 0.0;
+         }
+
+         else
+         {
+            cdata[ID][0] = cdata[ID][0] * Poi_Coeff / Deno;
+            cdata[ID][1] = cdata[ID][1] * Poi_Coeff / Deno;
+         }
+      }
+   } // jj,ii
+
+   delete [] sinkx2;
+   delete [] sinky2;
+   delete [] sinkz2;
+
+
+// backward FFT
+   FFT_Pencil_Backward( Pencil );
+
+
+// normalization
+   const real norm      = dh*dh / ( (real)Nx*Ny*Nz );
+   const long RhoK_Size = (long)Nx*Pencil->ny*Pencil->nz;
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<RhoK_Size; t++)    Pencil->Real[t] *= norm;
+
+} // FUNCTION : FFT_Periodic
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFT_Isolated
+// Description :  Evaluate the gravitational potential by FFT for the isolated BC (FFTW 3 pencil version)
+//
+// Note        :  1. Green's function in the k space has been set by Init_GreenFuncK() in the z-pencil layout
+//                2. 4*PI*NEWTON_G and FFT normalization coefficient has been included in gFuncK
+//                   --> The only coefficient that hasn't been taken into account is the scale factor in the comoving frame
+//
+// Parameter   :  Pencil    : FFTPencil_t object storing the input density and output potential
+//                gFuncK    : Green's function in the k space
+//                Poi_Coeff : Coefficient in front of density in the Poisson equation (4*Pi*Newton_G*a)
+//-------------------------------------------------------------------------------------------------------
+void FFT_Isolated( FFTPencil_t *Pencil, const real *gFuncK, const real Poi_Coeff )
+{
+
+   REAL_FFTW(complex)       *RhoK_cplx   = Pencil->Cplx;
+   const REAL_FFTW(complex) *gFuncK_cplx = (const REAL_FFTW(complex) *)gFuncK;
+
+
+// forward FFT
+   FFT_Pencil_Forward( Pencil );
+
+
+// multiply density and Green's function in the k space
+   const long RhoK_Size_cplx = (long)Pencil->nkx*Pencil->nky*Pencil->N[2];
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<RhoK_Size_cplx; t++)
+   {
+      const real Re = RhoK_cplx[t][0];
+      const real Im = RhoK_cplx[t][1];
+
+      RhoK_cplx[t][0] = Re*gFuncK_cplx[t][0] - Im*gFuncK_cplx[t][1];
+      RhoK_cplx[t][1] = Re*gFuncK_cplx[t][1] + Im*gFuncK_cplx[t][0];
+   }
+
+
+// backward FFT
+   FFT_Pencil_Backward( Pencil );
+
+
+// effect of "4*PI*NEWTON_G" has been included in gFuncK, but the scale factor in the comoving frame hasn't
+#  ifdef COMOVING
+   const real Coeff     = Poi_Coeff / ( 4.0*M_PI*NEWTON_G );   // == Time[0] == scale factor at the base level
+   const long RhoK_Size = (long)Pencil->N[0]*Pencil->ny*Pencil->nz;
+
+#  pragma omp parallel for schedule( static )
+   for (long t=0; t<RhoK_Size; t++)    Pencil->Real[t] *= Coeff;
+#  endif
+
+} // FUNCTION : FFT_Isolated
+
+
+
+#endif // SUPPORT_FFTW
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  CPU_PoissonSolver_FFT
 // Description :  Evaluate the base-level potential by FFT
 //
-// Note        :  Work with both periodic and isolated BC's
+// Note        :  1. Work with both periodic and isolated BC's
+//                2. SUPPORT_FFTW == FFTW2 : slab decomposition of rfftwnd_mpi in FFTW 2
+//                   SUPPORT_FFTW == FFTW3 : 2D pencil decomposition with OpenMP-threaded FFTW 3 (see FFTPencil.h)
 //
 // Parameter   :  Poi_Coeff : Coefficient in front of the RHS in the Poisson eq.
 //                SaveSg    : Sandglass to store the updated data
@@ -628,6 +786,7 @@ void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double
       for (int d=0; d<3; d++)    FFT_Size[d] *= 2;
 
 
+#  if   ( SUPPORT_FFTW == FFTW2 )
 // get the array indices using by FFTW
    int local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose, total_local_size;
 
@@ -657,14 +816,52 @@ void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double
                  MPI_NRank, List_z_start[MPI_NRank], FFT_Size[2] );
 
 
-// allocate memory (properly taking into account the zero-padding regions, where no data need to be exchanged)
-   const int NRecvSlice = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
+// the slab decomposition is a special case of Patch2Slab() with only one block along y
+   const int  NSplit_y        = 1;
+   const int  List_y_start[2] = { 0, FFT_Size[1] };
+   const int  SSize_x         = 2*(FFT_Size[0]/2+1);
+
+// number of cells received (properly taking into account the zero-padding regions, where no data need to be exchanged)
+   const int  NRecvSlice      = MIN( List_z_start[MPI_Rank]+local_nz, NX0_TOT[2] ) - MIN( List_z_start[MPI_Rank], NX0_TOT[2] );
+   const long NRecvCell       = (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice;
+
+   real *RhoK = new real [ total_local_size ];     // array storing both density and potential
+
+
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   FFTPencil_t *Pencil = FFTW_Pencil;
+
+#  ifdef GAMER_DEBUG
+   for (int d=0; d<3; d++)
+      if ( Pencil->N[d] != FFT_Size[d] )
+         Aux_Error( ERROR_INFO, "Pencil->N[%d] (%d) != FFT_Size[%d] (%d) !!\n", d, Pencil->N[d], d, FFT_Size[d] );
+#  endif
+
+   const int  NSplit_y      = Pencil->NSplit[0];
+   const int *List_y_start  = Pencil->Split_y;
+   const int *List_z_start  = Pencil->Split_z;
+   const int  SSize_x       = FFT_Size[0];
+   const long RhoK_Size     = (long)SSize_x*Pencil->ny*Pencil->nz;
 
-   real *RhoK         = new real [ total_local_size ];                           // array storing both density and potential
+// number of cells received (properly taking into account the zero-padding regions, where no data need to be exchanged)
+   const int  y_start       = List_y_start[ Pencil->RankY ];
+   const int  z_start       = List_z_start[ Pencil->RankZ ];
+   const int  NRecv_y       = MIN( y_start+Pencil->ny, NX0_TOT[1] ) - MIN( y_start, NX0_TOT[1] );
+   const int  NRecv_z       = MIN( z_start+Pencil->nz, NX0_TOT[2] ) - MIN( z_start, NX0_TOT[2] );
+   const long NRecvCell     = (long)NX0_TOT[0]*NRecv_y*NRecv_z;
+
+   real *RhoK = Pencil->Real;    // array storing both density and potential
+
+#  else
+#  error : ERROR : unsupported SUPPORT_FFTW !!
+#  endif // SUPPORT_FFTW
+
+
+// allocate memory
    real *SendBuf      = new real [ (long)amr->NPatchComma[0][1]*CUBE(PS1) ];     // MPI send buffer for density and potential
-   real *RecvBuf      = new real [ (long)NX0_TOT[0]*NX0_TOT[1]*NRecvSlice ];     // MPI recv buffer for density and potentia
-   long *SendBuf_SIdx = new long [ amr->NPatchComma[0][1]*PS1 ];                 // MPI send buffer for 1D coordinate in slab
-   long *RecvBuf_SIdx = new long [ NX0_TOT[0]*NX0_TOT[1]*NRecvSlice/SQR(PS1) ];  // MPI recv buffer for 1D coordinate in slab
+   real *RecvBuf      = new real [ NRecvCell ];                                  // MPI recv buffer for density and potential
+   long *SendBuf_SIdx = new long [ (long)amr->NPatchComma[0][1]*PS1 ];           // MPI send buffer for 1D coordinate in slab
+   long *RecvBuf_SIdx = new long [ NRecvCell/SQR(PS1) ];                         // MPI recv buffer for 1D coordinate in slab
 
    int  *List_PID    [MPI_NRank];   // PID of each patch slice sent to each rank
    int  *List_k      [MPI_NRank];   // local z coordinate of each patch slice sent to each rank
@@ -674,31 +871,48 @@ void CPU_PoissonSolver_FFT( const real Poi_Coeff, const int SaveSg, const double
 
 // initialize RhoK as zeros for the isolated BC where the zero-padding method is adopted
    if ( OPT__BC_POT == BC_POT_ISOLATED )
+   {
+#     if   ( SUPPORT_FFTW == FFTW2 )
       for (int t=0; t<total_local_size; t++)    RhoK[t] = (real)0.0;
+#     elif ( SUPPORT_FFTW == FFTW3 )
+#     pragma omp parallel for schedule( static )
+      for (long t=0; t<RhoK_Size; t++)          RhoK[t] = (real)0.0;
+#     endif
+   }
 
 
 // rearrange data from patch to slab
-   Patch2Slab( RhoK, SendBuf, RecvBuf, SendBuf_SIdx, RecvBuf_SIdx, List_PID, List_k, List_NSend, List_NRecv, List_z_start,
-               local_nz, FFT_Size, NRecvSlice, PrepTime );
+   Patch2Slab( RhoK, SendBuf, RecvBuf, SendBuf_SIdx, RecvBuf_SIdx, List_PID, List_k, List_NSend, List_NRecv,
+               NSplit_y, List_y_start, List_z_start, SSize_x, NRecvCell, PrepTime );
 
 
 // evaluate potential by FFT
+#  if   ( SUPPORT_FFTW == FFTW2 )
    if      ( OPT__BC_POT == BC_POT_PERIODIC )
       FFT_Periodic( RhoK, Poi_Coeff, local_y_start_after_transpose, local_ny_after_transpose, total_local_size );
 
    else if ( OPT__BC_POT == BC_POT_ISOLATED )
       FFT_Isolated( RhoK, GreenFuncK, Poi_Coeff, total_local_size );
 
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   if      ( OPT__BC_POT == BC_POT_PERIODIC )
+      FFT_Periodic( Pencil, Poi_Coeff );
+
+   else if ( OPT__BC_POT == BC_POT_ISOLATED )
+      FFT_Isolated( Pencil, GreenFuncK, Poi_Coeff );
+#  endif
+
    else
       Aux_Error( ERROR_INFO, "unsupported paramter %s = %d !!\n", "OPT__BC_POT", OPT__BC_POT );
 
 
 // rearrange data from slab back to patch
-   Slab2Patch( RhoK, RecvBuf, SendBuf, SaveSg, RecvBuf_SIdx, List_PID, List_k, List_NRecv, List_NSend,
-               local_nz, FFT_Size, NRecvSlice );
+   Slab2Patch( RhoK, RecvBuf, SendBuf, SaveSg, RecvBuf_SIdx, List_PID, List_k, List_NRecv, List_NSend, SSize_x );
 
 
+#  if ( SUPPORT_FFTW == FFTW2 )
    delete [] RhoK;
+#  endif
    delete [] SendBuf;
    delete [] RecvBuf;
    delete [] SendBuf_SIdx;
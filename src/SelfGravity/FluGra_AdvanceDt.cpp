@@ -0,0 +1,93 @@
+#include "GAMER.h"
+
+#if ( defined GRAVITY  &&  !defined GPU  &&  defined OPENMP )
+
+extern void (*Flu_ResetByUser_API_Ptr)( const int lv, const int FluSg, const double TTime );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FluGra_AdvanceDt
+// Description :  Advance the fluid solver followed by the Poisson and gravity solvers at lv>0 in one task graph
+//
+// Note        :  1. Invoked by EvolveLevel() for OPT__TASK_GRAPH in place of Flu_AdvanceDt() + Gra_AdvanceDt()
+//                   --> Invoke InvokeSolver_TaskGraph()
+//                   --> The Poisson and gravity solvers on a chunk of patch groups start as soon as the fluid solver
+//                       has updated the chunk and all chunks containing its sibling patch groups, instead of
+//                       waiting for the fluid solver on the entire level
+//                2. Only applicable if no operation is required between the fluid and gravity solvers, which
+//                   requires that
+//                   --> lv > 0 (the root-level Poisson solver is the FFT solver)
+//                   --> AUTO_REDUCE_DT is off (the fluid solver on the entire level must succeed first)
+//                   --> SERIAL (the density in the buffer patches need not be exchanged)
+//                   --> PARTICLE is off (particles are updated and deposited between the two solvers)
+//                   --> MHD is off (see TaskGraph_Supported())
+//                   --> OPT__FLU_CLUSTER is off
+//                   --> OPT__GRAVITY_EXTRA_MASS is off (see TaskGraph_Supported())
+//                   --> These are checked by EvolveLevel()
+//                3. FluSg and MagSg at lv are set to SaveSg_Flu and SaveSg_Mag in advance so that the Poisson and
+//                   gravity solvers read the updated fluid data at TimeNew while the fluid solver still reads the
+//                   input data at TimeOld
+//                   --> Prepare_PatchData() finds the sandglass by its physical time
+//                   --> PotSg is NOT updated here (see Gra_AdvanceDt())
+//
+// Parameter   :  lv         : Target refinement level
+//                TimeNew    : Target physical time to reach
+//                TimeOld    : Physical time before update
+//                dt         : Time interval to advance solution (can be different from TimeNew-TimeOld if COMOVING is on)
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//                SaveSg_Mag : Sandglass to store the updated B field
+//                SaveSg_Pot : Sandglass to store the updated potential data
+//                Poisson    : true --> invoke the Poisson solver to evaluate the gravitational potential
+//-------------------------------------------------------------------------------------------------------
+void FluGra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                       const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot, const bool Poisson )
+{
+
+// check
+   if ( lv == 0 )
+      Aux_Error( ERROR_INFO, "%s does not support the root level !!\n", __FUNCTION__ );
+
+   if ( AUTO_REDUCE_DT )
+      Aux_Error( ERROR_INFO, "%s does not support AUTO_REDUCE_DT !!\n", __FUNCTION__ );
+
+
+// coefficient in front of the RHS in the Poisson eq.
+#  ifdef COMOVING
+   const double Poi_Coeff = 4.0*M_PI*NEWTON_G*TimeNew;   // use TimeNew for calculating potential
+#  else
+   const double Poi_Coeff = 4.0*M_PI*NEWTON_G;
+#  endif
+
+
+// set the sandglass of the updated fluid data
+   amr->FluSg    [lv]             = SaveSg_Flu;
+   amr->FluSgTime[lv][SaveSg_Flu] = TimeNew;
+#  ifdef MHD
+   amr->MagSg    [lv]             = SaveSg_Mag;
+   amr->MagSgTime[lv][SaveSg_Mag] = TimeNew;
+#  endif
+
+
+// invoke the fluid solver and then the Poisson and gravity solvers
+   InvokeSolver_TaskGraph( FLUID_SOLVER, (Poisson) ? POISSON_AND_GRAVITY_SOLVER : GRAVITY_SOLVER,
+                           lv, TimeNew, TimeOld, dt, Poi_Coeff, SaveSg_Flu, SaveSg_Mag, (Poisson) ? SaveSg_Pot : NULL_INT );
+
+
+// reset the fluxes and electric field in the buffer patches at lv as zeros (see Flu_AdvanceDt())
+   if ( OPT__FIXUP_FLUX )  Buf_ResetBufferFlux( lv );
+
+
+// call Flu_ResetByUser_API_Ptr() here only if GRACKLE is disabled (see Gra_AdvanceDt())
+#  ifdef SUPPORT_GRACKLE
+   if ( !GRACKLE_ACTIVATE )
+#  endif
+   if ( OPT__RESET_FLUID  &&  Flu_ResetByUser_API_Ptr != NULL )
+      Flu_ResetByUser_API_Ptr( lv, SaveSg_Flu, TimeNew );
+
+} // FUNCTION : FluGra_AdvanceDt
+
+
+
+#endif // #if ( defined GRAVITY  &&  !defined GPU  &&  defined OPENMP )
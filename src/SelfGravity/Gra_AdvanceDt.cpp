@@ -25,6 +25,9 @@ extern void (*Flu_ResetByUser_API_Ptr)( const int lv, const int FluSg, const dou
 //                   (they will be updated in EvolveLevel instead)
 //                   --> It is because the lv-0 Poisson and Gravity solvers are invoked separately, and Gravity solver
 //                       needs to call Prepare_PatchData to get the updated potential
+//                5. For OverlapMPI, this function is invoked twice (first Overlap_Sync=true and then false)
+//                   --> Particles are collected before advancing the Sync patches and freed after advancing the
+//                       Async patches so that no MPI call is made while overlapping with Buf_GetBufferData()
 //
 // Parameter   :  lv             : Target refinement level
 //                TimeNew        : Target physical time to reach
@@ -84,7 +87,7 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
    const bool SibBufPatch       = NULL_BOOL;
    const bool FaSibBufPatch     = NULL_BOOL;
 #  endif
-   if ( Poisson )
+   if (  Poisson  &&  ( !OverlapMPI || Overlap_Sync )  )
    {
       TIMING_FUNC(   Prepare_PatchData_InitParticleDensityArray( lv ),
                      Timer_Par_Collect[lv]   );
@@ -168,7 +171,7 @@ void Gra_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, co
 
 // free memory for collecting particles from other ranks and levels, and free density arrays with ghost zones (rho_ext)
 #  ifdef PARTICLE
-   if ( Poisson )
+   if (  Poisson  &&  ( !OverlapMPI || !Overlap_Sync )  )
    {
 //    don't use the TIMING_FUNC macro since we don't want to call MPI_Barrier here even when OPT__TIMING_BARRIER is on
 //    --> otherwise OPT__TIMING_BALANCE will fail because all ranks are synchronized before and after Gra_AdvanceDt
@@ -13,6 +13,7 @@
 // Note        :  1. Use SaveSg to determine where to store the data
 //                   --> Currently it's set to the same Sg as the fluid data when calling
 //                       Gra_AdvanceDt() in EvolveLevel()
+//                2. Also update the maximum CFL speed of the updated patches for OPT__DT_CFL_CACHE
 //
 // Parameter   :  lv              : Target refinement level
 //                SaveSg          : Sandglass to store the updated data
@@ -88,6 +89,9 @@ void Gra_Close( const int lv, const int SaveSg, const real h_Flu_Array_G[][GRA_N
          } // i,j,k
 #        endif // #ifdef DUAL_ENERGY
 
+//       update the maximum CFL speed cached by Flu_Close() since the momentum and energy have been modified
+         if ( OPT__DT_CFL_CACHE )   dt_CFLCache_Update( lv, SaveSg, PID );
+
 #        elif ( MODEL == ELBDM )
 //       density field is NOT sent in and out in the ELBDM gravity solver
          for (int v=0; v<GRA_NIN; v++)
@@ -4,11 +4,15 @@
 
 
 
+#if   ( SUPPORT_FFTW == FFTW2 )
 #ifdef SERIAL
 rfftwnd_plan     FFTW_Plan, FFTW_Plan_Inv, FFTW_Plan_PS;    // PS : plan for calculating the power spectrum
 #else
 rfftwnd_mpi_plan FFTW_Plan, FFTW_Plan_Inv, FFTW_Plan_PS;
 #endif
+#elif ( SUPPORT_FFTW == FFTW3 )
+FFTPencil_t     *FFTW_Pencil, *FFTW_Pencil_PS;              // PS : pencil FFT for calculating the power spectrum
+#endif
 
 
 
@@ -16,6 +20,8 @@ rfftwnd_mpi_plan FFTW_Plan, FFTW_Plan_Inv, FFTW_Plan_PS;
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_FFTW
 // Description :  Create the FFTW plans 
+//
+// Note        :  SUPPORT_FFTW == FFTW3 : create the FFTPencil_t objects with the OpenMP-threaded FFTW 3 plans
 //-------------------------------------------------------------------------------------------------------
 void Init_FFTW()
 {
@@ -38,6 +44,7 @@ void Init_FFTW()
    }
 
 
+#  if   ( SUPPORT_FFTW == FFTW2 )
 // create plans for the self-gravity solver
 #  ifdef SERIAL
    FFTW_Plan     = rfftw3d_create_plan( FFT_Size[2], FFT_Size[1], FFT_Size[0], FFTW_REAL_TO_COMPLEX, 
@@ -72,6 +79,24 @@ void Init_FFTW()
       FFTW_Plan_PS = FFTW_Plan;
 
 
+#  elif ( SUPPORT_FFTW == FFTW3 )
+// initialize the multi-threaded FFTW
+#  ifdef OPENMP
+   if ( REAL_FFTW(init_threads)() == 0 )  Aux_Error( ERROR_INFO, "FFTW init_threads() failed !!\n" );
+#  endif
+
+// create the pencil FFT for the self-gravity solver
+   FFTW_Pencil = FFT_Pencil_Create( FFT_Size );
+
+// create the pencil FFT for calculating the power spectrum
+   if ( OPT__BC_POT == BC_POT_ISOLATED )
+      FFTW_Pencil_PS = FFT_Pencil_Create( NX0_TOT );
+
+   else
+      FFTW_Pencil_PS = FFTW_Pencil;
+#  endif // SUPPORT_FFTW
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" ); 
 
 } // FUNCTION : Init_FFTW
@@ -87,6 +112,7 @@ void End_FFTW()
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... ", __FUNCTION__ );
 
+#  if   ( SUPPORT_FFTW == FFTW2 )
 #  ifdef SERIAL
    if ( FFTW_Plan_PS != FFTW_Plan ) 
    rfftwnd_destroy_plan    ( FFTW_Plan_PS  );
@@ -101,6 +127,17 @@ void End_FFTW()
    rfftwnd_mpi_destroy_plan( FFTW_Plan_Inv );
 #  endif
 
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   if ( FFTW_Pencil_PS != FFTW_Pencil )
+   FFT_Pencil_Destroy( FFTW_Pencil_PS );
+
+   FFT_Pencil_Destroy( FFTW_Pencil    );
+
+#  ifdef OPENMP
+   REAL_FFTW(cleanup_threads)();
+#  endif
+#  endif // SUPPORT_FFTW
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 } // FUNCTION : End_FFTW
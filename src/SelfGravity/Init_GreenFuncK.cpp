@@ -2,11 +2,15 @@
 
 #ifdef GRAVITY
 
+#if   ( SUPPORT_FFTW == FFTW2 )
 #ifdef SERIAL
 extern rfftwnd_plan     FFTW_Plan;
 #else
 extern rfftwnd_mpi_plan FFTW_Plan;
 #endif
+#elif ( SUPPORT_FFTW == FFTW3 )
+extern FFTPencil_t     *FFTW_Pencil;
+#endif
 
 
 
@@ -17,7 +21,9 @@ extern rfftwnd_mpi_plan FFTW_Plan;
 //
 // Note        :  1. We only need to calculate it once during the initialization stage
 //                2. The zero-padding method is implemented
-//                3. Slab decomposition is assumed in FFTW
+//                3. Slab decomposition is assumed in FFTW 2
+//                   --> For SUPPORT_FFTW == FFTW3, the Green's function is computed in the x-pencil layout of
+//                       FFTW_Pencil and stored in the z-pencil layout (see FFTPencil.h)
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -34,11 +40,15 @@ void Init_GreenFuncK()
 
 // 1. get the array indices used by FFTW
    const int FFT_Size[3] = { 2*NX0_TOT[0], 2*NX0_TOT[1], 2*NX0_TOT[2] };
-   int local_nx, local_ny, local_nz, local_z_start, local_ny_after_transpose, local_y_start_after_transpose, total_local_size;
+   int local_nx, local_ny, local_nz, local_y_start, local_z_start, total_local_size;
+
+#  if   ( SUPPORT_FFTW == FFTW2 )
+   int local_ny_after_transpose, local_y_start_after_transpose;
 
 // note: total_local_size is NOT necessary to be equal to local_nx*local_ny*local_nz
-   local_nx = 2*( FFT_Size[0]/2 + 1 );
-   local_ny = FFT_Size[1];
+   local_nx      = 2*( FFT_Size[0]/2 + 1 );
+   local_ny      = FFT_Size[1];
+   local_y_start = 0;
 
 #  ifdef SERIAL
    local_nz                      = FFT_Size[2];
@@ -52,41 +62,66 @@ void Init_GreenFuncK()
 
 #  endif
 
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   FFTPencil_t *Pencil = FFTW_Pencil;
+
+   local_nx         = FFT_Size[0];
+   local_ny         = Pencil->ny;
+   local_nz         = Pencil->nz;
+   local_y_start    = Pencil->Split_y[ Pencil->RankY ];
+   local_z_start    = Pencil->Split_z[ Pencil->RankZ ];
+   total_local_size = 2*Pencil->nkx*Pencil->nky*Pencil->N[2];
+#  endif // SUPPORT_FFTW
+
 
 // 2. calculate the Green's function in the real space
    const double dh0   = amr->dh[0];
    const double Coeff = -NEWTON_G*CUBE(dh0)/( (double)FFT_Size[0]*FFT_Size[1]*FFT_Size[2] );
    double x, y, z, r;
-   int    kk;
+   int    jj, kk;
    long   idx;
 
    GreenFuncK = new real [ total_local_size ];
 
+#  if   ( SUPPORT_FFTW == FFTW2 )
+   real *GreenFuncX = GreenFuncK;      // Green's function in the real space
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   real *GreenFuncX = Pencil->Real;
+#  endif
+
    for (int k=0; k<local_nz; k++)   {  kk = k + local_z_start;
                                        z  = ( kk <= NX0_TOT[2] ) ? kk*dh0 : (FFT_Size[2]-kk)*dh0;
-   for (int j=0; j<local_ny; j++)   {  y  = ( j  <= NX0_TOT[1] ) ? j *dh0 : (FFT_Size[1]-j )*dh0;
+   for (int j=0; j<local_ny; j++)   {  jj = j + local_y_start;
+                                       y  = ( jj <= NX0_TOT[1] ) ? jj*dh0 : (FFT_Size[1]-jj)*dh0;
    for (int i=0; i<local_nx; i++)   {  x  = ( i  <= NX0_TOT[0] ) ? i *dh0 : (FFT_Size[0]-i )*dh0;
 
       r   = sqrt( x*x + y*y + z*z );
       idx = ( (long)k*local_ny + j )*local_nx + i;
 
-      GreenFuncK[idx] = real( Coeff / r );
+      GreenFuncX[idx] = real( Coeff / r );
 
    }}}
 
 
 // 3. reset the Green's function at the origin
 // ***by setting it equal to zero, we ignore the contribution from the mass within the same cell***
-   if ( MPI_Rank == 0 )    GreenFuncK[0] = GFUNC_COEFF0*Coeff/dh0;
+   if ( MPI_Rank == 0 )    GreenFuncX[0] = GFUNC_COEFF0*Coeff/dh0;
 
 
 // 4. convert the Green's function to the k space
+#  if   ( SUPPORT_FFTW == FFTW2 )
 #  ifdef SERIAL
    rfftwnd_one_real_to_complex( FFTW_Plan, GreenFuncK, NULL );
 #  else
    rfftwnd_mpi( FFTW_Plan, 1, GreenFuncK, NULL, FFTW_TRANSPOSED_ORDER );
 #  endif
 
+#  elif ( SUPPORT_FFTW == FFTW3 )
+   FFT_Pencil_Forward( Pencil );
+
+   memcpy( GreenFuncK, Pencil->Cplx, total_local_size*sizeof(real) );
+#  endif
+
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
 
@@ -26,6 +26,8 @@ real (*Poi_AddExtraMassForGravity_Ptr)( const double x, const double y, const do
 //                   --> It will NOT be stored in the output data
 //                   --> It WILL be included when computing the average density in Poi_GetAverageDensity(),
 //                       which will then be used as DC in the periodic Poisson solver
+//                3. Always invoked by a single thread, so it does NOT need to be thread-safe
+//                   --> OPT__TASK_GRAPH is disabled for the Poisson solver when OPT__GRAVITY_EXTRA_MASS is on
 //
 // Parameter   :  x/y/z    : Target physical coordinates
 //                Time     : Target physical time
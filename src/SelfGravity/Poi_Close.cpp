@@ -42,7 +42,7 @@ void Poi_Close( const int lv, const int SaveSg, const real h_Pot_Array_P_Out[][G
          }}}
 
 #        ifdef STORE_POT_GHOST
-         memcpy( amr->patch[SaveSg][lv][PID]->pot_ext, h_Pot_Array_P_Out[N], CUBE(GRA_NXT)*sizeof(real) );
+         Mis_CopyArray( amr->patch[SaveSg][lv][PID]->pot_ext[0][0], h_Pot_Array_P_Out[N][0][0], CUBE(GRA_NXT) );
 #        endif
       }
    } // for (int TID=0; TID<NPG; TID++)
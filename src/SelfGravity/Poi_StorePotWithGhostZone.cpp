@@ -57,7 +57,7 @@ void Poi_StorePotWithGhostZone( const int lv, const int PotSg, const bool AllPat
                                OPT__BC_FLU, OPT__BC_POT, MinDens_No, MinPres_No, DE_Consistency_No );
 
             for (int PID=PID0, P=0; PID<PID0+8; PID++, P++)
-               memcpy( amr->patch[PotSg][lv][PID]->pot_ext, Pot+P*PotSizeCube, PotSizeCube*sizeof(real) );
+               Mis_CopyArray( amr->patch[PotSg][lv][PID]->pot_ext[0][0], Pot+P*PotSizeCube, PotSizeCube );
          }
       }
 
@@ -239,8 +239,9 @@ void OutputError()
    const double coeff_NFW      = -4.0*M_PI*NEWTON_G*SQR(Gra_Radius0)*Gra_Dens0;
    const double coeff_Her      = -2.0*M_PI*NEWTON_G*SQR(Gra_Radius0)*Gra_Dens0;
 
-   real  (*fluid)[PS1][PS1][PS1], nume, anal, abserr, relerr;
-   double dh, x, y, z, x0, y0, z0, r, s;
+   real_fld (*fluid)[PS1][PS1][PS1];
+   real     nume, anal, abserr, relerr;
+   double   dh, x, y, z, x0, y0, z0, r, s;
 
 
 // 1. calculate errors and overwrite gas field